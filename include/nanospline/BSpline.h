@@ -1,21 +1,26 @@
 #pragma once
 
+#include <algorithm>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 
 #include <Eigen/Core>
 
 #include <nanospline/BSplineBase.h>
+#include <nanospline/BasisMatrix.h>
 #include <nanospline/Bezier.h>
 #include <nanospline/Exceptions.h>
+#include <nanospline/internal/closest_point.h>
+#include <nanospline/internal/unrolled_de_boor.h>
 
 namespace nanospline {
 
 template <typename _Scalar, int _dim = 3, int _degree = 3, bool _generic = (_degree < 0)>
-class BSpline : public BSplineBase<_Scalar, _dim, _degree, _generic>
+class BSpline final : public BSplineBase<_Scalar, _dim, _degree, _generic>
 {
 public:
-    using ThisType = BSpline<_Scalar, _dim, _degree, false>;
+    using ThisType = BSpline<_Scalar, _dim, _degree, _generic>;
     using Base = BSplineBase<_Scalar, _dim, _degree, _generic>;
     using Scalar = typename Base::Scalar;
     using Point = typename Base::Point;
@@ -24,6 +29,9 @@ public:
     // Note that BlossomVector has the same length as KnotVector; typedef is
     // just for clarity
     using BlossomVector = typename Base::KnotVector;
+    using ParameterVector = typename Base::ParameterVector;
+    using PointMatrix = typename Base::PointMatrix;
+    using DerivativeMatrix = typename Base::DerivativeMatrix;
 
 public:
     BSpline() = default;
@@ -50,8 +58,9 @@ public:
     }
 
 public:
+    template <typename Derived>
     void get_knot_span_control_points(
-        int curve_degree, int knot_span, ControlPoints& control_pts) const
+        int curve_degree, int knot_span, Eigen::MatrixBase<Derived>& control_pts) const
     {
         int span_index = knot_span - curve_degree;
         for (int i_control_point = 0; i_control_point <= curve_degree; ++i_control_point) {
@@ -66,24 +75,112 @@ public:
     Point evaluate(Scalar t) const override
     {
         Base::validate_curve();
-        const int p = Base::get_degree();
         const int k = Base::locate_span(t);
+        assert(Base::get_degree() >= 0);
+        assert(Base::m_knots.rows() ==
+               Base::m_control_points.rows() + Base::get_degree() + 1);
+
+        return evaluate_in_span(t, k, 0);
+    }
+
+    Point evaluate(Scalar t, EvaluationWorkspace<Scalar>& workspace) const override
+    {
+        Base::validate_curve();
+        const int p = Base::get_degree();
+        const int k = Base::locate_span(t, workspace.get_span_hint());
+        workspace.set_span_hint(k);
         assert(p >= 0);
         assert(Base::m_knots.rows() == Base::m_control_points.rows() + p + 1);
 
-        ControlPoints ctrl_pts(p + 1, _dim);
-        get_knot_span_control_points(p, k, ctrl_pts);
-
-        return deBoor(t, p, k, ctrl_pts);
+        if (UnrolledKernel::value || Base::use_power_basis(k)) {
+            // Fixed size scratch, no workspace needed.
+            return evaluate_in_span(t, k, 0);
+        }
+        auto ctrl_pts = workspace.template get_matrix<_dim>(0, p + 1);
+        return evaluate_in_span(t, k, 0, ctrl_pts);
     }
 
+    using Base::inverse_evaluate;
+
+    /**
+     * Exact closest point search.  Knot spans whose control points are
+     * farther from p than the best point found so far are skipped; the
+     * others are converted to Bézier form and solved with
+     * internal::bezier_closest_point.
+     */
     Scalar inverse_evaluate(const Point& p) const override
     {
-        throw not_implemented_error("Too complex, sigh");
+        Base::validate_curve();
+        const int d = Base::get_degree();
+        ControlPoints bezier_ctrl_pts;
+        ControlPoints ctrl_pts(d + 1, _dim);
+        BlossomVector blossom_vector(d);
+        return internal::bspline_closest_point(Base::m_knots,
+            d,
+            Base::m_control_points,
+            p,
+            [&](int k, Scalar& best_t, Scalar& best_sq_dist) {
+                extract_bezier_control_points(k, bezier_ctrl_pts, blossom_vector, ctrl_pts);
+                internal::bezier_closest_point(bezier_ctrl_pts,
+                    p,
+                    Base::m_knots[k],
+                    Base::m_knots[k + 1],
+                    best_t,
+                    best_sq_dist);
+            });
+    }
+
+    /**
+     * Control points of the Bézier segment covering knot span k, computed
+     * by blossoming: the j-th one is b[knots[k] (d-j times), knots[k+1]
+     * (j times)].
+     */
+    template <typename Derived>
+    void extract_bezier_control_points(int k, Eigen::PlainObjectBase<Derived>& out) const
+    {
+        const int d = Base::get_degree();
+        BlossomVector blossom_vector(d);
+        ControlPoints ctrl_pts(d + 1, _dim);
+        extract_bezier_control_points(k, out, blossom_vector, ctrl_pts);
+    }
+
+    /**
+     * Same as extract_bezier_control_points(k, out), with the scratch space
+     * borrowed from `workspace`.
+     */
+    template <typename Derived>
+    void extract_bezier_control_points(
+        int k, Eigen::PlainObjectBase<Derived>& out, EvaluationWorkspace<Scalar>& workspace) const
+    {
+        const int d = Base::get_degree();
+        auto blossom_vector = workspace.get_vector(1, d);
+        auto ctrl_pts = workspace.template get_matrix<_dim>(0, d + 1);
+        extract_bezier_control_points(k, out, blossom_vector, ctrl_pts);
+    }
+
+    /**
+     * Evaluate the blossom b_k[t_1, ..., t_d] of the polynomial piece on
+     * knot span k, where d is the degree and `blossom_vector` = [t_1, ...,
+     * t_d].  b_k[t, ..., t] is the point at t for t in span k.
+     */
+    template <typename Derived>
+    Point blossom(const Eigen::MatrixBase<Derived>& blossom_vector,
+        int k,
+        EvaluationWorkspace<Scalar>& workspace) const
+    {
+        Base::validate_curve();
+        const int d = Base::get_degree();
+        assert(blossom_vector.size() == d);
+        assert(k >= d && k < Base::m_control_points.rows());
+        auto ctrl_pts = workspace.template get_matrix<_dim>(0, d + 1);
+        ctrl_pts = Base::m_control_points.middleRows(k - d, d + 1);
+        blossom(blossom_vector, d, k, ctrl_pts);
+        return ctrl_pts.row(d);
     }
 
+    template <typename Derived>
     void get_derivative_coefficients(
-        int curve_degree, int knot_span, ControlPoints& control_pts) const
+        int curve_degree, int knot_span, Eigen::MatrixBase<Derived>& control_pts) const
     {
         int num_control_points = curve_degree + 1; // TODO is this right?
         for (int i = 0; i < num_control_points; i++) {
@@ -110,14 +207,7 @@ public:
 
         if (p == 0) return Point::Zero();
 
-        // Only uses the first p rows
-        ControlPoints ctrl_pts(p + 1, _dim);
-        get_knot_span_control_points(p, k, ctrl_pts);
-
-        int deriv_degree = p - 1;
-        get_derivative_coefficients(deriv_degree, k, ctrl_pts);
-
-        return deBoor(t, deriv_degree, k, ctrl_pts);
+        return evaluate_in_span(t, k, 1);
     }
 
     Point evaluate_2nd_derivative(Scalar t) const override
@@ -132,16 +222,49 @@ public:
 
         if (p <= 1) return Point::Zero();
 
-        // Only uses the first p rows
-        ControlPoints ctrl_pts(p + 1, _dim);
-        int deriv_degree = p - 1;
-        int deriv2_degree = p - 2;
+        return evaluate_in_span(t, k, 2);
+    }
+
+    using Base::evaluate_derivatives;
 
-        get_knot_span_control_points(p, k, ctrl_pts);
-        get_derivative_coefficients(deriv_degree, k, ctrl_pts);
-        get_derivative_coefficients(deriv2_degree, k, ctrl_pts);
+    void evaluate_derivatives(Scalar t, int k, PointMatrix& out) const override
+    {
+        constexpr int max_degree = _degree < 0 ? internal::MAX_STACK_DEGREE : _degree;
+        if (Base::get_degree() <= max_degree) {
+            evaluate_derivatives<max_degree>(t, k, out);
+        } else {
+            evaluate_derivatives<-1>(t, k, out);
+        }
+    }
 
-        return deBoor(t, deriv2_degree, k, ctrl_pts);
+    void evaluate_derivatives(Scalar t, int k, DerivativeMatrix& out) const override
+    {
+        Base::check_derivative_order(k);
+        constexpr int max_degree = _degree < 0 ? internal::MAX_STACK_DEGREE : _degree;
+        if (Base::get_degree() <= max_degree) {
+            evaluate_derivatives<max_degree>(t, k, out);
+        } else {
+            evaluate_derivatives<-1>(t, k, out);
+        }
+    }
+
+    using Base::batch_evaluate;
+    using Base::batch_evaluate_derivative;
+    using Base::batch_evaluate_2nd_derivative;
+
+    void batch_evaluate(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        batch_deBoor(ts, 0, out);
+    }
+
+    void batch_evaluate_derivative(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        batch_deBoor(ts, 1, out);
+    }
+
+    void batch_evaluate_2nd_derivative(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        batch_deBoor(ts, 2, out);
     }
 
     std::vector<Scalar> compute_inflections(
@@ -300,17 +423,25 @@ public:
     }
 
     /**
-     * Extract a subcurve in range [t0, t1].
+     * Extract a subcurve in range [t0, t1] of the domain.
      */
     ThisType subcurve(Scalar t0, Scalar t1) const
     {
-        if (t0 > t1) {
-            throw invalid_setting_error("t0 must be smaller than t1");
-        }
-        if (t0 < 0 || t0 > 1 || t1 < 0 || t1 > 1) {
-            throw invalid_setting_error("Invalid range");
-        }
-        return split(t0)[1].split(t1)[0];
+        BlossomVector blossom_vector(Base::get_degree());
+        ControlPoints ctrl_pts(Base::get_degree() + 1, _dim);
+        return subcurve(t0, t1, blossom_vector, ctrl_pts);
+    }
+
+    /**
+     * Same as subcurve(t0, t1), with the scratch space borrowed from
+     * `workspace`.
+     */
+    ThisType subcurve(Scalar t0, Scalar t1, EvaluationWorkspace<Scalar>& workspace) const
+    {
+        const int d = Base::get_degree();
+        auto blossom_vector = workspace.get_vector(1, d);
+        auto ctrl_pts = workspace.template get_matrix<_dim>(0, d + 1);
+        return subcurve(t0, t1, blossom_vector, ctrl_pts);
     }
 
 public:
@@ -406,33 +537,14 @@ public:
     static Eigen::MatrixXd form_least_squares_matrix(
         int num_control_pts, Eigen::MatrixXd knots, Eigen::MatrixXd parameters)
     {
-        assert(knots.rows() == num_control_pts + _degree + 1);
-
-        Eigen::MatrixXd basis_func_control_pts(num_control_pts, 1);
-        BSpline<Scalar, 1, _degree, false> basis_func;
-        basis_func_control_pts.setZero();
-        basis_func.set_knots(knots);
+        const int degree = int(knots.rows()) - num_control_pts - 1;
+        assert(_degree < 0 || degree == _degree);
 
         // Suppose we are fitting samples p_0, ..., p_n of a function f, with
         // parameter values t_0, ..., t_n. If B_j^n(t) is the jth basis function
         // then least_squares_matrix(i,j) = B_j^n(t_i)
-        // TODO replace with sparse matrices
-        const int num_constraints = int(parameters.rows());
-        Eigen::MatrixXd least_squares_matrix =
-            Eigen::MatrixXd::Zero(num_constraints, num_control_pts);
-
-        for (int j = 0; j < num_control_pts; j++) {
-            basis_func_control_pts.row(j) << 1.;
-            basis_func.set_control_points(basis_func_control_pts);
-
-            for (int i = 0; i < num_constraints; i++) {
-                Scalar t = parameters(i, 0);
-                Scalar bezier_value = basis_func.evaluate(t)(0);
-                least_squares_matrix(i, j) = bezier_value;
-            }
-            basis_func_control_pts.row(j) << 0.;
-        }
-        return least_squares_matrix;
+        const BasisMatrix<double> basis(knots.col(0), degree, parameters.col(0));
+        return Eigen::MatrixXd(basis.get_matrix());
     }
 
     static ThisType fit(Eigen::MatrixXd parameters,
@@ -473,9 +585,78 @@ public:
     }
 
 private:
-    template <typename Derived>
-    void blossom(
-        BlossomVector blossom_vector, int p, int k, Eigen::PlainObjectBase<Derived>& ctrl_pts) const
+    template <typename Derived, typename BlossomDerived, typename PointsDerived>
+    void extract_bezier_control_points(int k,
+        Eigen::PlainObjectBase<Derived>& out,
+        Eigen::MatrixBase<BlossomDerived>& blossom_vector,
+        Eigen::MatrixBase<PointsDerived>& ctrl_pts) const
+    {
+        const int d = Base::get_degree();
+        assert(k >= d && k < Base::m_control_points.rows());
+        out.resize(d + 1, _dim);
+        for (int j = 0; j <= d; j++) {
+            ctrl_pts = Base::m_control_points.middleRows(k - d, d + 1);
+            blossom_vector.head(d - j).setConstant(Base::m_knots[k]);
+            blossom_vector.tail(j).setConstant(Base::m_knots[k + 1]);
+            blossom(blossom_vector, d, k, ctrl_pts);
+            out.row(j) = ctrl_pts.row(d);
+        }
+    }
+
+    template <typename BlossomDerived, typename PointsDerived>
+    ThisType subcurve(Scalar t0,
+        Scalar t1,
+        Eigen::MatrixBase<BlossomDerived>& blossom_vector,
+        Eigen::MatrixBase<PointsDerived>& ctrl_pts) const
+    {
+        Base::validate_curve();
+        if (!(t0 < t1)) {
+            throw invalid_setting_error("t0 must be smaller than t1");
+        }
+        if (t0 < Base::get_domain_lower_bound() || t1 > Base::get_domain_upper_bound()) {
+            throw invalid_setting_error("Invalid range");
+        }
+
+        // The subcurve keeps the knots strictly inside (t0, t1), clamped
+        // with d+1 copies of t0 and t1.  It is a knot refinement restricted
+        // to [t0, t1], so its i-th control point is the blossom
+        //    c_i = b_k[u_{i+1}, ..., u_{i+d}]
+        // of the piece on any nonempty original span k inside
+        // [u_i, u_{i+d+1}]; repeated knots leave empty spans to skip.
+        const int d = Base::get_degree();
+        const int k0 = Base::locate_span(t0);
+        int k1 = Base::locate_span(t1);
+        while (k1 > k0 && Base::m_knots[k1] >= t1) k1--;
+        const int num_internal_knots = k1 - k0;
+        const int num_ctrl_pts = d + 1 + num_internal_knots;
+
+        KnotVector knots(num_ctrl_pts + d + 1);
+        knots.head(d + 1).setConstant(t0);
+        knots.segment(d + 1, num_internal_knots) =
+            Base::m_knots.segment(k0 + 1, num_internal_knots);
+        knots.tail(d + 1).setConstant(t1);
+
+        ControlPoints subcurve_ctrl_pts(num_ctrl_pts, _dim);
+        for (int i = 0; i < num_ctrl_pts; i++) {
+            int k = k0 + std::max(i - d, 0);
+            while (Base::m_knots[k] == Base::m_knots[k + 1]) k++;
+            blossom_vector = knots.segment(i + 1, d);
+            ctrl_pts = Base::m_control_points.middleRows(k - d, d + 1);
+            blossom(blossom_vector, d, k, ctrl_pts);
+            subcurve_ctrl_pts.row(i) = ctrl_pts.row(d);
+        }
+
+        ThisType subcurve;
+        subcurve.set_control_points(std::move(subcurve_ctrl_pts));
+        subcurve.set_knots(std::move(knots));
+        return subcurve;
+    }
+
+    template <typename BlossomDerived, typename Derived>
+    void blossom(const Eigen::MatrixBase<BlossomDerived>& blossom_vector,
+        int p,
+        int k,
+        Eigen::MatrixBase<Derived>& ctrl_pts) const
     {
         assert(ctrl_pts.rows() >= p + 1);
 
@@ -495,19 +676,151 @@ private:
     }
 
     template <typename Derived>
-    Point deBoor(Scalar t, int p, int k, Eigen::PlainObjectBase<Derived>& ctrl_pts) const
+    Point deBoor(Scalar t, int p, int k, Eigen::MatrixBase<Derived>& ctrl_pts) const
     {
         if (p > 0) {
-            // Set t_i=t for all blossom evaluation points
-            BlossomVector blossom_vector(Base::get_degree());
-            blossom_vector.setConstant(t);
-
-            // Evaluate the blossom
-            blossom(blossom_vector, p, k, ctrl_pts);
+            // Set t_i=t for all blossom evaluation points.  The constant
+            // expression is never materialized, so this does not allocate.
+            blossom(BlossomVector::Constant(p, t), p, k, ctrl_pts);
         }
         return ctrl_pts.row(p);
     }
 
+    /**
+     * Derivatives up to order k from the basis function derivatives of the
+     * knot span containing t (The NURBS Book, algorithm A3.2).
+     */
+    template <int _max_degree, typename Derived>
+    void evaluate_derivatives(Scalar t, int k, Eigen::PlainObjectBase<Derived>& out) const
+    {
+        Base::validate_curve();
+        assert(k >= 0);
+        const int p = Base::get_degree();
+        const int span = Base::locate_span(t);
+        const int n = std::min(k, p);
+        out.setZero(k + 1, _dim);
+
+        if (Base::use_power_basis(span)) {
+            for (int r = 0; r <= n; r++) {
+                out.row(r) = Base::evaluate_power_basis(t, span, r);
+            }
+            return;
+        }
+
+        internal::BasisScratch<Scalar, _max_degree> ders;
+        internal::compute_basis_function_derivatives<_max_degree>(
+            Base::m_knots, span, p, t, n, ders);
+
+        // Accumulate offsets from a reference control point to keep the
+        // partition of unity rounding independent of the coordinate scale.
+        const Point ref = Base::m_control_points.row(span - p);
+        for (int j = 1; j <= p; j++) {
+            const Point offset = Base::m_control_points.row(span - p + j) - ref;
+            for (int r = 0; r <= n; r++) {
+                out.row(r) += ders(r, j) * offset;
+            }
+        }
+        out.row(0) += ref;
+    }
+
+    /**
+     * Evaluate the `order`-th derivative at each entry of `ts`.  The knot
+     * span of the previous parameter is used as the starting point of the
+     * span search, and the scratch control points are shared by all samples.
+     */
+    void batch_deBoor(const ParameterVector& ts, int order, PointMatrix& out) const
+    {
+        Base::validate_curve();
+        const int p = Base::get_degree();
+        assert(Base::m_knots.rows() == Base::m_control_points.rows() + p + 1);
+
+        if (order > p) {
+            out.setZero(ts.size(), _dim);
+            return;
+        }
+
+        out.resize(ts.size(), _dim);
+        ControlPoints ctrl_pts(UnrolledKernel::value ? 0 : p + 1, _dim);
+        int k = -1;
+        for (Eigen::Index i = 0; i < ts.size(); i++) {
+            const Scalar t = ts[i];
+            k = Base::locate_span(t, k);
+            if (UnrolledKernel::value || Base::use_power_basis(k)) {
+                out.row(i) = evaluate_in_span(t, k, order);
+            } else {
+                out.row(i) = evaluate_in_span(t, k, order, ctrl_pts);
+            }
+        }
+    }
+
+    /**
+     * Fixed degrees up to internal::MAX_UNROLLED_DEGREE are evaluated with
+     * the compile time unrolled de Boor kernel on fixed size scratch space.
+     */
+    using UnrolledKernel = std::integral_constant<bool,
+        !_generic && _degree >= 1 && _degree <= internal::MAX_UNROLLED_DEGREE>;
+    static constexpr int UNROLLED_DEGREE = UnrolledKernel::value ? _degree : 1;
+    // Highest derivative order of the unrolled kernel that is instantiated,
+    // so that a linear curve does not get a kernel of degree -1.
+    static constexpr int UNROLLED_MAX_ORDER = UNROLLED_DEGREE < 2 ? UNROLLED_DEGREE : 2;
+
+    /**
+     * Evaluate the `order`-th derivative (order <= degree) at t, where k is
+     * the knot span containing t.
+     */
+    Point evaluate_in_span(Scalar t, int k, int order) const
+    {
+        if (Base::use_power_basis(k)) {
+            return Base::evaluate_power_basis(t, k, order);
+        }
+        return evaluate_in_span(t, k, order, UnrolledKernel());
+    }
+
+    Point evaluate_in_span(Scalar t, int k, int order, std::false_type) const
+    {
+        ControlPoints ctrl_pts(Base::get_degree() + 1, _dim);
+        return evaluate_in_span(t, k, order, ctrl_pts);
+    }
+
+    Point evaluate_in_span(Scalar t, int k, int order, std::true_type) const
+    {
+        assert(order <= UNROLLED_MAX_ORDER);
+        switch (order) {
+        case 0: return evaluate_in_span_unrolled<0>(t, k);
+        case 1: return evaluate_in_span_unrolled<1>(t, k);
+        default: return evaluate_in_span_unrolled<UNROLLED_MAX_ORDER>(t, k);
+        }
+    }
+
+    /**
+     * Same as above, using `ctrl_pts` (at least degree+1 rows) as scratch.
+     */
+    template <typename Derived>
+    Point evaluate_in_span(
+        Scalar t, int k, int order, Eigen::MatrixBase<Derived>& ctrl_pts) const
+    {
+        const int p = Base::get_degree();
+        get_knot_span_control_points(p, k, ctrl_pts);
+        for (int r = 1; r <= order; r++) {
+            get_derivative_coefficients(p - r, k, ctrl_pts);
+        }
+        return deBoor(t, p - order, k, ctrl_pts);
+    }
+
+    template <int _order>
+    Point evaluate_in_span_unrolled(Scalar t, int k) const
+    {
+        static_assert(_order <= UNROLLED_DEGREE, "Derivative order exceeds the degree");
+        constexpr int degree = UNROLLED_DEGREE - _order;
+        Eigen::Matrix<Scalar, UNROLLED_DEGREE + 1, _dim> ctrl_pts;
+        get_knot_span_control_points(UNROLLED_DEGREE, k, ctrl_pts);
+        for (int r = 1; r <= _order; r++) {
+            get_derivative_coefficients(UNROLLED_DEGREE - r, k, ctrl_pts);
+        }
+        internal::unrolled_de_boor<degree>(Base::m_knots, k, t, ctrl_pts);
+        return ctrl_pts.row(degree);
+    }
+
     void combine_Beziers(const std::vector<Bezier<_Scalar, _dim, _degree, _generic>>& beziers,
         const std::vector<_Scalar>& parameter_bounds)
     {
@@ -539,6 +852,8 @@ private:
             Base::m_knots.segment(i * degree + 1, degree)
                 .setConstant(parameter_bounds[static_cast<size_t>(i)]);
         }
+        Base::update_span_index();
+        Base::update_power_basis();
 
         for (const auto t : parameter_bounds) {
             // Attempt to remove as many multiplicty as possible.
@@ -3,6 +3,9 @@
 #include <limits>
 
 #include <nanospline/CurveBase.h>
+#include <nanospline/internal/basis_functions.h>
+#include <nanospline/internal/knot_span_index.h>
+#include <nanospline/internal/power_basis.h>
 
 namespace nanospline {
 
@@ -22,7 +25,9 @@ class BSplineBase : public CurveBase<_Scalar, _dim> {
     public:
         virtual ~BSplineBase()=default;
         virtual Point evaluate(Scalar t) const override =0;
+        using Base::evaluate;
         virtual Scalar inverse_evaluate(const Point& p) const override =0;
+        using Base::inverse_evaluate;
         virtual Point evaluate_derivative(Scalar t) const override=0;
         virtual Point evaluate_2nd_derivative(Scalar t) const override=0;
 
@@ -97,9 +102,33 @@ class BSplineBase : public CurveBase<_Scalar, _dim> {
         }
 
         virtual void insert_knot(Scalar t, int num_copies=1) {
+            validate_curve();
+            ControlPoints Rw(get_degree()+1, _dim);
+            _insert_knot(t, num_copies, Rw);
+        }
+
+        /**
+         * Same as insert_knot(t, num_copies), but the scratch control points
+         * are borrowed from `workspace`.  The new knot vector and control
+         * points still need to be allocated since the curve grows.
+         */
+        virtual void insert_knot(Scalar t, int num_copies,
+                EvaluationWorkspace<Scalar>& workspace) {
+            validate_curve();
+            auto Rw = workspace.template get_matrix<_dim>(0, get_degree()+1);
+            _insert_knot(t, num_copies, Rw);
+        }
+
+    protected:
+        /**
+         * Knot insertion (The NURBS Book, algorithm A5.1) using `Rw`, which
+         * must hold at least p+1 rows, as scratch space.
+         */
+        template<typename Derived>
+        void _insert_knot(Scalar t, int num_copies,
+                Eigen::MatrixBase<Derived>& Rw) {
             assert(num_copies >= 1);
             assert(in_domain(t));
-            validate_curve();
             const int r = num_copies;
             const int p = get_degree();
             const int k = locate_span(t);
@@ -128,7 +157,8 @@ class BSplineBase : public CurveBase<_Scalar, _dim> {
                     m_control_points.bottomRows(n-k+s+1);
             }
 
-            ControlPoints Rw = m_control_points.block(k-p, 0, p-s+1, _dim);
+            assert(Rw.rows() >= p-s+1);
+            Rw.topRows(p-s+1) = m_control_points.block(k-p, 0, p-s+1, _dim);
             for (int j=1; j<=r; j++) {
                 int L = k-p+j;
                 for (int i=0; i<=p-j-s; i++) {
@@ -149,8 +179,11 @@ class BSplineBase : public CurveBase<_Scalar, _dim> {
 
             m_control_points.swap(ctrl_pts_new);
             m_knots.swap(knots_new);
+            update_span_index();
+            update_power_basis();
         }
 
+    public:
         virtual int remove_knot(Scalar t, int num_copies=1, Scalar tol=-1) {
             assert(num_copies >= 1);
             assert(in_domain(t));
@@ -236,44 +269,30 @@ class BSplineBase : public CurveBase<_Scalar, _dim> {
                 j++;
             }
             Pw.conservativeResize(j, Eigen::NoChange_t());
+            update_span_index();
+            update_power_basis();
             return count;
         }
 
     public:
+        /**
+         * Locate the knot span k such that knots[k] <= t < knots[k+1].
+         * Uniform knot vectors are handled in constant time.
+         */
         int locate_span(const Scalar t) const {
-            const auto p = get_degree();
-            const auto num_knots = m_knots.rows();
-            assert(num_knots > m_control_points.rows());
-            int low = p;
-            int high = static_cast<int>(m_knots.rows()-p-1);
-
-            auto bypass_duplicates_after = [this, num_knots](int i) {
-                while(i+1<num_knots && this->m_knots[i] == this->m_knots[i+1]) {
-                    i=i+1;
-                }
-                return i;
-            };
-
-            auto bypass_duplicates_before= [this](int i) {
-                while(i-1>=0 && this->m_knots[i] == this->m_knots[i-1]) {
-                    i=i-1;
-                }
-                return i;
-            };
-
-            // Handle out of domain cases.
-            if (t <= m_knots[low]) return low;
-
-            if (t >= m_knots[high]) return bypass_duplicates_before(high)-1;
-
-            int mid = (high+low) / 2;
-            while(t < m_knots[mid] || t >= m_knots[mid+1]) {
-                if (t < m_knots[mid]) high=mid;
-                else low = mid;
-                mid = (high+low) / 2;
-            }
+            assert(m_knots.rows() > m_control_points.rows());
+            return m_span_index.locate(m_knots, get_degree(), t);
+        }
 
-            return bypass_duplicates_after(mid);
+        /**
+         * Same as locate_span(t), but start from span `hint` (e.g. the span
+         * found for the previous parameter) and march forward.  This makes a
+         * sweep over increasing parameters linear in the number of knots.
+         * Falls back to the search when the hint is not usable.
+         */
+        int locate_span(const Scalar t, int hint) const {
+            assert(m_knots.rows() > m_control_points.rows());
+            return m_span_index.locate(m_knots, get_degree(), t, hint);
         }
 
         int get_multiplicity(int k) const {
@@ -297,11 +316,13 @@ class BSplineBase : public CurveBase<_Scalar, _dim> {
         template<typename Derived>
         void set_control_points(const Eigen::PlainObjectBase<Derived>& ctrl_pts) {
             m_control_points = ctrl_pts;
+            update_power_basis();
         }
 
         template<typename Derived>
         void set_control_points(Eigen::PlainObjectBase<Derived>&& ctrl_pts) {
             m_control_points.swap(ctrl_pts);
+            update_power_basis();
         }
 
         const KnotVector& get_knots() const {
@@ -311,11 +332,31 @@ class BSplineBase : public CurveBase<_Scalar, _dim> {
         template<typename Derived>
         void set_knots(const Eigen::PlainObjectBase<Derived>& knots) {
             m_knots = knots;
+            update_span_index();
+            update_power_basis();
         }
 
         template<typename Derived>
         void set_knots(Eigen::PlainObjectBase<Derived>&& knots) {
             m_knots.swap(knots);
+            update_span_index();
+            update_power_basis();
+        }
+
+        /**
+         * Choose between de Boor's algorithm (the default) and Horner
+         * evaluation of a cached power basis form of every knot span, see
+         * EvaluationMode for the precision tradeoff.  Each span is expanded
+         * in the normalized parameter (t - knots[k]) / (knots[k+1] - knots[k]).
+         * The cache is rebuilt whenever the control points or knots change.
+         */
+        virtual void set_evaluation_mode(EvaluationMode mode) {
+            m_evaluation_mode = mode;
+            update_power_basis();
+        }
+
+        virtual EvaluationMode get_evaluation_mode() const {
+            return m_evaluation_mode;
         }
 
         int get_degree() const {
@@ -356,9 +397,77 @@ class BSplineBase : public CurveBase<_Scalar, _dim> {
             }
         }
 
+        /**
+         * Must be called whenever m_knots is modified.
+         */
+        void update_span_index() {
+            m_span_index.build(m_knots);
+        }
+
+        /**
+         * Whether knot span k is evaluated from the power basis cache.
+         */
+        bool use_power_basis(int k) const {
+            return m_evaluation_mode == EvaluationMode::PowerBasis &&
+                m_power_basis.rows() > 0 && m_knots[k+1] > m_knots[k];
+        }
+
+        /**
+         * Rebuild the power basis cache from the Taylor expansion of each
+         * knot span at its left knot.  Must be called whenever m_knots or
+         * m_control_points is modified.
+         */
+        void update_power_basis() {
+            m_power_basis.resize(0, _dim);
+            if (m_evaluation_mode != EvaluationMode::PowerBasis) return;
+            const int p = get_degree();
+            if (p < 0 || (_degree >= 0 && p != _degree)) return;
+
+            const int num_spans = static_cast<int>(m_control_points.rows()) - p;
+            m_power_basis.setZero(num_spans * (p+1), _dim);
+            internal::BasisScratch<Scalar, -1> ders;
+            for (int k=p; k<p+num_spans; k++) {
+                const Scalar h = m_knots[k+1] - m_knots[k];
+                if (!(h > 0)) continue;
+                internal::compute_basis_function_derivatives<-1>(
+                        m_knots, k, p, m_knots[k], p, ders);
+
+                // The j-th coefficient is C^(j)(knots[k]) * h^j / j!.
+                auto coeffs = m_power_basis.middleRows((k-p)*(p+1), p+1);
+                Scalar scale = 1;
+                for (int j=0; j<=p; j++) {
+                    if (j > 0) scale *= h / Scalar(j);
+                    for (int i=0; i<=p; i++) {
+                        coeffs.row(j) += (scale * ders(j, i)) *
+                            m_control_points.row(k-p+i);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Evaluate the `order`-th derivative at t from the power basis
+         * cache of knot span k.
+         */
+        Point evaluate_power_basis(Scalar t, int k, int order) const {
+            assert(use_power_basis(k));
+            const int p = get_degree();
+            const Scalar h = m_knots[k+1] - m_knots[k];
+            Scalar inv_scale = 1;
+            for (int r=0; r<order; r++) {
+                inv_scale /= h;
+            }
+            const auto coeffs = m_power_basis.middleRows((k-p)*(p+1), p+1);
+            return internal::evaluate_power_basis(
+                    coeffs, (t - m_knots[k]) / h, order) * inv_scale;
+        }
+
     protected:
         ControlPoints m_control_points;
         KnotVector m_knots;
+        internal::KnotSpanIndex<Scalar> m_span_index;
+        ControlPoints m_power_basis;
+        EvaluationMode m_evaluation_mode = EvaluationMode::Recursive;
 };
 
 }
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include <nanospline/PatchBase.h>
 #include <nanospline/BSpline.h>
+#include <nanospline/BasisMatrix.h>
+#include <nanospline/internal/basis_functions.h>
+#include <nanospline/internal/shared_lazy.h>
 
 using std::vector;
 
@@ -23,6 +29,8 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
         using KnotVector = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
         using IsoCurveU = BSpline<Scalar, _dim, _degree_u>;
         using IsoCurveV = BSpline<Scalar, _dim, _degree_v>;
+        using DerivativePatch = BSplinePatch<_Scalar, _dim, -1, -1>;
+        using DerivativeMatrix = typename Base::DerivativeMatrix;
 
     public:
         static BSplinePatch<_Scalar, _dim, _degree_u, _degree_v> ZeroPatch() {
@@ -54,33 +62,44 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
 
     public:
         Point evaluate(Scalar u, Scalar v) const override {
-            auto iso_curve_v = compute_iso_curve_v(u);
-            return iso_curve_v.evaluate(v);
+            return evaluate_tensor_product(u, v, 0, 0);
         }
 
         Point evaluate_derivative_u(Scalar u, Scalar v) const override {
-            auto iso_curve_u = compute_iso_curve_u(v);
-            return iso_curve_u.evaluate_derivative(u);
+            return evaluate_tensor_product(u, v, 1, 0);
         }
 
         Point evaluate_derivative_v(Scalar u, Scalar v) const override {
-            auto iso_curve_v = compute_iso_curve_v(u);
-            return iso_curve_v.evaluate_derivative(v);
+            return evaluate_tensor_product(u, v, 0, 1);
         }
 
         Point evaluate_2nd_derivative_uu(Scalar u, Scalar v) const override {
-            auto iso_curve_u = compute_iso_curve_u(v);
-            return iso_curve_u.evaluate_2nd_derivative(u);
+            return evaluate_tensor_product(u, v, 2, 0);
         }
 
         Point evaluate_2nd_derivative_vv(Scalar u, Scalar v) const override {
-            auto iso_curve_v = compute_iso_curve_v(u);
-            return iso_curve_v.evaluate_2nd_derivative(v);
+            return evaluate_tensor_product(u, v, 0, 2);
         }
 
         Point evaluate_2nd_derivative_uv(Scalar u, Scalar v) const override {
-            auto duv_patch = compute_duv_patch();
-            return duv_patch.evaluate(u, v);
+            return evaluate_tensor_product(u, v, 1, 1);
+        }
+
+        using Base::evaluate_all;
+
+        void evaluate_all(Scalar u, Scalar v, int max_order,
+                DerivativeMatrix& out) const override {
+            constexpr int max_degree_u =
+                _degree_u < 0 ? internal::MAX_STACK_DEGREE : _degree_u;
+            constexpr int max_degree_v =
+                _degree_v < 0 ? internal::MAX_STACK_DEGREE : _degree_v;
+
+            if (Base::get_degree_u() <= max_degree_u &&
+                    Base::get_degree_v() <= max_degree_v) {
+                evaluate_all<max_degree_u, max_degree_v>(u, v, max_order, out);
+            } else {
+                evaluate_all<-1, -1>(u, v, max_order, out);
+            }
         }
 
         void initialize() override {
@@ -134,6 +153,98 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
         }
 
     private:
+        /**
+         * Evaluate the (order_u, order_v)-th partial derivative directly from
+         * the tensor product of the local basis functions.  Only the
+         * (p+1) x (q+1) control points of the knot span around (u, v) are
+         * touched, and the scratch space lives on the stack unless the
+         * (runtime) degree exceeds internal::MAX_STACK_DEGREE.
+         */
+        Point evaluate_tensor_product(
+                Scalar u, Scalar v, int order_u, int order_v) const {
+            constexpr int max_degree_u =
+                _degree_u < 0 ? internal::MAX_STACK_DEGREE : _degree_u;
+            constexpr int max_degree_v =
+                _degree_v < 0 ? internal::MAX_STACK_DEGREE : _degree_v;
+
+            if (Base::get_degree_u() <= max_degree_u &&
+                    Base::get_degree_v() <= max_degree_v) {
+                return evaluate_tensor_product<max_degree_u, max_degree_v>(
+                        u, v, order_u, order_v);
+            } else {
+                return evaluate_tensor_product<-1, -1>(u, v, order_u, order_v);
+            }
+        }
+
+        template<int _max_degree_u, int _max_degree_v>
+        Point evaluate_tensor_product(
+                Scalar u, Scalar v, int order_u, int order_v) const {
+            const int degree_u = Base::get_degree_u();
+            const int degree_v = Base::get_degree_v();
+            if (order_u > degree_u || order_v > degree_v) {
+                return Point::Zero();
+            }
+
+            const int span_u = internal::locate_knot_span(m_knots_u, degree_u, u);
+            const int span_v = internal::locate_knot_span(m_knots_v, degree_v, v);
+
+            internal::BasisScratch<Scalar, _max_degree_u> basis_u;
+            internal::BasisScratch<Scalar, _max_degree_v> basis_v;
+            internal::compute_basis_function_derivatives<_max_degree_u>(
+                    m_knots_u, span_u, degree_u, u, order_u, basis_u);
+            internal::compute_basis_function_derivatives<_max_degree_v>(
+                    m_knots_v, span_v, degree_v, v, order_v, basis_v);
+
+            const int num_v = num_control_points_v();
+            const int base_u = span_u - degree_u;
+            const int base_v = span_v - degree_v;
+            assert(base_u >= 0 && base_v >= 0);
+
+            // Accumulate offsets from a reference control point so that the
+            // partition of unity rounding error does not scale with the
+            // magnitude of the coordinates.
+            const Point ref = Base::m_control_grid.row(base_u * num_v + base_v);
+            Point result = Point::Zero();
+            for (int i=0; i<=degree_u; i++) {
+                Point row_sum = Point::Zero();
+                const int row_offset = (base_u + i) * num_v + base_v;
+                for (int j=0; j<=degree_v; j++) {
+                    row_sum += basis_v(order_v, j) *
+                        (Base::m_control_grid.row(row_offset + j) - ref);
+                }
+                result += basis_u(order_u, i) * row_sum;
+            }
+            if (order_u == 0 && order_v == 0) {
+                result += ref;
+            }
+            return result;
+        }
+
+        /**
+         * Evaluate all partial derivatives up to `max_order` from a single
+         * set of basis function derivatives in u and v.
+         */
+        template<int _max_degree_u, int _max_degree_v>
+        void evaluate_all(Scalar u, Scalar v, int max_order,
+                DerivativeMatrix& out) const {
+            const int degree_u = Base::get_degree_u();
+            const int degree_v = Base::get_degree_v();
+            const int span_u = internal::locate_knot_span(m_knots_u, degree_u, u);
+            const int span_v = internal::locate_knot_span(m_knots_v, degree_v, v);
+
+            internal::BasisScratch<Scalar, _max_degree_u> basis_u;
+            internal::BasisScratch<Scalar, _max_degree_v> basis_v;
+            internal::compute_basis_function_derivatives<_max_degree_u>(
+                    m_knots_u, span_u, degree_u, u,
+                    std::min(max_order, degree_u), basis_u);
+            internal::compute_basis_function_derivatives<_max_degree_v>(
+                    m_knots_v, span_v, degree_v, v,
+                    std::min(max_order, degree_v), basis_v);
+
+            Base::evaluate_tensor_product_derivatives(basis_u, basis_v,
+                    span_u - degree_u, span_v - degree_v, max_order, out);
+        }
+
         // Hopefully we won't have more than 2 billion knots...
         // If so this will break.
         int get_num_knots_u() const {
@@ -156,21 +267,25 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
         template<typename Derived>
         void set_knots_u(const Eigen::PlainObjectBase<Derived>& knots) {
             m_knots_u = knots;
+            invalidate_cache();
         }
 
         template<typename Derived>
         void set_knots_v(const Eigen::PlainObjectBase<Derived>& knots) {
             m_knots_v = knots;
+            invalidate_cache();
         }
 
         template<typename Derived>
         void set_knots_u(Eigen::PlainObjectBase<Derived>&& knots) {
             m_knots_u.swap(knots);
+            invalidate_cache();
         }
 
         template<typename Derived>
         void set_knots_v(Eigen::PlainObjectBase<Derived>&& knots) {
             m_knots_v.swap(knots);
+            invalidate_cache();
         }
 
         IsoCurveU compute_iso_curve_u(Scalar v) const {
@@ -272,6 +387,51 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
             return compute_du_patch().compute_dv_patch();
         }
 
+        /**
+         * Derivative patches are cached.  They are built on first use, once
+         * even if several threads query concurrently, and dropped whenever
+         * the control grid, the degrees or the knots change.
+         */
+        const DerivativePatch& get_du_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.du_flag, [&]() {
+                cache.du.reset(new DerivativePatch(compute_du_patch()));
+            });
+            return *cache.du;
+        }
+
+        const DerivativePatch& get_dv_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.dv_flag, [&]() {
+                cache.dv.reset(new DerivativePatch(compute_dv_patch()));
+            });
+            return *cache.dv;
+        }
+
+        const DerivativePatch& get_duu_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.duu_flag, [&]() {
+                cache.duu.reset(new DerivativePatch(get_du_patch().compute_du_patch()));
+            });
+            return *cache.duu;
+        }
+
+        const DerivativePatch& get_duv_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.duv_flag, [&]() {
+                cache.duv.reset(new DerivativePatch(compute_duv_patch()));
+            });
+            return *cache.duv;
+        }
+
+        const DerivativePatch& get_dvv_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.dvv_flag, [&]() {
+                cache.dvv.reset(new DerivativePatch(get_dv_patch().compute_dv_patch()));
+            });
+            return *cache.dvv;
+        }
+
 
 
         Point get_control_point(int ui, int vj) const override {
@@ -386,7 +546,7 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
 
         // Initialize control grids of final split patches
         std::vector<ControlGrid> split_control_pts_u;
-        for (const auto ref_curve : reference_split_curves) {
+        for (const auto& ref_curve : reference_split_curves) {
           int num_ctrl_pts =
               static_cast<int>(ref_curve.get_control_points().rows());
 
@@ -455,7 +615,7 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
 
         // Initialize control grids of final split patches
         std::vector<ControlGrid> split_control_pts_v;
-        for (const auto ref_curve : reference_split_curves) {
+        for (const auto& ref_curve : reference_split_curves) {
           int num_ctrl_pts =
               static_cast<int>(ref_curve.get_control_points().rows());
 
@@ -645,11 +805,10 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
             Eigen::MatrixXd parameters)
         {
             const int num_control_pts = num_control_pts_u * num_control_pts_v;
-            Eigen::Matrix<Scalar, Eigen::Dynamic, 1> basis_func_control_pts(num_control_pts, 1);
-            BSplinePatch<Scalar, 1, _degree_u, _degree_v> basis_function;
-            basis_func_control_pts.setZero();
-            basis_function.set_knots_u(knots_u);
-            basis_function.set_knots_v(knots_v);
+            const int degree_u = int(knots_u.rows()) - num_control_pts_u - 1;
+            const int degree_v = int(knots_v.rows()) - num_control_pts_v - 1;
+            const BasisMatrix<double> basis_u(knots_u.col(0), degree_u, parameters.col(0));
+            const BasisMatrix<double> basis_v(knots_v.col(0), degree_v, parameters.col(1));
 
             // Suppose we are fitting samples p_0, ..., p_n of a function f, with
             // parameter values (u_0,v_0) ..., (u_n,v_n). If B_q^n(u,v) is the
@@ -657,23 +816,18 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
             // least_squares_matrix(i,q) = B_q^n(u_i, v_i),
             // where q is the linearized index over basis elements:
             // q = i*num_control_pts_v + j
+            // Each tensor product basis function is B_j(u) * B_k(v), so only
+            // the (p+1)*(q+1) products of nonzeros in row i contribute.
             const int num_constraints = int(parameters.rows());
             Eigen::MatrixXd least_squares_matrix =
                 Eigen::MatrixXd::Zero(num_constraints, num_control_pts);
-
-            for (int j = 0; j < num_control_pts_u; j++) {
-                for (int k = 0; k < num_control_pts_v; k++) {
-                    int index = j * num_control_pts_v + k; // TODO bug prone
-                    basis_func_control_pts.row(index) << 1.;
-                    basis_function.set_control_grid(basis_func_control_pts);
-                    basis_function.initialize();
-                    for (int i = 0; i < num_constraints; i++) {
-                        Scalar u = parameters(i, 0);
-                        Scalar v = parameters(i, 1);
-                        Scalar bezier_value = basis_function.evaluate(u, v)(0);
-                        least_squares_matrix(i, index) = bezier_value;
+            using InnerIterator = typename BasisMatrix<double>::SparseMatrix::InnerIterator;
+            for (int i = 0; i < num_constraints; i++) {
+                for (InnerIterator itr_u(basis_u.get_matrix(), i); itr_u; ++itr_u) {
+                    for (InnerIterator itr_v(basis_v.get_matrix(), i); itr_v; ++itr_v) {
+                        const int index = int(itr_u.col()) * num_control_pts_v + int(itr_v.col());
+                        least_squares_matrix(i, index) = itr_u.value() * itr_v.value();
                     }
-                    basis_func_control_pts.row(index) << 0.;
                 }
             }
             return least_squares_matrix;
@@ -724,6 +878,20 @@ class BSplinePatch final : public PatchBase<_Scalar, _dim> {
             Base::set_control_grid(updated_control_points);
             initialize();
         }
+    protected:
+        void invalidate_cache() override {
+            m_derivative_cache.reset();
+        }
+
+    private:
+        struct DerivativeCache {
+            std::once_flag du_flag, dv_flag, duu_flag, duv_flag, dvv_flag;
+            std::shared_ptr<const DerivativePatch> du, dv, duu, duv, dvv;
+        };
+
+        // Allocated by the first get_*_patch() call, and shared by copies
+        // until either one is modified.
+        internal::SharedLazy<DerivativeCache> m_derivative_cache;
 };
 
 }
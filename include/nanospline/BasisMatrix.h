@@ -0,0 +1,169 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include <nanospline/Exceptions.h>
+#include <nanospline/internal/basis_functions.h>
+
+namespace nanospline {
+
+namespace internal {
+
+/**
+ * Whether CurveType is rational, i.e. has weights.
+ */
+template <typename CurveType, typename = void>
+struct has_weights : std::false_type
+{};
+
+template <typename CurveType>
+struct has_weights<CurveType,
+    decltype(void(std::declval<const CurveType&>().get_weights()))> : std::true_type
+{};
+
+} // namespace internal
+
+/**
+ * The B-spline basis functions of a knot vector and degree, sampled at a
+ * fixed list of parameters and stored as a sparse matrix:
+ *
+ *     matrix(i, j) = N_j^(order)(t_i)
+ *
+ * where N_j is the j-th basis function and `order` the derivative order
+ * (0 for the basis functions themselves).  Each row has at most p+1
+ * nonzeros.  Once built, evaluating a curve over these knots at all
+ * parameters is a single sparse product with its control points, and the
+ * control points of many curves sharing the knots can be stacked side by
+ * side and evaluated together.
+ *
+ * Rational curves are not accepted by evaluate_curve.  They can be
+ * evaluated through their homogeneous B-spline, followed by a division by
+ * the last column.
+ */
+template <typename _Scalar>
+class BasisMatrix
+{
+public:
+    using Scalar = _Scalar;
+    using KnotVector = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+    using ParameterVector = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+    using SparseMatrix = Eigen::SparseMatrix<Scalar, Eigen::RowMajor>;
+
+public:
+    BasisMatrix() = default;
+
+    template <typename KnotDerived, typename ParameterDerived>
+    BasisMatrix(const Eigen::MatrixBase<KnotDerived>& knots,
+        int degree,
+        const Eigen::MatrixBase<ParameterDerived>& parameters,
+        int order = 0)
+    {
+        initialize(knots, degree, parameters, order);
+    }
+
+    /**
+     * (Re)build the matrix.  `order` may not exceed `degree`; higher
+     * derivatives of a degree p B-spline vanish.
+     */
+    template <typename KnotDerived, typename ParameterDerived>
+    void initialize(const Eigen::MatrixBase<KnotDerived>& knots,
+        int degree,
+        const Eigen::MatrixBase<ParameterDerived>& parameters,
+        int order = 0)
+    {
+        const int num_knots = static_cast<int>(knots.size());
+        const int num_control_pts = num_knots - degree - 1;
+        if (degree < 0 || num_control_pts < degree + 1) {
+            throw invalid_setting_error("Knot vector is too short for the given degree.");
+        }
+        if (order < 0 || order > degree) {
+            throw invalid_setting_error("Derivative order must be between 0 and degree.");
+        }
+
+        m_knots = knots;
+        m_parameters = parameters;
+        m_degree = degree;
+        m_order = order;
+
+        const int num_parameters = static_cast<int>(m_parameters.size());
+        std::vector<Eigen::Triplet<Scalar>> entries;
+        entries.reserve(static_cast<size_t>(num_parameters * (degree + 1)));
+        internal::BasisScratch<Scalar, -1> ders;
+        for (int i = 0; i < num_parameters; i++) {
+            const Scalar t = m_parameters[i];
+            const int span = internal::locate_knot_span(m_knots, degree, t);
+            internal::compute_basis_function_derivatives<-1>(
+                m_knots, span, degree, t, order, ders);
+            for (int j = 0; j <= degree; j++) {
+                entries.emplace_back(i, span - degree + j, ders(order, j));
+            }
+        }
+
+        m_matrix.resize(num_parameters, num_control_pts);
+        m_matrix.setFromTriplets(entries.begin(), entries.end());
+        m_matrix.makeCompressed();
+    }
+
+    const SparseMatrix& get_matrix() const { return m_matrix; }
+    const KnotVector& get_knots() const { return m_knots; }
+    const ParameterVector& get_parameters() const { return m_parameters; }
+    int get_degree() const { return m_degree; }
+    int get_derivative_order() const { return m_order; }
+    int get_num_parameters() const { return static_cast<int>(m_matrix.rows()); }
+    int get_num_control_points() const { return static_cast<int>(m_matrix.cols()); }
+
+    /**
+     * Evaluate control points given one per row.  Any number of columns is
+     * accepted, so the control points of several curves over the same
+     * knots can be stacked side by side.  Row i of the result corresponds
+     * to parameter i.
+     */
+    template <typename Derived>
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Derived::ColsAtCompileTime> evaluate(
+        const Eigen::MatrixBase<Derived>& control_points) const
+    {
+        if (control_points.rows() != m_matrix.cols()) {
+            throw invalid_setting_error("Control point count does not match the basis.");
+        }
+        return m_matrix * control_points;
+    }
+
+    /**
+     * Evaluate a non-rational B-spline curve with the same degree and knots
+     * as this basis at every parameter.
+     */
+    template <typename CurveType>
+    typename CurveType::PointMatrix evaluate_curve(const CurveType& curve) const
+    {
+        if (internal::has_weights<CurveType>::value) {
+            throw invalid_setting_error(
+                "Rational curves must be evaluated through their homogeneous curve.");
+        }
+        if (!is_compatible(curve)) {
+            throw invalid_setting_error("Curve is not defined over the knots of this basis.");
+        }
+        return m_matrix * curve.get_control_points();
+    }
+
+    template <typename CurveType>
+    bool is_compatible(const CurveType& curve) const
+    {
+        return !internal::has_weights<CurveType>::value &&
+               curve.get_degree() == m_degree && curve.get_knots().size() == m_knots.size() &&
+               curve.get_knots() == m_knots;
+    }
+
+private:
+    SparseMatrix m_matrix;
+    KnotVector m_knots;
+    ParameterVector m_parameters;
+    int m_degree = -1;
+    int m_order = 0;
+};
+
+} // namespace nanospline
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <nanospline/Exceptions.h>
+#include <nanospline/PolynomialRootFinder.h>
+#include <nanospline/internal/parallel_for.h>
+
+namespace nanospline {
+
+/**
+ * Real roots of many polynomials of the same degree at once.
+ *
+ * The coefficients of all polynomials are given back to back in one flat
+ * array, degree + 1 per polynomial, and the roots come back in compressed
+ * sparse row form: the roots of polynomial i are
+ * roots[offsets[i]], ..., roots[offsets[i + 1] - 1], in increasing order
+ * and without duplicates.  Polynomials that vanish identically, for which
+ * the single polynomial solvers throw infinite_root_error, get no roots.
+ *
+ * The polynomials are split evenly among `num_threads` threads; 0 means
+ * one per hardware thread.  Each thread reuses its coefficient and root
+ * buffers, so the cost per polynomial is that of the solve.
+ */
+template <typename Scalar>
+class BatchPolynomialRootFinder
+{
+public:
+    /**
+     * Power basis coefficients, from zero to degree.  Degrees up to 4 are
+     * solved in closed form by PolynomialRootFinder, higher degrees by
+     * BernsteinRootFinder.
+     */
+    static void find_real_roots_in_interval(int degree,
+        const std::vector<Scalar>& coeffs,
+        std::vector<int>& offsets,
+        std::vector<Scalar>& roots,
+        const Scalar t0,
+        const Scalar t1,
+        const Scalar eps,
+        int num_threads = 0)
+    {
+        solve(degree,
+            coeffs,
+            offsets,
+            roots,
+            num_threads,
+            [=](const std::vector<Scalar>& c, std::vector<Scalar>& r) {
+                switch (degree) {
+                case 0:
+                    PolynomialRootFinder<Scalar, 0>::find_real_roots_in_interval(c, r, t0, t1, eps);
+                    break;
+                case 1:
+                    PolynomialRootFinder<Scalar, 1>::find_real_roots_in_interval(c, r, t0, t1, eps);
+                    break;
+                case 2:
+                    PolynomialRootFinder<Scalar, 2>::find_real_roots_in_interval(c, r, t0, t1, eps);
+                    break;
+                case 3:
+                    PolynomialRootFinder<Scalar, 3>::find_real_roots_in_interval(c, r, t0, t1, eps);
+                    break;
+                case 4:
+                    PolynomialRootFinder<Scalar, 4>::find_real_roots_in_interval(c, r, t0, t1, eps);
+                    break;
+                default:
+                    BernsteinRootFinder<Scalar>::find_real_roots_in_interval(c, r, t0, t1, eps);
+                }
+            });
+    }
+
+    /**
+     * Bernstein coefficients over [t0, t1], solved by BernsteinRootFinder.
+     */
+    static void find_real_roots_in_bernstein_form(int degree,
+        const std::vector<Scalar>& coeffs,
+        std::vector<int>& offsets,
+        std::vector<Scalar>& roots,
+        const Scalar t0,
+        const Scalar t1,
+        const Scalar eps,
+        int num_threads = 0)
+    {
+        solve(degree,
+            coeffs,
+            offsets,
+            roots,
+            num_threads,
+            [=](const std::vector<Scalar>& c, std::vector<Scalar>& r) {
+                BernsteinRootFinder<Scalar>::find_real_roots_in_bernstein_form(c, r, t0, t1, eps);
+            });
+    }
+
+private:
+    template <typename Solver>
+    static void solve(int degree,
+        const std::vector<Scalar>& coeffs,
+        std::vector<int>& offsets,
+        std::vector<Scalar>& roots,
+        int num_threads,
+        const Solver& solver)
+    {
+        if (degree < 0) {
+            throw invalid_setting_error("Polynomial degree must be non-negative.");
+        }
+        const size_t stride = static_cast<size_t>(degree) + 1;
+        if (coeffs.size() % stride != 0) {
+            throw invalid_setting_error("Expecting degree + 1 coefficients per polynomial.");
+        }
+        const int num_polynomials = static_cast<int>(coeffs.size() / stride);
+
+        // parallel_for hands out contiguous chunks, so each chunk appends its
+        // roots to the buffer of its first polynomial and concatenating the
+        // buffers in order yields the roots of all polynomials in order.
+        std::vector<int> counts(static_cast<size_t>(num_polynomials));
+        std::vector<std::vector<Scalar>> chunk_roots(static_cast<size_t>(num_polynomials));
+        internal::parallel_for(num_polynomials, num_threads, [&](int begin, int end) {
+            std::vector<Scalar>& chunk = chunk_roots[static_cast<size_t>(begin)];
+            std::vector<Scalar> c(stride);
+            std::vector<Scalar> r;
+            for (int i = begin; i < end; i++) {
+                const Scalar* first = coeffs.data() + static_cast<size_t>(i) * stride;
+                std::copy(first, first + stride, c.begin());
+                r.clear();
+                try {
+                    solver(c, r);
+                } catch (infinite_root_error&) {
+                    r.clear();
+                }
+                std::sort(r.begin(), r.end());
+                r.erase(std::unique(r.begin(), r.end()), r.end());
+                counts[static_cast<size_t>(i)] = static_cast<int>(r.size());
+                chunk.insert(chunk.end(), r.begin(), r.end());
+            }
+        });
+
+        offsets.resize(static_cast<size_t>(num_polynomials) + 1);
+        offsets[0] = 0;
+        for (size_t i = 0; i < counts.size(); i++) {
+            offsets[i + 1] = offsets[i] + counts[i];
+        }
+        roots.clear();
+        roots.reserve(static_cast<size_t>(offsets.back()));
+        for (const auto& chunk : chunk_roots) {
+            roots.insert(roots.end(), chunk.begin(), chunk.end());
+        }
+    }
+};
+
+} // namespace nanospline
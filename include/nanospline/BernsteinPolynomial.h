@@ -0,0 +1,320 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <nanospline/Exceptions.h>
+#include <nanospline/PolynomialRootFinder.h>
+#include <nanospline/internal/bernstein.h>
+
+namespace nanospline {
+
+template <typename _Scalar, int _dim, int _degree, bool _generic>
+class Bezier;
+
+template <typename _Scalar, int _dim, int _degree, bool _generic>
+class RationalBezier;
+
+/**
+ * Polynomial in Bernstein form over [lower, upper], scalar or vector
+ * valued, with one coefficient per row and one column per component:
+ *
+ *   p(t) = sum_i b_i C(d, i) s^i (1 - s)^(d - i),  s = (t - lower) / (upper - lower).
+ *
+ * A Bezier curve is such a polynomial over [0, 1] with its control points
+ * as coefficients.  Sums, products, derivatives and restrictions stay in
+ * Bernstein form and only take binomial weighted sums of coefficients, so
+ * the polynomials behind geometric queries, e.g. x' y'' - y' x'' for the
+ * inflections or |C'|^2 for the singularities, are built without
+ * expanding them symbolically and are solved by BernsteinRootFinder.
+ *
+ * Operands of binary operations must share the domain; the lower degree
+ * operand is elevated for sums.  A scalar operand of a product scales
+ * every component of the other.
+ */
+template <typename _Scalar>
+class BernsteinPolynomial
+{
+public:
+    using Scalar = _Scalar;
+    using Coefficients = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+    using Value = Eigen::Matrix<Scalar, 1, Eigen::Dynamic>;
+
+public:
+    /**
+     * The scalar zero polynomial over [0, 1].
+     */
+    BernsteinPolynomial()
+        : m_coeffs(Coefficients::Zero(1, 1))
+    {}
+
+    explicit BernsteinPolynomial(Coefficients coeffs, Scalar lower = 0, Scalar upper = 1)
+        : m_coeffs(std::move(coeffs))
+        , m_lower(lower)
+        , m_upper(upper)
+    {
+        if (m_coeffs.rows() == 0 || m_coeffs.cols() == 0) {
+            throw invalid_setting_error("Bernstein polynomial needs at least one coefficient.");
+        }
+        if (!(m_lower < m_upper)) {
+            throw invalid_setting_error("Bernstein polynomial domain is empty.");
+        }
+    }
+
+    /**
+     * The curve itself, over [0, 1].
+     */
+    template <int _dim, int _degree, bool _generic>
+    explicit BernsteinPolynomial(const Bezier<Scalar, _dim, _degree, _generic>& curve)
+        : BernsteinPolynomial(Coefficients(curve.get_control_points()))
+    {}
+
+    /**
+     * The homogeneous curve (x w, y w, ..., w), over [0, 1], built from the
+     * control points and weights.  Its first components divided by the
+     * last one give the curve.
+     */
+    template <int _dim, int _degree, bool _generic>
+    explicit BernsteinPolynomial(const RationalBezier<Scalar, _dim, _degree, _generic>& curve)
+    {
+        const auto& ctrl_pts = curve.get_control_points();
+        const auto& weights = curve.get_weights();
+        m_coeffs.resize(ctrl_pts.rows(), ctrl_pts.cols() + 1);
+        m_coeffs.leftCols(ctrl_pts.cols()) = ctrl_pts.array().colwise() * weights.array();
+        m_coeffs.col(ctrl_pts.cols()) = weights;
+    }
+
+public:
+    int get_degree() const { return static_cast<int>(m_coeffs.rows()) - 1; }
+    int get_dim() const { return static_cast<int>(m_coeffs.cols()); }
+    const Coefficients& get_coefficients() const { return m_coeffs; }
+    Scalar get_domain_lower_bound() const { return m_lower; }
+    Scalar get_domain_upper_bound() const { return m_upper; }
+
+    /**
+     * Evaluate by de Casteljau's algorithm.
+     */
+    Value evaluate(Scalar t) const
+    {
+        const Scalar s = (t - m_lower) / (m_upper - m_lower);
+        Coefficients c = m_coeffs;
+        for (Eigen::Index r = 1; r < c.rows(); r++) {
+            for (Eigen::Index i = 0; i + r < c.rows(); i++) {
+                c.row(i) = (1 - s) * c.row(i) + s * c.row(i + 1);
+            }
+        }
+        return c.row(0);
+    }
+
+    /**
+     * Components first, ..., first + count - 1.
+     */
+    BernsteinPolynomial components(int first, int count = 1) const
+    {
+        if (first < 0 || count < 1 || first + count > get_dim()) {
+            throw invalid_setting_error("Component index out of range.");
+        }
+        return BernsteinPolynomial(m_coeffs.middleCols(first, count), m_lower, m_upper);
+    }
+
+    /**
+     * Derivative with respect to t, of degree d - 1.  The derivative of a
+     * constant is the zero constant.
+     */
+    BernsteinPolynomial derivative() const
+    {
+        if (get_degree() == 0) {
+            return BernsteinPolynomial(
+                Coefficients::Zero(1, m_coeffs.cols()), m_lower, m_upper);
+        }
+        return BernsteinPolynomial(
+            internal::bernstein_derivative(m_coeffs) / (m_upper - m_lower), m_lower, m_upper);
+    }
+
+    /**
+     * The same polynomial written with degree d + r.
+     */
+    BernsteinPolynomial elevate_degree(int r = 1) const
+    {
+        if (r < 0) {
+            throw invalid_setting_error("Degree elevation must be non-negative.");
+        }
+        if (r == 0) return *this;
+        const Coefficients one = Coefficients::Ones(r + 1, 1);
+        return BernsteinPolynomial(internal::bernstein_product(one, m_coeffs), m_lower, m_upper);
+    }
+
+    /**
+     * The same polynomial in Bernstein form over [t0, t1], obtained by two
+     * de Casteljau subdivisions.  [t0, t1] need not lie within the domain.
+     */
+    BernsteinPolynomial subpolynomial(Scalar t0, Scalar t1) const
+    {
+        if (!(t0 < t1)) {
+            throw invalid_setting_error("Invalid sub-domain.");
+        }
+        const Scalar h = m_upper - m_lower;
+        const Scalar s0 = (t0 - m_lower) / h;
+        const Scalar s1 = (t1 - m_lower) / h;
+
+        // Cut at one end, then at the other end in the parameter of the
+        // part kept, starting with the cut that leaves the longer part.
+        Coefficients c = m_coeffs;
+        if (s1 >= 1 - s0) {
+            subdivide(c, s1, true);
+            subdivide(c, s0 / s1, false);
+        } else {
+            subdivide(c, s0, false);
+            subdivide(c, (s1 - s0) / (1 - s0), true);
+        }
+        return BernsteinPolynomial(std::move(c), t0, t1);
+    }
+
+    /**
+     * Dot product of two vector valued polynomials, of degree m + n.
+     */
+    BernsteinPolynomial dot(const BernsteinPolynomial& other) const
+    {
+        check_domain(other);
+        if (get_dim() != other.get_dim()) {
+            throw invalid_setting_error("Dimension mismatch.");
+        }
+        const auto c = internal::bernstein_dot(m_coeffs, other.m_coeffs);
+        return BernsteinPolynomial(
+            Eigen::Map<const Coefficients>(c.data(), static_cast<Eigen::Index>(c.size()), 1),
+            m_lower,
+            m_upper);
+    }
+
+    /**
+     * x0 y1 - y0 x1 of two planar polynomials, of degree m + n.
+     */
+    BernsteinPolynomial cross(const BernsteinPolynomial& other) const
+    {
+        if (get_dim() != 2 || other.get_dim() != 2) {
+            throw invalid_setting_error("Cross product is for 2D polynomials only.");
+        }
+        return components(0) * other.components(1) - components(1) * other.components(0);
+    }
+
+    /**
+     * Sorted roots of a scalar polynomial within its domain.  Throws
+     * infinite_root_error if no coefficient exceeds eps in magnitude.
+     * Scaling a polynomial does not move its roots, so by default only
+     * the zero polynomial is taken to vanish.
+     */
+    std::vector<Scalar> compute_roots(Scalar eps = 0) const
+    {
+        if (get_dim() != 1) {
+            throw invalid_setting_error("Roots are for scalar polynomials only.");
+        }
+        const std::vector<Scalar> c(m_coeffs.data(), m_coeffs.data() + m_coeffs.size());
+        std::vector<Scalar> roots;
+        BernsteinRootFinder<Scalar>::find_real_roots_in_bernstein_form(
+            c, roots, m_lower, m_upper, eps);
+        return roots;
+    }
+
+public:
+    BernsteinPolynomial operator-() const
+    {
+        return BernsteinPolynomial(-m_coeffs, m_lower, m_upper);
+    }
+
+    BernsteinPolynomial operator+(const BernsteinPolynomial& other) const
+    {
+        return add(other, 1);
+    }
+
+    BernsteinPolynomial operator-(const BernsteinPolynomial& other) const
+    {
+        return add(other, -1);
+    }
+
+    /**
+     * Product, of degree m + n, in O(mn).  One operand must be scalar or
+     * both must have the same dimension, in which case the product is
+     * taken component by component.
+     */
+    BernsteinPolynomial operator*(const BernsteinPolynomial& other) const
+    {
+        check_domain(other);
+        if (get_dim() == 1) {
+            return BernsteinPolynomial(
+                internal::bernstein_product(m_coeffs, other.m_coeffs), m_lower, m_upper);
+        }
+        if (other.get_dim() == 1) {
+            return other * *this;
+        }
+        if (get_dim() != other.get_dim()) {
+            throw invalid_setting_error("Dimension mismatch.");
+        }
+        Coefficients c(get_degree() + other.get_degree() + 1, get_dim());
+        for (Eigen::Index i = 0; i < c.cols(); i++) {
+            c.col(i) = internal::bernstein_product(m_coeffs.col(i), other.m_coeffs.col(i));
+        }
+        return BernsteinPolynomial(std::move(c), m_lower, m_upper);
+    }
+
+    BernsteinPolynomial operator*(Scalar a) const
+    {
+        return BernsteinPolynomial(m_coeffs * a, m_lower, m_upper);
+    }
+
+    friend BernsteinPolynomial operator*(Scalar a, const BernsteinPolynomial& p) { return p * a; }
+
+private:
+    void check_domain(const BernsteinPolynomial& other) const
+    {
+        if (m_lower != other.m_lower || m_upper != other.m_upper) {
+            throw invalid_setting_error("Bernstein polynomials have different domains.");
+        }
+    }
+
+    BernsteinPolynomial add(const BernsteinPolynomial& other, Scalar sign) const
+    {
+        check_domain(other);
+        if (get_dim() != other.get_dim()) {
+            throw invalid_setting_error("Dimension mismatch.");
+        }
+        const int degree = std::max(get_degree(), other.get_degree());
+        const auto a = elevate_degree(degree - get_degree());
+        const auto b = other.elevate_degree(degree - other.get_degree());
+        return BernsteinPolynomial(a.m_coeffs + sign * b.m_coeffs, m_lower, m_upper);
+    }
+
+    /**
+     * Replace c by the coefficients of its part over [0, s] (left) or
+     * [s, 1] (right).
+     */
+    static void subdivide(Coefficients& c, Scalar s, bool left)
+    {
+        const Eigen::Index n = c.rows();
+        if (left) {
+            // The left part is the first point of every de Casteljau level,
+            // computed in place from the back.
+            for (Eigen::Index r = 1; r < n; r++) {
+                for (Eigen::Index i = n - 1; i >= r; i--) {
+                    c.row(i) = (1 - s) * c.row(i - 1) + s * c.row(i);
+                }
+            }
+        } else {
+            // The right part is the last point of every level.
+            for (Eigen::Index r = 1; r < n; r++) {
+                for (Eigen::Index i = 0; i + r < n; i++) {
+                    c.row(i) = (1 - s) * c.row(i) + s * c.row(i + 1);
+                }
+            }
+        }
+    }
+
+private:
+    Coefficients m_coeffs;
+    Scalar m_lower = 0;
+    Scalar m_upper = 1;
+};
+
+} // namespace nanospline
@@ -12,12 +12,9 @@
 #include <Eigen/src/QR/CompleteOrthogonalDecomposition.h>
 #include <nanospline/BezierBase.h>
 #include <nanospline/Exceptions.h>
-
-#if NANOSPLINE_SYMPY
-#include <nanospline/internal/auto_inflection_Bezier.h>
-#include <nanospline/internal/auto_match_tangent_Bezier.h>
-#include <nanospline/internal/auto_singularity_Bezier.h>
-#endif
+#include <nanospline/internal/closest_point.h>
+#include <nanospline/internal/cubic_bezier_kernel.h>
+#include <nanospline/internal/curve_polynomials.h>
 
 namespace nanospline {
 
@@ -31,22 +28,53 @@ public:
     using Point = typename Base::Point;
     using ControlPoints = typename Base::ControlPoints;
     using BlossomVector = typename Base::BlossomVector;
+    using ScratchControlPoints = typename Base::ScratchControlPoints;
+    using ParameterVector = typename Base::ParameterVector;
+    using PointMatrix = typename Base::PointMatrix;
 
 public:
     Bezier() = default;
-    Point evaluate(Scalar t) const override
+    Point evaluate(Scalar t) const override { return evaluate_hodograph(t, 0); }
+
+    Point evaluate(Scalar t, EvaluationWorkspace<Scalar>& workspace) const override
     {
-        int curve_degree = Base::get_degree();
-        ControlPoints control_pts(Base::m_control_points);
-        return deBoor(t, curve_degree, control_pts);
+        if (Base::use_power_basis()) return Base::evaluate_power_basis(t, 0);
+        auto control_pts =
+            workspace.template get_matrix<_dim>(0, Base::m_control_points.rows());
+        control_pts = Base::m_control_points;
+        return deBoor(t, Base::get_degree(), control_pts);
+    }
+
+    /**
+     * Evaluate the blossom b[t_1, ..., t_d] of the curve, where d is its
+     * degree and `blossom_vector` = [t_1, ..., t_d].  b[t, ..., t] is the
+     * point at t.
+     */
+    template <typename Derived>
+    Point blossom(const Eigen::MatrixBase<Derived>& blossom_vector,
+        EvaluationWorkspace<Scalar>& workspace) const
+    {
+        const int curve_degree = Base::get_degree();
+        assert(blossom_vector.size() == curve_degree);
+        auto control_pts = workspace.template get_matrix<_dim>(0, curve_degree + 1);
+        control_pts = Base::m_control_points;
+        blossom(blossom_vector, curve_degree, control_pts);
+        return control_pts.row(curve_degree);
     }
 
+    using Base::inverse_evaluate;
+
     Scalar inverse_evaluate(const Point& p) const override
     {
-        throw not_implemented_error("Too complex, sigh");
+        Scalar t = 0;
+        Scalar sq_dist = std::numeric_limits<Scalar>::max();
+        internal::bezier_closest_point(Base::m_control_points, p, Scalar(0), Scalar(1), t, sq_dist);
+        return t;
     }
 
-    void get_derivative_coefficients(int curve_degree, ControlPoints& control_pts) const
+    template <typename Derived>
+    void get_derivative_coefficients(
+        int curve_degree, Eigen::MatrixBase<Derived>& control_pts) const
     {
         int deriv_degree = curve_degree - 1;
 
@@ -55,45 +83,60 @@ public:
         }
     }
 
-    Point evaluate_derivative(Scalar t) const override
-    {
-        const auto curve_degree = Base::get_degree();
-        assert(curve_degree >= 0);
-
-        if (curve_degree == 0) return Point::Zero();
+    Point evaluate_derivative(Scalar t) const override { return evaluate_hodograph(t, 1); }
 
-        const int deriv_degree = curve_degree - 1;
+    Point evaluate_2nd_derivative(Scalar t) const override { return evaluate_hodograph(t, 2); }
 
-        // Get control points defining the derivative
-        ControlPoints control_pts(Base::m_control_points);
-        get_derivative_coefficients(curve_degree, control_pts);
+    using Base::batch_evaluate;
+    using Base::batch_evaluate_derivative;
+    using Base::batch_evaluate_2nd_derivative;
 
-        // Evaluate the derivative curve
-        return deBoor(t, deriv_degree, control_pts);
+    void batch_evaluate(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        if (Base::use_power_basis()) {
+            Base::batch_evaluate_power_basis(ts, 0, out);
+            return;
+        }
+        batch_deBoor(ts, Base::get_degree(), Base::m_control_points, out);
     }
 
-    Point evaluate_2nd_derivative(Scalar t) const override
+    void batch_evaluate_derivative(const ParameterVector& ts, PointMatrix& out) const override
     {
+        if (Base::use_power_basis()) {
+            Base::batch_evaluate_power_basis(ts, 1, out);
+            return;
+        }
         const auto curve_degree = Base::get_degree();
-        assert(curve_degree >= 0);
+        if (curve_degree == 0) {
+            out.setZero(ts.size(), _dim);
+            return;
+        }
 
-        if (curve_degree <= 1) return Point::Zero();
+        ControlPoints control_pts(Base::m_control_points);
+        get_derivative_coefficients(curve_degree, control_pts);
+        batch_deBoor(ts, curve_degree - 1, control_pts, out);
+    }
 
-        const int deriv_degree = curve_degree - 1;
-        const int deriv2_degree = curve_degree - 2;
+    void batch_evaluate_2nd_derivative(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        if (Base::use_power_basis()) {
+            Base::batch_evaluate_power_basis(ts, 2, out);
+            return;
+        }
+        const auto curve_degree = Base::get_degree();
+        if (curve_degree <= 1) {
+            out.setZero(ts.size(), _dim);
+            return;
+        }
 
-        // Get control points defining the second derivative
         ControlPoints control_pts(Base::m_control_points);
         get_derivative_coefficients(curve_degree, control_pts);
-        get_derivative_coefficients(deriv_degree, control_pts);
-
-        // Evaluate the second derivative curve
-        return deBoor(t, deriv2_degree, control_pts);
+        get_derivative_coefficients(curve_degree - 1, control_pts);
+        batch_deBoor(ts, curve_degree - 2, control_pts, out);
     }
 
     std::vector<Scalar> compute_inflections(const Scalar lower, const Scalar upper) const override
     {
-#if NANOSPLINE_SYMPY
         if (_dim != 2) {
             throw std::runtime_error("Inflection computation is for 2D curves only");
         }
@@ -104,8 +147,11 @@ public:
         std::vector<Scalar> res;
 
         try {
-            res = nanospline::internal::compute_Bezier_inflections(
-                Base::m_control_points, lower, upper);
+            res = internal::bernstein_roots_in_range(
+                internal::bezier_inflection_polynomial(Base::m_control_points),
+                lower,
+                upper,
+                true);
         } catch (infinite_root_error&) {
             // Infinitely many inflections.
             res.clear();
@@ -115,10 +161,6 @@ public:
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
     Scalar get_turning_angle(Scalar t0, Scalar t1) const override
@@ -140,7 +182,6 @@ public:
 
     std::vector<Scalar> reduce_turning_angle(const Scalar lower, const Scalar upper) const override
     {
-#if NANOSPLINE_SYMPY
         constexpr Scalar tol = static_cast<Scalar>(1e-8);
         if (_dim != 2) {
             throw std::runtime_error("Turning angle reduction is for 2D curves only");
@@ -167,8 +208,10 @@ public:
 
         std::vector<Scalar> res;
         try {
-            res = nanospline::internal::match_tangent_bezier(
-                Base::m_control_points, degree, ave_tangent, lower, upper);
+            res = internal::bernstein_roots_in_range(
+                internal::bezier_tangent_polynomial(Base::m_control_points, ave_tangent),
+                lower,
+                upper);
         } catch (infinite_root_error&) {
             res.clear();
         }
@@ -177,31 +220,28 @@ public:
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
     std::vector<Scalar> compute_singularities(
         const Scalar lower = 0.0, const Scalar upper = 1.0) const override
     {
-#if NANOSPLINE_SYMPY
         if (_dim != 2) {
             throw std::runtime_error("Singularity computation is for 2D curves only");
         }
 
-        std::vector<Scalar> res = nanospline::internal::compute_Bezier_singularities(
-            Base::m_control_points, lower, upper);
+        std::vector<Scalar> res;
+        try {
+            res = internal::bernstein_roots_in_range(
+                internal::bezier_singularity_polynomial(Base::m_control_points), lower, upper);
+        } catch (infinite_root_error&) {
+            // Collapsed to a point.
+            res.clear();
+        }
 
         std::sort(res.begin(), res.end());
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
     /**
@@ -249,41 +289,21 @@ public:
      */
     ThisType subcurve(Scalar t0, Scalar t1) const
     {
-        if (t0 > t1) {
-            throw invalid_setting_error("t0 must be smaller than t1");
-        }
-        if (t0 < 0 || t0 > 1 || t1 < 0 || t1 > 1) {
-            throw invalid_setting_error("Invalid range");
-        }
-        // To get the coefficients of a subcurve defined on a subdomain
-        // [t0,t1], each coefficient is given by a blossom:
-        //    c_i = b[t0, ..., t0, t1, ..., t1]
-        //             |________|   |________|
-        //              =degree-i       =i
-        // for i = 0, ... ,degree
-
-        const auto curve_degree = Base::get_degree();
-        ControlPoints subcurve_control_pts(curve_degree + 1, _dim);
-
-        for (int i = 0; i < curve_degree + 1; i++) {
-            // Form the blossom vector [t0, ..., t0, t1, ..., t1]
-            BlossomVector blossom_vector(curve_degree);
-            blossom_vector.setConstant(t1);
-
-            for (int j = 0; j < i; j++) {
-                blossom_vector(j) = t0;
-            }
-            // Evaluate the blossom
-            ControlPoints control_points(Base::m_control_points);
-            blossom(blossom_vector, curve_degree, control_points);
-
-            subcurve_control_pts.row(curve_degree - i) = control_points.row(curve_degree);
-        }
-
-        ThisType subcurve;
-        subcurve.set_control_points(subcurve_control_pts);
+        BlossomVector blossom_vector(Base::get_degree());
+        ControlPoints control_pts(Base::m_control_points.rows(), _dim);
+        return subcurve(t0, t1, blossom_vector, control_pts);
+    }
 
-        return subcurve;
+    /**
+     * Same as subcurve(t0, t1), with the scratch space borrowed from
+     * `workspace`.
+     */
+    ThisType subcurve(Scalar t0, Scalar t1, EvaluationWorkspace<Scalar>& workspace) const
+    {
+        const int curve_degree = Base::get_degree();
+        auto blossom_vector = workspace.get_vector(1, curve_degree);
+        auto control_pts = workspace.template get_matrix<_dim>(0, curve_degree + 1);
+        return subcurve(t0, t1, blossom_vector, control_pts);
     }
 
     /**
@@ -368,7 +388,83 @@ public:
     }
 
 private:
-    void blossom(BlossomVector blossom_vector, int degree, ControlPoints& control_pts) const
+    /**
+     * Evaluate the `order`-th derivative with de Casteljau's algorithm on a
+     * scratch copy of the control points.  Generic curves keep the copy on
+     * the stack unless their degree exceeds internal::MAX_STACK_DEGREE, so
+     * evaluation does not touch the heap.
+     */
+    Point evaluate_hodograph(Scalar t, int order) const
+    {
+        if (Base::use_power_basis()) {
+            return Base::evaluate_power_basis(t, order);
+        } else if (Base::get_degree() <= internal::MAX_STACK_DEGREE) {
+            return evaluate_hodograph<ScratchControlPoints>(t, order);
+        } else {
+            return evaluate_hodograph<ControlPoints>(t, order);
+        }
+    }
+
+    template <typename Scratch>
+    Point evaluate_hodograph(Scalar t, int order) const
+    {
+        const int curve_degree = Base::get_degree();
+        assert(curve_degree >= 0);
+        if (order > curve_degree) return Point::Zero();
+
+        // Get control points defining the derivative curve.
+        Scratch control_pts(Base::m_control_points);
+        for (int i = 0; i < order; i++) {
+            get_derivative_coefficients(curve_degree - i, control_pts);
+        }
+
+        return deBoor(t, curve_degree - order, control_pts);
+    }
+
+    template <typename BlossomDerived, typename PointsDerived>
+    ThisType subcurve(Scalar t0,
+        Scalar t1,
+        Eigen::MatrixBase<BlossomDerived>& blossom_vector,
+        Eigen::MatrixBase<PointsDerived>& control_pts) const
+    {
+        if (t0 > t1) {
+            throw invalid_setting_error("t0 must be smaller than t1");
+        }
+        if (t0 < 0 || t0 > 1 || t1 < 0 || t1 > 1) {
+            throw invalid_setting_error("Invalid range");
+        }
+        // To get the coefficients of a subcurve defined on a subdomain
+        // [t0,t1], each coefficient is given by a blossom:
+        //    c_i = b[t0, ..., t0, t1, ..., t1]
+        //             |________|   |________|
+        //              =degree-i       =i
+        // for i = 0, ... ,degree
+
+        const auto curve_degree = Base::get_degree();
+        ControlPoints subcurve_control_pts(curve_degree + 1, _dim);
+
+        for (int i = 0; i < curve_degree + 1; i++) {
+            // Form the blossom vector [t0, ..., t0, t1, ..., t1]
+            blossom_vector.head(i).setConstant(t0);
+            blossom_vector.tail(curve_degree - i).setConstant(t1);
+
+            // Evaluate the blossom
+            control_pts = Base::m_control_points;
+            blossom(blossom_vector, curve_degree, control_pts);
+
+            subcurve_control_pts.row(curve_degree - i) = control_pts.row(curve_degree);
+        }
+
+        ThisType subcurve;
+        subcurve.set_control_points(std::move(subcurve_control_pts));
+
+        return subcurve;
+    }
+
+    template <typename Derived, typename PointsDerived>
+    void blossom(const Eigen::MatrixBase<Derived>& blossom_vector,
+        int degree,
+        Eigen::MatrixBase<PointsDerived>& control_pts) const
     {
         // Unfurl the standard de Boor recursion into two loops:
         // if degree == 0
@@ -389,21 +485,36 @@ private:
         }
     }
 
-    Point deBoor(Scalar t, int degree, ControlPoints& control_pts) const
+    template <typename PointsDerived>
+    Point deBoor(Scalar t, int degree, Eigen::MatrixBase<PointsDerived>& control_pts) const
     {
         // This function returns the degree+1 control points of a Bezier curve
         // of degree "degree" after applying "degree" iterations of deBoor's
         // algorithm
         if (degree > 0) {
-            // Set t_i=t for all blossom evaluation points
-            BlossomVector blossom_vector(Base::get_degree());
-            blossom_vector.setConstant(t);
-
-            // Evaluate the blossom
-            blossom(blossom_vector, degree, control_pts);
+            // Set t_i=t for all blossom evaluation points.  The constant
+            // expression is never materialized, so this does not allocate.
+            blossom(BlossomVector::Constant(Base::get_degree(), t), degree, control_pts);
         }
         return control_pts.row(degree);
     }
+
+    /**
+     * Evaluate the Bezier curve of degree `degree` defined by `coeffs` at each
+     * entry of `ts`, reusing a single scratch copy of the coefficients.
+     */
+    void batch_deBoor(const ParameterVector& ts,
+        int degree,
+        const ControlPoints& coeffs,
+        PointMatrix& out) const
+    {
+        out.resize(ts.size(), _dim);
+        ControlPoints control_pts(coeffs);
+        for (Eigen::Index i = 0; i < ts.size(); i++) {
+            control_pts = coeffs;
+            out.row(i) = deBoor(ts[i], degree, control_pts);
+        }
+    }
 };
 
 template <typename _Scalar, int _dim>
@@ -418,12 +529,26 @@ public:
 public:
     Point evaluate(Scalar t) const override { return Base::m_control_points; }
 
+    using Base::evaluate;
+    using Base::inverse_evaluate;
+
     Scalar inverse_evaluate(const Point& p) const override { return 0.0; }
 
     Point evaluate_derivative(Scalar t) const override { return Point::Zero(); }
 
     Point evaluate_2nd_derivative(Scalar t) const override { return Point::Zero(); }
 
+    using Base::evaluate_derivatives;
+
+    /**
+     * Closed-form point and derivatives.
+     */
+    void evaluate_derivatives(
+        Scalar t, int k, typename Base::DerivativeMatrix& out) const override
+    {
+        Base::evaluate_derivatives_pointwise(*this, t, k, out);
+    }
+
     std::vector<Scalar> compute_inflections(
         const Scalar lower = 0.0, const Scalar upper = 1.0) const override
     {
@@ -471,6 +596,9 @@ public:
         return (1.0 - t) * Base::m_control_points.row(0) + t * Base::m_control_points.row(1);
     }
 
+    using Base::evaluate;
+    using Base::inverse_evaluate;
+
     Scalar inverse_evaluate(const Point& p) const override
     {
         Point e = Base::m_control_points.row(1) - Base::m_control_points.row(0);
@@ -485,6 +613,17 @@ public:
 
     Point evaluate_2nd_derivative(Scalar t) const override { return Point::Zero(); }
 
+    using Base::evaluate_derivatives;
+
+    /**
+     * Closed-form point and derivatives.
+     */
+    void evaluate_derivatives(
+        Scalar t, int k, typename Base::DerivativeMatrix& out) const override
+    {
+        Base::evaluate_derivatives_pointwise(*this, t, k, out);
+    }
+
     std::vector<Scalar> compute_inflections(
         const Scalar lower = 0.0, const Scalar upper = 1.0) const override
     {
@@ -563,9 +702,15 @@ public:
         return (1.0 - t) * p0 + t * p1;
     }
 
+    using Base::evaluate;
+    using Base::inverse_evaluate;
+
     Scalar inverse_evaluate(const Point& p) const override
     {
-        throw not_implemented_error("Too complex, sigh");
+        Scalar t = 0;
+        Scalar sq_dist = std::numeric_limits<Scalar>::max();
+        internal::bezier_closest_point(Base::m_control_points, p, Scalar(0), Scalar(1), t, sq_dist);
+        return t;
     }
 
     Point evaluate_derivative(Scalar t) const override
@@ -583,6 +728,17 @@ public:
         return 2 * (ctrl_pts.row(0) + ctrl_pts.row(2) - 2 * ctrl_pts.row(1));
     }
 
+    using Base::evaluate_derivatives;
+
+    /**
+     * Closed-form point and derivatives.
+     */
+    void evaluate_derivatives(
+        Scalar t, int k, typename Base::DerivativeMatrix& out) const override
+    {
+        Base::evaluate_derivatives_pointwise(*this, t, k, out);
+    }
+
     std::vector<Scalar> compute_inflections(
         const Scalar lower = 0.0, const Scalar upper = 1.0) const override
     {
@@ -602,7 +758,6 @@ public:
 
     std::vector<Scalar> reduce_turning_angle(const Scalar lower, const Scalar upper) const override
     {
-#if NANOSPLINE_SYMPY
         constexpr Scalar tol = static_cast<Scalar>(1e-8);
         if (_dim != 2) {
             throw std::runtime_error("Turning angle reduction is for 2D curves only");
@@ -625,13 +780,8 @@ public:
 
         std::vector<Scalar> res;
         try {
-            res = nanospline::internal::match_tangent_Bezier_degree_2(Base::m_control_points(0, 0),
-                Base::m_control_points(0, 1),
-                Base::m_control_points(1, 0),
-                Base::m_control_points(1, 1),
-                Base::m_control_points(2, 0),
-                Base::m_control_points(2, 1),
-                ave_tangent,
+            res = internal::bernstein_roots_in_range(
+                internal::bezier_tangent_polynomial(Base::m_control_points, ave_tangent),
                 lower,
                 upper);
         } catch (infinite_root_error&) {
@@ -642,37 +792,27 @@ public:
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
     std::vector<Scalar> compute_singularities(const Scalar lower, const Scalar upper) const override
     {
-#if NANOSPLINE_SYMPY
         if (_dim != 2) {
             throw std::runtime_error("Singularity computation is for 2D curves only");
         }
 
-        auto res = nanospline::internal::compute_Bezier_degree_2_singularities(
-            Base::m_control_points(0, 0),
-            Base::m_control_points(0, 1),
-            Base::m_control_points(1, 0),
-            Base::m_control_points(1, 1),
-            Base::m_control_points(2, 0),
-            Base::m_control_points(2, 1),
-            lower,
-            upper);
+        std::vector<Scalar> res;
+        try {
+            res = internal::bernstein_roots_in_range(
+                internal::bezier_singularity_polynomial(Base::m_control_points), lower, upper);
+        } catch (infinite_root_error&) {
+            // Collapsed to a point.
+            res.clear();
+        }
 
         std::sort(res.begin(), res.end());
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
 public:
@@ -731,65 +871,75 @@ public:
 public:
     Point evaluate(Scalar t) const override
     {
-        const Point q0 =
-            (1.0 - t) * Base::m_control_points.row(0) + t * Base::m_control_points.row(1);
-        const Point q1 =
-            (1.0 - t) * Base::m_control_points.row(1) + t * Base::m_control_points.row(2);
-        const Point q2 =
-            (1.0 - t) * Base::m_control_points.row(2) + t * Base::m_control_points.row(3);
-
-        const Point p0 = (1.0 - t) * q0 + t * q1;
-        const Point p1 = (1.0 - t) * q1 + t * q2;
-        return (1.0 - t) * p0 + t * p1;
+        if (Base::use_power_basis()) return Base::evaluate_power_basis(t, 0);
+        const auto& ctrl_pts = Base::m_control_points;
+        return internal::cubic_bezier_evaluate<Point>(
+            t, ctrl_pts.row(0), ctrl_pts.row(1), ctrl_pts.row(2), ctrl_pts.row(3));
     }
 
+    using Base::evaluate;
+    using Base::inverse_evaluate;
+
     Scalar inverse_evaluate(const Point& p) const override
     {
-        throw not_implemented_error("Too complex, sigh");
+        Scalar t = 0;
+        Scalar sq_dist = std::numeric_limits<Scalar>::max();
+        internal::bezier_closest_point(Base::m_control_points, p, Scalar(0), Scalar(1), t, sq_dist);
+        return t;
     }
 
     Point evaluate_derivative(Scalar t) const override
     {
-        const Point q0 =
-            (1.0 - t) * Base::m_control_points.row(0) + t * Base::m_control_points.row(1);
-        const Point q1 =
-            (1.0 - t) * Base::m_control_points.row(1) + t * Base::m_control_points.row(2);
-        const Point q2 =
-            (1.0 - t) * Base::m_control_points.row(2) + t * Base::m_control_points.row(3);
-
-        const Point p0 = (1.0 - t) * q0 + t * q1;
-        const Point p1 = (1.0 - t) * q1 + t * q2;
-
-        return (p1 - p0) * 3;
+        if (Base::use_power_basis()) return Base::evaluate_power_basis(t, 1);
+        const auto& ctrl_pts = Base::m_control_points;
+        return internal::cubic_bezier_derivative<Point>(
+            t, ctrl_pts.row(0), ctrl_pts.row(1), ctrl_pts.row(2), ctrl_pts.row(3));
     }
 
     Point evaluate_2nd_derivative(Scalar t) const override
     {
-        const Point q0 =
-            (1.0 - t) * Base::m_control_points.row(0) + t * Base::m_control_points.row(1);
-        const Point q1 =
-            (1.0 - t) * Base::m_control_points.row(1) + t * Base::m_control_points.row(2);
-        const Point q2 =
-            (1.0 - t) * Base::m_control_points.row(2) + t * Base::m_control_points.row(3);
-        return 6 * (q0 + q2 - 2 * q1);
+        if (Base::use_power_basis()) return Base::evaluate_power_basis(t, 2);
+        const auto& ctrl_pts = Base::m_control_points;
+        return internal::cubic_bezier_2nd_derivative<Point>(
+            t, ctrl_pts.row(0), ctrl_pts.row(1), ctrl_pts.row(2), ctrl_pts.row(3));
+    }
+
+    using Base::evaluate_derivatives;
+
+    /**
+     * Closed-form point and derivatives from a single de Casteljau pass.
+     */
+    void evaluate_derivatives(
+        Scalar t, int k, typename Base::DerivativeMatrix& out) const override
+    {
+        if (Base::use_power_basis()) {
+            Base::evaluate_derivatives_pointwise(*this, t, k, out);
+            return;
+        }
+        Base::check_derivative_order(k);
+        const auto& ctrl_pts = Base::m_control_points;
+        Point d0, d1, d2;
+        internal::cubic_bezier_derivatives(
+            t, ctrl_pts.row(0), ctrl_pts.row(1), ctrl_pts.row(2), ctrl_pts.row(3), k, d0, d1, d2);
+        out.resize(k + 1, _dim);
+        out.row(0) = d0;
+        if (k >= 1) out.row(1) = d1;
+        if (k >= 2) out.row(2) = d2;
     }
 
     std::vector<Scalar> compute_inflections(const Scalar lower, const Scalar upper) const override
     {
-#if NANOSPLINE_SYMPY
+        if (_dim != 2) {
+            throw std::runtime_error("Inflection computation is for 2D curves only");
+        }
+
         std::vector<Scalar> res;
         try {
-            res = nanospline::internal::compute_Bezier_degree_3_inflections(
-                Base::m_control_points(0, 0),
-                Base::m_control_points(0, 1),
-                Base::m_control_points(1, 0),
-                Base::m_control_points(1, 1),
-                Base::m_control_points(2, 0),
-                Base::m_control_points(2, 1),
-                Base::m_control_points(3, 0),
-                Base::m_control_points(3, 1),
+            res = internal::bernstein_roots_in_range(
+                internal::bezier_inflection_polynomial(Base::m_control_points),
                 lower,
-                upper);
+                upper,
+                true);
         } catch (infinite_root_error&) {
             res.clear();
         }
@@ -798,10 +948,6 @@ public:
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
     Scalar get_turning_angle(Scalar t0, Scalar t1) const override
@@ -823,7 +969,6 @@ public:
 
     std::vector<Scalar> reduce_turning_angle(const Scalar lower, const Scalar upper) const override
     {
-#if NANOSPLINE_SYMPY
         constexpr Scalar tol = static_cast<Scalar>(1e-8);
         if (_dim != 2) {
             throw std::runtime_error("Turning angle reduction is for 2D curves only");
@@ -846,15 +991,8 @@ public:
 
         std::vector<Scalar> res;
         try {
-            res = nanospline::internal::match_tangent_Bezier_degree_3(Base::m_control_points(0, 0),
-                Base::m_control_points(0, 1),
-                Base::m_control_points(1, 0),
-                Base::m_control_points(1, 1),
-                Base::m_control_points(2, 0),
-                Base::m_control_points(2, 1),
-                Base::m_control_points(3, 0),
-                Base::m_control_points(3, 1),
-                ave_tangent,
+            res = internal::bernstein_roots_in_range(
+                internal::bezier_tangent_polynomial(Base::m_control_points, ave_tangent),
                 lower,
                 upper);
         } catch (infinite_root_error&) {
@@ -865,39 +1003,27 @@ public:
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
     std::vector<Scalar> compute_singularities(const Scalar lower, const Scalar upper) const override
     {
-#if NANOSPLINE_SYMPY
         if (_dim != 2) {
             throw std::runtime_error("Singularity computation is for 2D curves only");
         }
 
-        std::vector<Scalar> res = nanospline::internal::compute_Bezier_degree_3_singularities(
-            Base::m_control_points(0, 0),
-            Base::m_control_points(0, 1),
-            Base::m_control_points(1, 0),
-            Base::m_control_points(1, 1),
-            Base::m_control_points(2, 0),
-            Base::m_control_points(2, 1),
-            Base::m_control_points(3, 0),
-            Base::m_control_points(3, 1),
-            lower,
-            upper);
+        std::vector<Scalar> res;
+        try {
+            res = internal::bernstein_roots_in_range(
+                internal::bezier_singularity_polynomial(Base::m_control_points), lower, upper);
+        } catch (infinite_root_error&) {
+            // Collapsed to a point.
+            res.clear();
+        }
 
         std::sort(res.begin(), res.end());
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
 public:
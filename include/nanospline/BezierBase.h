@@ -1,8 +1,15 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
 #include <Eigen/Core>
 
 #include <nanospline/CurveBase.h>
+#include <nanospline/internal/basis_functions.h>
+#include <nanospline/internal/power_basis.h>
 
 namespace nanospline {
 
@@ -18,11 +25,25 @@ class BezierBase : public CurveBase<_Scalar, _dim> {
         using Point = Eigen::Matrix<Scalar, 1, _dim>;
         using ControlPoints = Eigen::Matrix<Scalar, _generic?Eigen::Dynamic:_degree+1, _dim>;
         using BlossomVector = Eigen::Matrix<Scalar, _generic?Eigen::Dynamic:_degree, 1>;
+        /**
+         * Scratch copy of the control points used during evaluation.  For
+         * generic curves it lives on the stack as long as the degree does
+         * not exceed internal::MAX_STACK_DEGREE, otherwise ControlPoints is
+         * used instead.
+         */
+        using ScratchControlPoints = typename std::conditional<_generic,
+              Eigen::Matrix<Scalar, Eigen::Dynamic, _dim, Eigen::ColMajor,
+                  internal::MAX_STACK_DEGREE+1, _dim>,
+              ControlPoints>::type;
+        using PointMatrix = typename Base::PointMatrix;
+        using DerivativeMatrix = typename Base::DerivativeMatrix;
 
     public:
         virtual ~BezierBase()=default;
         virtual Point evaluate(Scalar t) const override =0;
+        using Base::evaluate;
         virtual Scalar inverse_evaluate(const Point& p) const override =0;
+        using Base::inverse_evaluate;
         virtual Point evaluate_derivative(Scalar t) const override =0;
         virtual Point evaluate_2nd_derivative(Scalar t) const override =0;
 
@@ -63,6 +84,69 @@ class BezierBase : public CurveBase<_Scalar, _dim> {
                     "Compute singularity is not support for this curve type");
         }
 
+        using Base::evaluate_derivatives;
+
+        /**
+         * All derivatives from a single de Casteljau pass: after d-j steps,
+         * the j-th derivative is d!/(d-j)! times the j-th forward difference
+         * of the remaining j+1 points.
+         */
+        virtual void evaluate_derivatives(
+                Scalar t, int k, PointMatrix& out) const override {
+            assert(k >= 0);
+            compute_derivatives(t, k, out);
+        }
+
+        virtual void evaluate_derivatives(
+                Scalar t, int k, DerivativeMatrix& out) const override {
+            Base::check_derivative_order(k);
+            compute_derivatives(t, k, out);
+        }
+
+    private:
+        template<typename Derived>
+        void compute_derivatives(
+                Scalar t, int k, Eigen::PlainObjectBase<Derived>& out) const {
+            if (use_power_basis()) {
+                out.setZero(k+1, _dim);
+                for (int j=0; j<=std::min(k, get_degree()); j++) {
+                    out.row(j) = evaluate_power_basis(t, j);
+                }
+            } else if (get_degree() <= internal::MAX_STACK_DEGREE) {
+                de_casteljau_derivatives<ScratchControlPoints>(t, k, out);
+            } else {
+                de_casteljau_derivatives<ControlPoints>(t, k, out);
+            }
+        }
+
+        template<typename Scratch, typename Derived>
+        void de_casteljau_derivatives(
+                Scalar t, int k, Eigen::PlainObjectBase<Derived>& out) const {
+            assert(k >= 0);
+            const int d = get_degree();
+            out.setZero(k+1, _dim);
+
+            Scratch pts(m_control_points);
+            Scratch diff(m_control_points.rows(), _dim);
+            for (int j=d; j>=0; j--) {
+                // pts[0..j] hold the points after d-j de Casteljau steps.
+                if (j <= k) {
+                    diff.topRows(j+1) = pts.topRows(j+1);
+                    Scalar factor = 1;
+                    for (int r=1; r<=j; r++) {
+                        for (int i=0; i+r<=j; i++) {
+                            diff.row(i) = diff.row(i+1) - diff.row(i);
+                        }
+                        factor *= Scalar(d-r+1);
+                    }
+                    out.row(j) = factor * diff.row(0);
+                }
+                for (int i=0; i<j; i++) {
+                    pts.row(i) = (1-t) * pts.row(i) + t * pts.row(i+1);
+                }
+            }
+        }
+
     public:
         const ControlPoints& get_control_points() const {
             return m_control_points;
@@ -71,11 +155,32 @@ class BezierBase : public CurveBase<_Scalar, _dim> {
         template<typename Derived>
         void set_control_points(const Eigen::PlainObjectBase<Derived>& ctrl_pts) {
             m_control_points = ctrl_pts;
+            update_power_basis();
         }
 
         template<typename Derived>
         void set_control_points(Eigen::PlainObjectBase<Derived>&& ctrl_pts) {
             m_control_points.swap(ctrl_pts);
+            update_power_basis();
+        }
+
+        /**
+         * Choose between de Casteljau's algorithm (the default) and Horner
+         * evaluation of a cached power basis form, see EvaluationMode for
+         * the precision tradeoff.  The power basis is only stored in that
+         * mode, and is converted on first use after the control points
+         * change.  The degree 0, 1 and 2 specializations always evaluate in
+         * closed form, so for them this is a no-op and the mode stays
+         * Recursive.
+         */
+        virtual void set_evaluation_mode(EvaluationMode mode) {
+            if (CLOSED_FORM_ONLY) return;
+            m_evaluation_mode = mode;
+            update_power_basis();
+        }
+
+        virtual EvaluationMode get_evaluation_mode() const {
+            return m_evaluation_mode;
         }
 
         int get_degree() const {
@@ -95,8 +200,70 @@ class BezierBase : public CurveBase<_Scalar, _dim> {
             out << "c:\n" << m_control_points << "\n";
         }
 
+    protected:
+        bool use_power_basis() const {
+            return m_evaluation_mode == EvaluationMode::PowerBasis;
+        }
+
+        void update_power_basis() {
+            if (use_power_basis()) {
+                m_power_basis.reset(new PowerBasisCache());
+            } else {
+                m_power_basis.reset();
+            }
+        }
+
+        Point evaluate_power_basis(Scalar t, int order) const {
+            return internal::evaluate_power_basis(get_power_basis(), t, order);
+        }
+
+        void batch_evaluate_power_basis(const typename Base::ParameterVector& ts,
+                int order, PointMatrix& out) const {
+            const auto& coeffs = get_power_basis();
+            out.resize(ts.size(), _dim);
+            for (Eigen::Index i=0; i<ts.size(); i++) {
+                out.row(i) = internal::evaluate_power_basis(coeffs, ts[i], order);
+            }
+        }
+
+    private:
+        static constexpr bool CLOSED_FORM_ONLY =
+            !_generic && _degree >= 0 && _degree <= 2;
+
+        struct PowerBasisCache {
+            EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+            std::atomic<bool> ready{false};
+            std::mutex mutex;
+            ControlPoints coeffs;
+        };
+
+        /**
+         * Converted once, even if several threads evaluate concurrently.
+         * Afterwards this is a single acquire load, cheaper than
+         * std::call_once on this hot path.
+         */
+        const ControlPoints& get_power_basis() const {
+            assert(m_power_basis);
+            PowerBasisCache& cache = *m_power_basis;
+            if (!cache.ready.load(std::memory_order_acquire)) {
+                std::lock_guard<std::mutex> lock(cache.mutex);
+                if (!cache.ready.load(std::memory_order_relaxed)) {
+                    cache.coeffs = m_control_points;
+                    internal::bezier_to_power_basis(cache.coeffs);
+                    cache.ready.store(true, std::memory_order_release);
+                }
+            }
+            return cache.coeffs;
+        }
+
     protected:
         ControlPoints m_control_points;
+        EvaluationMode m_evaluation_mode = EvaluationMode::Recursive;
+
+    private:
+        // Null unless the evaluation mode is PowerBasis.  Shared by copies
+        // until either one is modified.
+        std::shared_ptr<PowerBasisCache> m_power_basis;
 };
 
 }
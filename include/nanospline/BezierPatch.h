@@ -1,7 +1,12 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include <nanospline/PatchBase.h>
 #include <nanospline/Bezier.h>
+#include <nanospline/internal/basis_functions.h>
+#include <nanospline/internal/shared_lazy.h>
 
 namespace nanospline {
 
@@ -20,6 +25,8 @@ class BezierPatch final : public PatchBase<_Scalar, _dim> {
         using ControlGrid = typename Base::ControlGrid;
         using IsoCurveU = Bezier<Scalar, _dim, _degree_u>;
         using IsoCurveV = Bezier<Scalar, _dim, _degree_v>;
+        using DerivativePatch = BezierPatch<_Scalar, _dim, -1, -1>;
+        using DerivativeMatrix = typename Base::DerivativeMatrix;
 
     public:
         static BezierPatch<_Scalar, _dim, _degree_u, _degree_v> ZeroPatch() {
@@ -41,33 +48,50 @@ class BezierPatch final : public PatchBase<_Scalar, _dim> {
 
     public:
         Point evaluate(Scalar u, Scalar v) const override {
-            auto iso_curve_v = compute_iso_curve_v(u);
-            return iso_curve_v.evaluate(v);
+            DerivativeMatrix ders;
+            evaluate_all(u, v, 0, ders);
+            return ders.row(0);
         }
 
         Point evaluate_derivative_u(Scalar u, Scalar v) const override {
-            auto iso_curve_u = compute_iso_curve_u(v);
-            return iso_curve_u.evaluate_derivative(u);
+            DerivativeMatrix ders;
+            evaluate_all(u, v, 1, ders);
+            return ders.row(1);
         }
 
         Point evaluate_derivative_v(Scalar u, Scalar v) const override {
-            auto iso_curve_v = compute_iso_curve_v(u);
-            return iso_curve_v.evaluate_derivative(v);
+            DerivativeMatrix ders;
+            evaluate_all(u, v, 1, ders);
+            return ders.row(2);
         }
 
         Point evaluate_2nd_derivative_uu(Scalar u, Scalar v) const override {
-            auto iso_curve_u = compute_iso_curve_u(v);
-            return iso_curve_u.evaluate_2nd_derivative(u);
+            return get_duu_patch().evaluate(u, v);
         }
 
         Point evaluate_2nd_derivative_vv(Scalar u, Scalar v) const override {
-            auto iso_curve_v = compute_iso_curve_v(u);
-            return iso_curve_v.evaluate_2nd_derivative(v);
+            return get_dvv_patch().evaluate(u, v);
         }
 
         Point evaluate_2nd_derivative_uv(Scalar u, Scalar v) const override {
-            auto duv_patch = compute_duv_patch();
-            return duv_patch.evaluate(u, v);
+            return get_duv_patch().evaluate(u, v);
+        }
+
+        using Base::evaluate_all;
+
+        void evaluate_all(Scalar u, Scalar v, int max_order,
+                DerivativeMatrix& out) const override {
+            constexpr int max_degree_u =
+                _degree_u < 0 ? internal::MAX_STACK_DEGREE : _degree_u;
+            constexpr int max_degree_v =
+                _degree_v < 0 ? internal::MAX_STACK_DEGREE : _degree_v;
+
+            if (Base::get_degree_u() <= max_degree_u &&
+                    Base::get_degree_v() <= max_degree_v) {
+                evaluate_all<max_degree_u, max_degree_v>(u, v, max_order, out);
+            } else {
+                evaluate_all<-1, -1>(u, v, max_order, out);
+            }
         }
 
         void initialize() override {
@@ -209,6 +233,51 @@ class BezierPatch final : public PatchBase<_Scalar, _dim> {
             return duv_patch;
         }
 
+        /**
+         * Derivative patches are cached.  They are built on first use, once
+         * even if several threads query concurrently, and dropped whenever
+         * the control grid, the degrees or the knots change.
+         */
+        const DerivativePatch& get_du_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.du_flag, [&]() {
+                cache.du.reset(new DerivativePatch(compute_du_patch()));
+            });
+            return *cache.du;
+        }
+
+        const DerivativePatch& get_dv_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.dv_flag, [&]() {
+                cache.dv.reset(new DerivativePatch(compute_dv_patch()));
+            });
+            return *cache.dv;
+        }
+
+        const DerivativePatch& get_duu_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.duu_flag, [&]() {
+                cache.duu.reset(new DerivativePatch(get_du_patch().compute_du_patch()));
+            });
+            return *cache.duu;
+        }
+
+        const DerivativePatch& get_duv_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.duv_flag, [&]() {
+                cache.duv.reset(new DerivativePatch(compute_duv_patch()));
+            });
+            return *cache.duv;
+        }
+
+        const DerivativePatch& get_dvv_patch() const {
+            DerivativeCache& cache = m_derivative_cache.get();
+            std::call_once(cache.dvv_flag, [&]() {
+                cache.dvv.reset(new DerivativePatch(get_dv_patch().compute_dv_patch()));
+            });
+            return *cache.dvv;
+        }
+
 
         Point get_control_point(int ui, int vj) const override {
             return Base::m_control_grid.row(Base::control_point_linear_index(ui,vj));
@@ -222,6 +291,26 @@ class BezierPatch final : public PatchBase<_Scalar, _dim> {
             return degree_v + 1;
         }
     private: 
+        /**
+         * Evaluate all partial derivatives up to `max_order` from a single
+         * set of Bernstein basis function derivatives in u and v.
+         */
+        template<int _max_degree_u, int _max_degree_v>
+        void evaluate_all(Scalar u, Scalar v, int max_order,
+                DerivativeMatrix& out) const {
+            const int degree_u = Base::get_degree_u();
+            const int degree_v = Base::get_degree_v();
+
+            internal::BasisScratch<Scalar, _max_degree_u> basis_u;
+            internal::BasisScratch<Scalar, _max_degree_v> basis_v;
+            internal::compute_bernstein_derivatives<_max_degree_u>(
+                    degree_u, u, std::min(max_order, degree_u), basis_u);
+            internal::compute_bernstein_derivatives<_max_degree_v>(
+                    degree_v, v, std::min(max_order, degree_v), basis_v);
+
+            Base::evaluate_tensor_product_derivatives(
+                    basis_u, basis_v, 0, 0, max_order, out);
+        }
 
         // Construct the implicit isocurves determined by each column of control points
         // i.e. fixed values of u. This copies these columns into
@@ -559,6 +648,20 @@ class BezierPatch final : public PatchBase<_Scalar, _dim> {
             Base::set_control_grid(updated_control_points);
             initialize();
         }
+    protected:
+        void invalidate_cache() override {
+            m_derivative_cache.reset();
+        }
+
+    private:
+        struct DerivativeCache {
+            std::once_flag du_flag, dv_flag, duu_flag, duv_flag, dvv_flag;
+            std::shared_ptr<const DerivativePatch> du, dv, duu, duv, dvv;
+        };
+
+        // Allocated by the first get_*_patch() call, and shared by copies
+        // until either one is modified.
+        internal::SharedLazy<DerivativeCache> m_derivative_cache;
 };
 
 } // namespace nanospline
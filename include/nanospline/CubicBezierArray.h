@@ -0,0 +1,151 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <nanospline/Bezier.h>
+#include <nanospline/Exceptions.h>
+#include <nanospline/internal/cubic_bezier_kernel.h>
+#include <nanospline/internal/simd_packet.h>
+
+namespace nanospline {
+
+/**
+ * A set of cubic Bezier curves stored as a structure of arrays, evaluated
+ * several curves at a time with SIMD instructions.
+ *
+ * Coordinate `d` of control point `i` of every curve is stored contiguously,
+ * so one packet load fetches that value for internal::Packet<Scalar>::SIZE
+ * consecutive curves.  Each query takes one parameter per curve.  Full
+ * packets go through the vectorized kernel and the remaining curves through
+ * the scalar one; both share the closed-form code of Bezier<Scalar, dim, 3>.
+ */
+template <typename _Scalar, int _dim = 2>
+class CubicBezierArray
+{
+public:
+    static_assert(_dim > 0, "Dimension must be positive.");
+    using Scalar = _Scalar;
+    using Curve = Bezier<_Scalar, _dim, 3>;
+    using Point = typename Curve::Point;
+    using ParameterArray = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+    using PointArray = Eigen::Matrix<Scalar, Eigen::Dynamic, _dim>;
+    using Packet = internal::Packet<Scalar>;
+
+public:
+    CubicBezierArray() = default;
+
+    explicit CubicBezierArray(const std::vector<Curve>& curves) { set_curves(curves); }
+
+    void set_curves(const std::vector<Curve>& curves)
+    {
+        const Eigen::Index num_curves = static_cast<Eigen::Index>(curves.size());
+        m_control_points.resize(num_curves, 4 * _dim);
+        for (Eigen::Index k = 0; k < num_curves; k++) {
+            const auto& ctrl_pts = curves[static_cast<size_t>(k)].get_control_points();
+            for (int i = 0; i < 4; i++) {
+                for (int d = 0; d < _dim; d++) {
+                    m_control_points(k, i * _dim + d) = ctrl_pts(i, d);
+                }
+            }
+        }
+    }
+
+    Eigen::Index size() const { return m_control_points.rows(); }
+
+    Curve get_curve(Eigen::Index k) const
+    {
+        typename Curve::ControlPoints ctrl_pts;
+        for (int i = 0; i < 4; i++) {
+            for (int d = 0; d < _dim; d++) {
+                ctrl_pts(i, d) = m_control_points(k, i * _dim + d);
+            }
+        }
+        Curve curve;
+        curve.set_control_points(ctrl_pts);
+        return curve;
+    }
+
+public:
+    /**
+     * Evaluate curve k at ts[k] and store the result in row k of `points`.
+     */
+    void evaluate(const ParameterArray& ts, PointArray& points) const
+    {
+        apply(ts, points, [](const Packet& t, const Packet& c0, const Packet& c1,
+                              const Packet& c2, const Packet& c3) {
+            return internal::cubic_bezier_evaluate<Packet>(t, c0, c1, c2, c3);
+        }, [](Scalar t, Scalar c0, Scalar c1, Scalar c2, Scalar c3) {
+            return internal::cubic_bezier_evaluate<Scalar>(t, c0, c1, c2, c3);
+        });
+    }
+
+    void evaluate_derivative(const ParameterArray& ts, PointArray& derivatives) const
+    {
+        apply(ts, derivatives, [](const Packet& t, const Packet& c0, const Packet& c1,
+                                   const Packet& c2, const Packet& c3) {
+            return internal::cubic_bezier_derivative<Packet>(t, c0, c1, c2, c3);
+        }, [](Scalar t, Scalar c0, Scalar c1, Scalar c2, Scalar c3) {
+            return internal::cubic_bezier_derivative<Scalar>(t, c0, c1, c2, c3);
+        });
+    }
+
+    void evaluate_2nd_derivative(const ParameterArray& ts, PointArray& derivatives) const
+    {
+        apply(ts, derivatives, [](const Packet& t, const Packet& c0, const Packet& c1,
+                                   const Packet& c2, const Packet& c3) {
+            return internal::cubic_bezier_2nd_derivative<Packet>(t, c0, c1, c2, c3);
+        }, [](Scalar t, Scalar c0, Scalar c1, Scalar c2, Scalar c3) {
+            return internal::cubic_bezier_2nd_derivative<Scalar>(t, c0, c1, c2, c3);
+        });
+    }
+
+private:
+    template <typename PacketKernel, typename ScalarKernel>
+    void apply(const ParameterArray& ts,
+        PointArray& out,
+        const PacketKernel& packet_kernel,
+        const ScalarKernel& scalar_kernel) const
+    {
+        const Eigen::Index num_curves = size();
+        if (ts.size() != num_curves) {
+            throw invalid_setting_error("Expect one parameter per curve.");
+        }
+        out.resize(num_curves, _dim);
+
+        const Eigen::Index num_packed = num_curves - num_curves % Packet::SIZE;
+        for (Eigen::Index k = 0; k < num_packed; k += Packet::SIZE) {
+            const Packet t = Packet::load(ts.data() + k);
+            for (int d = 0; d < _dim; d++) {
+                const Packet value = packet_kernel(t,
+                    Packet::load(coordinates(0, d) + k),
+                    Packet::load(coordinates(1, d) + k),
+                    Packet::load(coordinates(2, d) + k),
+                    Packet::load(coordinates(3, d) + k));
+                value.store(out.col(d).data() + k);
+            }
+        }
+
+        for (Eigen::Index k = num_packed; k < num_curves; k++) {
+            for (int d = 0; d < _dim; d++) {
+                out(k, d) = scalar_kernel(ts[k],
+                    coordinates(0, d)[k],
+                    coordinates(1, d)[k],
+                    coordinates(2, d)[k],
+                    coordinates(3, d)[k]);
+            }
+        }
+    }
+
+    const Scalar* coordinates(int i, int d) const
+    {
+        return m_control_points.col(i * _dim + d).data();
+    }
+
+private:
+    // Column i * _dim + d holds coordinate d of control point i of all curves.
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 4 * _dim> m_control_points;
+};
+
+} // namespace nanospline
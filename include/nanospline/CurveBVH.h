@@ -0,0 +1,343 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <nanospline/BSpline.h>
+#include <nanospline/Bezier.h>
+#include <nanospline/Exceptions.h>
+#include <nanospline/NURBS.h>
+#include <nanospline/RationalBezier.h>
+#include <nanospline/internal/closest_point.h>
+#include <nanospline/internal/parallel_for.h>
+
+namespace nanospline {
+
+/**
+ * Bounding volume hierarchy over a set of curves for closest point
+ * queries.
+ *
+ * Every curve is split into its (rational) Bézier pieces, and the bounding
+ * boxes of their control points, which contain the pieces, are organized
+ * in a binary tree.  A query descends into the nearer child first and
+ * skips any box farther than the best point found so far, so only the
+ * pieces near the query point are solved exactly, with the Bernstein root
+ * isolation of internal::bezier_closest_point.
+ *
+ * Usage: add the curves, call initialize(), then query.  Queries are
+ * const and may run concurrently.
+ */
+template <typename _Scalar, int _dim = 2>
+class CurveBVH
+{
+public:
+    static_assert(_dim > 0, "Dimension must be positive.");
+    using Scalar = _Scalar;
+    using Point = Eigen::Matrix<Scalar, 1, _dim>;
+    using PointMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, _dim>;
+
+    struct ClosestPoint
+    {
+        int curve_id;
+        Scalar t;
+        Scalar distance;
+    };
+
+    /**
+     * Pieces per leaf.
+     */
+    static constexpr int LEAF_SIZE = 4;
+
+public:
+    /**
+     * Add a curve and return its id, the number of curves added before it.
+     */
+    template <int degree, bool generic>
+    int add_curve(const Bezier<Scalar, _dim, degree, generic>& curve)
+    {
+        const int id = m_num_curves++;
+        add_piece(curve.get_control_points(), id, 0, 1);
+        return id;
+    }
+
+    template <int degree, bool generic>
+    int add_curve(const RationalBezier<Scalar, _dim, degree, generic>& curve)
+    {
+        const int id = m_num_curves++;
+        add_rational_piece(curve, id, 0, 1);
+        return id;
+    }
+
+    template <int degree, bool generic>
+    int add_curve(const BSpline<Scalar, _dim, degree, generic>& curve)
+    {
+        const int id = m_num_curves++;
+        const auto pieces = curve.convert_to_Bezier();
+        const auto& beziers = std::get<0>(pieces);
+        const auto& bounds = std::get<1>(pieces);
+        for (size_t i = 0; i < beziers.size(); i++) {
+            add_piece(beziers[i].get_control_points(), id, bounds[i], bounds[i + 1]);
+        }
+        return id;
+    }
+
+    template <int degree, bool generic>
+    int add_curve(const NURBS<Scalar, _dim, degree, generic>& curve)
+    {
+        const int id = m_num_curves++;
+        const auto pieces = curve.convert_to_RationalBezier();
+        const auto& beziers = std::get<0>(pieces);
+        const auto& bounds = std::get<1>(pieces);
+        for (size_t i = 0; i < beziers.size(); i++) {
+            add_rational_piece(beziers[i], id, bounds[i], bounds[i + 1]);
+        }
+        return id;
+    }
+
+    int get_num_curves() const { return m_num_curves; }
+    int get_num_pieces() const { return static_cast<int>(m_pieces.size()); }
+
+    /**
+     * Build the tree.  Must be called after the last add_curve and before
+     * the first query.
+     */
+    void initialize()
+    {
+        const int num_pieces = get_num_pieces();
+        m_order.resize(static_cast<size_t>(num_pieces));
+        for (int i = 0; i < num_pieces; i++) {
+            m_order[static_cast<size_t>(i)] = i;
+        }
+        m_piece_min.resize(num_pieces, _dim);
+        m_piece_max.resize(num_pieces, _dim);
+        for (int i = 0; i < num_pieces; i++) {
+            m_piece_min.row(i) = m_pieces[static_cast<size_t>(i)].bbox_min;
+            m_piece_max.row(i) = m_pieces[static_cast<size_t>(i)].bbox_max;
+        }
+
+        m_nodes.clear();
+        m_node_min.resize(std::max(2 * num_pieces, 1), _dim);
+        m_node_max.resize(std::max(2 * num_pieces, 1), _dim);
+        if (num_pieces > 0) {
+            build_node(0, num_pieces);
+        }
+        m_node_min.conservativeResize(static_cast<Eigen::Index>(m_nodes.size()), _dim);
+        m_node_max.conservativeResize(static_cast<Eigen::Index>(m_nodes.size()), _dim);
+        m_initialized = true;
+    }
+
+    /**
+     * Closest point to p over all curves.  Returns curve_id -1 if there are
+     * no curves.
+     */
+    ClosestPoint query(const Point& p) const
+    {
+        if (!m_initialized) {
+            throw invalid_setting_error("CurveBVH is not initialized.");
+        }
+        ClosestPoint result{-1, 0, std::numeric_limits<Scalar>::infinity()};
+        if (m_nodes.empty()) return result;
+
+        Scalar best_sq_dist = std::numeric_limits<Scalar>::max();
+        std::vector<std::pair<Scalar, int>> stack;
+        stack.emplace_back(box_sq_distance(m_node_min.row(0), m_node_max.row(0), p), 0);
+        while (!stack.empty()) {
+            const auto entry = stack.back();
+            stack.pop_back();
+            if (entry.first >= best_sq_dist) continue;
+
+            const Node& node = m_nodes[static_cast<size_t>(entry.second)];
+            if (node.count > 0) {
+                for (int i = node.start; i < node.start + node.count; i++) {
+                    const int piece_id = m_order[static_cast<size_t>(i)];
+                    const Piece& piece = m_pieces[static_cast<size_t>(piece_id)];
+                    if (box_sq_distance(m_piece_min.row(piece_id),
+                            m_piece_max.row(piece_id),
+                            p) >= best_sq_dist) {
+                        continue;
+                    }
+                    const Scalar prev_sq_dist = best_sq_dist;
+                    solve_piece(piece, p, result.t, best_sq_dist);
+                    if (best_sq_dist < prev_sq_dist) {
+                        result.curve_id = piece.curve_id;
+                    }
+                }
+                continue;
+            }
+
+            const Scalar d_left =
+                box_sq_distance(m_node_min.row(node.left), m_node_max.row(node.left), p);
+            const Scalar d_right =
+                box_sq_distance(m_node_min.row(node.right), m_node_max.row(node.right), p);
+            // Push the farther child first so the nearer one is visited next.
+            if (d_left <= d_right) {
+                stack.emplace_back(d_right, node.right);
+                stack.emplace_back(d_left, node.left);
+            } else {
+                stack.emplace_back(d_left, node.left);
+                stack.emplace_back(d_right, node.right);
+            }
+        }
+
+        result.distance = std::sqrt(best_sq_dist);
+        return result;
+    }
+
+    /**
+     * Closest point to each row of `points`.  The rows are split evenly
+     * among `num_threads` threads; 0 means one per hardware thread.
+     */
+    std::vector<ClosestPoint> batch_query(const PointMatrix& points, int num_threads = 0) const
+    {
+        if (!m_initialized) {
+            throw invalid_setting_error("CurveBVH is not initialized.");
+        }
+        const int num_points = static_cast<int>(points.rows());
+        std::vector<ClosestPoint> results(static_cast<size_t>(num_points));
+        internal::parallel_for(num_points, num_threads, [&](int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                results[static_cast<size_t>(i)] = query(points.row(i));
+            }
+        });
+        return results;
+    }
+
+private:
+    using PieceControlPoints = Eigen::Matrix<Scalar, Eigen::Dynamic, _dim + 1>;
+
+    struct Piece
+    {
+        // Homogeneous control points; the weights are all 1 unless rational.
+        PieceControlPoints ctrl_pts;
+        Point bbox_min, bbox_max;
+        bool rational;
+        int curve_id;
+        Scalar t0, t1;
+    };
+
+    struct Node
+    {
+        // Children of an internal node, or the range [start, start+count) of
+        // m_order for a leaf (count > 0).
+        int left, right;
+        int start, count;
+    };
+
+    template <typename Derived>
+    void add_piece(const Eigen::MatrixBase<Derived>& ctrl_pts, int curve_id, Scalar t0, Scalar t1)
+    {
+        Piece piece;
+        piece.ctrl_pts.resize(ctrl_pts.rows(), _dim + 1);
+        piece.ctrl_pts.template leftCols<_dim>() = ctrl_pts;
+        piece.ctrl_pts.col(_dim).setOnes();
+        piece.rational = false;
+        piece.curve_id = curve_id;
+        piece.t0 = t0;
+        piece.t1 = t1;
+        push_piece(piece, ctrl_pts);
+    }
+
+    template <int degree, bool generic>
+    void add_rational_piece(const RationalBezier<Scalar, _dim, degree, generic>& curve,
+        int curve_id,
+        Scalar t0,
+        Scalar t1)
+    {
+        Piece piece;
+        piece.ctrl_pts = curve.get_homogeneous().get_control_points();
+        piece.rational = true;
+        piece.curve_id = curve_id;
+        piece.t0 = t0;
+        piece.t1 = t1;
+        // With positive weights the piece lies in the convex hull of its
+        // Cartesian control points.
+        push_piece(piece, curve.get_control_points());
+    }
+
+    template <typename Derived>
+    void push_piece(Piece& piece, const Eigen::MatrixBase<Derived>& ctrl_pts)
+    {
+        piece.bbox_min = ctrl_pts.colwise().minCoeff();
+        piece.bbox_max = ctrl_pts.colwise().maxCoeff();
+        m_pieces.push_back(piece);
+        m_initialized = false;
+    }
+
+    int build_node(int start, int end)
+    {
+        const int node_id = static_cast<int>(m_nodes.size());
+        m_nodes.push_back(Node{-1, -1, start, 0});
+
+        Point bbox_min = Point::Constant(std::numeric_limits<Scalar>::max());
+        Point bbox_max = Point::Constant(std::numeric_limits<Scalar>::lowest());
+        Point centroid_min = bbox_min, centroid_max = bbox_max;
+        for (int i = start; i < end; i++) {
+            const int piece_id = m_order[static_cast<size_t>(i)];
+            bbox_min = bbox_min.cwiseMin(m_piece_min.row(piece_id));
+            bbox_max = bbox_max.cwiseMax(m_piece_max.row(piece_id));
+            const Point centroid = (m_piece_min.row(piece_id) + m_piece_max.row(piece_id)) / 2;
+            centroid_min = centroid_min.cwiseMin(centroid);
+            centroid_max = centroid_max.cwiseMax(centroid);
+        }
+        m_node_min.row(node_id) = bbox_min;
+        m_node_max.row(node_id) = bbox_max;
+
+        if (end - start <= LEAF_SIZE) {
+            m_nodes[static_cast<size_t>(node_id)].count = end - start;
+            return node_id;
+        }
+
+        // Median split along the axis with the largest centroid extent.
+        int axis = 0;
+        (centroid_max - centroid_min).maxCoeff(&axis);
+        const int mid = (start + end) / 2;
+        std::nth_element(m_order.begin() + start,
+            m_order.begin() + mid,
+            m_order.begin() + end,
+            [&](int a, int b) {
+                return m_piece_min(a, axis) + m_piece_max(a, axis) <
+                       m_piece_min(b, axis) + m_piece_max(b, axis);
+            });
+
+        const int left = build_node(start, mid);
+        const int right = build_node(mid, end);
+        m_nodes[static_cast<size_t>(node_id)].left = left;
+        m_nodes[static_cast<size_t>(node_id)].right = right;
+        return node_id;
+    }
+
+    template <typename MinDerived, typename MaxDerived>
+    static Scalar box_sq_distance(const Eigen::MatrixBase<MinDerived>& bbox_min,
+        const Eigen::MatrixBase<MaxDerived>& bbox_max,
+        const Point& p)
+    {
+        return (p.cwiseMax(bbox_min).cwiseMin(bbox_max) - p).squaredNorm();
+    }
+
+    static void solve_piece(const Piece& piece, const Point& p, Scalar& t, Scalar& sq_dist)
+    {
+        if (piece.rational) {
+            internal::rational_bezier_closest_point(
+                piece.ctrl_pts, p, piece.t0, piece.t1, t, sq_dist);
+        } else {
+            internal::bezier_closest_point(
+                piece.ctrl_pts.template leftCols<_dim>(), p, piece.t0, piece.t1, t, sq_dist);
+        }
+    }
+
+private:
+    std::vector<Piece, Eigen::aligned_allocator<Piece>> m_pieces;
+    PointMatrix m_piece_min, m_piece_max;
+    std::vector<int> m_order;
+    std::vector<Node> m_nodes;
+    PointMatrix m_node_min, m_node_max;
+    int m_num_curves = 0;
+    bool m_initialized = false;
+};
+
+} // namespace nanospline
@@ -6,19 +6,60 @@
 #include <memory>
 
 #include <Eigen/Core>
+#include <nanospline/EvaluationWorkspace.h>
 #include <nanospline/Exceptions.h>
+#include <nanospline/generic_algorithms.h>
 namespace nanospline {
 
+/**
+ * How polynomial curves are evaluated.
+ *
+ * Recursive: de Casteljau / de Boor on the control points.  Every step is a
+ * convex combination, so the error stays at a few ulps for any degree.
+ * This is the default.
+ *
+ * PowerBasis: the curve (or each knot span of a B-spline) is converted once
+ * to monomial coefficients, which are kept until the control points or knots
+ * change.  Points and derivatives then take O(d) Horner steps instead of
+ * O(d^2).  The monomial coefficients grow like binom(d, j) with alternating
+ * signs, so cancellation error grows roughly like 2^d times the size of the
+ * control points.  Recommended for low and moderate degrees (say d <= 7)
+ * evaluated many times between updates.
+ */
+enum class EvaluationMode {
+    Recursive,
+    PowerBasis
+};
+
 template<typename _Scalar, int _dim>
 class CurveBase {
     public:
         static_assert(_dim >= 0, "Negative degree is not allowed");
         using Scalar = _Scalar;
         using Point = Eigen::Matrix<Scalar, 1, _dim>;
+        using ParameterVector = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+        using PointMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, _dim>;
+        /**
+         * The point and its first two derivatives stacked row by row,
+         * truncated to the requested order.  The storage is fixed, so
+         * filling it never allocates.
+         */
+        using DerivativeMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, _dim,
+              Eigen::ColMajor, 3, _dim>;
 
     public:
         virtual ~CurveBase()=default;
         virtual Point evaluate(Scalar t) const =0;
+
+        /**
+         * Same as evaluate(t), but any scratch storage is borrowed from
+         * `workspace`.  Curves that need no scratch storage ignore it.
+         */
+        virtual Point evaluate(Scalar t,
+                EvaluationWorkspace<Scalar>& workspace) const {
+            return evaluate(t);
+        }
+
         virtual Scalar inverse_evaluate(const Point& p) const =0;
         virtual Point evaluate_derivative(Scalar t) const =0;
         virtual Point evaluate_2nd_derivative(Scalar t) const =0;
@@ -38,35 +79,127 @@ class CurveBase {
                 const Scalar lower=0.0,
                 const Scalar upper=1.0) const =0;
 
+        /**
+         * Parameters in [lower, upper] where the derivative vanishes.  A
+         * curve collapsed to a single point has no isolated singularities,
+         * and none are reported for it.
+         */
         virtual std::vector<Scalar> compute_singularities(
                 const Scalar lower=0.0,
                 const Scalar upper=1.0) const =0;
 
         virtual void write(std::ostream &out) const =0;
         virtual Scalar get_turning_angle(Scalar t0, Scalar t1) const {
-            if (_dim != 2) {
-                throw std::runtime_error(
-                        "Turning angle computation is for 2D curves only");
+            return nanospline::get_turning_angle(*this, t0, t1);
+        }
+
+    public:
+        /**
+         * Batch evaluation.  Row i of `out` is set to the value at ts[i].
+         * `out` is only resized if its shape does not match, so a caller
+         * evaluating repeatedly can reuse the same buffer.  Curve types
+         * override these with allocation-free kernels.
+         */
+        virtual void batch_evaluate(const ParameterVector& ts, PointMatrix& out) const {
+            out.resize(ts.size(), _dim);
+            for (Eigen::Index i=0; i<ts.size(); i++) {
+                out.row(i) = evaluate(ts[i]);
+            }
+        }
+
+        virtual void batch_evaluate_derivative(
+                const ParameterVector& ts, PointMatrix& out) const {
+            out.resize(ts.size(), _dim);
+            for (Eigen::Index i=0; i<ts.size(); i++) {
+                out.row(i) = evaluate_derivative(ts[i]);
             }
+        }
 
-            constexpr Scalar EPS = std::numeric_limits<Scalar>::epsilon();
-            constexpr int NUM_RETRIES = 10;
-            Point d0 = evaluate_derivative(t0);
-            Point d1 = evaluate_derivative(t1);
+        virtual void batch_evaluate_2nd_derivative(
+                const ParameterVector& ts, PointMatrix& out) const {
+            out.resize(ts.size(), _dim);
+            for (Eigen::Index i=0; i<ts.size(); i++) {
+                out.row(i) = evaluate_2nd_derivative(ts[i]);
+            }
+        }
 
-            for (int i=0; i<NUM_RETRIES && d0.norm() < EPS; i++) {
-                t0 += (t1-t0) * 1e-3;
-                d0 = evaluate_derivative(t0);
+        /**
+         * Warm-started inverse evaluation, for a query point that moved
+         * only a little since the last query.  Searches within `radius` of
+         * the guess t0 first (see nanospline::local_inverse_evaluate) and
+         * only falls back to the global inverse_evaluate(p) if that fails
+         * to converge.
+         */
+        Scalar inverse_evaluate(const Point& p, Scalar t0, Scalar radius) const {
+            Scalar t = t0;
+            if (nanospline::local_inverse_evaluate(*this, p, t0, radius, t)) {
+                return t;
             }
+            return inverse_evaluate(p);
+        }
+
+        /**
+         * Inverse evaluation of an ordered sequence of query points, one
+         * per row, such as a tracked point over successive frames.  Each
+         * query is warm-started from the answer to the previous one, the
+         * first from t0.  ts[i] is set to the parameter of points.row(i).
+         */
+        void batch_inverse_evaluate(const PointMatrix& points, Scalar t0,
+                Scalar radius, ParameterVector& ts) const {
+            ts.resize(points.rows());
+            for (Eigen::Index i=0; i<points.rows(); i++) {
+                t0 = inverse_evaluate(points.row(i), t0, radius);
+                ts[i] = t0;
+            }
+        }
 
-            for (int i=0; i<NUM_RETRIES && d1.norm() < EPS; i++) {
-                t1 -= (t1-t0) * 1e-3;
-                d1 = evaluate_derivative(t1);
+        /**
+         * Evaluate the curve and its derivatives up to order k at t in one
+         * pass.  Row i of `out` ((k+1) x dim) holds the i-th derivative.
+         */
+        virtual void evaluate_derivatives(Scalar t, int k, PointMatrix& out) const {
+            assert(k >= 0);
+            if (k > 2) {
+                throw not_implemented_error(
+                        "Derivatives above order 2 are not supported by this curve type");
             }
+            out.resize(k+1, _dim);
+            out.row(0) = evaluate(t);
+            if (k >= 1) out.row(1) = evaluate_derivative(t);
+            if (k >= 2) out.row(2) = evaluate_2nd_derivative(t);
+        }
+
+        /**
+         * Same as evaluate_derivatives(t, k, PointMatrix&) for k <= 2, into
+         * fixed-size storage.  The default implementation calls the
+         * individual evaluation methods.
+         */
+        virtual void evaluate_derivatives(Scalar t, int k, DerivativeMatrix& out) const {
+            evaluate_derivatives_pointwise(*this, t, k, out);
+        }
+
+        PointMatrix evaluate_derivatives(Scalar t, int k) const {
+            PointMatrix out(k+1, _dim);
+            evaluate_derivatives(t, k, out);
+            return out;
+        }
+
+        PointMatrix batch_evaluate(const ParameterVector& ts) const {
+            PointMatrix out(ts.size(), _dim);
+            batch_evaluate(ts, out);
+            return out;
+        }
+
+        PointMatrix batch_evaluate_derivative(const ParameterVector& ts) const {
+            PointMatrix out(ts.size(), _dim);
+            batch_evaluate_derivative(ts, out);
+            return out;
+        }
 
-            return std::atan2(
-                    d0[0]*d1[1] - d0[1]*d1[0],
-                    d0[0]*d1[0] + d0[1]*d1[1]);
+        PointMatrix batch_evaluate_2nd_derivative(const ParameterVector& ts) const {
+            PointMatrix out(ts.size(), _dim);
+            batch_evaluate_2nd_derivative(ts, out);
+            return out;
         }
 
     public:
@@ -81,16 +214,12 @@ class CurveBase {
         }
       }
 
+        /**
+         * See nanospline::evaluate_curvature for the statically dispatched
+         * version.
+         */
         Point evaluate_curvature(Scalar t) const {
-            const auto d1 = evaluate_derivative(t);
-            const auto d2 = evaluate_2nd_derivative(t);
-
-            const auto sq_speed = d1.squaredNorm();
-            if (sq_speed == 0) {
-                return Point::Zero();
-            } else {
-                return (d2 - d1 * (d1.dot(d2)) / sq_speed) / sq_speed;
-            }
+            return nanospline::evaluate_curvature(*this, t);
         }
 
         constexpr int get_dim() const {
@@ -107,58 +236,38 @@ class CurveBase {
                 const Scalar lower=0.0,
                 const Scalar upper=1.0,
                 const int level=3) const {
-
-            assert(num_samples > 0);
-            const Scalar delta_t = (upper - lower) / num_samples;
-
-            Scalar min_t = 0.0;
-            Scalar min_dist = std::numeric_limits<Scalar>::max();
-            for (int i=0; i<=num_samples; i++) {
-                const Scalar t = lower +
-                    (Scalar)(i) / (Scalar)(num_samples) * (upper-lower);
-                const auto q = this->evaluate(t);
-                const auto dist = (p-q).squaredNorm();
-                if (dist < min_dist) {
-                    min_dist = dist;
-                    min_t = t;
-                }
-            }
-
-            if (level <= 0) {
-                constexpr Scalar TOL =
-                    std::numeric_limits<Scalar>::epsilon() * 100;
-                return newton_raphson(p, min_t, 10, TOL, lower, upper);
-            } else {
-                return approximate_inverse_evaluate(p,
-                        num_samples,
-                        std::max(min_t-delta_t, lower),
-                        std::min(min_t+delta_t, upper),
-                        level-1);
-            }
+            return nanospline::approximate_inverse_evaluate(
+                    *this, p, num_samples, lower, upper, level);
         }
 
         Scalar newton_raphson(const Point& p, Scalar t, int num_iterations,
                 const Scalar tol, const Scalar lower, const Scalar upper) const {
-            Scalar prev_t = t;
-            Scalar prev_err = -1;
-            for (int i=0; i<num_iterations; i++) {
-                const auto d0 = this->evaluate(t);
-                const auto d1 = this->evaluate_derivative(t);
-                const auto d2 = this->evaluate_2nd_derivative(t);
-                const auto f =  (p-d0).dot(d1);
-                const auto df =  (p-d0).dot(d2) - d1.squaredNorm();
-                const auto err = std::abs(f);
-                if (err < tol) return t;
-                if (prev_err > 0 && err > prev_err) return prev_t;
-
-                prev_err = err;
-                prev_t = t;
-
-                t -= f/df;
-                if (t <= lower) return lower;
-                if (t >= upper) return upper;
+            return nanospline::newton_raphson(
+                    *this, p, t, num_iterations, tol, lower, upper);
+        }
+
+        /**
+         * Fill `out` from the individual evaluation methods of `curve`.
+         * Called with a final curve type, those calls are not virtual.
+         */
+        template<typename CurveType>
+        static void evaluate_derivatives_pointwise(const CurveType& curve,
+                Scalar t, int k, DerivativeMatrix& out) {
+            check_derivative_order(k);
+            out.resize(k+1, _dim);
+            out.row(0) = curve.evaluate(t);
+            if (k >= 1) out.row(1) = curve.evaluate_derivative(t);
+            if (k >= 2) out.row(2) = curve.evaluate_2nd_derivative(t);
+        }
+
+        /**
+         * Throw unless a DerivativeMatrix can hold derivatives up to order k.
+         */
+        static void check_derivative_order(int k) {
+            if (k < 0 || k > 2) {
+                throw invalid_setting_error(
+                        "DerivativeMatrix holds derivatives up to order 2");
             }
-            return t;
         }
 };
 
@@ -0,0 +1,622 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <typeindex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <nanospline/BSpline.h>
+#include <nanospline/BatchPolynomialRootFinder.h>
+#include <nanospline/Bezier.h>
+#include <nanospline/CurveBase.h>
+#include <nanospline/Exceptions.h>
+#include <nanospline/NURBS.h>
+#include <nanospline/RationalBezier.h>
+#include <nanospline/internal/curve_polynomials.h>
+
+namespace nanospline {
+
+/**
+ * A set of curves of mixed types, grouped by concrete type and degree into
+ * contiguous buckets.
+ *
+ * Batch queries take one parameter (or query point) per curve, in insertion
+ * order, and write one result row per curve in the same order.  Each bucket
+ * loops over its own curves with the concrete type known at compile time.
+ * The built-in curve types are final, so there is one virtual call per
+ * bucket rather than one per curve, and curves of the same kind sit next to
+ * each other in memory.  Other curve types get the same only if they are
+ * final too.
+ *
+ * Curves are copied into the collection.  Curves given through CurveBase
+ * are matched against the Bezier, RationalBezier, BSpline and NURBS types
+ * with dynamic degree or degree 1 to 3; any other type must be added
+ * through the templated overload of add_curve.
+ */
+template <typename _Scalar, int _dim = 2>
+class CurveCollection
+{
+public:
+    using Scalar = _Scalar;
+    using CurveType = CurveBase<_Scalar, _dim>;
+    using Point = typename CurveType::Point;
+    using ParameterVector = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+    using PointMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, _dim>;
+
+private:
+    enum class RootQuery { Inflection, Singularity, TurningAngle };
+
+    /**
+     * Polynomials to solve for a root query, in Bernstein form on [0, 1],
+     * grouped by degree.  Each solves for the roots over the parameter
+     * range [t_min, t_max] of one curve (piece).
+     */
+    struct PolynomialBatch
+    {
+        struct Group
+        {
+            std::vector<Scalar> coeffs;
+            std::vector<int> curve_ids;
+            std::vector<Scalar> t_min, t_max;
+        };
+
+        void add(const std::vector<Scalar>& coeffs, int curve_id, Scalar t_min, Scalar t_max)
+        {
+            Group& group = groups[static_cast<int>(coeffs.size()) - 1];
+            group.coeffs.insert(group.coeffs.end(), coeffs.begin(), coeffs.end());
+            group.curve_ids.push_back(curve_id);
+            group.t_min.push_back(t_min);
+            group.t_max.push_back(t_max);
+        }
+
+        std::map<int, Group> groups;
+        // (curve id, parameter, tolerance) of the roots known without
+        // solving.  Roots of the same curve closer than the larger of their
+        // tolerances are the same root.
+        std::vector<std::tuple<int, Scalar, Scalar>> roots;
+    };
+
+    class BucketBase
+    {
+    public:
+        virtual ~BucketBase() = default;
+        virtual const CurveType& get_curve(size_t i) const = 0;
+        virtual void evaluate(const ParameterVector& ts, PointMatrix& out) const = 0;
+        virtual void evaluate_derivative(const ParameterVector& ts, PointMatrix& out) const = 0;
+        virtual void evaluate_2nd_derivative(
+            const ParameterVector& ts, PointMatrix& out) const = 0;
+        virtual void compute_bounding_boxes(PointMatrix& bbox_min, PointMatrix& bbox_max) const = 0;
+        virtual void inverse_evaluate(const PointMatrix& queries, ParameterVector& ts) const = 0;
+        virtual void approximate_inverse_evaluate(
+            const PointMatrix& queries, ParameterVector& ts) const = 0;
+        virtual void build_polynomials(RootQuery query, PolynomialBatch& batch) const = 0;
+    };
+
+    template <typename Curve>
+    class Bucket final : public BucketBase
+    {
+    public:
+        size_t add(const Curve& curve, int id)
+        {
+            m_curves.push_back(curve);
+            m_ids.push_back(id);
+            return m_curves.size() - 1;
+        }
+
+        const CurveType& get_curve(size_t i) const override { return m_curves[i]; }
+
+        void evaluate(const ParameterVector& ts, PointMatrix& out) const override
+        {
+            for (size_t i = 0; i < m_curves.size(); i++) {
+                const int id = m_ids[i];
+                out.row(id) = m_curves[i].evaluate(ts[id]);
+            }
+        }
+
+        void evaluate_derivative(const ParameterVector& ts, PointMatrix& out) const override
+        {
+            for (size_t i = 0; i < m_curves.size(); i++) {
+                const int id = m_ids[i];
+                out.row(id) = m_curves[i].evaluate_derivative(ts[id]);
+            }
+        }
+
+        void evaluate_2nd_derivative(const ParameterVector& ts, PointMatrix& out) const override
+        {
+            for (size_t i = 0; i < m_curves.size(); i++) {
+                const int id = m_ids[i];
+                out.row(id) = m_curves[i].evaluate_2nd_derivative(ts[id]);
+            }
+        }
+
+        void compute_bounding_boxes(PointMatrix& bbox_min, PointMatrix& bbox_max) const override
+        {
+            // With positive weights every curve type here lies inside the
+            // convex hull of its control points.
+            for (size_t i = 0; i < m_curves.size(); i++) {
+                const int id = m_ids[i];
+                const auto& ctrl_pts = m_curves[i].get_control_points();
+                bbox_min.row(id) = ctrl_pts.colwise().minCoeff();
+                bbox_max.row(id) = ctrl_pts.colwise().maxCoeff();
+            }
+        }
+
+        void inverse_evaluate(const PointMatrix& queries, ParameterVector& ts) const override
+        {
+            for (size_t i = 0; i < m_curves.size(); i++) {
+                const int id = m_ids[i];
+                ts[id] = m_curves[i].inverse_evaluate(queries.row(id));
+            }
+        }
+
+        void approximate_inverse_evaluate(
+            const PointMatrix& queries, ParameterVector& ts) const override
+        {
+            for (size_t i = 0; i < m_curves.size(); i++) {
+                const int id = m_ids[i];
+                const Curve& curve = m_curves[i];
+                ts[id] = curve.approximate_inverse_evaluate(queries.row(id),
+                    curve.get_domain_lower_bound(),
+                    curve.get_domain_upper_bound());
+            }
+        }
+
+        void build_polynomials(RootQuery query, PolynomialBatch& batch) const override
+        {
+            for (size_t i = 0; i < m_curves.size(); i++) {
+                append_polynomials(m_curves[i], m_ids[i], query, batch);
+            }
+        }
+
+    private:
+        std::vector<Curve, Eigen::aligned_allocator<Curve>> m_curves;
+        std::vector<int> m_ids;
+    };
+
+public:
+    /**
+     * Add a copy of `curve` and return its index.
+     */
+    template <typename Curve>
+    int add_curve(const Curve& curve)
+    {
+        static_assert(std::is_base_of<CurveType, Curve>::value,
+            "Curve must derive from CurveBase with the same scalar type and dimension.");
+        static_assert(!std::is_abstract<Curve>::value, "Curve must be a concrete curve type.");
+
+        const int id = size();
+        const BucketKey key(std::type_index(typeid(Curve)), curve.get_degree());
+        auto itr = m_bucket_index.find(key);
+        if (itr == m_bucket_index.end()) {
+            m_buckets.emplace_back(new Bucket<Curve>());
+            itr = m_bucket_index.insert({key, m_buckets.size() - 1}).first;
+        }
+        const size_t bucket_id = itr->second;
+        auto& bucket = static_cast<Bucket<Curve>&>(*m_buckets[bucket_id]);
+        const size_t local_id = bucket.add(curve, id);
+        m_locations.emplace_back(bucket_id, local_id);
+        return id;
+    }
+
+    /**
+     * Add a copy of a curve known only through its base class.  Throws
+     * not_implemented_error if its concrete type is not one of the types
+     * listed in the class comment.
+     */
+    int add_curve(const CurveType& curve)
+    {
+        int id = -1;
+        if (try_add<Bezier<Scalar, _dim, -1>>(curve, id) ||
+            try_add<Bezier<Scalar, _dim, 1>>(curve, id) ||
+            try_add<Bezier<Scalar, _dim, 2>>(curve, id) ||
+            try_add<Bezier<Scalar, _dim, 3>>(curve, id) ||
+            try_add<RationalBezier<Scalar, _dim, -1>>(curve, id) ||
+            try_add<RationalBezier<Scalar, _dim, 1>>(curve, id) ||
+            try_add<RationalBezier<Scalar, _dim, 2>>(curve, id) ||
+            try_add<RationalBezier<Scalar, _dim, 3>>(curve, id) ||
+            try_add<BSpline<Scalar, _dim, -1>>(curve, id) ||
+            try_add<BSpline<Scalar, _dim, 1>>(curve, id) ||
+            try_add<BSpline<Scalar, _dim, 2>>(curve, id) ||
+            try_add<BSpline<Scalar, _dim, 3>>(curve, id) ||
+            try_add<NURBS<Scalar, _dim, -1>>(curve, id) ||
+            try_add<NURBS<Scalar, _dim, 1>>(curve, id) ||
+            try_add<NURBS<Scalar, _dim, 2>>(curve, id) ||
+            try_add<NURBS<Scalar, _dim, 3>>(curve, id)) {
+            return id;
+        }
+        throw not_implemented_error("Unsupported curve type in CurveCollection.");
+    }
+
+    int add_curve(const std::shared_ptr<CurveType>& curve) { return add_curve(*curve); }
+
+    int size() const { return static_cast<int>(m_locations.size()); }
+
+    int get_num_buckets() const { return static_cast<int>(m_buckets.size()); }
+
+    /**
+     * The stored copy of curve `id`.  The reference is invalidated by the
+     * next call to add_curve.
+     */
+    const CurveType& get_curve(int id) const
+    {
+        const auto& loc = m_locations[static_cast<size_t>(id)];
+        return m_buckets[loc.first]->get_curve(loc.second);
+    }
+
+public:
+    /**
+     * Evaluate curve i at ts[i] and store the result in row i of `out`.
+     */
+    void evaluate(const ParameterVector& ts, PointMatrix& out) const
+    {
+        prepare(ts.rows(), out);
+        for (const auto& bucket : m_buckets) {
+            bucket->evaluate(ts, out);
+        }
+    }
+
+    void evaluate_derivative(const ParameterVector& ts, PointMatrix& out) const
+    {
+        prepare(ts.rows(), out);
+        for (const auto& bucket : m_buckets) {
+            bucket->evaluate_derivative(ts, out);
+        }
+    }
+
+    void evaluate_2nd_derivative(const ParameterVector& ts, PointMatrix& out) const
+    {
+        prepare(ts.rows(), out);
+        for (const auto& bucket : m_buckets) {
+            bucket->evaluate_2nd_derivative(ts, out);
+        }
+    }
+
+    /**
+     * Axis aligned bounding box of the control points of each curve, which
+     * contains the curve itself.
+     */
+    void compute_bounding_boxes(PointMatrix& bbox_min, PointMatrix& bbox_max) const
+    {
+        bbox_min.resize(size(), _dim);
+        bbox_max.resize(size(), _dim);
+        for (const auto& bucket : m_buckets) {
+            bucket->compute_bounding_boxes(bbox_min, bbox_max);
+        }
+    }
+
+    /**
+     * For each curve i, the parameter of the point on it closest to row i of
+     * `queries`, found with the curve's exact inverse_evaluate.
+     */
+    void inverse_evaluate(const PointMatrix& queries, ParameterVector& ts) const
+    {
+        prepare_queries(queries, ts);
+        for (const auto& bucket : m_buckets) {
+            bucket->inverse_evaluate(queries, ts);
+        }
+    }
+
+    /**
+     * Same as inverse_evaluate, but with the curve's
+     * approximate_inverse_evaluate over its whole domain: sampling and
+     * Newton-Raphson iterations, which are cheaper than the exact search
+     * but may settle on a local minimum of the distance.
+     */
+    void approximate_inverse_evaluate(const PointMatrix& queries, ParameterVector& ts) const
+    {
+        prepare_queries(queries, ts);
+        for (const auto& bucket : m_buckets) {
+            bucket->approximate_inverse_evaluate(queries, ts);
+        }
+    }
+
+    /**
+     * Inflections of every curve over its whole domain, in compressed
+     * sparse row form: those of curve i are ts[offsets[i]], ...,
+     * ts[offsets[i + 1] - 1], in increasing order.
+     *
+     * The polynomials of all Bezier pieces are built directly from their
+     * control points and solved together by BatchPolynomialRootFinder on
+     * `num_threads` threads (0 means one per hardware thread), so this
+     * works for every degree.  Curve types other than those listed in the
+     * class comment fall back to their own compute_inflections.  2D only.
+     */
+    void compute_inflections(
+        std::vector<int>& offsets, std::vector<Scalar>& ts, int num_threads = 0) const
+    {
+        find_roots(RootQuery::Inflection, offsets, ts, num_threads);
+    }
+
+    /**
+     * Singularities of every curve over its whole domain, in the layout of
+     * compute_inflections.
+     */
+    void compute_singularities(
+        std::vector<int>& offsets, std::vector<Scalar>& ts, int num_threads = 0) const
+    {
+        find_roots(RootQuery::Singularity, offsets, ts, num_threads);
+    }
+
+    /**
+     * Split points reducing the turning angle of every Bezier piece of
+     * every curve, as reduce_turning_angle, in the layout of
+     * compute_inflections.
+     */
+    void reduce_turning_angle(
+        std::vector<int>& offsets, std::vector<Scalar>& ts, int num_threads = 0) const
+    {
+        find_roots(RootQuery::TurningAngle, offsets, ts, num_threads);
+    }
+
+private:
+    using BucketKey = std::pair<std::type_index, int>;
+
+    template <typename Curve>
+    bool try_add(const CurveType& curve, int& id)
+    {
+        const Curve* c = dynamic_cast<const Curve*>(&curve);
+        if (c == nullptr) return false;
+        id = add_curve(*c);
+        return true;
+    }
+
+    void prepare(Eigen::Index num_parameters, PointMatrix& out) const
+    {
+        if (num_parameters != size()) {
+            throw invalid_setting_error("Expecting one parameter per curve.");
+        }
+        out.resize(size(), _dim);
+    }
+
+    void prepare_queries(const PointMatrix& queries, ParameterVector& ts) const
+    {
+        if (queries.rows() != size()) {
+            throw invalid_setting_error("Expecting one query point per curve.");
+        }
+        ts.resize(size());
+    }
+
+    void find_roots(RootQuery query,
+        std::vector<int>& offsets,
+        std::vector<Scalar>& ts,
+        int num_threads) const
+    {
+        if (_dim != 2) {
+            throw std::runtime_error("Root queries are for 2D curves only");
+        }
+        // The polynomials are built from normalized control points, so the
+        // tolerance is relative to the size of each piece.
+        const Scalar tol = internal::vanishing_tolerance<Scalar>();
+
+        PolynomialBatch batch;
+        for (const auto& bucket : m_buckets) {
+            bucket->build_polynomials(query, batch);
+        }
+
+        auto& found = batch.roots;
+        std::vector<int> group_offsets;
+        std::vector<Scalar> group_roots;
+        std::vector<Scalar> coeffs;
+        std::vector<Scalar> roots;
+        for (const auto& entry : batch.groups) {
+            const auto& group = entry.second;
+            const size_t stride = static_cast<size_t>(entry.first) + 1;
+            BatchPolynomialRootFinder<Scalar>::find_real_roots_in_bernstein_form(
+                entry.first, group.coeffs, group_offsets, group_roots, 0, 1, tol, num_threads);
+            for (size_t i = 0; i < group.curve_ids.size(); i++) {
+                roots.assign(group_roots.begin() + group_offsets[i],
+                    group_roots.begin() + group_offsets[i + 1]);
+                if (query == RootQuery::Inflection) {
+                    // Flat points are not inflections.
+                    coeffs.assign(group.coeffs.begin() + static_cast<std::ptrdiff_t>(i * stride),
+                        group.coeffs.begin() + static_cast<std::ptrdiff_t>((i + 1) * stride));
+                    internal::remove_tangential_roots(coeffs, roots);
+                }
+                const Scalar t_min = group.t_min[i];
+                const Scalar t_max = group.t_max[i];
+                for (const Scalar s : roots) {
+                    found.emplace_back(
+                        group.curve_ids[i], t_min + s * (t_max - t_min), tol * (t_max - t_min));
+                }
+            }
+        }
+
+        // A root at a knot is found by the pieces on both sides, a few ulps
+        // apart.
+        std::sort(found.begin(), found.end());
+        size_t num_found = 0;
+        for (size_t i = 0; i < found.size(); i++) {
+            if (num_found > 0) {
+                const auto& prev = found[num_found - 1];
+                const auto& curr = found[i];
+                if (std::get<0>(prev) == std::get<0>(curr) &&
+                    std::get<1>(curr) - std::get<1>(prev) <=
+                        std::max(std::get<2>(prev), std::get<2>(curr))) {
+                    continue;
+                }
+            }
+            found[num_found++] = found[i];
+        }
+        found.resize(num_found);
+
+        offsets.assign(static_cast<size_t>(size()) + 1, 0);
+        ts.resize(found.size());
+        for (size_t i = 0; i < found.size(); i++) {
+            offsets[static_cast<size_t>(std::get<0>(found[i])) + 1]++;
+            ts[i] = std::get<1>(found[i]);
+        }
+        for (size_t i = 1; i < offsets.size(); i++) {
+            offsets[i] += offsets[i - 1];
+        }
+    }
+
+    template <int degree, bool generic>
+    static void append_polynomials(const Bezier<Scalar, _dim, degree, generic>& curve,
+        int id,
+        RootQuery query,
+        PolynomialBatch& batch)
+    {
+        append_piece(curve, id, 0, 1, query, batch);
+    }
+
+    template <int degree, bool generic>
+    static void append_polynomials(const RationalBezier<Scalar, _dim, degree, generic>& curve,
+        int id,
+        RootQuery query,
+        PolynomialBatch& batch)
+    {
+        append_piece(curve, id, 0, 1, query, batch);
+    }
+
+    template <int degree, bool generic>
+    static void append_polynomials(const BSpline<Scalar, _dim, degree, generic>& curve,
+        int id,
+        RootQuery query,
+        PolynomialBatch& batch)
+    {
+        const auto pieces = curve.convert_to_Bezier();
+        const auto& beziers = std::get<0>(pieces);
+        const auto& bounds = std::get<1>(pieces);
+        for (size_t i = 0; i < beziers.size(); i++) {
+            append_piece(beziers[i], id, bounds[i], bounds[i + 1], query, batch);
+        }
+    }
+
+    template <int degree, bool generic>
+    static void append_polynomials(const NURBS<Scalar, _dim, degree, generic>& curve,
+        int id,
+        RootQuery query,
+        PolynomialBatch& batch)
+    {
+        const auto pieces = curve.convert_to_RationalBezier();
+        const auto& beziers = std::get<0>(pieces);
+        const auto& bounds = std::get<1>(pieces);
+        for (size_t i = 0; i < beziers.size(); i++) {
+            append_piece(beziers[i], id, bounds[i], bounds[i + 1], query, batch);
+        }
+    }
+
+    template <typename Curve>
+    static void append_polynomials(
+        const Curve& curve, int id, RootQuery query, PolynomialBatch& batch)
+    {
+        const Scalar lower = curve.get_domain_lower_bound();
+        const Scalar upper = curve.get_domain_upper_bound();
+        std::vector<Scalar> roots;
+        switch (query) {
+        case RootQuery::Inflection: roots = curve.compute_inflections(lower, upper); break;
+        case RootQuery::Singularity: roots = curve.compute_singularities(lower, upper); break;
+        case RootQuery::TurningAngle: roots = curve.reduce_turning_angle(lower, upper); break;
+        }
+        for (const Scalar t : roots) {
+            batch.roots.emplace_back(id, t, Scalar(0));
+        }
+    }
+
+    template <int degree, bool generic>
+    static void append_piece(const Bezier<Scalar, _dim, degree, generic>& piece,
+        int id,
+        Scalar t_min,
+        Scalar t_max,
+        RootQuery query,
+        PolynomialBatch& batch)
+    {
+        const auto& ctrl_pts = piece.get_control_points();
+        const int d = piece.get_degree();
+        Eigen::Matrix<Scalar, 2, 1> normal;
+        switch (query) {
+        case RootQuery::Inflection:
+            if (d > 2) {
+                batch.add(internal::bezier_inflection_polynomial(ctrl_pts), id, t_min, t_max);
+            }
+            break;
+        case RootQuery::Singularity:
+            if (d > 0) {
+                batch.add(internal::bezier_singularity_polynomial(ctrl_pts), id, t_min, t_max);
+            }
+            break;
+        case RootQuery::TurningAngle:
+            if (d >= 2 && turning_angle_normal(piece, id, t_min, t_max, batch, normal)) {
+                batch.add(
+                    internal::bezier_tangent_polynomial(ctrl_pts, normal), id, t_min, t_max);
+            }
+            break;
+        }
+    }
+
+    template <int degree, bool generic>
+    static void append_piece(const RationalBezier<Scalar, _dim, degree, generic>& piece,
+        int id,
+        Scalar t_min,
+        Scalar t_max,
+        RootQuery query,
+        PolynomialBatch& batch)
+    {
+        const auto& ctrl_pts = piece.get_homogeneous().get_control_points();
+        const int d = piece.get_degree();
+        Eigen::Matrix<Scalar, 2, 1> normal;
+        switch (query) {
+        case RootQuery::Inflection:
+            if (d > 2) {
+                batch.add(
+                    internal::rational_bezier_inflection_polynomial(ctrl_pts), id, t_min, t_max);
+            }
+            break;
+        case RootQuery::Singularity:
+            if (d > 0) {
+                batch.add(
+                    internal::rational_bezier_singularity_polynomial(ctrl_pts), id, t_min, t_max);
+            }
+            break;
+        case RootQuery::TurningAngle:
+            if (d >= 2 && turning_angle_normal(piece, id, t_min, t_max, batch, normal)) {
+                batch.add(internal::rational_bezier_tangent_polynomial(ctrl_pts, normal),
+                    id,
+                    t_min,
+                    t_max);
+            }
+            break;
+        }
+    }
+
+    /**
+     * Normal to the average of the unit end tangents of a Bezier piece, at
+     * which reduce_turning_angle splits it.  A piece with a vanishing end
+     * tangent is split at its middle instead and false is returned.
+     */
+    template <typename Piece>
+    static bool turning_angle_normal(const Piece& piece,
+        int id,
+        Scalar t_min,
+        Scalar t_max,
+        PolynomialBatch& batch,
+        Eigen::Matrix<Scalar, 2, 1>& normal)
+    {
+        constexpr Scalar tol = static_cast<Scalar>(1e-8);
+        Point tan0 = piece.evaluate_derivative(0);
+        Point tan1 = piece.evaluate_derivative(1);
+        if (tan0.norm() < tol || tan1.norm() < tol) {
+            batch.roots.emplace_back(id, (t_min + t_max) / 2, Scalar(0));
+            return false;
+        }
+        tan0 /= tan0.norm();
+        tan1 /= tan1.norm();
+        normal << -(tan0[1] + tan1[1]) / 2, (tan0[0] + tan1[0]) / 2;
+        return true;
+    }
+
+private:
+    std::vector<std::unique_ptr<BucketBase>> m_buckets;
+    std::map<BucketKey, size_t> m_bucket_index;
+    std::vector<std::pair<size_t, size_t>> m_locations;
+};
+
+} // namespace nanospline
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+
+#include <Eigen/Core>
+
+namespace nanospline {
+
+/**
+ * Reusable scratch storage for evaluation queries.
+ *
+ * Curves of dynamic degree need temporary copies of their control points
+ * (and blossom vectors, knot insertion buffers, ...) whose size is only known
+ * at runtime.  Passing an EvaluationWorkspace to the overloads of `evaluate`,
+ * `blossom`, `insert_knot` and `subcurve` lets them borrow that storage
+ * instead of allocating it on every call.  The buffers only ever grow, so
+ * once the largest degree has been seen no further allocation happens.
+ *
+ * A workspace is not thread safe; create one per thread.
+ */
+template <typename _Scalar>
+class EvaluationWorkspace
+{
+public:
+    using Scalar = _Scalar;
+    template <int _cols>
+    using MatrixMap = Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, _cols>>;
+    using VectorMap = Eigen::Map<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>>;
+
+    /**
+     * Number of independent buffers.  Buffers in different slots never
+     * alias, so a routine may hold one view per slot at the same time.
+     */
+    static constexpr int NUM_SLOTS = 2;
+
+public:
+    /**
+     * View buffer `slot` as a `rows` x `cols` matrix, growing it if needed.
+     * The content is unspecified.  The view is invalidated by the next
+     * request on the same slot.
+     */
+    template <int _cols>
+    MatrixMap<_cols> get_matrix(int slot, Eigen::Index rows, Eigen::Index cols = _cols)
+    {
+        return MatrixMap<_cols>(reserve(slot, rows * cols), rows, cols);
+    }
+
+    /**
+     * View buffer `slot` as a vector of `size` entries, growing it if
+     * needed.  The content is unspecified.
+     */
+    VectorMap get_vector(int slot, Eigen::Index size)
+    {
+        return VectorMap(reserve(slot, size), size);
+    }
+
+    /**
+     * Knot span found by the last B-spline evaluation through this
+     * workspace, or -1.  The next evaluation tries it first, so a sweep
+     * over increasing parameters rarely searches for its span.  Only a
+     * hint: it is validated before use, so one workspace may be shared by
+     * several curves.
+     */
+    int get_span_hint() const { return m_span_hint; }
+    void set_span_hint(int k) { m_span_hint = k; }
+
+    /**
+     * Total number of scalars currently reserved.
+     */
+    Eigen::Index capacity() const
+    {
+        Eigen::Index total = 0;
+        for (const auto& buffer : m_buffers) {
+            total += buffer.size();
+        }
+        return total;
+    }
+
+private:
+    Scalar* reserve(int slot, Eigen::Index size)
+    {
+        assert(slot >= 0 && slot < NUM_SLOTS);
+        auto& buffer = m_buffers[static_cast<size_t>(slot)];
+        if (buffer.size() < size) {
+            buffer.resize(size);
+        }
+        return buffer.data();
+    }
+
+private:
+    std::array<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>, NUM_SLOTS> m_buffers;
+    int m_span_hint = -1;
+};
+
+} // namespace nanospline
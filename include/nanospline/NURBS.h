@@ -8,11 +8,12 @@
 #include <nanospline/BSplineBase.h>
 #include <nanospline/Exceptions.h>
 #include <nanospline/RationalBezier.h>
+#include <nanospline/internal/closest_point.h>
 
 namespace nanospline {
 
 template <typename _Scalar, int _dim = 2, int _degree = 3, bool _generic = (_degree < 0)>
-class NURBS : public BSplineBase<_Scalar, _dim, _degree, _generic>
+class NURBS final : public BSplineBase<_Scalar, _dim, _degree, _generic>
 {
 public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -22,6 +23,9 @@ public:
     using ControlPoints = typename Base::ControlPoints;
     using WeightVector = Eigen::Matrix<_Scalar, Eigen::Dynamic, 1>;
     using BSplineHomogeneous = BSpline<_Scalar, _dim + 1, _degree, _generic>;
+    using ParameterVector = typename Base::ParameterVector;
+    using PointMatrix = typename Base::PointMatrix;
+    using DerivativeMatrix = typename Base::DerivativeMatrix;
 
 public:
     NURBS() = default;
@@ -48,9 +52,38 @@ public:
         return p.template segment<_dim>(0) / p[_dim];
     }
 
+    Point evaluate(Scalar t, EvaluationWorkspace<Scalar>& workspace) const override
+    {
+        validate_initialization();
+        auto p = m_bspline_homogeneous.evaluate(t, workspace);
+        return p.template segment<_dim>(0) / p[_dim];
+    }
+
+    using Base::inverse_evaluate;
+
+    /**
+     * Exact closest point search over the knot spans, pruned with the
+     * bounding boxes of the control points as in BSpline::inverse_evaluate.
+     */
     Scalar inverse_evaluate(const Point& p) const override
     {
-        throw not_implemented_error("Too complex, sigh");
+        validate_initialization();
+        const int d = Base::get_degree();
+        typename BSplineHomogeneous::ControlPoints bezier_ctrl_pts;
+        EvaluationWorkspace<Scalar> workspace;
+        return internal::bspline_closest_point(Base::m_knots,
+            d,
+            Base::m_control_points,
+            p,
+            [&](int k, Scalar& best_t, Scalar& best_sq_dist) {
+                m_bspline_homogeneous.extract_bezier_control_points(k, bezier_ctrl_pts, workspace);
+                internal::rational_bezier_closest_point(bezier_ctrl_pts,
+                    p,
+                    Base::m_knots[k],
+                    Base::m_knots[k + 1],
+                    best_t,
+                    best_sq_dist);
+            });
     }
 
     Point evaluate_derivative(Scalar t) const override
@@ -75,6 +108,75 @@ public:
         return (d2.template head<_dim>() - d2[_dim] * c0 - 2 * d1[_dim] * c1) / p0[_dim];
     }
 
+    using Base::evaluate_derivatives;
+
+    /**
+     * Derivatives of the homogeneous curve A(t) = w(t) C(t), corrected with
+     * C^(k) = (A^(k) - sum_{i=1}^{k} binom(k, i) w^(i) C^(k-i)) / w
+     * (The NURBS Book, algorithm A4.2).
+     */
+    void evaluate_derivatives(Scalar t, int k, PointMatrix& out) const override
+    {
+        validate_initialization();
+        typename BSplineHomogeneous::PointMatrix ders;
+        m_bspline_homogeneous.evaluate_derivatives(t, k, ders);
+        rationalize_derivatives(ders, out);
+    }
+
+    void evaluate_derivatives(Scalar t, int k, DerivativeMatrix& out) const override
+    {
+        Base::check_derivative_order(k);
+        validate_initialization();
+        typename BSplineHomogeneous::DerivativeMatrix ders;
+        m_bspline_homogeneous.evaluate_derivatives(t, k, ders);
+        rationalize_derivatives(ders, out);
+    }
+
+    using Base::batch_evaluate;
+    using Base::batch_evaluate_derivative;
+    using Base::batch_evaluate_2nd_derivative;
+
+    void batch_evaluate(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        validate_initialization();
+        typename BSplineHomogeneous::PointMatrix p;
+        m_bspline_homogeneous.batch_evaluate(ts, p);
+        out = p.template leftCols<_dim>().array().colwise() / p.col(_dim).array();
+    }
+
+    void batch_evaluate_derivative(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        validate_initialization();
+        typename BSplineHomogeneous::PointMatrix p, d;
+        m_bspline_homogeneous.batch_evaluate(ts, p);
+        m_bspline_homogeneous.batch_evaluate_derivative(ts, d);
+
+        out.resize(ts.size(), _dim);
+        for (Eigen::Index i = 0; i < ts.size(); i++) {
+            const Scalar w = p(i, _dim);
+            const Point c0 = p.row(i).template head<_dim>() / w;
+            out.row(i) = (d.row(i).template head<_dim>() - c0 * d(i, _dim)) / w;
+        }
+    }
+
+    void batch_evaluate_2nd_derivative(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        validate_initialization();
+        typename BSplineHomogeneous::PointMatrix p0, d1, d2;
+        m_bspline_homogeneous.batch_evaluate(ts, p0);
+        m_bspline_homogeneous.batch_evaluate_derivative(ts, d1);
+        m_bspline_homogeneous.batch_evaluate_2nd_derivative(ts, d2);
+
+        out.resize(ts.size(), _dim);
+        for (Eigen::Index i = 0; i < ts.size(); i++) {
+            const Scalar w = p0(i, _dim);
+            const Point c0 = p0.row(i).template head<_dim>() / w;
+            const Point c1 = (d1.row(i).template head<_dim>() - c0 * d1(i, _dim)) / w;
+            out.row(i) =
+                (d2.row(i).template head<_dim>() - d2(i, _dim) * c0 - 2 * d1(i, _dim) * c1) / w;
+        }
+    }
+
     void insert_knot(Scalar t, int multiplicity = 1) override
     {
         validate_initialization();
@@ -82,6 +184,14 @@ public:
         set_homogeneous(m_bspline_homogeneous);
     }
 
+    void insert_knot(
+        Scalar t, int multiplicity, EvaluationWorkspace<Scalar>& workspace) override
+    {
+        validate_initialization();
+        m_bspline_homogeneous.insert_knot(t, multiplicity, workspace);
+        set_homogeneous(m_bspline_homogeneous);
+    }
+
     int remove_knot(Scalar t, int multiplicity = 1, Scalar tol = -1) override
     {
         validate_initialization();
@@ -253,6 +363,19 @@ public:
         m_bspline_homogeneous.set_knots(Base::m_knots);
     }
 
+    /**
+     * The mode applies to the homogeneous curve, which does the evaluation.
+     */
+    void set_evaluation_mode(EvaluationMode mode) override
+    {
+        m_bspline_homogeneous.set_evaluation_mode(mode);
+    }
+
+    EvaluationMode get_evaluation_mode() const override
+    {
+        return m_bspline_homogeneous.get_evaluation_mode();
+    }
+
     const WeightVector& get_weights() const { return m_weights; }
 
     template <typename Derived>
@@ -272,11 +395,14 @@ public:
     void set_homogeneous(const BSplineHomogeneous& homogeneous)
     {
         const auto ctrl_pts = homogeneous.get_control_points();
+        const auto mode = get_evaluation_mode();
         m_bspline_homogeneous = homogeneous;
+        m_bspline_homogeneous.set_evaluation_mode(mode);
         m_weights = ctrl_pts.template rightCols<1>();
         Base::m_control_points =
             ctrl_pts.template leftCols<_dim>().array().colwise() / m_weights.array();
         Base::m_knots = homogeneous.get_knots();
+        Base::update_span_index();
         validate_initialization();
     }
 
@@ -290,6 +416,24 @@ public:
     }
 
 private:
+    template <typename HomogeneousDerived, typename Derived>
+    static void rationalize_derivatives(const Eigen::MatrixBase<HomogeneousDerived>& ders,
+        Eigen::PlainObjectBase<Derived>& out)
+    {
+        const auto k = ders.rows() - 1;
+        out.resize(k + 1, _dim);
+        const Scalar w = ders(0, _dim);
+        for (Eigen::Index r = 0; r <= k; r++) {
+            Point v = ders.row(r).template head<_dim>();
+            Scalar binom = 1;
+            for (Eigen::Index i = 1; i <= r; i++) {
+                binom = binom * Scalar(r - i + 1) / Scalar(i);
+                v -= binom * ders(i, _dim) * out.row(r - i);
+            }
+            out.row(r) = v / w;
+        }
+    }
+
     void validate_initialization() const
     {
         Base::validate_curve();
@@ -18,6 +18,7 @@ class NURBSPatch final : public PatchBase<_Scalar, _dim> {
         using UVPoint = typename Base::UVPoint;
         using Point = typename Base::Point;
         using ControlGrid = typename Base::ControlGrid;
+        using DerivativeMatrix = typename Base::DerivativeMatrix;
         using ThisType = NURBSPatch<_Scalar, _dim, _degree_u, _degree_v>;
         using Weights = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
         using KnotVector = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
@@ -77,65 +78,29 @@ class NURBSPatch final : public PatchBase<_Scalar, _dim> {
         }
 
         Point evaluate_2nd_derivative_uu(Scalar u, Scalar v) const override {
-            validate_initialization();
-            constexpr Scalar tol = std::numeric_limits<Scalar>::epsilon();
-            const auto p0 = m_homogeneous.evaluate(u, v);
-            const auto du = m_homogeneous.evaluate_derivative_u(u, v);
-            const auto duu = m_homogeneous.evaluate_2nd_derivative_uu(u, v);
-
-            const Point Auu = duu.template head<_dim>();
-            const Scalar wuu = duu[_dim];
-            const Scalar w = p0[_dim];
-            if (w <= tol) return Point::Zero();
-
-            const Point S = p0.template head<_dim>() / w;
-            const Point Su = evaluate_derivative_u(u, v);
-            const Scalar wu = du[_dim];
-
-            return (Auu - Su * wu * 2 - S * wuu) / w;
+            return evaluate_all(u, v, 2).row(3);
         }
 
         Point evaluate_2nd_derivative_vv(Scalar u, Scalar v) const override {
-            validate_initialization();
-            constexpr Scalar tol = std::numeric_limits<Scalar>::epsilon();
-
-            const auto p0 = m_homogeneous.evaluate(u, v);
-            const auto dv = m_homogeneous.evaluate_derivative_v(u, v);
-            const auto dvv = m_homogeneous.evaluate_2nd_derivative_vv(u, v);
-
-            const Point Avv = dvv.template segment<_dim>(0);
-            const Scalar wvv = dvv[_dim];
-            const Scalar w = p0[_dim];
-            if (w <= tol) return Point::Zero();
-
-            const Point S = p0.template segment<_dim>(0) / w;
-            const Point Sv = evaluate_derivative_v(u, v);
-            const Scalar wv = dv[_dim];
-
-            return (Avv - Sv * wv * 2 - S * wvv) / w;
+            return evaluate_all(u, v, 2).row(5);
         }
 
         Point evaluate_2nd_derivative_uv(Scalar u, Scalar v) const override {
-            validate_initialization();
-            constexpr Scalar tol = std::numeric_limits<Scalar>::epsilon();
-
-            const auto p0 = m_homogeneous.evaluate(u, v);
-            const auto du = m_homogeneous.evaluate_derivative_u(u, v);
-            const auto dv = m_homogeneous.evaluate_derivative_v(u, v);
-            const auto duv = m_homogeneous.evaluate_2nd_derivative_uv(u, v);
-
-            const Point Auv = duv.template segment<_dim>(0);
-            const Scalar wuv = duv[_dim];
-            const Point S = p0.template segment<_dim>(0) / p0[_dim];
-            const Scalar w = p0[_dim];
-            if (w <= tol) return Point::Zero();
+            return evaluate_all(u, v, 2).row(4);
+        }
 
-            const Scalar wu = du[_dim];
-            const Scalar wv = dv[_dim];
-            const Point Su = evaluate_derivative_u(u, v);
-            const Point Sv = evaluate_derivative_v(u, v);
+        using Base::evaluate_all;
 
-            return (Auv - S*wuv - wu*Sv - wv*Su) / w;
+        /**
+         * Evaluate all partial derivatives of the homogeneous patch in one
+         * pass and apply the rational correction once.
+         */
+        void evaluate_all(Scalar u, Scalar v, int max_order,
+                DerivativeMatrix& out) const override {
+            validate_initialization();
+            typename BSplinePatchHomogeneous::DerivativeMatrix ders;
+            m_homogeneous.evaluate_all(u, v, max_order, ders);
+            Base::rationalize_derivatives(ders, out);
         }
 
         void initialize() override {
@@ -4,6 +4,7 @@
 #include <vector>
 #include <Eigen/Core>
 #include <nanospline/Exceptions.h>
+#include <nanospline/generic_algorithms.h>
 #include <nanospline/split.h>
 
 
@@ -16,7 +17,15 @@ class PatchBase {
         using Point = Eigen::Matrix<Scalar, 1, _dim>;
         using UVPoint = Eigen::Matrix<Scalar, 1, 2>;
         using ControlGrid = Eigen::Matrix<Scalar, Eigen::Dynamic, _dim>;
+        using PointMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, _dim>;
+        using UVMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, 2>;
         using ThisType = PatchBase<_Scalar,_dim>;
+        /**
+         * Partial derivatives stacked row by row in the order
+         * [S, Su, Sv, Suu, Suv, Svv], truncated to the requested order.
+         */
+        using DerivativeMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, _dim,
+              Eigen::ColMajor, 6, _dim>;
 
     public:
         virtual ~PatchBase() = default;
@@ -36,6 +45,35 @@ class PatchBase {
         virtual int num_control_points_v() const = 0;
         virtual UVPoint get_control_point_preimage(int i, int j) const = 0;
 
+    public:
+        /**
+         * Evaluate the patch and all of its partial derivatives up to
+         * `max_order` (at most 2) at (u, v).  On return, `out` has 1, 3 or 6
+         * rows ordered as S, Su, Sv, Suu, Suv, Svv.
+         *
+         * The default implementation calls the individual evaluation
+         * methods.  Subclasses override it to share one set of basis
+         * functions across all derivatives.
+         */
+        virtual void evaluate_all(Scalar u, Scalar v, int max_order,
+                DerivativeMatrix& out) const {
+            out.resize(num_partial_derivatives(max_order), _dim);
+            out.row(0) = evaluate(u, v);
+            if (max_order < 1) return;
+            out.row(1) = evaluate_derivative_u(u, v);
+            out.row(2) = evaluate_derivative_v(u, v);
+            if (max_order < 2) return;
+            out.row(3) = evaluate_2nd_derivative_uu(u, v);
+            out.row(4) = evaluate_2nd_derivative_uv(u, v);
+            out.row(5) = evaluate_2nd_derivative_vv(u, v);
+        }
+
+        DerivativeMatrix evaluate_all(Scalar u, Scalar v, int max_order=2) const {
+            DerivativeMatrix out;
+            evaluate_all(u, v, max_order, out);
+            return out;
+        }
+
 
     public:
         virtual UVPoint inverse_evaluate(const Point& p,
@@ -52,6 +90,57 @@ class PatchBase {
                     min_u, max_u, min_v, max_v);
         }
 
+        /**
+         * Closest point search from uv within the given bounds, reporting
+         * the iterations used, the final residual and whether it converged.
+         * See nanospline::trust_region_newton_raphson.
+         */
+        NewtonRaphsonResult<Scalar> trust_region_newton_raphson(
+                const Point& p,
+                const UVPoint& uv,
+                const Scalar min_u,
+                const Scalar max_u,
+                const Scalar min_v,
+                const Scalar max_v,
+                const NewtonRaphsonSettings<Scalar>& settings =
+                    NewtonRaphsonSettings<Scalar>()) const {
+            return nanospline::trust_region_newton_raphson(*this, p, uv,
+                    min_u, max_u, min_v, max_v, settings);
+        }
+
+        /**
+         * Warm-started inverse evaluation, for a query point that moved
+         * only a little since the last query.  Searches within `radius` of
+         * the guess uv0 in both parameters first (see
+         * nanospline::local_inverse_evaluate) and only falls back to the
+         * global search over the whole domain if that fails to converge.
+         */
+        UVPoint inverse_evaluate(const Point& p, const UVPoint& uv0,
+                const Scalar radius) const {
+            UVPoint uv = uv0;
+            if (nanospline::local_inverse_evaluate(*this, p, uv0, radius, uv)) {
+                return uv;
+            }
+            return inverse_evaluate(p,
+                    get_u_lower_bound(), get_u_upper_bound(),
+                    get_v_lower_bound(), get_v_upper_bound());
+        }
+
+        /**
+         * Inverse evaluation of an ordered sequence of query points, one
+         * per row.  Each query is warm-started from the answer to the
+         * previous one, the first from uv0.  Row i of `uvs` is set to the
+         * parameters of points.row(i).
+         */
+        void batch_inverse_evaluate(const PointMatrix& points,
+                UVPoint uv0, const Scalar radius, UVMatrix& uvs) const {
+            uvs.resize(points.rows(), 2);
+            for (Eigen::Index i=0; i<points.rows(); i++) {
+                uv0 = inverse_evaluate(points.row(i), uv0, radius);
+                uvs.row(i) = uv0;
+            }
+        }
+
     public:
 
 
@@ -91,10 +180,12 @@ class PatchBase {
 
         void set_degree_u(int degree) {
             m_degree_u = degree;
+            invalidate_cache();
         }
 
         void set_degree_v(int degree) {
             m_degree_v = degree;
+            invalidate_cache();
         }
 
         int get_degree_u() const {
@@ -122,16 +213,19 @@ class PatchBase {
         template<typename Derived>
         void set_control_grid(const Eigen::PlainObjectBase<Derived>& ctrl_grid) {
             m_control_grid = ctrl_grid;
+            invalidate_cache();
         }
 
         template<typename Derived>
         void set_control_grid(Eigen::PlainObjectBase<Derived>&& ctrl_grid) {
             m_control_grid.swap(ctrl_grid);
+            invalidate_cache();
         }
 
         template<typename Derived>
         void swap_control_grid(Eigen::PlainObjectBase<Derived>& ctrl_grid) {
             m_control_grid.swap(ctrl_grid);
+            invalidate_cache();
         }
 
         constexpr int get_dim() const {
@@ -185,48 +279,8 @@ class PatchBase {
                 const Scalar max_u,
                 const Scalar min_v,
                 const Scalar max_v) const {
-            Scalar u = uv[0];
-            Scalar v = uv[1];
-            UVPoint prev_uv = uv;
-            Scalar prev_dist = std::numeric_limits<Scalar>::max();
-            for (int i=0; i<num_iterations; i++) {
-                const Point r = this->evaluate(u, v) - p;
-                const Scalar dist = r.norm();
-                if (dist < tol) {
-                    break;
-                }
-
-                if (dist > prev_dist) {
-                    // Ops, Newton Raphson diverged...
-                    // Use the best result so far.
-                    return prev_uv;
-                }
-                prev_dist = dist;
-                prev_uv = {u, v};
-
-                const Point Su = this->evaluate_derivative_u(u, v);
-                const Point Sv = this->evaluate_derivative_v(u, v);
-                const Point Suu = this->evaluate_2nd_derivative_uu(u, v);
-                const Point Svv = this->evaluate_2nd_derivative_vv(u, v);
-                const Point Suv = this->evaluate_2nd_derivative_uv(u, v);
-
-                Eigen::Matrix<Scalar, 2, 2> J;
-                J << Su.squaredNorm() + r.dot(Suu), Su.dot(Sv) + r.dot(Suv),
-                     Sv.dot(Su) + r.dot(Suv), Sv.squaredNorm() + r.dot(Svv);
-                Eigen::Matrix<Scalar, 2, 1> kappa;
-                kappa << -r.dot(Su), -r.dot(Sv);
-
-                Eigen::Matrix<Scalar, 2, 1> delta = J.inverse() * kappa;
-
-                u += delta[0];
-                v += delta[1];
-
-                if (u < min_u) u = min_u;
-                if (u > max_u) u = max_u;
-                if (v < min_v) v = min_v;
-                if (v > max_v) v = max_v;
-            }
-            return {u, v};
+            return nanospline::newton_raphson(*this, p, uv, num_iterations,
+                    tol, min_u, max_u, min_v, max_v);
         }
 
         std::pair<int, int> find_closest_control_point(Point p) const {
@@ -248,6 +302,107 @@ class PatchBase {
             return std::pair<int, int>(i_min, j_min);
         }
 
+    protected:
+        /**
+         * Number of rows of the DerivativeMatrix holding all partial
+         * derivatives up to `max_order`.
+         */
+        static int num_partial_derivatives(int max_order) {
+            if (max_order < 0 || max_order > 2) {
+                throw invalid_setting_error(
+                        "Partial derivatives are supported up to order 2");
+            }
+            return (max_order+1) * (max_order+2) / 2;
+        }
+
+        /**
+         * Accumulate the partial derivatives of the tensor product patch
+         * from the basis function derivatives basis_u(k, i) and
+         * basis_v(k, j) of the (p+1) x (q+1) control points starting at
+         * (base_u, base_v).  Derivative orders beyond the rows of the basis
+         * matrices are zero.
+         */
+        template<typename BasisU, typename BasisV>
+        void evaluate_tensor_product_derivatives(
+                const BasisU& basis_u, const BasisV& basis_v,
+                int base_u, int base_v, int max_order,
+                DerivativeMatrix& out) const {
+            constexpr int order_u[] = {0, 1, 0, 2, 1, 0};
+            constexpr int order_v[] = {0, 0, 1, 0, 1, 2};
+            const int num_rows = num_partial_derivatives(max_order);
+            const int degree_u = static_cast<int>(basis_u.cols()) - 1;
+            const int degree_v = static_cast<int>(basis_v.cols()) - 1;
+            const int n_u = static_cast<int>(basis_u.rows()) - 1;
+            const int n_v = static_cast<int>(basis_v.rows()) - 1;
+            const int num_v = num_control_points_v();
+            out.setZero(num_rows, _dim);
+
+            // Accumulate offsets from a reference control point so that the
+            // partition of unity rounding error does not scale with the
+            // magnitude of the coordinates.
+            const Point ref = m_control_grid.row(base_u * num_v + base_v);
+            Eigen::Matrix<Scalar, 3, _dim> row_sum;
+            for (int i=0; i<=degree_u; i++) {
+                row_sum.setZero();
+                const int row_offset = (base_u + i) * num_v + base_v;
+                for (int j=0; j<=degree_v; j++) {
+                    const Point offset = m_control_grid.row(row_offset + j) - ref;
+                    for (int k=0; k<=n_v; k++) {
+                        row_sum.row(k) += basis_v(k, j) * offset;
+                    }
+                }
+                for (int r=0; r<num_rows; r++) {
+                    if (order_u[r] <= n_u && order_v[r] <= n_v) {
+                        out.row(r) += basis_u(order_u[r], i) *
+                            row_sum.row(order_v[r]);
+                    }
+                }
+            }
+            out.row(0) += ref;
+        }
+
+        /**
+         * Convert the partial derivatives of a homogeneous patch
+         * A = (w S, w) into those of the rational patch S by applying the
+         * quotient rule once for all rows.
+         */
+        template<typename Derived>
+        static void rationalize_derivatives(
+                const Eigen::MatrixBase<Derived>& ders, DerivativeMatrix& out) {
+            constexpr Scalar tol = std::numeric_limits<Scalar>::epsilon();
+            const auto num_rows = ders.rows();
+            out.resize(num_rows, _dim);
+
+            const Scalar w = ders(0, _dim);
+            out.row(0) = ders.row(0).template head<_dim>() / w;
+            if (num_rows == 1) return;
+
+            const Scalar wu = ders(1, _dim);
+            const Scalar wv = ders(2, _dim);
+            out.row(1) = (ders.row(1).template head<_dim>() - wu * out.row(0)) / w;
+            out.row(2) = (ders.row(2).template head<_dim>() - wv * out.row(0)) / w;
+            if (num_rows == 3) return;
+
+            if (w <= tol) {
+                out.template bottomRows<3>().setZero();
+                return;
+            }
+            out.row(3) = (ders.row(3).template head<_dim>()
+                    - 2 * wu * out.row(1) - ders(3, _dim) * out.row(0)) / w;
+            out.row(4) = (ders.row(4).template head<_dim>()
+                    - wu * out.row(2) - wv * out.row(1)
+                    - ders(4, _dim) * out.row(0)) / w;
+            out.row(5) = (ders.row(5).template head<_dim>()
+                    - 2 * wv * out.row(2) - ders(5, _dim) * out.row(0)) / w;
+        }
+
+    protected:
+        /**
+         * Called whenever the control grid or the degrees change.  Patch
+         * types caching data derived from them must drop it here.
+         */
+        virtual void invalidate_cache() {}
+
     protected:
         int m_degree_u = -1;
         int m_degree_v = -1;
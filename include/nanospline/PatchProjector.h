@@ -0,0 +1,397 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <nanospline/BSplinePatch.h>
+#include <nanospline/Exceptions.h>
+#include <nanospline/NURBSPatch.h>
+#include <nanospline/generic_algorithms.h>
+#include <nanospline/internal/parallel_for.h>
+
+namespace nanospline {
+
+namespace internal {
+
+/**
+ * Parameter values where a patch is split into its Bézier pieces along u
+ * and v: the distinct knots within the domain for B-spline patches, and
+ * just the domain bounds otherwise.
+ */
+template <typename PatchType>
+std::vector<typename PatchType::Scalar> patch_breakpoints_u(const PatchType& patch)
+{
+    return {patch.get_u_lower_bound(), patch.get_u_upper_bound()};
+}
+
+template <typename PatchType>
+std::vector<typename PatchType::Scalar> patch_breakpoints_v(const PatchType& patch)
+{
+    return {patch.get_v_lower_bound(), patch.get_v_upper_bound()};
+}
+
+template <typename KnotVector, typename Scalar>
+std::vector<Scalar> distinct_knots_in_range(const KnotVector& knots, Scalar lower, Scalar upper)
+{
+    std::vector<Scalar> breaks{lower};
+    for (Eigen::Index i = 0; i < knots.size(); i++) {
+        if (knots[i] > breaks.back() && knots[i] < upper) {
+            breaks.push_back(knots[i]);
+        }
+    }
+    breaks.push_back(upper);
+    return breaks;
+}
+
+template <typename Scalar, int dim, int degree_u, int degree_v>
+std::vector<Scalar> patch_breakpoints_u(const BSplinePatch<Scalar, dim, degree_u, degree_v>& patch)
+{
+    return distinct_knots_in_range(
+        patch.get_knots_u(), patch.get_u_lower_bound(), patch.get_u_upper_bound());
+}
+
+template <typename Scalar, int dim, int degree_u, int degree_v>
+std::vector<Scalar> patch_breakpoints_v(const BSplinePatch<Scalar, dim, degree_u, degree_v>& patch)
+{
+    return distinct_knots_in_range(
+        patch.get_knots_v(), patch.get_v_lower_bound(), patch.get_v_upper_bound());
+}
+
+template <typename Scalar, int dim, int degree_u, int degree_v>
+std::vector<Scalar> patch_breakpoints_u(const NURBSPatch<Scalar, dim, degree_u, degree_v>& patch)
+{
+    return distinct_knots_in_range(
+        patch.get_knots_u(), patch.get_u_lower_bound(), patch.get_u_upper_bound());
+}
+
+template <typename Scalar, int dim, int degree_u, int degree_v>
+std::vector<Scalar> patch_breakpoints_v(const NURBSPatch<Scalar, dim, degree_u, degree_v>& patch)
+{
+    return distinct_knots_in_range(
+        patch.get_knots_v(), patch.get_v_lower_bound(), patch.get_v_upper_bound());
+}
+
+} // namespace internal
+
+/**
+ * Reusable point projection (inverse evaluation) accelerator for a patch.
+ *
+ * The patch is first split at its knot lines into Bézier pieces, then
+ * each piece is subdivided at the parameter midpoints up to `max_depth`
+ * times.  Every leaf stores the bounding box of its sub-patch control grid,
+ * which contains the sub-patch (for rational patches, as long as the
+ * weights are positive), plus a small grid of samples; interior nodes store
+ * the union of their children's boxes.  All of this is built once.
+ *
+ * A query visits leaves in order of box distance, refines the nearest
+ * sample of each leaf with trust_region_newton_raphson restricted to the
+ * leaf, and stops once the next box is farther than the best point found.
+ * No sub-patch is built and the patch is only evaluated by the Newton
+ * iterations.
+ *
+ * The projector keeps its own copy of the patch.  Queries are const and
+ * may run concurrently.
+ */
+template <typename PatchType>
+class PatchProjector
+{
+public:
+    using Scalar = typename PatchType::Scalar;
+    using Point = typename PatchType::Point;
+    using UVPoint = typename PatchType::UVPoint;
+    static constexpr int dim = Point::ColsAtCompileTime;
+    using PointMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, dim>;
+    using UVMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, 2>;
+
+    struct Projection
+    {
+        UVPoint uv;
+        Scalar distance;
+    };
+
+public:
+    PatchProjector() = default;
+
+    explicit PatchProjector(const PatchType& patch, int max_depth = 3, int num_samples = 3)
+    {
+        initialize(patch, max_depth, num_samples);
+    }
+
+    /**
+     * Build the hierarchy.  Each Bézier piece is subdivided `max_depth`
+     * times, into 4^max_depth leaves, and each leaf is sampled on a
+     * `num_samples` x `num_samples` grid.
+     */
+    void initialize(const PatchType& patch, int max_depth = 3, int num_samples = 3)
+    {
+        if (max_depth < 0) {
+            throw invalid_setting_error("Subdivision depth must be non-negative.");
+        }
+        if (num_samples < 2) {
+            throw invalid_setting_error("At least 2 samples per direction are required.");
+        }
+        m_patch = patch;
+        m_max_depth = max_depth;
+        m_num_samples = num_samples;
+
+        const auto breaks_u = internal::patch_breakpoints_u(m_patch);
+        const auto breaks_v = internal::patch_breakpoints_v(m_patch);
+        m_nodes.clear();
+        m_num_leaves = 0;
+        m_sample_uvs.resize(0, 2);
+        m_sample_points.resize(0, dim);
+        m_leaf_uvs.clear();
+        m_leaf_points.clear();
+        build_span_node(breaks_u,
+            0,
+            static_cast<int>(breaks_u.size()) - 1,
+            breaks_v,
+            0,
+            static_cast<int>(breaks_v.size()) - 1);
+
+        const int samples_per_leaf = num_samples * num_samples;
+        m_sample_uvs.resize(m_num_leaves * samples_per_leaf, 2);
+        m_sample_points.resize(m_num_leaves * samples_per_leaf, dim);
+        for (int i = 0; i < m_num_leaves * samples_per_leaf; i++) {
+            m_sample_uvs.row(i) = m_leaf_uvs[static_cast<size_t>(i)];
+            m_sample_points.row(i) = m_leaf_points[static_cast<size_t>(i)];
+        }
+        m_leaf_uvs.clear();
+        m_leaf_points.clear();
+        m_initialized = true;
+    }
+
+    const PatchType& get_patch() const { return m_patch; }
+    int get_num_nodes() const { return static_cast<int>(m_nodes.size()); }
+    int get_num_leaves() const { return m_num_leaves; }
+
+    /**
+     * Closest point to p on the patch, with its distance.
+     */
+    Projection project(const Point& p) const
+    {
+        if (!m_initialized) {
+            throw invalid_setting_error("PatchProjector is not initialized.");
+        }
+        const int samples_per_leaf = m_num_samples * m_num_samples;
+
+        Projection result{m_sample_uvs.row(0), std::numeric_limits<Scalar>::infinity()};
+        Scalar best_sq_dist = std::numeric_limits<Scalar>::max();
+
+        using Entry = std::pair<Scalar, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        queue.emplace(box_sq_distance(m_nodes[0], p), 0);
+        while (!queue.empty()) {
+            const Entry entry = queue.top();
+            queue.pop();
+            if (entry.first >= best_sq_dist) break;
+
+            const Node& node = m_nodes[static_cast<size_t>(entry.second)];
+            if (node.num_children > 0) {
+                for (int i = 0; i < node.num_children; i++) {
+                    const int child = node.children[i];
+                    const Scalar d = box_sq_distance(m_nodes[static_cast<size_t>(child)], p);
+                    if (d < best_sq_dist) queue.emplace(d, child);
+                }
+                continue;
+            }
+
+            Eigen::Index closest_sample = 0;
+            const Scalar sample_sq_dist =
+                (m_sample_points.middleRows(node.leaf_id * samples_per_leaf, samples_per_leaf)
+                        .rowwise() -
+                    p)
+                    .rowwise()
+                    .squaredNorm()
+                    .minCoeff(&closest_sample);
+            const UVPoint seed = m_sample_uvs.row(node.leaf_id * samples_per_leaf +
+                                                  static_cast<int>(closest_sample));
+            if (sample_sq_dist < best_sq_dist) {
+                best_sq_dist = sample_sq_dist;
+                result.uv = seed;
+            }
+
+            const auto solution = trust_region_newton_raphson(
+                m_patch, p, seed, node.u_min, node.u_max, node.v_min, node.v_max);
+            const Scalar sq_dist = solution.residual * solution.residual;
+            if (sq_dist < best_sq_dist) {
+                best_sq_dist = sq_dist;
+                result.uv = solution.uv;
+            }
+        }
+
+        result.distance = std::sqrt(best_sq_dist);
+        return result;
+    }
+
+    UVPoint inverse_evaluate(const Point& p) const { return project(p).uv; }
+
+    /**
+     * Warm-started variant: tries Newton within `radius` of the guess uv0
+     * first (see nanospline::local_inverse_evaluate) and only searches the
+     * tree if that fails to converge.
+     */
+    UVPoint inverse_evaluate(const Point& p, const UVPoint& uv0, Scalar radius) const
+    {
+        if (!m_initialized) {
+            throw invalid_setting_error("PatchProjector is not initialized.");
+        }
+        UVPoint uv = uv0;
+        if (local_inverse_evaluate(m_patch, p, uv0, radius, uv)) return uv;
+        return inverse_evaluate(p);
+    }
+
+    /**
+     * Parameters of the closest point to each row of `points`.  The rows
+     * are split evenly among `num_threads` threads; 0 means one per
+     * hardware thread.
+     */
+    UVMatrix batch_inverse_evaluate(const PointMatrix& points, int num_threads = 0) const
+    {
+        if (!m_initialized) {
+            throw invalid_setting_error("PatchProjector is not initialized.");
+        }
+        const int num_points = static_cast<int>(points.rows());
+        UVMatrix results(num_points, 2);
+        internal::parallel_for(num_points, num_threads, [&](int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                results.row(i) = inverse_evaluate(points.row(i));
+            }
+        });
+        return results;
+    }
+
+private:
+    struct Node
+    {
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+        Point bbox_min, bbox_max;
+        Scalar u_min, u_max, v_min, v_max;
+        int children[4] = {-1, -1, -1, -1};
+        int num_children = 0;
+        // Index of the leaf's samples, or -1 for an interior node.
+        int leaf_id = -1;
+    };
+
+    /**
+     * Node covering the Bézier pieces [iu0, iu1) x [iv0, iv1).  Splits in
+     * half by piece count until a single piece is left.
+     */
+    int build_span_node(const std::vector<Scalar>& breaks_u,
+        int iu0,
+        int iu1,
+        const std::vector<Scalar>& breaks_v,
+        int iv0,
+        int iv1)
+    {
+        if (iu1 - iu0 == 1 && iv1 - iv0 == 1) {
+            return build_node(breaks_u[static_cast<size_t>(iu0)],
+                breaks_u[static_cast<size_t>(iu1)],
+                breaks_v[static_cast<size_t>(iv0)],
+                breaks_v[static_cast<size_t>(iv1)],
+                0);
+        }
+
+        const int node_id = push_node(breaks_u[static_cast<size_t>(iu0)],
+            breaks_u[static_cast<size_t>(iu1)],
+            breaks_v[static_cast<size_t>(iv0)],
+            breaks_v[static_cast<size_t>(iv1)]);
+        const int mu = iu1 - iu0 > 1 ? (iu0 + iu1) / 2 : iu1;
+        const int mv = iv1 - iv0 > 1 ? (iv0 + iv1) / 2 : iv1;
+        const int u_ranges[3] = {iu0, mu, iu1};
+        const int v_ranges[3] = {iv0, mv, iv1};
+        for (int i = 0; i < 2; i++) {
+            if (u_ranges[i] == u_ranges[i + 1]) continue;
+            for (int j = 0; j < 2; j++) {
+                if (v_ranges[j] == v_ranges[j + 1]) continue;
+                const int child = build_span_node(
+                    breaks_u, u_ranges[i], u_ranges[i + 1], breaks_v, v_ranges[j], v_ranges[j + 1]);
+                add_child(node_id, child);
+            }
+        }
+        return node_id;
+    }
+
+    /**
+     * Node covering [u_min, u_max] x [v_min, v_max] within a single Bézier
+     * piece, subdivided at the midpoints until `depth` reaches max depth.
+     */
+    int build_node(Scalar u_min, Scalar u_max, Scalar v_min, Scalar v_max, int depth)
+    {
+        const int node_id = push_node(u_min, u_max, v_min, v_max);
+        if (depth < m_max_depth) {
+            const Scalar u_mid = (u_min + u_max) / 2;
+            const Scalar v_mid = (v_min + v_max) / 2;
+            add_child(node_id, build_node(u_min, u_mid, v_min, v_mid, depth + 1));
+            add_child(node_id, build_node(u_mid, u_max, v_min, v_mid, depth + 1));
+            add_child(node_id, build_node(u_min, u_mid, v_mid, v_max, depth + 1));
+            add_child(node_id, build_node(u_mid, u_max, v_mid, v_max, depth + 1));
+            return node_id;
+        }
+
+        const auto piece = m_patch.subpatch(u_min, u_max, v_min, v_max);
+        const auto& ctrl_pts = piece.get_control_grid();
+        Node& node = m_nodes[static_cast<size_t>(node_id)];
+        node.bbox_min = ctrl_pts.colwise().minCoeff();
+        node.bbox_max = ctrl_pts.colwise().maxCoeff();
+        node.leaf_id = m_num_leaves++;
+
+        for (int i = 0; i < m_num_samples; i++) {
+            const Scalar u = u_min + (u_max - u_min) * i / (m_num_samples - 1);
+            for (int j = 0; j < m_num_samples; j++) {
+                const Scalar v = v_min + (v_max - v_min) * j / (m_num_samples - 1);
+                m_leaf_uvs.push_back(UVPoint(u, v));
+                m_leaf_points.push_back(m_patch.evaluate(u, v));
+            }
+        }
+        return node_id;
+    }
+
+    int push_node(Scalar u_min, Scalar u_max, Scalar v_min, Scalar v_max)
+    {
+        Node node;
+        node.bbox_min.setConstant(std::numeric_limits<Scalar>::max());
+        node.bbox_max.setConstant(std::numeric_limits<Scalar>::lowest());
+        node.u_min = u_min;
+        node.u_max = u_max;
+        node.v_min = v_min;
+        node.v_max = v_max;
+        m_nodes.push_back(node);
+        return static_cast<int>(m_nodes.size()) - 1;
+    }
+
+    void add_child(int node_id, int child_id)
+    {
+        Node& node = m_nodes[static_cast<size_t>(node_id)];
+        const Node& child = m_nodes[static_cast<size_t>(child_id)];
+        node.children[node.num_children++] = child_id;
+        node.bbox_min = node.bbox_min.cwiseMin(child.bbox_min);
+        node.bbox_max = node.bbox_max.cwiseMax(child.bbox_max);
+    }
+
+    static Scalar box_sq_distance(const Node& node, const Point& p)
+    {
+        return (p.cwiseMax(node.bbox_min).cwiseMin(node.bbox_max) - p).squaredNorm();
+    }
+
+private:
+    PatchType m_patch;
+    std::vector<Node, Eigen::aligned_allocator<Node>> m_nodes;
+    UVMatrix m_sample_uvs;
+    PointMatrix m_sample_points;
+    std::vector<UVPoint, Eigen::aligned_allocator<UVPoint>> m_leaf_uvs;
+    std::vector<Point, Eigen::aligned_allocator<Point>> m_leaf_points;
+    int m_max_depth = 3;
+    int m_num_samples = 3;
+    int m_num_leaves = 0;
+    bool m_initialized = false;
+};
+
+} // namespace nanospline
@@ -1,17 +1,280 @@
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 #include <Eigen/Eigenvalues>
 
 #include <nanospline/Exceptions.h>
+#include <nanospline/internal/bernstein.h>
 
 namespace nanospline
 {
+namespace internal
+{
+/**
+ * Refine a root of sum_i coeffs[i] * t^i, i <= degree, with a few Newton
+ * steps, keeping the best iterate so that polishing never hurts.  Steps
+ * are limited to the error of a closed-form triple root, cbrt(ulp): near a
+ * multiple root the derivative vanishes and a full step may land on
+ * another root.
+ */
+template <typename Scalar>
+Scalar polish_polynomial_root(const std::vector<Scalar> &coeffs, const int degree, Scalar t)
+{
+    using std::abs;
+    auto residual = [&](const Scalar x, Scalar &derivative) {
+        Scalar value = coeffs[static_cast<size_t>(degree)];
+        derivative = 0;
+        for (int i = degree - 1; i >= 0; --i)
+        {
+            derivative = derivative * x + value;
+            value = value * x + coeffs[static_cast<size_t>(i)];
+        }
+        return value;
+    };
+
+    const Scalar max_step =
+        std::cbrt(std::numeric_limits<Scalar>::epsilon()) * std::max(Scalar(1), abs(t));
+    Scalar derivative;
+    Scalar value = residual(t, derivative);
+    for (int i = 0; i < 4 && value != 0 && derivative != 0; ++i)
+    {
+        const Scalar step = value / derivative;
+        if (!(abs(step) <= max_step))
+            break;
+        const Scalar next = t - step;
+        Scalar next_derivative;
+        const Scalar next_value = residual(next, next_derivative);
+        if (!(abs(next_value) < abs(value)))
+            break;
+        t = next;
+        value = next_value;
+        derivative = next_derivative;
+    }
+    return t;
+}
+
+/**
+ * Whether the complex pair re +/- i im is close enough to the real axis to
+ * be reported as a double real root.  This is the companion matrix test,
+ * |z| - |re| <= eps, which accepts imaginary parts up to about
+ * sqrt(2 eps |re|).  A double root perturbed by rounding becomes a complex
+ * pair whose imaginary part is of the order of sqrt(ulp), far above eps.
+ */
+template <typename Scalar>
+bool is_nearly_real(const Scalar re, const Scalar im, const Scalar eps)
+{
+    using std::abs;
+    return std::hypot(re, im) - abs(re) <= eps;
+}
+
+/**
+ * Append the real roots of y^2 + b y + c.  A complex pair that is nearly
+ * real as a root t = y - shift of the caller's polynomial (see
+ * is_nearly_real) is reported as a double root, once.
+ */
+template <typename Scalar>
+void solve_monic_quadratic(const Scalar b, const Scalar c, std::vector<Scalar> &roots, const Scalar eps, const Scalar shift = 0)
+{
+    using std::abs;
+    const Scalar discr = b * b - 4 * c;
+    if (discr < 0)
+    {
+        if (is_nearly_real(-b / 2 - shift, std::sqrt(-discr) / 2, eps))
+            roots.push_back(-b / 2);
+        return;
+    }
+
+    // Avoid the cancellation in -b + sqrt(discr) by recovering the smaller
+    // root from the product of the roots.
+    const Scalar sqrt_discr = std::sqrt(discr);
+    const Scalar q = -(b + (b < 0 ? -sqrt_discr : sqrt_discr)) / 2;
+    if (q == 0)
+    {
+        roots.push_back(0);
+        return;
+    }
+    roots.push_back(q);
+    if (sqrt_discr > 0)
+        roots.push_back(c / q);
+}
+
+/**
+ * Append the real roots of t^3 + a t^2 + b t + c: trigonometric formula
+ * when all three roots are real, Cardano's formula otherwise.  A nearly
+ * real complex pair (see is_nearly_real) is reported as a double root.
+ */
+template <typename Scalar>
+void solve_monic_cubic(const Scalar a, const Scalar b, const Scalar c, std::vector<Scalar> &roots, const Scalar eps)
+{
+    using std::abs;
+    // Depressed cubic x^3 + p x + q with t = x - a / 3.
+    const Scalar shift = a / 3;
+    const Scalar p = b - a * shift;
+    const Scalar q = (2 * shift * shift - b) * shift + c;
+    const Scalar half_q = q / 2;
+    const Scalar third_p = p / 3;
+    const Scalar discr = half_q * half_q + third_p * third_p * third_p;
+
+    if (p == 0 && q == 0)
+    {
+        roots.push_back(-shift);
+        return;
+    }
+
+    if (discr <= 0)
+    {
+        // Three real roots, 2 sqrt(-p/3) cos(phi/3 - 2 pi k / 3).
+        const Scalar r = std::sqrt(-third_p);
+        const Scalar cos_phi = std::max(Scalar(-1), std::min(Scalar(1), -half_q / (r * r * r)));
+        const Scalar phi = std::acos(cos_phi);
+        const Scalar two_pi_3 = 2 * std::acos(Scalar(-1)) / 3;
+        for (int k = 0; k < 3; ++k)
+            roots.push_back(2 * r * std::cos(phi / 3 - two_pi_3 * Scalar(k)) - shift);
+        return;
+    }
+
+    // One real root.  Choosing the sign of A after q avoids cancellation.
+    const Scalar A = -std::cbrt(half_q + (half_q < 0 ? -std::sqrt(discr) : std::sqrt(discr)));
+    const Scalar B = (A == 0) ? Scalar(0) : -third_p / A;
+    roots.push_back(A + B - shift);
+    if (is_nearly_real(-(A + B) / 2 - shift, std::sqrt(Scalar(3)) / 2 * abs(A - B), eps))
+        roots.push_back(-(A + B) / 2 - shift);
+}
+} // namespace internal
+
+/**
+ * Compute the real roots in [t0, t1] of a real polynomial of any degree
+ * without going through the complex plane.
+ * The coeffs are assumed to be from zero to degree.
+ *
+ * The polynomial is converted to Bernstein form over [t0, t1] and the
+ * interval is subdivided until Descartes' rule of signs isolates each
+ * root, which is then refined by bracketing.  Only the real roots inside
+ * the interval are ever computed, and the Bernstein basis is much better
+ * conditioned than the companion matrix for high degrees.  Roots of even
+ * multiplicity are found among the critical points.  Roots are reported
+ * in increasing order; a multiple root is reported once.
+ *
+ * Leading coefficients smaller than eps are dropped, as in
+ * PolynomialRootFinder.
+ */
+template <typename Scalar>
+class BernsteinRootFinder
+{
+    public:
+    static void find_real_roots_in_interval(const std::vector<Scalar> &coeffs, std::vector<Scalar> &roots, const Scalar t0, const Scalar t1, const Scalar eps)
+    {
+        using std::abs;
+        assert(t0 < t1);
+
+        size_t num_coeffs = coeffs.size();
+        while (num_coeffs > 0 && abs(coeffs[num_coeffs - 1]) < eps)
+            --num_coeffs;
+
+        if (num_coeffs == 0)
+            throw infinite_root_error();
+        if (num_coeffs == 1)
+            return;
+
+        std::vector<Scalar> power(coeffs);
+        power.resize(num_coeffs);
+        const std::vector<Scalar> bernstein = internal::power_to_bernstein(power, t0, t1);
+
+        // Converting the magnitudes instead bounds the magnitude of every
+        // term summed above, hence the rounding error of the conversion.
+        for (auto &c : power)
+            c = abs(c);
+        const std::vector<Scalar> magnitudes =
+            internal::power_to_bernstein(power, abs(t0), abs(t0) + (t1 - t0));
+
+        find_roots(bernstein, roots, t0, t1, internal::zero_tolerance(magnitudes));
+    }
+
+    /**
+     * Same as find_real_roots_in_interval, but with the polynomial given
+     * by its Bernstein coefficients over [t0, t1], which skips the
+     * conversion and its rounding.  Throws infinite_root_error if no
+     * coefficient exceeds eps in magnitude.
+     */
+    static void find_real_roots_in_bernstein_form(const std::vector<Scalar> &bernstein, std::vector<Scalar> &roots, const Scalar t0, const Scalar t1, const Scalar eps)
+    {
+        using std::abs;
+        assert(t0 < t1);
+
+        bool vanishes = true;
+        for (const Scalar c : bernstein)
+            vanishes = vanishes && abs(c) <= eps;
+        if (vanishes)
+            throw infinite_root_error();
+        if (bernstein.size() == 1)
+            return;
+
+        find_roots(bernstein, roots, t0, t1, internal::zero_tolerance(bernstein));
+    }
+
+    private:
+    static void find_roots(const std::vector<Scalar> &bernstein, std::vector<Scalar> &roots, const Scalar t0, const Scalar t1, const Scalar zero_tol)
+    {
+        using std::abs;
+        const size_t num_coeffs = bernstein.size();
+
+        std::vector<Scalar> result;
+        internal::isolate_bernstein_roots(bernstein, t0, t1, result, zero_tol);
+
+        // Roots at the subdivision points are reported by both halves.
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+
+        // Roots of even multiplicity, such as those of the squared speed
+        // solved for singularities, need not change sign.  They are the
+        // critical points where the polynomial vanishes up to rounding,
+        // unless rounding already split them into nearby simple roots.
+        const size_t degree = num_coeffs - 1;
+        std::vector<Scalar> derivative(degree);
+        for (size_t i = 0; i < degree; i++)
+            derivative[i] = Scalar(degree) * (bernstein[i + 1] - bernstein[i]);
+        std::vector<Scalar> critical_points;
+        internal::isolate_bernstein_roots(
+            derivative, t0, t1, critical_points, 2 * Scalar(degree) * zero_tol);
+
+        std::vector<Scalar> scratch(num_coeffs);
+        auto value_at = [&](const Scalar t) {
+            return internal::evaluate_bernstein(bernstein, (t - t0) / (t1 - t0), scratch);
+        };
+        std::vector<Scalar> tangential_roots;
+        for (const Scalar c : critical_points)
+        {
+            if (abs(value_at(c)) > zero_tol)
+                continue;
+            const auto next = std::lower_bound(result.begin(), result.end(), c);
+            bool split = false;
+            if (next != result.end())
+                split = split || abs(value_at((c + *next) / 2)) <= zero_tol;
+            if (next != result.begin())
+                split = split || abs(value_at((c + *(next - 1)) / 2)) <= zero_tol;
+            if (!split)
+                tangential_roots.push_back(c);
+        }
+
+        result.insert(result.end(), tangential_roots.begin(), tangential_roots.end());
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        roots.insert(roots.end(), result.begin(), result.end());
+    }
+};
+
 /**
  * Compute the roots for a real polynomial of degree _degree.
  * The coeffs are assumed to be from zero to degree.
+ *
+ * Degrees up to 4 are solved in closed form.  Higher degrees use the
+ * eigenvalues of the companion matrix, or BernsteinRootFinder if
+ * NANOSPLINE_BERNSTEIN_ROOT_FINDER is defined.
  */
 template <typename Scalar, int _degree>
 class PolynomialRootFinder
@@ -33,6 +296,11 @@ class PolynomialRootFinder
             return;
         }
 
+#ifdef NANOSPLINE_BERNSTEIN_ROOT_FINDER
+        std::vector<Scalar> truncated(coeffs);
+        truncated.resize(static_cast<size_t>(_degree) + 1);
+        BernsteinRootFinder<Scalar>::find_real_roots_in_interval(truncated, roots, t0, t1, eps);
+#else
         typedef Eigen::Matrix<Scalar, _degree, _degree> MatType;
 
         MatType companion;
@@ -58,6 +326,116 @@ class PolynomialRootFinder
             if (current_t >= t0 && current_t <= t1)
                 roots.push_back(current_t);
         }
+#endif
+    }
+};
+
+/**
+ * Cubic, solved in closed form and polished with Newton's method.
+ */
+template <typename Scalar>
+class PolynomialRootFinder<Scalar, 3>
+{
+    public:
+    static void find_real_roots_in_interval(const std::vector<Scalar> &coeffs, std::vector<Scalar> &roots, const Scalar t0, const Scalar t1, const Scalar eps)
+    {
+        using std::abs;
+        assert(coeffs.size() > 3);
+
+        //Largest degree is zero, the polynomial is one degree less
+        if (abs(coeffs[3]) < eps)
+        {
+            PolynomialRootFinder<Scalar, 2>::find_real_roots_in_interval(coeffs, roots, t0, t1, eps);
+            return;
+        }
+
+        std::vector<Scalar> candidates;
+        internal::solve_monic_cubic(
+            coeffs[2] / coeffs[3], coeffs[1] / coeffs[3], coeffs[0] / coeffs[3], candidates, eps);
+
+        for (const Scalar candidate : candidates)
+        {
+            const Scalar root = internal::polish_polynomial_root(coeffs, 3, candidate);
+            if (root >= t0 && root <= t1)
+                roots.push_back(root);
+        }
+    }
+};
+
+/**
+ * Quartic, solved in closed form by Ferrari's method and polished with
+ * Newton's method.
+ */
+template <typename Scalar>
+class PolynomialRootFinder<Scalar, 4>
+{
+    public:
+    static void find_real_roots_in_interval(const std::vector<Scalar> &coeffs, std::vector<Scalar> &roots, const Scalar t0, const Scalar t1, const Scalar eps)
+    {
+        using std::abs;
+        assert(coeffs.size() > 4);
+
+        //Largest degree is zero, the polynomial is one degree less
+        if (abs(coeffs[4]) < eps)
+        {
+            PolynomialRootFinder<Scalar, 3>::find_real_roots_in_interval(coeffs, roots, t0, t1, eps);
+            return;
+        }
+
+        const Scalar a = coeffs[3] / coeffs[4];
+        const Scalar b = coeffs[2] / coeffs[4];
+        const Scalar c = coeffs[1] / coeffs[4];
+        const Scalar d = coeffs[0] / coeffs[4];
+
+        // Depressed quartic y^4 + p y^2 + q y + r with t = y - a / 4.
+        const Scalar shift = a / 4;
+        const Scalar shift2 = shift * shift;
+        const Scalar p = b - 6 * shift2;
+        const Scalar q = c - 2 * b * shift + 8 * shift2 * shift;
+        const Scalar r = d - c * shift + b * shift2 - 3 * shift2 * shift2;
+
+        std::vector<Scalar> ys;
+
+        // Largest root of the resolvent cubic, for which
+        // y^4 + p y^2 + q y + r = (y^2 + p/2 + m)^2 - (s y - q / (2 s))^2
+        // with s = sqrt(2 m).
+        std::vector<Scalar> resolvent;
+        internal::solve_monic_cubic(p, p * p / 4 - r, -q * q / 8, resolvent, Scalar(0));
+        const Scalar m = *std::max_element(resolvent.begin(), resolvent.end());
+
+        if (m > 0 && abs(q) >= eps)
+        {
+            const Scalar s = std::sqrt(2 * m);
+            const Scalar base = p / 2 + m;
+            const Scalar offset = q / (2 * s);
+            internal::solve_monic_quadratic(-s, base + offset, ys, eps, shift);
+            internal::solve_monic_quadratic(s, base - offset, ys, eps, shift);
+        }
+        else
+        {
+            // Biquadratic: z^2 + p z + r with z = y^2.
+            std::vector<Scalar> zs;
+            internal::solve_monic_quadratic(p, r, zs, eps);
+            for (const Scalar z : zs)
+            {
+                if (z > 0)
+                {
+                    ys.push_back(std::sqrt(z));
+                    ys.push_back(-std::sqrt(z));
+                }
+                else if (z > -eps)
+                {
+                    ys.push_back(0);
+                }
+            }
+        }
+
+        for (const Scalar y : ys)
+        {
+            const Scalar root = internal::polish_polynomial_root(coeffs, 4, y - shift);
+            if (root >= t0 && root <= t1)
+                roots.push_back(root);
+        }
     }
 };
 
@@ -5,12 +5,8 @@
 #include <nanospline/Bezier.h>
 #include <nanospline/BezierBase.h>
 #include <nanospline/Exceptions.h>
-
-#if NANOSPLINE_SYMPY
-#include <nanospline/internal/auto_inflection_RationalBezier.h>
-#include <nanospline/internal/auto_match_tangent_RationalBezier.h>
-#include <nanospline/internal/auto_singularity_RationalBezier.h>
-#endif
+#include <nanospline/internal/closest_point.h>
+#include <nanospline/internal/curve_polynomials.h>
 
 namespace nanospline {
 
@@ -25,6 +21,9 @@ public:
     using ControlPoints = typename Base::ControlPoints;
     using WeightVector = Eigen::Matrix<_Scalar, _generic ? Eigen::Dynamic : _degree + 1, 1>;
     using BezierHomogeneous = Bezier<_Scalar, _dim + 1, _degree, _generic>;
+    using ParameterVector = typename Base::ParameterVector;
+    using PointMatrix = typename Base::PointMatrix;
+    using DerivativeMatrix = typename Base::DerivativeMatrix;
 
 public:
     Point evaluate(Scalar t) const override
@@ -34,9 +33,23 @@ public:
         return p.template head<_dim>() / p[_dim];
     }
 
+    Point evaluate(Scalar t, EvaluationWorkspace<Scalar>& workspace) const override
+    {
+        validate_initialization();
+        auto p = m_bezier_homogeneous.evaluate(t, workspace);
+        return p.template head<_dim>() / p[_dim];
+    }
+
+    using Base::inverse_evaluate;
+
     Scalar inverse_evaluate(const Point& p) const override
     {
-        throw not_implemented_error("Too complex, sigh");
+        validate_initialization();
+        Scalar t = 0;
+        Scalar sq_dist = std::numeric_limits<Scalar>::max();
+        internal::rational_bezier_closest_point(
+            m_bezier_homogeneous.get_control_points(), p, Scalar(0), Scalar(1), t, sq_dist);
+        return t;
     }
 
     Point evaluate_derivative(Scalar t) const override
@@ -62,9 +75,77 @@ public:
         return (d2.template head<_dim>() - d2[_dim] * c0 - 2 * d1[_dim] * c1) / p0[_dim];
     }
 
+    using Base::evaluate_derivatives;
+
+    /**
+     * Derivatives of the homogeneous curve A(t) = w(t) C(t), corrected with
+     * C^(k) = (A^(k) - sum_{i=1}^{k} binom(k, i) w^(i) C^(k-i)) / w
+     * (The NURBS Book, algorithm A4.2).
+     */
+    void evaluate_derivatives(Scalar t, int k, PointMatrix& out) const override
+    {
+        validate_initialization();
+        typename BezierHomogeneous::PointMatrix ders;
+        m_bezier_homogeneous.evaluate_derivatives(t, k, ders);
+        rationalize_derivatives(ders, out);
+    }
+
+    void evaluate_derivatives(Scalar t, int k, DerivativeMatrix& out) const override
+    {
+        Base::check_derivative_order(k);
+        validate_initialization();
+        typename BezierHomogeneous::DerivativeMatrix ders;
+        m_bezier_homogeneous.evaluate_derivatives(t, k, ders);
+        rationalize_derivatives(ders, out);
+    }
+
+    using Base::batch_evaluate;
+    using Base::batch_evaluate_derivative;
+    using Base::batch_evaluate_2nd_derivative;
+
+    void batch_evaluate(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        validate_initialization();
+        typename BezierHomogeneous::PointMatrix p;
+        m_bezier_homogeneous.batch_evaluate(ts, p);
+        out = p.template leftCols<_dim>().array().colwise() / p.col(_dim).array();
+    }
+
+    void batch_evaluate_derivative(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        validate_initialization();
+        typename BezierHomogeneous::PointMatrix p, d;
+        m_bezier_homogeneous.batch_evaluate(ts, p);
+        m_bezier_homogeneous.batch_evaluate_derivative(ts, d);
+
+        out.resize(ts.size(), _dim);
+        for (Eigen::Index i = 0; i < ts.size(); i++) {
+            const Scalar w = p(i, _dim);
+            const Point c0 = p.row(i).template head<_dim>() / w;
+            out.row(i) = (d.row(i).template head<_dim>() - c0 * d(i, _dim)) / w;
+        }
+    }
+
+    void batch_evaluate_2nd_derivative(const ParameterVector& ts, PointMatrix& out) const override
+    {
+        validate_initialization();
+        typename BezierHomogeneous::PointMatrix p0, d1, d2;
+        m_bezier_homogeneous.batch_evaluate(ts, p0);
+        m_bezier_homogeneous.batch_evaluate_derivative(ts, d1);
+        m_bezier_homogeneous.batch_evaluate_2nd_derivative(ts, d2);
+
+        out.resize(ts.size(), _dim);
+        for (Eigen::Index i = 0; i < ts.size(); i++) {
+            const Scalar w = p0(i, _dim);
+            const Point c0 = p0.row(i).template head<_dim>() / w;
+            const Point c1 = (d1.row(i).template head<_dim>() - c0 * d1(i, _dim)) / w;
+            out.row(i) =
+                (d2.row(i).template head<_dim>() - d2(i, _dim) * c0 - 2 * d1(i, _dim) * c1) / w;
+        }
+    }
+
     std::vector<Scalar> compute_inflections(const Scalar lower, const Scalar upper) const override
     {
-#if NANOSPLINE_SYMPY
         if (_dim != 2) {
             throw std::runtime_error("Inflection computation is for 2D curves only");
         }
@@ -75,8 +156,12 @@ public:
 
         std::vector<Scalar> res;
         try {
-            res = internal::compute_RationalBezier_inflections(
-                Base::m_control_points, m_weights, lower, upper);
+            res = internal::bernstein_roots_in_range(
+                internal::rational_bezier_inflection_polynomial(
+                    m_bezier_homogeneous.get_control_points()),
+                lower,
+                upper,
+                true);
         } catch (infinite_root_error&) {
             res.clear();
         }
@@ -85,15 +170,10 @@ public:
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
     std::vector<Scalar> reduce_turning_angle(const Scalar lower, const Scalar upper) const override
     {
-#if NANOSPLINE_SYMPY
         constexpr Scalar tol = static_cast<Scalar>(1e-8);
         if (_dim != 2) {
             throw std::runtime_error("Turning angle reduction is for 2D curves only");
@@ -120,8 +200,11 @@ public:
 
         std::vector<Scalar> res;
         try {
-            res = nanospline::internal::match_tangent_rational_bezier(
-                Base::m_control_points, m_weights, degree, ave_tangent, lower, upper);
+            res = internal::bernstein_roots_in_range(
+                internal::rational_bezier_tangent_polynomial(
+                    m_bezier_homogeneous.get_control_points(), ave_tangent),
+                lower,
+                upper);
         } catch (infinite_root_error&) {
             res.clear();
         }
@@ -130,31 +213,31 @@ public:
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
     std::vector<Scalar> compute_singularities(
         const Scalar lower = 0.0, const Scalar upper = 1.0) const override
     {
-#if NANOSPLINE_SYMPY
         if (_dim != 2) {
             throw std::runtime_error("Singularity computation is for 2D curves only");
         }
 
-        std::vector<Scalar> res = nanospline::internal::compute_RationalBezier_singularities(
-            Base::m_control_points, m_weights, lower, upper);
+        std::vector<Scalar> res;
+        try {
+            res = internal::bernstein_roots_in_range(
+                internal::rational_bezier_singularity_polynomial(
+                    m_bezier_homogeneous.get_control_points()),
+                lower,
+                upper);
+        } catch (infinite_root_error&) {
+            // Collapsed to a point.
+            res.clear();
+        }
 
         std::sort(res.begin(), res.end());
         res.erase(std::unique(res.begin(), res.end()), res.end());
 
         return res;
-#else
-        throw not_implemented_error("This feature require 'NANOSPLINE_SYMPY' compiler flag.");
-        return {};
-#endif
     }
 
 public:
@@ -168,6 +251,20 @@ public:
         m_bezier_homogeneous.set_control_points(std::move(ctrl_pts));
     }
 
+    /**
+     * The mode applies to the homogeneous curve, which does the evaluation,
+     * so it is a no-op for the degree 0, 1 and 2 specializations.
+     */
+    void set_evaluation_mode(EvaluationMode mode) override
+    {
+        m_bezier_homogeneous.set_evaluation_mode(mode);
+    }
+
+    EvaluationMode get_evaluation_mode() const override
+    {
+        return m_bezier_homogeneous.get_evaluation_mode();
+    }
+
     const WeightVector& get_weights() const { return m_weights; }
 
     template <typename Derived>
@@ -187,7 +284,9 @@ public:
     void set_homogeneous(const BezierHomogeneous& homogeneous)
     {
         const auto ctrl_pts = homogeneous.get_control_points();
+        const auto mode = get_evaluation_mode();
         m_bezier_homogeneous = homogeneous;
+        m_bezier_homogeneous.set_evaluation_mode(mode);
         m_weights = ctrl_pts.template rightCols<1>();
         Base::m_control_points =
             ctrl_pts.template leftCols<_dim>().array().colwise() / m_weights.array();
@@ -212,6 +311,24 @@ public:
     }
 
 private:
+    template <typename HomogeneousDerived, typename Derived>
+    static void rationalize_derivatives(const Eigen::MatrixBase<HomogeneousDerived>& ders,
+        Eigen::PlainObjectBase<Derived>& out)
+    {
+        const auto k = ders.rows() - 1;
+        out.resize(k + 1, _dim);
+        const Scalar w = ders(0, _dim);
+        for (Eigen::Index r = 0; r <= k; r++) {
+            Point v = ders.row(r).template head<_dim>();
+            Scalar binom = 1;
+            for (Eigen::Index i = 1; i <= r; i++) {
+                binom = binom * Scalar(r - i + 1) / Scalar(i);
+                v -= binom * ders(i, _dim) * out.row(r - i);
+            }
+            out.row(r) = v / w;
+        }
+    }
+
     void validate_initialization() const
     {
         const auto& ctrl_pts = m_bezier_homogeneous.get_control_points();
@@ -3,8 +3,14 @@
 #include <string>
 #include <iostream>
 
+#include <nanospline/tessellate.h>
+
 namespace nanospline
 {
+/**
+ * Write the curve as an SVG path of num_samples line segments (see
+ * tessellate), optionally followed by its control points.
+ */
 template <typename SplineType, typename Matrix>
 void to_svg(std::ostream &out, SplineType &curve, const Matrix &offset, typename SplineType::Scalar scaling = 1,
             bool export_ctrl = true,
@@ -13,19 +19,15 @@ void to_svg(std::ostream &out, SplineType &curve, const Matrix &offset, typename
             int num_samples = 1e3)
 {
     //TODO: maybe approximate this curve into many cubic beziers
-    using Scalar = typename SplineType::Scalar;
     const auto &control_points = curve.get_control_points();
     assert(control_points.cols() == 2);
     const auto num_control_points = control_points.rows();
 
-    const auto min_t = curve.get_domain_lower_bound();
-    const auto max_t = curve.get_domain_upper_bound();
+    const auto points = tessellate(curve, num_samples);
     out << "<path d=\"";
-    for (int i = 0; i < num_samples + 1; i++)
+    for (int i = 0; i < points.rows(); i++)
     {
-        auto t = min_t + Scalar(i) / Scalar(num_samples) * (max_t - min_t);
-        t = std::max(min_t, std::min(max_t, t));
-        const auto p = curve.evaluate(t);
+        const auto p = points.row(i);
         if (i == 0)
         {
             out << "M" << (p[0] + offset[0]) * scaling << "," << (p[1] + offset[1]) * scaling << " ";
@@ -54,6 +56,9 @@ void to_svg(std::ostream &out, SplineType &curve, const Matrix &offset, typename
     return;
 }
 
+/**
+ * Same as to_svg, in EPS.
+ */
 template <typename SplineType, typename Matrix>
 void to_eps(std::ostream &out, SplineType &curve, const Matrix &offset, typename SplineType::Scalar scaling = 1,
             bool export_ctrl = true,
@@ -62,21 +67,17 @@ void to_eps(std::ostream &out, SplineType &curve, const Matrix &offset, typename
             int num_samples = 1e3)
 {
     //TODO: maybe approximate this curve into many cubic beziers
-    using Scalar = typename SplineType::Scalar;
     const auto &control_points = curve.get_control_points();
     assert(control_points.cols() == 2);
     const auto num_control_points = control_points.rows();
 
-    const auto min_t = curve.get_domain_lower_bound();
-    const auto max_t = curve.get_domain_upper_bound();
+    const auto points = tessellate(curve, num_samples);
     out << color <<" setrgbcolor\n";
     out << line_width << " setlinewidth\n";
 
-    for (int i = 0; i < num_samples + 1; i++)
+    for (int i = 0; i < points.rows(); i++)
     {
-        auto t = min_t + Scalar(i) / Scalar(num_samples) * (max_t - min_t);
-        t = std::max(min_t, std::min(max_t, t));
-        const auto p = curve.evaluate(t);
+        const auto p = points.row(i);
         if (i == 0)
         {
             out << (p[0] + offset[0]) * scaling << " " << (p[1] + offset[1]) * scaling << " moveto\n";
@@ -1,6 +0,0 @@
-#pragma once
-#if !defined(NANOSPLINE_HEADER_ONLY) //&& defined(NANOSPLINE_SYMPY)
-#include "forward_declaration_inflection.h"
-#include "forward_declaration_match_tangent.h"
-#include "forward_declaration_singularity.h"
-#endif
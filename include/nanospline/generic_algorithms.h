@@ -0,0 +1,488 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+
+namespace nanospline {
+
+/**
+ * Algorithms templated on the curve or patch type instead of going through
+ * the virtual CurveBase/PatchBase interface.  Called with a concrete final
+ * type such as Bezier<double, 3, 3>, every evaluation below is resolved at
+ * compile time and can be inlined.  The virtual member functions of
+ * CurveBase and PatchBase forward to these with `*this`, so both paths run
+ * the same code.  Bezier, RationalBezier, BSpline, NURBS, BezierPatch and
+ * BSplinePatch are final for this reason, and cannot be derived from.
+ *
+ * Static curve interface: `Scalar`, `Point`, `DerivativeMatrix`,
+ * `get_dim()`, `evaluate(t)`, `evaluate_derivative(t)`,
+ * `evaluate_2nd_derivative(t)`,
+ * `evaluate_derivatives(t, k, DerivativeMatrix&)` for k <= 2,
+ * `get_domain_lower_bound()` and `get_domain_upper_bound()`.
+ * DerivativeMatrix has a fixed capacity of 3 rows, so none of the curve
+ * algorithms below allocate.
+ *
+ * Static patch interface: `Scalar`, `Point`, `UVPoint`, `DerivativeMatrix`,
+ * `evaluate_all(u, v, max_order, DerivativeMatrix&)` and the
+ * `get_{u,v}_{lower,upper}_bound()` accessors.
+ */
+
+/**
+ * Curvature vector of `curve` at t.
+ */
+template <typename CurveType>
+typename CurveType::Point evaluate_curvature(
+    const CurveType& curve, const typename CurveType::Scalar t)
+{
+    using Point = typename CurveType::Point;
+    const Point d1 = curve.evaluate_derivative(t);
+    const Point d2 = curve.evaluate_2nd_derivative(t);
+
+    const auto sq_speed = d1.squaredNorm();
+    if (sq_speed == 0) {
+        return Point::Zero();
+    } else {
+        return (d2 - d1 * (d1.dot(d2)) / sq_speed) / sq_speed;
+    }
+}
+
+/**
+ * Newton-Raphson iterations minimizing |curve(t) - p| starting from t,
+ * clamped to [lower, upper].
+ */
+template <typename CurveType>
+typename CurveType::Scalar newton_raphson(const CurveType& curve,
+    const typename CurveType::Point& p,
+    typename CurveType::Scalar t,
+    const int num_iterations,
+    const typename CurveType::Scalar tol,
+    const typename CurveType::Scalar lower,
+    const typename CurveType::Scalar upper)
+{
+    using Scalar = typename CurveType::Scalar;
+    using Point = typename CurveType::Point;
+    Scalar prev_t = t;
+    Scalar prev_err = -1;
+    typename CurveType::DerivativeMatrix ders;
+    for (int i = 0; i < num_iterations; i++) {
+        curve.evaluate_derivatives(t, 2, ders);
+        const Point d0 = ders.row(0);
+        const Point d1 = ders.row(1);
+        const Point d2 = ders.row(2);
+        const auto f = (p - d0).dot(d1);
+        const auto df = (p - d0).dot(d2) - d1.squaredNorm();
+        const auto err = std::abs(f);
+        if (err < tol) return t;
+        if (prev_err > 0 && err > prev_err) return prev_t;
+
+        prev_err = err;
+        prev_t = t;
+
+        t -= f / df;
+        if (t <= lower) return lower;
+        if (t >= upper) return upper;
+    }
+    return t;
+}
+
+/**
+ * Closest point search by uniform sampling of [lower, upper], refined
+ * `level` times around the best sample and finished with Newton-Raphson.
+ */
+template <typename CurveType>
+typename CurveType::Scalar approximate_inverse_evaluate(const CurveType& curve,
+    const typename CurveType::Point& p,
+    const int num_samples,
+    const typename CurveType::Scalar lower,
+    const typename CurveType::Scalar upper,
+    const int level)
+{
+    using Scalar = typename CurveType::Scalar;
+    assert(num_samples > 0);
+    const Scalar delta_t = (upper - lower) / num_samples;
+
+    Scalar min_t = 0.0;
+    Scalar min_dist = std::numeric_limits<Scalar>::max();
+    for (int i = 0; i <= num_samples; i++) {
+        const Scalar t = lower + (Scalar)(i) / (Scalar)(num_samples) * (upper - lower);
+        const auto q = curve.evaluate(t);
+        const auto dist = (p - q).squaredNorm();
+        if (dist < min_dist) {
+            min_dist = dist;
+            min_t = t;
+        }
+    }
+
+    if (level <= 0) {
+        constexpr Scalar TOL = std::numeric_limits<Scalar>::epsilon() * 100;
+        return newton_raphson(curve, p, min_t, 10, TOL, lower, upper);
+    } else {
+        return approximate_inverse_evaluate(curve,
+            p,
+            num_samples,
+            std::max(min_t - delta_t, lower),
+            std::min(min_t + delta_t, upper),
+            level - 1);
+    }
+}
+
+/**
+ * Warm-started closest point search, for a query point that moved only a
+ * little since the last one: Newton-Raphson from the guess t0, restricted
+ * to the trust region [t0 - radius, t0 + radius] within the domain.
+ *
+ * Returns true and sets t if the iterations reach a local minimum of
+ * |curve(t) - p|: a point on the curve within rounding error, a stationary
+ * point or a domain end point.  Returns
+ * false if they stall or are cut off by the trust region, in which case
+ * the caller should fall back to a global search.
+ */
+template <typename CurveType>
+bool local_inverse_evaluate(const CurveType& curve,
+    const typename CurveType::Point& p,
+    const typename CurveType::Scalar t0,
+    const typename CurveType::Scalar radius,
+    typename CurveType::Scalar& t)
+{
+    using Scalar = typename CurveType::Scalar;
+    using Point = typename CurveType::Point;
+    constexpr Scalar TOL = std::numeric_limits<Scalar>::epsilon() * 100;
+    const Scalar domain_lower = curve.get_domain_lower_bound();
+    const Scalar domain_upper = curve.get_domain_upper_bound();
+    const Scalar lower = std::max(domain_lower, t0 - radius);
+    const Scalar upper = std::min(domain_upper, t0 + radius);
+    if (!(lower <= upper)) return false;
+
+    t = newton_raphson(curve, p, std::min(std::max(t0, lower), upper), 20, TOL, lower, upper);
+
+    typename CurveType::DerivativeMatrix ders;
+    curve.evaluate_derivatives(t, 2, ders);
+    const Point r = ders.row(0) - p;
+    const Point d1 = ders.row(1);
+    // A query point on the curve: the residual is rounding noise in no
+    // particular direction, so the stationarity test below is meaningless.
+    const Scalar scale = std::max(p.norm(), d1.norm() * (domain_upper - domain_lower));
+    if (r.norm() <= TOL * std::max(scale, Scalar(1))) return true;
+    const Scalar g = r.dot(d1);
+    // The residual is orthogonal to the tangent at a stationary point.
+    if (std::abs(g) <= std::sqrt(TOL) * r.norm() * d1.norm()) {
+        return d1.squaredNorm() + r.dot(ders.row(2)) > 0;
+    }
+    if (t <= domain_lower) return g > 0;
+    if (t >= domain_upper) return g < 0;
+    return false;
+}
+
+/**
+ * Signed angle between the tangents at t0 and t1 of a 2D curve.  Only
+ * meaningful if the tangent turns by less than pi in between; curve types
+ * with an exact turning angle provide their own get_turning_angle member.
+ */
+template <typename CurveType>
+typename CurveType::Scalar get_turning_angle(const CurveType& curve,
+    typename CurveType::Scalar t0,
+    typename CurveType::Scalar t1)
+{
+    using Scalar = typename CurveType::Scalar;
+    using Point = typename CurveType::Point;
+    if (curve.get_dim() != 2) {
+        throw std::runtime_error("Turning angle computation is for 2D curves only");
+    }
+
+    constexpr Scalar EPS = std::numeric_limits<Scalar>::epsilon();
+    constexpr int NUM_RETRIES = 10;
+    Point d0 = curve.evaluate_derivative(t0);
+    Point d1 = curve.evaluate_derivative(t1);
+
+    for (int i = 0; i < NUM_RETRIES && d0.norm() < EPS; i++) {
+        t0 += (t1 - t0) * 1e-3;
+        d0 = curve.evaluate_derivative(t0);
+    }
+
+    for (int i = 0; i < NUM_RETRIES && d1.norm() < EPS; i++) {
+        t1 -= (t1 - t0) * 1e-3;
+        d1 = curve.evaluate_derivative(t1);
+    }
+
+    return std::atan2(d0[0] * d1[1] - d0[1] * d1[0], d0[0] * d1[0] + d0[1] * d1[1]);
+}
+
+/**
+ * Iteration and tolerance policy of trust_region_newton_raphson.
+ */
+template <typename Scalar>
+struct NewtonRaphsonSettings
+{
+    int max_iterations = 20;
+    /**
+     * Converged once |patch(u, v) - p| is at most this.
+     */
+    Scalar residual_tolerance = std::numeric_limits<Scalar>::epsilon() * 100;
+    /**
+     * Converged once the residual r = patch(u, v) - p is orthogonal to the
+     * partial derivative S_k in every free parameter k:
+     * |r.S_k| <= gradient_tolerance |r| |S_k|.
+     */
+    Scalar gradient_tolerance = std::sqrt(std::numeric_limits<Scalar>::epsilon());
+    /**
+     * Stop once a step moves (u, v) by at most this.  By default only
+     * vanishing steps stop the iterations, since a parameter step far below
+     * machine precision can still reduce the residual of a steep patch.
+     */
+    Scalar step_tolerance = 0;
+};
+
+template <typename Scalar>
+struct NewtonRaphsonResult
+{
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    Eigen::Matrix<Scalar, 1, 2> uv;
+    /**
+     * |patch(uv) - p|.
+     */
+    Scalar residual;
+    int num_iterations;
+    /**
+     * Whether uv satisfies one of the convergence criteria, as opposed to
+     * running out of iterations or stalling.
+     */
+    bool converged;
+};
+
+/**
+ * Minimize |patch(u, v) - p| over [min_u, max_u] x [min_v, max_v], starting
+ * from uv, with Newton steps damped Levenberg-Marquardt style.
+ *
+ * Each step solves (H + lambda diag(H)) d = -g, where g and H are the
+ * gradient and Hessian of |patch(u, v) - p|^2 / 2, or the Gauss-Newton
+ * matrix in place of H where H is not positive definite.  A step is kept
+ * only if it decreases the distance, and lambda shrinks or grows with the
+ * ratio of actual to predicted decrease, which bounds the step like a trust
+ * region.  Steps are projected onto the domain, and a parameter at a bound
+ * whose gradient points outward is held fixed, so minima on the boundary
+ * are reached too.
+ *
+ * A local minimum is converged if its residual is below the residual
+ * tolerance, or if it is stationary in all parameters not held by a bound
+ * and the Hessian is positive definite in those.
+ */
+template <typename PatchType>
+NewtonRaphsonResult<typename PatchType::Scalar> trust_region_newton_raphson(
+    const PatchType& patch,
+    const typename PatchType::Point& p,
+    const typename PatchType::UVPoint& uv,
+    const typename PatchType::Scalar min_u,
+    const typename PatchType::Scalar max_u,
+    const typename PatchType::Scalar min_v,
+    const typename PatchType::Scalar max_v,
+    const NewtonRaphsonSettings<typename PatchType::Scalar>& settings =
+        NewtonRaphsonSettings<typename PatchType::Scalar>())
+{
+    using Scalar = typename PatchType::Scalar;
+    using Point = typename PatchType::Point;
+    using UVPoint = typename PatchType::UVPoint;
+    using Vector2 = Eigen::Matrix<Scalar, 2, 1>;
+    using Matrix2 = Eigen::Matrix<Scalar, 2, 2>;
+    constexpr int MAX_REJECTED_STEPS = 10;
+    constexpr Scalar MIN_DAMPING = 1e-3;
+
+    const UVPoint lower(min_u, min_v);
+    const UVPoint upper(max_u, max_v);
+    NewtonRaphsonResult<Scalar> result;
+    result.uv = uv.cwiseMax(lower).cwiseMin(upper);
+    result.num_iterations = 0;
+    result.converged = false;
+
+    typename PatchType::DerivativeMatrix ders, next_ders;
+    patch.evaluate_all(result.uv[0], result.uv[1], 2, ders);
+    Scalar damping = 0;
+    for (;; result.num_iterations++) {
+        const Point r = ders.row(0) - p;
+        const Point Su = ders.row(1);
+        const Point Sv = ders.row(2);
+        result.residual = r.norm();
+        if (result.residual <= settings.residual_tolerance) {
+            result.converged = true;
+            break;
+        }
+
+        const Vector2 g(r.dot(Su), r.dot(Sv));
+        const Scalar tangent_norm[2] = {Su.norm(), Sv.norm()};
+        Matrix2 H_gn, H;
+        H_gn << Su.squaredNorm(), Su.dot(Sv), Su.dot(Sv), Sv.squaredNorm();
+        H << r.dot(ders.row(3)), r.dot(ders.row(4)), r.dot(ders.row(4)), r.dot(ders.row(5));
+        H += H_gn;
+
+        // Parameters held at a bound, and those that are free.
+        bool is_free[2];
+        bool stationary = true;
+        for (int k = 0; k < 2; k++) {
+            is_free[k] = !((result.uv[k] <= lower[k] && g[k] > 0) ||
+                           (result.uv[k] >= upper[k] && g[k] < 0));
+            if (is_free[k]) {
+                stationary = stationary && std::abs(g[k]) <= settings.gradient_tolerance *
+                                                                 result.residual *
+                                                                 tangent_norm[k];
+            }
+        }
+        // Decouple the held parameters, whose steps are zero.
+        auto restrict_to_free = [&is_free](Matrix2 M) {
+            for (int k = 0; k < 2; k++) {
+                if (!is_free[k]) {
+                    M.row(k).setZero();
+                    M.col(k).setZero();
+                    M(k, k) = 1;
+                }
+            }
+            return M;
+        };
+        Matrix2 H_free = restrict_to_free(H);
+        const bool positive_definite = H_free(0, 0) > 0 && H_free.determinant() > 0;
+        if (stationary) {
+            result.converged = positive_definite;
+            break;
+        }
+        if (result.num_iterations >= settings.max_iterations) break;
+
+        if (!positive_definite) H_free = restrict_to_free(H_gn);
+        Vector2 g_free = g;
+        for (int k = 0; k < 2; k++) {
+            if (!is_free[k]) g_free[k] = 0;
+        }
+
+        bool accepted = false;
+        for (int i = 0; i < MAX_REJECTED_STEPS; i++) {
+            Matrix2 A = H_free;
+            A.diagonal() *= 1 + damping;
+            // Grow the damping until A is positive definite.
+            const Eigen::LDLT<Matrix2> ldlt(A);
+            if (ldlt.info() != Eigen::Success || !(ldlt.vectorD().minCoeff() > 0)) {
+                damping = std::max(damping * 4, MIN_DAMPING);
+                continue;
+            }
+            const Vector2 d = -ldlt.solve(g_free);
+            if (!d.allFinite()) {
+                damping = std::max(damping * 4, MIN_DAMPING);
+                continue;
+            }
+            const UVPoint next =
+                (result.uv + d.transpose()).cwiseMax(lower).cwiseMin(upper);
+            const Vector2 step = (next - result.uv).transpose();
+            if (step.norm() <= settings.step_tolerance) break;
+
+            patch.evaluate_all(next[0], next[1], 2, next_ders);
+            const Scalar actual = (r.squaredNorm() - (next_ders.row(0) - p).squaredNorm()) / 2;
+            const Scalar predicted = -(g_free.dot(step) + step.dot(H_free * step) / 2);
+            if (actual > 0) {
+                const Scalar rho = predicted > 0 ? actual / predicted : 1;
+                if (rho > 0.75) {
+                    damping /= 3;
+                } else if (rho < 0.25) {
+                    damping = std::max(damping * 2, MIN_DAMPING);
+                }
+                result.uv = next;
+                ders.swap(next_ders);
+                accepted = true;
+                break;
+            }
+            damping = std::max(damping * 4, MIN_DAMPING);
+        }
+        if (!accepted) break;
+    }
+    return result;
+}
+
+/**
+ * trust_region_newton_raphson with the given iteration count and residual
+ * tolerance, returning only the parameters.
+ */
+template <typename PatchType>
+typename PatchType::UVPoint newton_raphson(const PatchType& patch,
+    const typename PatchType::Point& p,
+    const typename PatchType::UVPoint uv,
+    const int num_iterations,
+    const typename PatchType::Scalar tol,
+    const typename PatchType::Scalar min_u,
+    const typename PatchType::Scalar max_u,
+    const typename PatchType::Scalar min_v,
+    const typename PatchType::Scalar max_v)
+{
+    NewtonRaphsonSettings<typename PatchType::Scalar> settings;
+    settings.max_iterations = num_iterations;
+    settings.residual_tolerance = tol;
+    return trust_region_newton_raphson(patch, p, uv, min_u, max_u, min_v, max_v, settings).uv;
+}
+
+/**
+ * Patch version of local_inverse_evaluate: Newton-Raphson from uv0 within
+ * the trust region [u0 - radius, u0 + radius] x [v0 - radius, v0 + radius]
+ * clipped to the domain.  Returns true and sets uv only if it reaches a
+ * local minimum of |patch(u, v) - p|: p itself within rounding error, or
+ * stationary in every parameter except those at a domain bound the
+ * distance grows away from.
+ */
+template <typename PatchType>
+bool local_inverse_evaluate(const PatchType& patch,
+    const typename PatchType::Point& p,
+    const typename PatchType::UVPoint& uv0,
+    const typename PatchType::Scalar radius,
+    typename PatchType::UVPoint& uv)
+{
+    using Scalar = typename PatchType::Scalar;
+    using Point = typename PatchType::Point;
+    using UVPoint = typename PatchType::UVPoint;
+    constexpr Scalar TOL = std::numeric_limits<Scalar>::epsilon() * 100;
+    const UVPoint domain_lower(patch.get_u_lower_bound(), patch.get_v_lower_bound());
+    const UVPoint domain_upper(patch.get_u_upper_bound(), patch.get_v_upper_bound());
+    const UVPoint lower = domain_lower.cwiseMax((uv0.array() - radius).matrix());
+    const UVPoint upper = domain_upper.cwiseMin((uv0.array() + radius).matrix());
+    if (!(lower[0] <= upper[0] && lower[1] <= upper[1])) return false;
+
+    uv = newton_raphson(patch,
+        p,
+        uv0.cwiseMax(lower).cwiseMin(upper),
+        20,
+        TOL,
+        lower[0],
+        upper[0],
+        lower[1],
+        upper[1]);
+
+    typename PatchType::DerivativeMatrix ders;
+    patch.evaluate_all(uv[0], uv[1], 2, ders);
+    const Point r = ders.row(0) - p;
+    const Point Su = ders.row(1);
+    const Point Sv = ders.row(2);
+    // A query point on the patch, see the curve version.
+    const Scalar scale = std::max({p.norm(),
+        Su.norm() * (domain_upper[0] - domain_lower[0]),
+        Sv.norm() * (domain_upper[1] - domain_lower[1])});
+    if (r.norm() <= TOL * std::max(scale, Scalar(1))) return true;
+    const Scalar g[2] = {r.dot(Su), r.dot(Sv)};
+    const Scalar tangent_norm[2] = {Su.norm(), Sv.norm()};
+    bool stationary[2];
+    for (int k = 0; k < 2; k++) {
+        stationary[k] = std::abs(g[k]) <= std::sqrt(TOL) * r.norm() * tangent_norm[k];
+        if (stationary[k]) continue;
+        const bool held = (uv[k] <= domain_lower[k] && g[k] > 0) ||
+                          (uv[k] >= domain_upper[k] && g[k] < 0);
+        if (!held) return false;
+    }
+
+    // Second order condition in the stationary parameters.
+    const Scalar H00 = Su.squaredNorm() + r.dot(ders.row(3));
+    const Scalar H01 = Su.dot(Sv) + r.dot(ders.row(4));
+    const Scalar H11 = Sv.squaredNorm() + r.dot(ders.row(5));
+    if (stationary[0] && stationary[1]) return H00 > 0 && H00 * H11 - H01 * H01 > 0;
+    if (stationary[0]) return H00 > 0;
+    if (stationary[1]) return H11 > 0;
+    return true;
+}
+
+} // namespace nanospline
@@ -1,288 +0,0 @@
-/**
- * This code is automatically generated by scripts/inflection.py
- */
-
-#pragma once
-#include <cassert>
-#include <vector>
-
-#include <nanospline/Exceptions.h>
-#include <nanospline/PolynomialRootFinder.h>
-#include <nanospline/BezierBase.h>
-
-namespace nanospline {
-namespace internal {
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_Bezier_degree_2_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 0>::find_real_roots_in_interval({
-        -4*cx0*cy1 + 4*cx0*cy2 + 4*cx1*cy0 - 4*cx1*cy2 - 4*cx2*cy0 + 4*cx2*cy1
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_Bezier_degree_3_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 2>::find_real_roots_in_interval({
-        -18*cx0*cy1 + 18*cx0*cy2 + 18*cx1*cy0 - 18*cx1*cy2 - 18*cx2*cy0 + 18*cx2*cy1,
-    36*cx0*cy1 - 54*cx0*cy2 + 18*cx0*cy3 - 36*cx1*cy0 + 54*cx1*cy2 - 18*cx1*cy3 + 54*cx2*cy0 - 54*cx2*cy1 - 18*cx3*cy0 + 18*cx3*cy1,
-    -18*cx0*cy1 + 36*cx0*cy2 - 18*cx0*cy3 + 18*cx1*cy0 - 54*cx1*cy2 + 36*cx1*cy3 - 36*cx2*cy0 + 54*cx2*cy1 - 18*cx2*cy3 + 18*cx3*cy0 - 36*cx3*cy1 + 18*cx3*cy2
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_Bezier_degree_4_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3, Scalar cx4, Scalar cy4,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 4>::find_real_roots_in_interval({
-        -48*cx0*cy1 + 48*cx0*cy2 + 48*cx1*cy0 - 48*cx1*cy2 - 48*cx2*cy0 + 48*cx2*cy1,
-    192*cx0*cy1 - 288*cx0*cy2 + 96*cx0*cy3 - 192*cx1*cy0 + 288*cx1*cy2 - 96*cx1*cy3 + 288*cx2*cy0 - 288*cx2*cy1 - 96*cx3*cy0 + 96*cx3*cy1,
-    -288*cx0*cy1 + 576*cx0*cy2 - 336*cx0*cy3 + 48*cx0*cy4 + 288*cx1*cy0 - 720*cx1*cy2 + 480*cx1*cy3 - 48*cx1*cy4 - 576*cx2*cy0 + 720*cx2*cy1 - 144*cx2*cy3 + 336*cx3*cy0 - 480*cx3*cy1 + 144*cx3*cy2 - 48*cx4*cy0 + 48*cx4*cy1,
-    192*cx0*cy1 - 480*cx0*cy2 + 384*cx0*cy3 - 96*cx0*cy4 - 192*cx1*cy0 + 768*cx1*cy2 - 768*cx1*cy3 + 192*cx1*cy4 + 480*cx2*cy0 - 768*cx2*cy1 + 384*cx2*cy3 - 96*cx2*cy4 - 384*cx3*cy0 + 768*cx3*cy1 - 384*cx3*cy2 + 96*cx4*cy0 - 192*cx4*cy1 + 96*cx4*cy2,
-    -48*cx0*cy1 + 144*cx0*cy2 - 144*cx0*cy3 + 48*cx0*cy4 + 48*cx1*cy0 - 288*cx1*cy2 + 384*cx1*cy3 - 144*cx1*cy4 - 144*cx2*cy0 + 288*cx2*cy1 - 288*cx2*cy3 + 144*cx2*cy4 + 144*cx3*cy0 - 384*cx3*cy1 + 288*cx3*cy2 - 48*cx3*cy4 - 48*cx4*cy0 + 144*cx4*cy1 - 144*cx4*cy2 + 48*cx4*cy3
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_Bezier_degree_5_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3, Scalar cx4, Scalar cy4, Scalar cx5, Scalar cy5,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 6>::find_real_roots_in_interval({
-        -100*cx0*cy1 + 100*cx0*cy2 + 100*cx1*cy0 - 100*cx1*cy2 - 100*cx2*cy0 + 100*cx2*cy1,
-    600*cx0*cy1 - 900*cx0*cy2 + 300*cx0*cy3 - 600*cx1*cy0 + 900*cx1*cy2 - 300*cx1*cy3 + 900*cx2*cy0 - 900*cx2*cy1 - 300*cx3*cy0 + 300*cx3*cy1,
-    -1500*cx0*cy1 + 3000*cx0*cy2 - 1800*cx0*cy3 + 300*cx0*cy4 + 1500*cx1*cy0 - 3600*cx1*cy2 + 2400*cx1*cy3 - 300*cx1*cy4 - 3000*cx2*cy0 + 3600*cx2*cy1 - 600*cx2*cy3 + 1800*cx3*cy0 - 2400*cx3*cy1 + 600*cx3*cy2 - 300*cx4*cy0 + 300*cx4*cy1,
-    2000*cx0*cy1 - 5000*cx0*cy2 + 4200*cx0*cy3 - 1300*cx0*cy4 + 100*cx0*cy5 - 2000*cx1*cy0 + 7400*cx1*cy2 - 7400*cx1*cy3 + 2100*cx1*cy4 - 100*cx1*cy5 + 5000*cx2*cy0 - 7400*cx2*cy1 + 3200*cx2*cy3 - 800*cx2*cy4 - 4200*cx3*cy0 + 7400*cx3*cy1 - 3200*cx3*cy2 + 1300*cx4*cy0 - 2100*cx4*cy1 + 800*cx4*cy2 - 100*cx5*cy0 + 100*cx5*cy1,
-    -1500*cx0*cy1 + 4500*cx0*cy2 - 4800*cx0*cy3 + 2100*cx0*cy4 - 300*cx0*cy5 + 1500*cx1*cy0 - 8100*cx1*cy2 + 10800*cx1*cy3 - 4800*cx1*cy4 + 600*cx1*cy5 - 4500*cx2*cy0 + 8100*cx2*cy1 - 6600*cx2*cy3 + 3300*cx2*cy4 - 300*cx2*cy5 + 4800*cx3*cy0 - 10800*cx3*cy1 + 6600*cx3*cy2 - 600*cx3*cy4 - 2100*cx4*cy0 + 4800*cx4*cy1 - 3300*cx4*cy2 + 600*cx4*cy3 + 300*cx5*cy0 - 600*cx5*cy1 + 300*cx5*cy2,
-    600*cx0*cy1 - 2100*cx0*cy2 + 2700*cx0*cy3 - 1500*cx0*cy4 + 300*cx0*cy5 - 600*cx1*cy0 + 4500*cx1*cy2 - 7500*cx1*cy3 + 4500*cx1*cy4 - 900*cx1*cy5 + 2100*cx2*cy0 - 4500*cx2*cy1 + 6000*cx2*cy3 - 4500*cx2*cy4 + 900*cx2*cy5 - 2700*cx3*cy0 + 7500*cx3*cy1 - 6000*cx3*cy2 + 1500*cx3*cy4 - 300*cx3*cy5 + 1500*cx4*cy0 - 4500*cx4*cy1 + 4500*cx4*cy2 - 1500*cx4*cy3 - 300*cx5*cy0 + 900*cx5*cy1 - 900*cx5*cy2 + 300*cx5*cy3,
-    -100*cx0*cy1 + 400*cx0*cy2 - 600*cx0*cy3 + 400*cx0*cy4 - 100*cx0*cy5 + 100*cx1*cy0 - 1000*cx1*cy2 + 2000*cx1*cy3 - 1500*cx1*cy4 + 400*cx1*cy5 - 400*cx2*cy0 + 1000*cx2*cy1 - 2000*cx2*cy3 + 2000*cx2*cy4 - 600*cx2*cy5 + 600*cx3*cy0 - 2000*cx3*cy1 + 2000*cx3*cy2 - 1000*cx3*cy4 + 400*cx3*cy5 - 400*cx4*cy0 + 1500*cx4*cy1 - 2000*cx4*cy2 + 1000*cx4*cy3 - 100*cx4*cy5 + 100*cx5*cy0 - 400*cx5*cy1 + 600*cx5*cy2 - 400*cx5*cy3 + 100*cx5*cy4
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_Bezier_degree_6_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3, Scalar cx4, Scalar cy4, Scalar cx5, Scalar cy5, Scalar cx6, Scalar cy6,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 8>::find_real_roots_in_interval({
-        -180*cx0*cy1 + 180*cx0*cy2 + 180*cx1*cy0 - 180*cx1*cy2 - 180*cx2*cy0 + 180*cx2*cy1,
-    1440*cx0*cy1 - 2160*cx0*cy2 + 720*cx0*cy3 - 1440*cx1*cy0 + 2160*cx1*cy2 - 720*cx1*cy3 + 2160*cx2*cy0 - 2160*cx2*cy1 - 720*cx3*cy0 + 720*cx3*cy1,
-    -5040*cx0*cy1 + 10080*cx0*cy2 - 6120*cx0*cy3 + 1080*cx0*cy4 + 5040*cx1*cy0 - 11880*cx1*cy2 + 7920*cx1*cy3 - 1080*cx1*cy4 - 10080*cx2*cy0 + 11880*cx2*cy1 - 1800*cx2*cy3 + 6120*cx3*cy0 - 7920*cx3*cy1 + 1800*cx3*cy2 - 1080*cx4*cy0 + 1080*cx4*cy1,
-    10080*cx0*cy1 - 25200*cx0*cy2 + 21600*cx0*cy3 - 7200*cx0*cy4 + 720*cx0*cy5 - 10080*cx1*cy0 + 36000*cx1*cy2 - 36000*cx1*cy3 + 10800*cx1*cy4 - 720*cx1*cy5 + 25200*cx2*cy0 - 36000*cx2*cy1 + 14400*cx2*cy3 - 3600*cx2*cy4 - 21600*cx3*cy0 + 36000*cx3*cy1 - 14400*cx3*cy2 + 7200*cx4*cy0 - 10800*cx4*cy1 + 3600*cx4*cy2 - 720*cx5*cy0 + 720*cx5*cy1,
-    -12600*cx0*cy1 + 37800*cx0*cy2 - 41400*cx0*cy3 + 19800*cx0*cy4 - 3780*cx0*cy5 + 180*cx0*cy6 + 12600*cx1*cy0 - 64800*cx1*cy2 + 86400*cx1*cy3 - 40500*cx1*cy4 + 6480*cx1*cy5 - 180*cx1*cy6 - 37800*cx2*cy0 + 64800*cx2*cy1 - 48600*cx2*cy3 + 24300*cx2*cy4 - 2700*cx2*cy5 + 41400*cx3*cy0 - 86400*cx3*cy1 + 48600*cx3*cy2 - 3600*cx3*cy4 - 19800*cx4*cy0 + 40500*cx4*cy1 - 24300*cx4*cy2 + 3600*cx4*cy3 + 3780*cx5*cy0 - 6480*cx5*cy1 + 2700*cx5*cy2 - 180*cx6*cy0 + 180*cx6*cy1,
-    10080*cx0*cy1 - 35280*cx0*cy2 + 46800*cx0*cy3 - 28800*cx0*cy4 + 7920*cx0*cy5 - 720*cx0*cy6 - 10080*cx1*cy0 + 71280*cx1*cy2 - 118800*cx1*cy3 + 75600*cx1*cy4 - 19440*cx1*cy5 + 1440*cx1*cy6 + 35280*cx2*cy0 - 71280*cx2*cy1 + 86400*cx2*cy3 - 64800*cx2*cy4 + 15120*cx2*cy5 - 720*cx2*cy6 - 46800*cx3*cy0 + 118800*cx3*cy1 - 86400*cx3*cy2 + 18000*cx3*cy4 - 3600*cx3*cy5 + 28800*cx4*cy0 - 75600*cx4*cy1 + 64800*cx4*cy2 - 18000*cx4*cy3 - 7920*cx5*cy0 + 19440*cx5*cy1 - 15120*cx5*cy2 + 3600*cx5*cy3 + 720*cx6*cy0 - 1440*cx6*cy1 + 720*cx6*cy2,
-    -5040*cx0*cy1 + 20160*cx0*cy2 - 31320*cx0*cy3 + 23400*cx0*cy4 - 8280*cx0*cy5 + 1080*cx0*cy6 + 5040*cx1*cy0 - 47160*cx1*cy2 + 94320*cx1*cy3 - 75600*cx1*cy4 + 26640*cx1*cy5 - 3240*cx1*cy6 - 20160*cx2*cy0 + 47160*cx2*cy1 - 84600*cx2*cy3 + 84600*cx2*cy4 - 30240*cx2*cy5 + 3240*cx2*cy6 + 31320*cx3*cy0 - 94320*cx3*cy1 + 84600*cx3*cy2 - 34200*cx3*cy4 + 13680*cx3*cy5 - 1080*cx3*cy6 - 23400*cx4*cy0 + 75600*cx4*cy1 - 84600*cx4*cy2 + 34200*cx4*cy3 - 1800*cx4*cy5 + 8280*cx5*cy0 - 26640*cx5*cy1 + 30240*cx5*cy2 - 13680*cx5*cy3 + 1800*cx5*cy4 - 1080*cx6*cy0 + 3240*cx6*cy1 - 3240*cx6*cy2 + 1080*cx6*cy3,
-    1440*cx0*cy1 - 6480*cx0*cy2 + 11520*cx0*cy3 - 10080*cx0*cy4 + 4320*cx0*cy5 - 720*cx0*cy6 - 1440*cx1*cy0 + 17280*cx1*cy2 - 40320*cx1*cy3 + 38880*cx1*cy4 - 17280*cx1*cy5 + 2880*cx1*cy6 + 6480*cx2*cy0 - 17280*cx2*cy1 + 43200*cx2*cy3 - 54000*cx2*cy4 + 25920*cx2*cy5 - 4320*cx2*cy6 - 11520*cx3*cy0 + 40320*cx3*cy1 - 43200*cx3*cy2 + 28800*cx3*cy4 - 17280*cx3*cy5 + 2880*cx3*cy6 + 10080*cx4*cy0 - 38880*cx4*cy1 + 54000*cx4*cy2 - 28800*cx4*cy3 + 4320*cx4*cy5 - 720*cx4*cy6 - 4320*cx5*cy0 + 17280*cx5*cy1 - 25920*cx5*cy2 + 17280*cx5*cy3 - 4320*cx5*cy4 + 720*cx6*cy0 - 2880*cx6*cy1 + 4320*cx6*cy2 - 2880*cx6*cy3 + 720*cx6*cy4,
-    -180*cx0*cy1 + 900*cx0*cy2 - 1800*cx0*cy3 + 1800*cx0*cy4 - 900*cx0*cy5 + 180*cx0*cy6 + 180*cx1*cy0 - 2700*cx1*cy2 + 7200*cx1*cy3 - 8100*cx1*cy4 + 4320*cx1*cy5 - 900*cx1*cy6 - 900*cx2*cy0 + 2700*cx2*cy1 - 9000*cx2*cy3 + 13500*cx2*cy4 - 8100*cx2*cy5 + 1800*cx2*cy6 + 1800*cx3*cy0 - 7200*cx3*cy1 + 9000*cx3*cy2 - 9000*cx3*cy4 + 7200*cx3*cy5 - 1800*cx3*cy6 - 1800*cx4*cy0 + 8100*cx4*cy1 - 13500*cx4*cy2 + 9000*cx4*cy3 - 2700*cx4*cy5 + 900*cx4*cy6 + 900*cx5*cy0 - 4320*cx5*cy1 + 8100*cx5*cy2 - 7200*cx5*cy3 + 2700*cx5*cy4 - 180*cx5*cy6 - 180*cx6*cy0 + 900*cx6*cy1 - 1800*cx6*cy2 + 1800*cx6*cy3 - 900*cx6*cy4 + 180*cx6*cy5
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_Bezier_degree_7_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3, Scalar cx4, Scalar cy4, Scalar cx5, Scalar cy5, Scalar cx6, Scalar cy6, Scalar cx7, Scalar cy7,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 10>::find_real_roots_in_interval({
-        -294*cx0*cy1 + 294*cx0*cy2 + 294*cx1*cy0 - 294*cx1*cy2 - 294*cx2*cy0 + 294*cx2*cy1,
-    2940*cx0*cy1 - 4410*cx0*cy2 + 1470*cx0*cy3 - 2940*cx1*cy0 + 4410*cx1*cy2 - 1470*cx1*cy3 + 4410*cx2*cy0 - 4410*cx2*cy1 - 1470*cx3*cy0 + 1470*cx3*cy1,
-    -13230*cx0*cy1 + 26460*cx0*cy2 - 16170*cx0*cy3 + 2940*cx0*cy4 + 13230*cx1*cy0 - 30870*cx1*cy2 + 20580*cx1*cy3 - 2940*cx1*cy4 - 26460*cx2*cy0 + 30870*cx2*cy1 - 4410*cx2*cy3 + 16170*cx3*cy0 - 20580*cx3*cy1 + 4410*cx3*cy2 - 2940*cx4*cy0 + 2940*cx4*cy1,
-    35280*cx0*cy1 - 88200*cx0*cy2 + 76440*cx0*cy3 - 26460*cx0*cy4 + 2940*cx0*cy5 - 35280*cx1*cy0 + 123480*cx1*cy2 - 123480*cx1*cy3 + 38220*cx1*cy4 - 2940*cx1*cy5 + 88200*cx2*cy0 - 123480*cx2*cy1 + 47040*cx2*cy3 - 11760*cx2*cy4 - 76440*cx3*cy0 + 123480*cx3*cy1 - 47040*cx3*cy2 + 26460*cx4*cy0 - 38220*cx4*cy1 + 11760*cx4*cy2 - 2940*cx5*cy0 + 2940*cx5*cy1,
-    -61740*cx0*cy1 + 185220*cx0*cy2 - 205800*cx0*cy3 + 102900*cx0*cy4 - 22050*cx0*cy5 + 1470*cx0*cy6 + 61740*cx1*cy0 - 308700*cx1*cy2 + 411600*cx1*cy3 - 198450*cx1*cy4 + 35280*cx1*cy5 - 1470*cx1*cy6 - 185220*cx2*cy0 + 308700*cx2*cy1 - 220500*cx2*cy3 + 110250*cx2*cy4 - 13230*cx2*cy5 + 205800*cx3*cy0 - 411600*cx3*cy1 + 220500*cx3*cy2 - 14700*cx3*cy4 - 102900*cx4*cy0 + 198450*cx4*cy1 - 110250*cx4*cy2 + 14700*cx4*cy3 + 22050*cx5*cy0 - 35280*cx5*cy1 + 13230*cx5*cy2 - 1470*cx6*cy0 + 1470*cx6*cy1,
-    74088*cx0*cy1 - 259308*cx0*cy2 + 349860*cx0*cy3 - 226380*cx0*cy4 + 70560*cx0*cy5 - 9114*cx0*cy6 + 294*cx0*cy7 - 74088*cx1*cy0 + 506268*cx1*cy2 - 843780*cx1*cy3 + 552720*cx1*cy4 - 156996*cx1*cy5 + 16170*cx1*cy6 - 294*cx1*cy7 + 259308*cx2*cy0 - 506268*cx2*cy1 + 582120*cx2*cy3 - 436590*cx2*cy4 + 108486*cx2*cy5 - 7056*cx2*cy6 - 349860*cx3*cy0 + 843780*cx3*cy1 - 582120*cx3*cy2 + 110250*cx3*cy4 - 22050*cx3*cy5 + 226380*cx4*cy0 - 552720*cx4*cy1 + 436590*cx4*cy2 - 110250*cx4*cy3 - 70560*cx5*cy0 + 156996*cx5*cy1 - 108486*cx5*cy2 + 22050*cx5*cy3 + 9114*cx6*cy0 - 16170*cx6*cy1 + 7056*cx6*cy2 - 294*cx7*cy0 + 294*cx7*cy1,
-    -61740*cx0*cy1 + 246960*cx0*cy2 - 391020*cx0*cy3 + 308700*cx0*cy4 - 124950*cx0*cy5 + 23520*cx0*cy6 - 1470*cx0*cy7 + 61740*cx1*cy0 - 555660*cx1*cy2 + 1111320*cx1*cy3 - 918750*cx1*cy4 + 358680*cx1*cy5 - 60270*cx1*cy6 + 2940*cx1*cy7 - 246960*cx2*cy0 + 555660*cx2*cy1 - 940800*cx2*cy3 + 940800*cx2*cy4 - 357210*cx2*cy5 + 49980*cx2*cy6 - 1470*cx2*cy7 + 391020*cx3*cy0 - 1111320*cx3*cy1 + 940800*cx3*cy2 - 345450*cx3*cy4 + 138180*cx3*cy5 - 13230*cx3*cy6 - 308700*cx4*cy0 + 918750*cx4*cy1 - 940800*cx4*cy2 + 345450*cx4*cy3 - 14700*cx4*cy5 + 124950*cx5*cy0 - 358680*cx5*cy1 + 357210*cx5*cy2 - 138180*cx5*cy3 + 14700*cx5*cy4 - 23520*cx6*cy0 + 60270*cx6*cy1 - 49980*cx6*cy2 + 13230*cx6*cy3 + 1470*cx7*cy0 - 2940*cx7*cy1 + 1470*cx7*cy2,
-    35280*cx0*cy1 - 158760*cx0*cy2 + 288120*cx0*cy3 - 267540*cx0*cy4 + 132300*cx0*cy5 - 32340*cx0*cy6 + 2940*cx0*cy7 - 35280*cx1*cy0 + 405720*cx1*cy2 - 946680*cx1*cy3 + 943740*cx1*cy4 - 467460*cx1*cy5 + 108780*cx1*cy6 - 8820*cx1*cy7 + 158760*cx2*cy0 - 405720*cx2*cy1 + 952560*cx2*cy3 - 1190700*cx2*cy4 + 608580*cx2*cy5 - 132300*cx2*cy6 + 8820*cx2*cy7 - 288120*cx3*cy0 + 946680*cx3*cy1 - 952560*cx3*cy2 + 573300*cx3*cy4 - 343980*cx3*cy5 + 67620*cx3*cy6 - 2940*cx3*cy7 + 267540*cx4*cy0 - 943740*cx4*cy1 + 1190700*cx4*cy2 - 573300*cx4*cy3 + 70560*cx4*cy5 - 11760*cx4*cy6 - 132300*cx5*cy0 + 467460*cx5*cy1 - 608580*cx5*cy2 + 343980*cx5*cy3 - 70560*cx5*cy4 + 32340*cx6*cy0 - 108780*cx6*cy1 + 132300*cx6*cy2 - 67620*cx6*cy3 + 11760*cx6*cy4 - 2940*cx7*cy0 + 8820*cx7*cy1 - 8820*cx7*cy2 + 2940*cx7*cy3,
-    -13230*cx0*cy1 + 66150*cx0*cy2 - 135240*cx0*cy3 + 144060*cx0*cy4 - 83790*cx0*cy5 + 24990*cx0*cy6 - 2940*cx0*cy7 + 13230*cx1*cy0 - 189630*cx1*cy2 + 505680*cx1*cy3 - 589470*cx1*cy4 + 352800*cx1*cy5 - 104370*cx1*cy6 + 11760*cx1*cy7 - 66150*cx2*cy0 + 189630*cx2*cy1 - 590940*cx2*cy3 + 886410*cx2*cy4 - 568890*cx2*cy5 + 167580*cx2*cy6 - 17640*cx2*cy7 + 135240*cx3*cy0 - 505680*cx3*cy1 + 590940*cx3*cy2 - 529200*cx3*cy4 + 423360*cx3*cy5 - 126420*cx3*cy6 + 11760*cx3*cy7 - 144060*cx4*cy0 + 589470*cx4*cy1 - 886410*cx4*cy2 + 529200*cx4*cy3 - 127890*cx4*cy5 + 42630*cx4*cy6 - 2940*cx4*cy7 + 83790*cx5*cy0 - 352800*cx5*cy1 + 568890*cx5*cy2 - 423360*cx5*cy3 + 127890*cx5*cy4 - 4410*cx5*cy6 - 24990*cx6*cy0 + 104370*cx6*cy1 - 167580*cx6*cy2 + 126420*cx6*cy3 - 42630*cx6*cy4 + 4410*cx6*cy5 + 2940*cx7*cy0 - 11760*cx7*cy1 + 17640*cx7*cy2 - 11760*cx7*cy3 + 2940*cx7*cy4,
-    2940*cx0*cy1 - 16170*cx0*cy2 + 36750*cx0*cy3 - 44100*cx0*cy4 + 29400*cx0*cy5 - 10290*cx0*cy6 + 1470*cx0*cy7 - 2940*cx1*cy0 + 51450*cx1*cy2 - 154350*cx1*cy3 + 205800*cx1*cy4 - 144060*cx1*cy5 + 51450*cx1*cy6 - 7350*cx1*cy7 + 16170*cx2*cy0 - 51450*cx2*cy1 + 205800*cx2*cy3 - 360150*cx2*cy4 + 277830*cx2*cy5 - 102900*cx2*cy6 + 14700*cx2*cy7 - 36750*cx3*cy0 + 154350*cx3*cy1 - 205800*cx3*cy2 + 257250*cx3*cy4 - 257250*cx3*cy5 + 102900*cx3*cy6 - 14700*cx3*cy7 + 44100*cx4*cy0 - 205800*cx4*cy1 + 360150*cx4*cy2 - 257250*cx4*cy3 + 102900*cx4*cy5 - 51450*cx4*cy6 + 7350*cx4*cy7 - 29400*cx5*cy0 + 144060*cx5*cy1 - 277830*cx5*cy2 + 257250*cx5*cy3 - 102900*cx5*cy4 + 10290*cx5*cy6 - 1470*cx5*cy7 + 10290*cx6*cy0 - 51450*cx6*cy1 + 102900*cx6*cy2 - 102900*cx6*cy3 + 51450*cx6*cy4 - 10290*cx6*cy5 - 1470*cx7*cy0 + 7350*cx7*cy1 - 14700*cx7*cy2 + 14700*cx7*cy3 - 7350*cx7*cy4 + 1470*cx7*cy5,
-    -294*cx0*cy1 + 1764*cx0*cy2 - 4410*cx0*cy3 + 5880*cx0*cy4 - 4410*cx0*cy5 + 1764*cx0*cy6 - 294*cx0*cy7 + 294*cx1*cy0 - 6174*cx1*cy2 + 20580*cx1*cy3 - 30870*cx1*cy4 + 24696*cx1*cy5 - 10290*cx1*cy6 + 1764*cx1*cy7 - 1764*cx2*cy0 + 6174*cx2*cy1 - 30870*cx2*cy3 + 61740*cx2*cy4 - 55566*cx2*cy5 + 24696*cx2*cy6 - 4410*cx2*cy7 + 4410*cx3*cy0 - 20580*cx3*cy1 + 30870*cx3*cy2 - 51450*cx3*cy4 + 61740*cx3*cy5 - 30870*cx3*cy6 + 5880*cx3*cy7 - 5880*cx4*cy0 + 30870*cx4*cy1 - 61740*cx4*cy2 + 51450*cx4*cy3 - 30870*cx4*cy5 + 20580*cx4*cy6 - 4410*cx4*cy7 + 4410*cx5*cy0 - 24696*cx5*cy1 + 55566*cx5*cy2 - 61740*cx5*cy3 + 30870*cx5*cy4 - 6174*cx5*cy6 + 1764*cx5*cy7 - 1764*cx6*cy0 + 10290*cx6*cy1 - 24696*cx6*cy2 + 30870*cx6*cy3 - 20580*cx6*cy4 + 6174*cx6*cy5 - 294*cx6*cy7 + 294*cx7*cy0 - 1764*cx7*cy1 + 4410*cx7*cy2 - 5880*cx7*cy3 + 4410*cx7*cy4 - 1764*cx7*cy5 + 294*cx7*cy6
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_Bezier_degree_8_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3, Scalar cx4, Scalar cy4, Scalar cx5, Scalar cy5, Scalar cx6, Scalar cy6, Scalar cx7, Scalar cy7, Scalar cx8, Scalar cy8,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 12>::find_real_roots_in_interval({
-        -448*cx0*cy1 + 448*cx0*cy2 + 448*cx1*cy0 - 448*cx1*cy2 - 448*cx2*cy0 + 448*cx2*cy1,
-    5376*cx0*cy1 - 8064*cx0*cy2 + 2688*cx0*cy3 - 5376*cx1*cy0 + 8064*cx1*cy2 - 2688*cx1*cy3 + 8064*cx2*cy0 - 8064*cx2*cy1 - 2688*cx3*cy0 + 2688*cx3*cy1,
-    -29568*cx0*cy1 + 59136*cx0*cy2 - 36288*cx0*cy3 + 6720*cx0*cy4 + 29568*cx1*cy0 - 68544*cx1*cy2 + 45696*cx1*cy3 - 6720*cx1*cy4 - 59136*cx2*cy0 + 68544*cx2*cy1 - 9408*cx2*cy3 + 36288*cx3*cy0 - 45696*cx3*cy1 + 9408*cx3*cy2 - 6720*cx4*cy0 + 6720*cx4*cy1,
-    98560*cx0*cy1 - 246400*cx0*cy2 + 215040*cx0*cy3 - 76160*cx0*cy4 + 8960*cx0*cy5 - 98560*cx1*cy0 + 340480*cx1*cy2 - 340480*cx1*cy3 + 107520*cx1*cy4 - 8960*cx1*cy5 + 246400*cx2*cy0 - 340480*cx2*cy1 + 125440*cx2*cy3 - 31360*cx2*cy4 - 215040*cx3*cy0 + 340480*cx3*cy1 - 125440*cx3*cy2 + 76160*cx4*cy0 - 107520*cx4*cy1 + 31360*cx4*cy2 - 8960*cx5*cy0 + 8960*cx5*cy1,
-    -221760*cx0*cy1 + 665280*cx0*cy2 - 745920*cx0*cy3 + 383040*cx0*cy4 - 87360*cx0*cy5 + 6720*cx0*cy6 + 221760*cx1*cy0 - 1088640*cx1*cy2 + 1451520*cx1*cy3 - 712320*cx1*cy4 + 134400*cx1*cy5 - 6720*cx1*cy6 - 665280*cx2*cy0 + 1088640*cx2*cy1 - 752640*cx2*cy3 + 376320*cx2*cy4 - 47040*cx2*cy5 + 745920*cx3*cy0 - 1451520*cx3*cy1 + 752640*cx3*cy2 - 47040*cx3*cy4 - 383040*cx4*cy0 + 712320*cx4*cy1 - 376320*cx4*cy2 + 47040*cx4*cy3 + 87360*cx5*cy0 - 134400*cx5*cy1 + 47040*cx5*cy2 - 6720*cx6*cy0 + 6720*cx6*cy1,
-    354816*cx0*cy1 - 1241856*cx0*cy2 + 1693440*cx0*cy3 - 1128960*cx0*cy4 + 376320*cx0*cy5 - 56448*cx0*cy6 + 2688*cx0*cy7 - 354816*cx1*cy0 + 2370816*cx1*cy2 - 3951360*cx1*cy3 + 2634240*cx1*cy4 - 790272*cx1*cy5 + 94080*cx1*cy6 - 2688*cx1*cy7 + 1241856*cx2*cy0 - 2370816*cx2*cy1 + 2634240*cx2*cy3 - 1975680*cx2*cy4 + 508032*cx2*cy5 - 37632*cx2*cy6 - 1693440*cx3*cy0 + 3951360*cx3*cy1 - 2634240*cx3*cy2 + 470400*cx3*cy4 - 94080*cx3*cy5 + 1128960*cx4*cy0 - 2634240*cx4*cy1 + 1975680*cx4*cy2 - 470400*cx4*cy3 - 376320*cx5*cy0 + 790272*cx5*cy1 - 508032*cx5*cy2 + 94080*cx5*cy3 + 56448*cx6*cy0 - 94080*cx6*cy1 + 37632*cx6*cy2 - 2688*cx7*cy0 + 2688*cx7*cy1,
-    -413952*cx0*cy1 + 1655808*cx0*cy2 - 2653056*cx0*cy3 + 2163840*cx0*cy4 - 940800*cx0*cy5 + 206976*cx0*cy6 - 19264*cx0*cy7 + 448*cx0*cy8 + 413952*cx1*cy0 - 3631488*cx1*cy2 + 7262976*cx1*cy3 - 6115200*cx1*cy4 + 2521344*cx1*cy5 - 486080*cx1*cy6 + 34944*cx1*cy7 - 448*cx1*cy8 - 1655808*cx2*cy0 + 3631488*cx2*cy1 - 5927040*cx2*cy3 + 5927040*cx2*cy4 - 2323776*cx2*cy5 + 363776*cx2*cy6 - 15680*cx2*cy7 + 2653056*cx3*cy0 - 7262976*cx3*cy1 + 5927040*cx3*cy2 - 2054080*cx3*cy4 + 821632*cx3*cy5 - 84672*cx3*cy6 - 2163840*cx4*cy0 + 6115200*cx4*cy1 - 5927040*cx4*cy2 + 2054080*cx4*cy3 - 78400*cx4*cy5 + 940800*cx5*cy0 - 2521344*cx5*cy1 + 2323776*cx5*cy2 - 821632*cx5*cy3 + 78400*cx5*cy4 - 206976*cx6*cy0 + 486080*cx6*cy1 - 363776*cx6*cy2 + 84672*cx6*cy3 + 19264*cx7*cy0 - 34944*cx7*cy1 + 15680*cx7*cy2 - 448*cx8*cy0 + 448*cx8*cy1,
-    354816*cx0*cy1 - 1596672*cx0*cy2 + 2935296*cx0*cy3 - 2822400*cx0*cy4 + 1505280*cx0*cy5 - 432768*cx0*cy6 + 59136*cx0*cy7 - 2688*cx0*cy8 - 354816*cx1*cy0 + 3967488*cx1*cy2 - 9257472*cx1*cy3 + 9408000*cx1*cy4 - 4929792*cx1*cy5 + 1317120*cx1*cy6 - 155904*cx1*cy7 + 5376*cx1*cy8 + 1596672*cx2*cy0 - 3967488*cx2*cy1 + 8956416*cx2*cy3 - 11195520*cx2*cy4 + 5908224*cx2*cy5 - 1430016*cx2*cy6 + 134400*cx2*cy7 - 2688*cx2*cy8 - 2935296*cx3*cy0 + 9257472*cx3*cy1 - 8956416*cx3*cy2 + 5080320*cx3*cy4 - 3048192*cx3*cy5 + 639744*cx3*cy6 - 37632*cx3*cy7 + 2822400*cx4*cy0 - 9408000*cx4*cy1 + 11195520*cx4*cy2 - 5080320*cx4*cy3 + 564480*cx4*cy5 - 94080*cx4*cy6 - 1505280*cx5*cy0 + 4929792*cx5*cy1 - 5908224*cx5*cy2 + 3048192*cx5*cy3 - 564480*cx5*cy4 + 432768*cx6*cy0 - 1317120*cx6*cy1 + 1430016*cx6*cy2 - 639744*cx6*cy3 + 94080*cx6*cy4 - 59136*cx7*cy0 + 155904*cx7*cy1 - 134400*cx7*cy2 + 37632*cx7*cy3 + 2688*cx8*cy0 - 5376*cx8*cy1 + 2688*cx8*cy2,
-    -221760*cx0*cy1 + 1108800*cx0*cy2 - 2298240*cx0*cy3 + 2540160*cx0*cy4 - 1599360*cx0*cy5 + 564480*cx0*cy6 - 100800*cx0*cy7 + 6720*cx0*cy8 + 221760*cx1*cy0 - 3084480*cx1*cy2 + 8225280*cx1*cy3 - 9784320*cx1*cy4 + 6209280*cx1*cy5 - 2116800*cx1*cy6 + 349440*cx1*cy7 - 20160*cx1*cy8 - 1108800*cx2*cy0 + 3084480*cx2*cy1 - 9219840*cx2*cy3 + 13829760*cx2*cy4 - 9172800*cx2*cy5 + 3010560*cx2*cy6 - 443520*cx2*cy7 + 20160*cx2*cy8 + 2298240*cx3*cy0 - 8225280*cx3*cy1 + 9219840*cx3*cy2 - 7761600*cx3*cy4 + 6209280*cx3*cy5 - 1975680*cx3*cy6 + 241920*cx3*cy7 - 6720*cx3*cy8 - 2540160*cx4*cy0 + 9784320*cx4*cy1 - 13829760*cx4*cy2 + 7761600*cx4*cy3 - 1693440*cx4*cy5 + 564480*cx4*cy6 - 47040*cx4*cy7 + 1599360*cx5*cy0 - 6209280*cx5*cy1 + 9172800*cx5*cy2 - 6209280*cx5*cy3 + 1693440*cx5*cy4 - 47040*cx5*cy6 - 564480*cx6*cy0 + 2116800*cx6*cy1 - 3010560*cx6*cy2 + 1975680*cx6*cy3 - 564480*cx6*cy4 + 47040*cx6*cy5 + 100800*cx7*cy0 - 349440*cx7*cy1 + 443520*cx7*cy2 - 241920*cx7*cy3 + 47040*cx7*cy4 - 6720*cx8*cy0 + 20160*cx8*cy1 - 20160*cx8*cy2 + 6720*cx8*cy3,
-    98560*cx0*cy1 - 542080*cx0*cy2 + 1249920*cx0*cy3 - 1559040*cx0*cy4 + 1128960*cx0*cy5 - 470400*cx0*cy6 + 103040*cx0*cy7 - 8960*cx0*cy8 - 98560*cx1*cy0 + 1671040*cx1*cy2 - 5013120*cx1*cy3 + 6827520*cx1*cy4 - 5080320*cx1*cy5 + 2101120*cx1*cy6 - 443520*cx1*cy7 + 35840*cx1*cy8 + 542080*cx2*cy0 - 1671040*cx2*cy1 + 6397440*cx2*cy3 - 11195520*cx2*cy4 + 8937600*cx2*cy5 - 3700480*cx2*cy6 + 743680*cx2*cy7 - 53760*cx2*cy8 - 1249920*cx3*cy0 + 5013120*cx3*cy1 - 6397440*cx3*cy2 + 7495040*cx3*cy4 - 7495040*cx3*cy5 + 3198720*cx3*cy6 - 600320*cx3*cy7 + 35840*cx3*cy8 + 1559040*cx4*cy0 - 6827520*cx4*cy1 + 11195520*cx4*cy2 - 7495040*cx4*cy3 + 2696960*cx4*cy5 - 1348480*cx4*cy6 + 228480*cx4*cy7 - 8960*cx4*cy8 - 1128960*cx5*cy0 + 5080320*cx5*cy1 - 8937600*cx5*cy2 + 7495040*cx5*cy3 - 2696960*cx5*cy4 + 219520*cx5*cy6 - 31360*cx5*cy7 + 470400*cx6*cy0 - 2101120*cx6*cy1 + 3700480*cx6*cy2 - 3198720*cx6*cy3 + 1348480*cx6*cy4 - 219520*cx6*cy5 - 103040*cx7*cy0 + 443520*cx7*cy1 - 743680*cx7*cy2 + 600320*cx7*cy3 - 228480*cx7*cy4 + 31360*cx7*cy5 + 8960*cx8*cy0 - 35840*cx8*cy1 + 53760*cx8*cy2 - 35840*cx8*cy3 + 8960*cx8*cy4,
-    -29568*cx0*cy1 + 177408*cx0*cy2 - 450240*cx0*cy3 + 624960*cx0*cy4 - 510720*cx0*cy5 + 244608*cx0*cy6 - 63168*cx0*cy7 + 6720*cx0*cy8 + 29568*cx1*cy0 - 600768*cx1*cy2 + 2002560*cx1*cy3 - 3071040*cx1*cy4 + 2618112*cx1*cy5 - 1270080*cx1*cy6 + 325248*cx1*cy7 - 33600*cx1*cy8 - 177408*cx2*cy0 + 600768*cx2*cy1 - 2869440*cx2*cy3 + 5738880*cx2*cy4 - 5353152*cx2*cy5 + 2671872*cx2*cy6 - 678720*cx2*cy7 + 67200*cx2*cy8 + 450240*cx3*cy0 - 2002560*cx3*cy1 + 2869440*cx3*cy2 - 4468800*cx3*cy4 + 5362560*cx3*cy5 - 2869440*cx3*cy6 + 725760*cx3*cy7 - 67200*cx3*cy8 - 624960*cx4*cy0 + 3071040*cx4*cy1 - 5738880*cx4*cy2 + 4468800*cx4*cy3 - 2399040*cx4*cy5 + 1599360*cx4*cy6 - 409920*cx4*cy7 + 33600*cx4*cy8 + 510720*cx5*cy0 - 2618112*cx5*cy1 + 5353152*cx5*cy2 - 5362560*cx5*cy3 + 2399040*cx5*cy4 - 385728*cx5*cy6 + 110208*cx5*cy7 - 6720*cx5*cy8 - 244608*cx6*cy0 + 1270080*cx6*cy1 - 2671872*cx6*cy2 + 2869440*cx6*cy3 - 1599360*cx6*cy4 + 385728*cx6*cy5 - 9408*cx6*cy7 + 63168*cx7*cy0 - 325248*cx7*cy1 + 678720*cx7*cy2 - 725760*cx7*cy3 + 409920*cx7*cy4 - 110208*cx7*cy5 + 9408*cx7*cy6 - 6720*cx8*cy0 + 33600*cx8*cy1 - 67200*cx8*cy2 + 67200*cx8*cy3 - 33600*cx8*cy4 + 6720*cx8*cy5,
-    5376*cx0*cy1 - 34944*cx0*cy2 + 96768*cx0*cy3 - 147840*cx0*cy4 + 134400*cx0*cy5 - 72576*cx0*cy6 + 21504*cx0*cy7 - 2688*cx0*cy8 - 5376*cx1*cy0 + 129024*cx1*cy2 - 473088*cx1*cy3 + 806400*cx1*cy4 - 774144*cx1*cy5 + 430080*cx1*cy6 - 129024*cx1*cy7 + 16128*cx1*cy8 + 34944*cx2*cy0 - 129024*cx2*cy1 + 752640*cx2*cy3 - 1693440*cx2*cy4 + 1806336*cx2*cy5 - 1053696*cx2*cy6 + 322560*cx2*cy7 - 40320*cx2*cy8 - 96768*cx3*cy0 + 473088*cx3*cy1 - 752640*cx3*cy2 + 1505280*cx3*cy4 - 2107392*cx3*cy5 + 1354752*cx3*cy6 - 430080*cx3*cy7 + 53760*cx3*cy8 + 147840*cx4*cy0 - 806400*cx4*cy1 + 1693440*cx4*cy2 - 1505280*cx4*cy3 + 1128960*cx4*cy5 - 940800*cx4*cy6 + 322560*cx4*cy7 - 40320*cx4*cy8 - 134400*cx5*cy0 + 774144*cx5*cy1 - 1806336*cx5*cy2 + 2107392*cx5*cy3 - 1128960*cx5*cy4 + 301056*cx5*cy6 - 129024*cx5*cy7 + 16128*cx5*cy8 + 72576*cx6*cy0 - 430080*cx6*cy1 + 1053696*cx6*cy2 - 1354752*cx6*cy3 + 940800*cx6*cy4 - 301056*cx6*cy5 + 21504*cx6*cy7 - 2688*cx6*cy8 - 21504*cx7*cy0 + 129024*cx7*cy1 - 322560*cx7*cy2 + 430080*cx7*cy3 - 322560*cx7*cy4 + 129024*cx7*cy5 - 21504*cx7*cy6 + 2688*cx8*cy0 - 16128*cx8*cy1 + 40320*cx8*cy2 - 53760*cx8*cy3 + 40320*cx8*cy4 - 16128*cx8*cy5 + 2688*cx8*cy6,
-    -448*cx0*cy1 + 3136*cx0*cy2 - 9408*cx0*cy3 + 15680*cx0*cy4 - 15680*cx0*cy5 + 9408*cx0*cy6 - 3136*cx0*cy7 + 448*cx0*cy8 + 448*cx1*cy0 - 12544*cx1*cy2 + 50176*cx1*cy3 - 94080*cx1*cy4 + 100352*cx1*cy5 - 62720*cx1*cy6 + 21504*cx1*cy7 - 3136*cx1*cy8 - 3136*cx2*cy0 + 12544*cx2*cy1 - 87808*cx2*cy3 + 219520*cx2*cy4 - 263424*cx2*cy5 + 175616*cx2*cy6 - 62720*cx2*cy7 + 9408*cx2*cy8 + 9408*cx3*cy0 - 50176*cx3*cy1 + 87808*cx3*cy2 - 219520*cx3*cy4 + 351232*cx3*cy5 - 263424*cx3*cy6 + 100352*cx3*cy7 - 15680*cx3*cy8 - 15680*cx4*cy0 + 94080*cx4*cy1 - 219520*cx4*cy2 + 219520*cx4*cy3 - 219520*cx4*cy5 + 219520*cx4*cy6 - 94080*cx4*cy7 + 15680*cx4*cy8 + 15680*cx5*cy0 - 100352*cx5*cy1 + 263424*cx5*cy2 - 351232*cx5*cy3 + 219520*cx5*cy4 - 87808*cx5*cy6 + 50176*cx5*cy7 - 9408*cx5*cy8 - 9408*cx6*cy0 + 62720*cx6*cy1 - 175616*cx6*cy2 + 263424*cx6*cy3 - 219520*cx6*cy4 + 87808*cx6*cy5 - 12544*cx6*cy7 + 3136*cx6*cy8 + 3136*cx7*cy0 - 21504*cx7*cy1 + 62720*cx7*cy2 - 100352*cx7*cy3 + 94080*cx7*cy4 - 50176*cx7*cy5 + 12544*cx7*cy6 - 448*cx7*cy8 - 448*cx8*cy0 + 3136*cx8*cy1 - 9408*cx8*cy2 + 15680*cx8*cy3 - 15680*cx8*cy4 + 9408*cx8*cy5 - 3136*cx8*cy6 + 448*cx8*cy7
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_Bezier_degree_9_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3, Scalar cx4, Scalar cy4, Scalar cx5, Scalar cy5, Scalar cx6, Scalar cy6, Scalar cx7, Scalar cy7, Scalar cx8, Scalar cy8, Scalar cx9, Scalar cy9,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 14>::find_real_roots_in_interval({
-        -648*cx0*cy1 + 648*cx0*cy2 + 648*cx1*cy0 - 648*cx1*cy2 - 648*cx2*cy0 + 648*cx2*cy1,
-    9072*cx0*cy1 - 13608*cx0*cy2 + 4536*cx0*cy3 - 9072*cx1*cy0 + 13608*cx1*cy2 - 4536*cx1*cy3 + 13608*cx2*cy0 - 13608*cx2*cy1 - 4536*cx3*cy0 + 4536*cx3*cy1,
-    -58968*cx0*cy1 + 117936*cx0*cy2 - 72576*cx0*cy3 + 13608*cx0*cy4 + 58968*cx1*cy0 - 136080*cx1*cy2 + 90720*cx1*cy3 - 13608*cx1*cy4 - 117936*cx2*cy0 + 136080*cx2*cy1 - 18144*cx2*cy3 + 72576*cx3*cy0 - 90720*cx3*cy1 + 18144*cx3*cy2 - 13608*cx4*cy0 + 13608*cx4*cy1,
-    235872*cx0*cy1 - 589680*cx0*cy2 + 517104*cx0*cy3 - 185976*cx0*cy4 + 22680*cx0*cy5 - 235872*cx1*cy0 + 807408*cx1*cy2 - 807408*cx1*cy3 + 258552*cx1*cy4 - 22680*cx1*cy5 + 589680*cx2*cy0 - 807408*cx2*cy1 + 290304*cx2*cy3 - 72576*cx2*cy4 - 517104*cx3*cy0 + 807408*cx3*cy1 - 290304*cx3*cy2 + 185976*cx4*cy0 - 258552*cx4*cy1 + 72576*cx4*cy2 - 22680*cx5*cy0 + 22680*cx5*cy1,
-    -648648*cx0*cy1 + 1945944*cx0*cy2 - 2195424*cx0*cy3 + 1147608*cx0*cy4 - 272160*cx0*cy5 + 22680*cx0*cy6 + 648648*cx1*cy0 - 3143448*cx1*cy2 + 4191264*cx1*cy3 - 2082024*cx1*cy4 + 408240*cx1*cy5 - 22680*cx1*cy6 - 1945944*cx2*cy0 + 3143448*cx2*cy1 - 2122848*cx2*cy3 + 1061424*cx2*cy4 - 136080*cx2*cy5 + 2195424*cx3*cy0 - 4191264*cx3*cy1 + 2122848*cx3*cy2 - 127008*cx3*cy4 - 1147608*cx4*cy0 + 2082024*cx4*cy1 - 1061424*cx4*cy2 + 127008*cx4*cy3 + 272160*cx5*cy0 - 408240*cx5*cy1 + 136080*cx5*cy2 - 22680*cx6*cy0 + 22680*cx6*cy1,
-    1297296*cx0*cy1 - 4540536*cx0*cy2 + 6237000*cx0*cy3 - 4241160*cx0*cy4 + 1474200*cx0*cy5 - 240408*cx0*cy6 + 13608*cx0*cy7 - 1297296*cx1*cy0 + 8532216*cx1*cy2 - 14220360*cx1*cy3 + 9593640*cx1*cy4 - 2980152*cx1*cy5 + 385560*cx1*cy6 - 13608*cx1*cy7 + 4540536*cx2*cy0 - 8532216*cx2*cy1 + 9253440*cx2*cy3 - 6940080*cx2*cy4 + 1823472*cx2*cy5 - 145152*cx2*cy6 - 6237000*cx3*cy0 + 14220360*cx3*cy1 - 9253440*cx3*cy2 + 1587600*cx3*cy4 - 317520*cx3*cy5 + 4241160*cx4*cy0 - 9593640*cx4*cy1 + 6940080*cx4*cy2 - 1587600*cx4*cy3 - 1474200*cx5*cy0 + 2980152*cx5*cy1 - 1823472*cx5*cy2 + 317520*cx5*cy3 + 240408*cx6*cy0 - 385560*cx6*cy1 + 145152*cx6*cy2 - 13608*cx7*cy0 + 13608*cx7*cy1,
-    -1945944*cx0*cy1 + 7783776*cx0*cy2 - 12573792*cx0*cy3 + 10478160*cx0*cy4 - 4762800*cx0*cy5 + 1143072*cx0*cy6 - 127008*cx0*cy7 + 4536*cx0*cy8 + 1945944*cx1*cy0 - 16765056*cx1*cy2 + 33530112*cx1*cy3 - 28576800*cx1*cy4 + 12192768*cx1*cy5 - 2540160*cx1*cy6 + 217728*cx1*cy7 - 4536*cx1*cy8 - 7783776*cx2*cy0 + 16765056*cx2*cy1 - 26671680*cx2*cy3 + 26671680*cx2*cy4 - 10668672*cx2*cy5 + 1778112*cx2*cy6 - 90720*cx2*cy7 + 12573792*cx3*cy0 - 33530112*cx3*cy1 + 26671680*cx3*cy2 - 8890560*cx3*cy4 + 3556224*cx3*cy5 - 381024*cx3*cy6 - 10478160*cx4*cy0 + 28576800*cx4*cy1 - 26671680*cx4*cy2 + 8890560*cx4*cy3 - 317520*cx4*cy5 + 4762800*cx5*cy0 - 12192768*cx5*cy1 + 10668672*cx5*cy2 - 3556224*cx5*cy3 + 317520*cx5*cy4 - 1143072*cx6*cy0 + 2540160*cx6*cy1 - 1778112*cx6*cy2 + 381024*cx6*cy3 + 127008*cx7*cy0 - 217728*cx7*cy1 + 90720*cx7*cy2 - 4536*cx8*cy0 + 4536*cx8*cy1,
-    2223936*cx0*cy1 - 10007712*cx0*cy2 + 18561312*cx0*cy3 - 18261936*cx0*cy4 + 10206000*cx0*cy5 - 3211488*cx0*cy6 + 526176*cx0*cy7 - 36936*cx0*cy8 + 648*cx0*cy9 - 2223936*cx1*cy0 + 24377760*cx1*cy2 - 56881440*cx1*cy3 + 58541616*cx1*cy4 - 31761072*cx1*cy5 + 9162720*cx1*cy6 - 1283040*cx1*cy7 + 68040*cx1*cy8 - 648*cx1*cy9 + 10007712*cx2*cy0 - 24377760*cx2*cy1 + 53561088*cx2*cy3 - 66951360*cx2*cy4 + 36033984*cx2*cy5 - 9253440*cx2*cy6 + 1010880*cx2*cy7 - 31104*cx2*cy8 - 18561312*cx3*cy0 + 56881440*cx3*cy1 - 53561088*cx3*cy2 + 29211840*cx3*cy4 - 17527104*cx3*cy5 + 3810240*cx3*cy6 - 254016*cx3*cy7 + 18261936*cx4*cy0 - 58541616*cx4*cy1 + 66951360*cx4*cy2 - 29211840*cx4*cy3 + 3048192*cx4*cy5 - 508032*cx4*cy6 - 10206000*cx5*cy0 + 31761072*cx5*cy1 - 36033984*cx5*cy2 + 17527104*cx5*cy3 - 3048192*cx5*cy4 + 3211488*cx6*cy0 - 9162720*cx6*cy1 + 9253440*cx6*cy2 - 3810240*cx6*cy3 + 508032*cx6*cy4 - 526176*cx7*cy0 + 1283040*cx7*cy1 - 1010880*cx7*cy2 + 254016*cx7*cy3 + 36936*cx8*cy0 - 68040*cx8*cy1 + 31104*cx8*cy2 - 648*cx9*cy0 + 648*cx9*cy1,
-    -1945944*cx0*cy1 + 9729720*cx0*cy2 - 20357568*cx0*cy3 + 23051952*cx0*cy4 - 15240960*cx0*cy5 + 5905872*cx0*cy6 - 1270080*cx0*cy7 + 131544*cx0*cy8 - 4536*cx0*cy9 + 1945944*cx1*cy0 - 26494776*cx1*cy2 + 70652736*cx1*cy3 - 85158864*cx1*cy4 + 56010528*cx1*cy5 - 20638800*cx1*cy6 + 4027968*cx1*cy7 - 353808*cx1*cy8 + 9072*cx1*cy9 - 9729720*cx2*cy0 + 26494776*cx2*cy1 - 76966848*cx2*cy3 + 115450272*cx2*cy4 - 78109920*cx2*cy5 + 27179712*cx2*cy6 - 4626720*cx2*cy7 + 312984*cx2*cy8 - 4536*cx2*cy9 + 20357568*cx3*cy0 - 70652736*cx3*cy1 + 76966848*cx3*cy2 - 62233920*cx3*cy4 + 49787136*cx3*cy5 - 16384032*cx3*cy6 + 2249856*cx3*cy7 - 90720*cx3*cy8 - 23051952*cx4*cy0 + 85158864*cx4*cy1 - 115450272*cx4*cy2 + 62233920*cx4*cy3 - 12764304*cx4*cy5 + 4254768*cx4*cy6 - 381024*cx4*cy7 + 15240960*cx5*cy0 - 56010528*cx5*cy1 + 78109920*cx5*cy2 - 49787136*cx5*cy3 + 12764304*cx5*cy4 - 317520*cx5*cy6 - 5905872*cx6*cy0 + 20638800*cx6*cy1 - 27179712*cx6*cy2 + 16384032*cx6*cy3 - 4254768*cx6*cy4 + 317520*cx6*cy5 + 1270080*cx7*cy0 - 4027968*cx7*cy1 + 4626720*cx7*cy2 - 2249856*cx7*cy3 + 381024*cx7*cy4 - 131544*cx8*cy0 + 353808*cx8*cy1 - 312984*cx8*cy2 + 90720*cx8*cy3 + 4536*cx9*cy0 - 9072*cx9*cy1 + 4536*cx9*cy2,
-    1297296*cx0*cy1 - 7135128*cx0*cy2 + 16615368*cx0*cy3 - 21255696*cx0*cy4 + 16193520*cx0*cy5 - 7429968*cx0*cy6 + 1968624*cx0*cy7 - 267624*cx0*cy8 + 13608*cx0*cy9 - 1297296*cx1*cy0 + 21505176*cx1*cy2 - 64515528*cx1*cy3 + 89077968*cx1*cy4 - 68774832*cx1*cy5 + 30799440*cx1*cy6 - 7702128*cx1*cy7 + 948024*cx1*cy8 - 40824*cx1*cy9 + 7135128*cx2*cy0 - 21505176*cx2*cy1 + 79906176*cx2*cy3 - 139835808*cx2*cy4 + 113926176*cx2*cy5 - 50041152*cx2*cy6 + 11612160*cx2*cy7 - 1238328*cx2*cy8 + 40824*cx2*cy9 - 16615368*cx3*cy0 + 64515528*cx3*cy1 - 79906176*cx3*cy2 + 89794656*cx3*cy4 - 89794656*cx3*cy5 + 39626496*cx3*cy6 - 8309952*cx3*cy7 + 703080*cx3*cy8 - 13608*cx3*cy9 + 21255696*cx4*cy0 - 89077968*cx4*cy1 + 139835808*cx4*cy2 - 89794656*cx4*cy3 + 30354912*cx4*cy5 - 15177456*cx4*cy6 + 2748816*cx4*cy7 - 145152*cx4*cy8 - 16193520*cx5*cy0 + 68774832*cx5*cy1 - 113926176*cx5*cy2 + 89794656*cx5*cy3 - 30354912*cx5*cy4 + 2222640*cx5*cy6 - 317520*cx5*cy7 + 7429968*cx6*cy0 - 30799440*cx6*cy1 + 50041152*cx6*cy2 - 39626496*cx6*cy3 + 15177456*cx6*cy4 - 2222640*cx6*cy5 - 1968624*cx7*cy0 + 7702128*cx7*cy1 - 11612160*cx7*cy2 + 8309952*cx7*cy3 - 2748816*cx7*cy4 + 317520*cx7*cy5 + 267624*cx8*cy0 - 948024*cx8*cy1 + 1238328*cx8*cy2 - 703080*cx8*cy3 + 145152*cx8*cy4 - 13608*cx9*cy0 + 40824*cx9*cy1 - 40824*cx9*cy2 + 13608*cx9*cy3,
-    -648648*cx0*cy1 + 3891888*cx0*cy2 - 9979200*cx0*cy3 + 14220360*cx0*cy4 - 12247200*cx0*cy5 + 6477408*cx0*cy6 - 2032128*cx0*cy7 + 340200*cx0*cy8 - 22680*cx0*cy9 + 648648*cx1*cy0 - 12873168*cx1*cy2 + 42910560*cx1*cy3 - 66747240*cx1*cy4 + 59113152*cx1*cy5 - 31116960*cx1*cy6 + 9471168*cx1*cy7 - 1496880*cx1*cy8 + 90720*cx1*cy9 - 3891888*cx2*cy0 + 12873168*cx2*cy1 - 59603040*cx2*cy3 + 119206080*cx2*cy4 - 113545152*cx2*cy5 + 60201792*cx2*cy6 - 17690400*cx2*cy7 + 2585520*cx2*cy8 - 136080*cx2*cy9 + 9979200*cx3*cy0 - 42910560*cx3*cy1 + 59603040*cx3*cy2 - 88905600*cx3*cy4 + 106686720*cx3*cy5 - 59058720*cx3*cy6 + 16692480*cx3*cy7 - 2177280*cx3*cy8 + 90720*cx3*cy9 - 14220360*cx4*cy0 + 66747240*cx4*cy1 - 119206080*cx4*cy2 + 88905600*cx4*cy3 - 44770320*cx4*cy5 + 29846880*cx4*cy6 - 8164800*cx4*cy7 + 884520*cx4*cy8 - 22680*cx4*cy9 + 12247200*cx5*cy0 - 59113152*cx5*cy1 + 113545152*cx5*cy2 - 106686720*cx5*cy3 + 44770320*cx5*cy4 - 6477408*cx5*cy6 + 1850688*cx5*cy7 - 136080*cx5*cy8 - 6477408*cx6*cy0 + 31116960*cx6*cy1 - 60201792*cx6*cy2 + 59058720*cx6*cy3 - 29846880*cx6*cy4 + 6477408*cx6*cy5 - 127008*cx6*cy7 + 2032128*cx7*cy0 - 9471168*cx7*cy1 + 17690400*cx7*cy2 - 16692480*cx7*cy3 + 8164800*cx7*cy4 - 1850688*cx7*cy5 + 127008*cx7*cy6 - 340200*cx8*cy0 + 1496880*cx8*cy1 - 2585520*cx8*cy2 + 2177280*cx8*cy3 - 884520*cx8*cy4 + 136080*cx8*cy5 + 22680*cx9*cy0 - 90720*cx9*cy1 + 136080*cx9*cy2 - 90720*cx9*cy3 + 22680*cx9*cy4,
-    235872*cx0*cy1 - 1533168*cx0*cy2 + 4291056*cx0*cy3 - 6735960*cx0*cy4 + 6463800*cx0*cy5 - 3864672*cx0*cy6 + 1397088*cx0*cy7 - 276696*cx0*cy8 + 22680*cx0*cy9 - 235872*cx1*cy0 + 5524848*cx1*cy2 - 20257776*cx1*cy3 + 35040600*cx1*cy4 - 34986168*cx1*cy5 + 21137760*cx1*cy6 - 7566048*cx1*cy7 + 1456056*cx1*cy8 - 113400*cx1*cy9 + 1533168*cx2*cy0 - 5524848*cx2*cy1 + 31207680*cx2*cy3 - 70217280*cx2*cy4 + 76531392*cx2*cy5 - 47500992*cx2*cy6 + 16873920*cx2*cy7 - 3129840*cx2*cy8 + 226800*cx2*cy9 - 4291056*cx3*cy0 + 20257776*cx3*cy1 - 31207680*cx3*cy2 + 59693760*cx3*cy4 - 83571264*cx3*cy5 + 55629504*cx3*cy6 - 19776960*cx3*cy7 + 3492720*cx3*cy8 - 226800*cx3*cy9 + 6735960*cx4*cy0 - 35040600*cx4*cy1 + 70217280*cx4*cy2 - 59693760*cx4*cy3 + 41912640*cx4*cy5 - 34927200*cx4*cy6 + 12791520*cx4*cy7 - 2109240*cx4*cy8 + 113400*cx4*cy9 - 6463800*cx5*cy0 + 34986168*cx5*cy1 - 76531392*cx5*cy2 + 83571264*cx5*cy3 - 41912640*cx5*cy4 + 10033632*cx5*cy6 - 4300128*cx5*cy7 + 639576*cx5*cy8 - 22680*cx5*cy9 + 3864672*cx6*cy0 - 21137760*cx6*cy1 + 47500992*cx6*cy2 - 55629504*cx6*cy3 + 34927200*cx6*cy4 - 10033632*cx6*cy5 + 580608*cx6*cy7 - 72576*cx6*cy8 - 1397088*cx7*cy0 + 7566048*cx7*cy1 - 16873920*cx7*cy2 + 19776960*cx7*cy3 - 12791520*cx7*cy4 + 4300128*cx7*cy5 - 580608*cx7*cy6 + 276696*cx8*cy0 - 1456056*cx8*cy1 + 3129840*cx8*cy2 - 3492720*cx8*cy3 + 2109240*cx8*cy4 - 639576*cx8*cy5 + 72576*cx8*cy6 - 22680*cx9*cy0 + 113400*cx9*cy1 - 226800*cx9*cy2 + 226800*cx9*cy3 - 113400*cx9*cy4 + 22680*cx9*cy5,
-    -58968*cx0*cy1 + 412776*cx0*cy2 - 1251936*cx0*cy3 + 2145528*cx0*cy4 - 2268000*cx0*cy5 + 1510488*cx0*cy6 - 616896*cx0*cy7 + 140616*cx0*cy8 - 13608*cx0*cy9 + 58968*cx1*cy0 - 1610280*cx1*cy2 + 6441120*cx1*cy3 - 12260808*cx1*cy4 + 13617072*cx1*cy5 - 9276120*cx1*cy6 + 3810240*cx1*cy7 - 861840*cx1*cy8 + 81648*cx1*cy9 - 412776*cx2*cy0 + 1610280*cx2*cy1 - 10904544*cx2*cy3 + 27261360*cx2*cy4 - 33448464*cx2*cy5 + 23768640*cx2*cy6 - 9888480*cx2*cy7 + 2218104*cx2*cy8 - 204120*cx2*cy9 + 1251936*cx3*cy0 - 6441120*cx3*cy1 + 10904544*cx3*cy2 - 26036640*cx3*cy4 + 41658624*cx3*cy5 - 32387040*cx3*cy6 + 13862016*cx3*cy7 - 3084480*cx3*cy8 + 272160*cx3*cy9 - 2145528*cx4*cy0 + 12260808*cx4*cy1 - 27261360*cx4*cy2 + 26036640*cx4*cy3 - 24322032*cx4*cy5 + 24322032*cx4*cy6 - 11158560*cx4*cy7 + 2472120*cx4*cy8 - 204120*cx4*cy9 + 2268000*cx5*cy0 - 13617072*cx5*cy1 + 33448464*cx5*cy2 - 41658624*cx5*cy3 + 24322032*cx5*cy4 - 8700048*cx5*cy6 + 4971456*cx5*cy7 - 1115856*cx5*cy8 + 81648*cx5*cy9 - 1510488*cx6*cy0 + 9276120*cx6*cy1 - 23768640*cx6*cy2 + 32387040*cx6*cy3 - 24322032*cx6*cy4 + 8700048*cx6*cy5 - 997920*cx6*cy7 + 249480*cx6*cy8 - 13608*cx6*cy9 + 616896*cx7*cy0 - 3810240*cx7*cy1 + 9888480*cx7*cy2 - 13862016*cx7*cy3 + 11158560*cx7*cy4 - 4971456*cx7*cy5 + 997920*cx7*cy6 - 18144*cx7*cy8 - 140616*cx8*cy0 + 861840*cx8*cy1 - 2218104*cx8*cy2 + 3084480*cx8*cy3 - 2472120*cx8*cy4 + 1115856*cx8*cy5 - 249480*cx8*cy6 + 18144*cx8*cy7 + 13608*cx9*cy0 - 81648*cx9*cy1 + 204120*cx9*cy2 - 272160*cx9*cy3 + 204120*cx9*cy4 - 81648*cx9*cy5 + 13608*cx9*cy6,
-    9072*cx0*cy1 - 68040*cx0*cy2 + 222264*cx0*cy3 - 412776*cx0*cy4 + 476280*cx0*cy5 - 349272*cx0*cy6 + 158760*cx0*cy7 - 40824*cx0*cy8 + 4536*cx0*cy9 - 9072*cx1*cy0 + 285768*cx1*cy2 - 1238328*cx1*cy3 + 2571912*cx1*cy4 - 3143448*cx1*cy5 + 2381400*cx1*cy6 - 1102248*cx1*cy7 + 285768*cx1*cy8 - 31752*cx1*cy9 + 68040*cx2*cy0 - 285768*cx2*cy1 + 2286144*cx2*cy3 - 6286896*cx2*cy4 + 8573040*cx2*cy5 - 6858432*cx2*cy6 + 3265920*cx2*cy7 - 857304*cx2*cy8 + 95256*cx2*cy9 - 222264*cx3*cy0 + 1238328*cx3*cy1 - 2286144*cx3*cy2 + 6667920*cx3*cy4 - 12002256*cx3*cy5 + 10668672*cx3*cy6 - 5334336*cx3*cy7 + 1428840*cx3*cy8 - 158760*cx3*cy9 + 412776*cx4*cy0 - 2571912*cx4*cy1 + 6286896*cx4*cy2 - 6667920*cx4*cy3 + 8001504*cx4*cy5 - 9335088*cx4*cy6 + 5143824*cx4*cy7 - 1428840*cx4*cy8 + 158760*cx4*cy9 - 476280*cx5*cy0 + 3143448*cx5*cy1 - 8573040*cx5*cy2 + 12002256*cx5*cy3 - 8001504*cx5*cy4 + 4000752*cx5*cy6 - 2857680*cx5*cy7 + 857304*cx5*cy8 - 95256*cx5*cy9 + 349272*cx6*cy0 - 2381400*cx6*cy1 + 6858432*cx6*cy2 - 10668672*cx6*cy3 + 9335088*cx6*cy4 - 4000752*cx6*cy5 + 762048*cx6*cy7 - 285768*cx6*cy8 + 31752*cx6*cy9 - 158760*cx7*cy0 + 1102248*cx7*cy1 - 3265920*cx7*cy2 + 5334336*cx7*cy3 - 5143824*cx7*cy4 + 2857680*cx7*cy5 - 762048*cx7*cy6 + 40824*cx7*cy8 - 4536*cx7*cy9 + 40824*cx8*cy0 - 285768*cx8*cy1 + 857304*cx8*cy2 - 1428840*cx8*cy3 + 1428840*cx8*cy4 - 857304*cx8*cy5 + 285768*cx8*cy6 - 40824*cx8*cy7 - 4536*cx9*cy0 + 31752*cx9*cy1 - 95256*cx9*cy2 + 158760*cx9*cy3 - 158760*cx9*cy4 + 95256*cx9*cy5 - 31752*cx9*cy6 + 4536*cx9*cy7,
-    -648*cx0*cy1 + 5184*cx0*cy2 - 18144*cx0*cy3 + 36288*cx0*cy4 - 45360*cx0*cy5 + 36288*cx0*cy6 - 18144*cx0*cy7 + 5184*cx0*cy8 - 648*cx0*cy9 + 648*cx1*cy0 - 23328*cx1*cy2 + 108864*cx1*cy3 - 244944*cx1*cy4 + 326592*cx1*cy5 - 272160*cx1*cy6 + 139968*cx1*cy7 - 40824*cx1*cy8 + 5184*cx1*cy9 - 5184*cx2*cy0 + 23328*cx2*cy1 - 217728*cx2*cy3 + 653184*cx2*cy4 - 979776*cx2*cy5 + 870912*cx2*cy6 - 466560*cx2*cy7 + 139968*cx2*cy8 - 18144*cx2*cy9 + 18144*cx3*cy0 - 108864*cx3*cy1 + 217728*cx3*cy2 - 762048*cx3*cy4 + 1524096*cx3*cy5 - 1524096*cx3*cy6 + 870912*cx3*cy7 - 272160*cx3*cy8 + 36288*cx3*cy9 - 36288*cx4*cy0 + 244944*cx4*cy1 - 653184*cx4*cy2 + 762048*cx4*cy3 - 1143072*cx4*cy5 + 1524096*cx4*cy6 - 979776*cx4*cy7 + 326592*cx4*cy8 - 45360*cx4*cy9 + 45360*cx5*cy0 - 326592*cx5*cy1 + 979776*cx5*cy2 - 1524096*cx5*cy3 + 1143072*cx5*cy4 - 762048*cx5*cy6 + 653184*cx5*cy7 - 244944*cx5*cy8 + 36288*cx5*cy9 - 36288*cx6*cy0 + 272160*cx6*cy1 - 870912*cx6*cy2 + 1524096*cx6*cy3 - 1524096*cx6*cy4 + 762048*cx6*cy5 - 217728*cx6*cy7 + 108864*cx6*cy8 - 18144*cx6*cy9 + 18144*cx7*cy0 - 139968*cx7*cy1 + 466560*cx7*cy2 - 870912*cx7*cy3 + 979776*cx7*cy4 - 653184*cx7*cy5 + 217728*cx7*cy6 - 23328*cx7*cy8 + 5184*cx7*cy9 - 5184*cx8*cy0 + 40824*cx8*cy1 - 139968*cx8*cy2 + 272160*cx8*cy3 - 326592*cx8*cy4 + 244944*cx8*cy5 - 108864*cx8*cy6 + 23328*cx8*cy7 - 648*cx8*cy9 + 648*cx9*cy0 - 5184*cx9*cy1 + 18144*cx9*cy2 - 36288*cx9*cy3 + 45360*cx9*cy4 - 36288*cx9*cy5 + 18144*cx9*cy6 - 5184*cx9*cy7 + 648*cx9*cy8
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_Bezier_degree_10_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3, Scalar cx4, Scalar cy4, Scalar cx5, Scalar cy5, Scalar cx6, Scalar cy6, Scalar cx7, Scalar cy7, Scalar cx8, Scalar cy8, Scalar cx9, Scalar cy9, Scalar cx10, Scalar cy10,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 16>::find_real_roots_in_interval({
-        -900*cx0*cy1 + 900*cx0*cy2 + 900*cx1*cy0 - 900*cx1*cy2 - 900*cx2*cy0 + 900*cx2*cy1,
-    14400*cx0*cy1 - 21600*cx0*cy2 + 7200*cx0*cy3 - 14400*cx1*cy0 + 21600*cx1*cy2 - 7200*cx1*cy3 + 21600*cx2*cy0 - 21600*cx2*cy1 - 7200*cx3*cy0 + 7200*cx3*cy1,
-    -108000*cx0*cy1 + 216000*cx0*cy2 - 133200*cx0*cy3 + 25200*cx0*cy4 + 108000*cx1*cy0 - 248400*cx1*cy2 + 165600*cx1*cy3 - 25200*cx1*cy4 - 216000*cx2*cy0 + 248400*cx2*cy1 - 32400*cx2*cy3 + 133200*cx3*cy0 - 165600*cx3*cy1 + 32400*cx3*cy2 - 25200*cx4*cy0 + 25200*cx4*cy1,
-    504000*cx0*cy1 - 1260000*cx0*cy2 + 1108800*cx0*cy3 - 403200*cx0*cy4 + 50400*cx0*cy5 - 504000*cx1*cy0 + 1713600*cx1*cy2 - 1713600*cx1*cy3 + 554400*cx1*cy4 - 50400*cx1*cy5 + 1260000*cx2*cy0 - 1713600*cx2*cy1 + 604800*cx2*cy3 - 151200*cx2*cy4 - 1108800*cx3*cy0 + 1713600*cx3*cy1 - 604800*cx3*cy2 + 403200*cx4*cy0 - 554400*cx4*cy1 + 151200*cx4*cy2 - 50400*cx5*cy0 + 50400*cx5*cy1,
-    -1638000*cx0*cy1 + 4914000*cx0*cy2 - 5569200*cx0*cy3 + 2948400*cx0*cy4 - 718200*cx0*cy5 + 63000*cx0*cy6 + 1638000*cx1*cy0 - 7862400*cx1*cy2 + 10483200*cx1*cy3 - 5254200*cx1*cy4 + 1058400*cx1*cy5 - 63000*cx1*cy6 - 4914000*cx2*cy0 + 7862400*cx2*cy1 - 5216400*cx2*cy3 + 2608200*cx2*cy4 - 340200*cx2*cy5 + 5569200*cx3*cy0 - 10483200*cx3*cy1 + 5216400*cx3*cy2 - 302400*cx3*cy4 - 2948400*cx4*cy0 + 5254200*cx4*cy1 - 2608200*cx4*cy2 + 302400*cx4*cy3 + 718200*cx5*cy0 - 1058400*cx5*cy1 + 340200*cx5*cy2 - 63000*cx6*cy0 + 63000*cx6*cy1,
-    3931200*cx0*cy1 - 13759200*cx0*cy2 + 19000800*cx0*cy3 - 13104000*cx0*cy4 + 4687200*cx0*cy5 - 806400*cx0*cy6 + 50400*cx0*cy7 - 3931200*cx1*cy0 + 25552800*cx1*cy2 - 42588000*cx1*cy3 + 28980000*cx1*cy4 - 9223200*cx1*cy5 + 1260000*cx1*cy6 - 50400*cx1*cy7 + 13759200*cx2*cy0 - 25552800*cx2*cy1 + 27216000*cx2*cy3 - 20412000*cx2*cy4 + 5443200*cx2*cy5 - 453600*cx2*cy6 - 19000800*cx3*cy0 + 42588000*cx3*cy1 - 27216000*cx3*cy2 + 4536000*cx3*cy4 - 907200*cx3*cy5 + 13104000*cx4*cy0 - 28980000*cx4*cy1 + 20412000*cx4*cy2 - 4536000*cx4*cy3 - 4687200*cx5*cy0 + 9223200*cx5*cy1 - 5443200*cx5*cy2 + 907200*cx5*cy3 + 806400*cx6*cy0 - 1260000*cx6*cy1 + 453600*cx6*cy2 - 50400*cx7*cy0 + 50400*cx7*cy1,
-    -7207200*cx0*cy1 + 28828800*cx0*cy2 - 46846800*cx0*cy3 + 39639600*cx0*cy4 - 18572400*cx0*cy5 + 4712400*cx0*cy6 - 579600*cx0*cy7 + 25200*cx0*cy8 + 7207200*cx1*cy0 - 61261200*cx1*cy2 + 122522400*cx1*cy3 - 105336000*cx1*cy4 + 46015200*cx1*cy5 - 10080000*cx1*cy6 + 957600*cx1*cy7 - 25200*cx1*cy8 - 28828800*cx2*cy0 + 61261200*cx2*cy1 - 95634000*cx2*cy3 + 95634000*cx2*cy4 - 38782800*cx2*cy5 + 6728400*cx2*cy6 - 378000*cx2*cy7 + 46846800*cx3*cy0 - 122522400*cx3*cy1 + 95634000*cx3*cy2 - 30996000*cx3*cy4 + 12398400*cx3*cy5 - 1360800*cx3*cy6 - 39639600*cx4*cy0 + 105336000*cx4*cy1 - 95634000*cx4*cy2 + 30996000*cx4*cy3 - 1058400*cx4*cy5 + 18572400*cx5*cy0 - 46015200*cx5*cy1 + 38782800*cx5*cy2 - 12398400*cx5*cy3 + 1058400*cx5*cy4 - 4712400*cx6*cy0 + 10080000*cx6*cy1 - 6728400*cx6*cy2 + 1360800*cx6*cy3 + 579600*cx7*cy0 - 957600*cx7*cy1 + 378000*cx7*cy2 - 25200*cx8*cy0 + 25200*cx8*cy1,
-    10296000*cx0*cy1 - 46332000*cx0*cy2 + 86486400*cx0*cy3 - 86486400*cx0*cy4 + 49896000*cx0*cy5 - 16632000*cx0*cy6 + 3024000*cx0*cy7 - 259200*cx0*cy8 + 7200*cx0*cy9 - 10296000*cx1*cy0 + 111196800*cx1*cy2 - 259459200*cx1*cy3 + 269438400*cx1*cy4 - 149688000*cx1*cy5 + 45360000*cx1*cy6 - 6998400*cx1*cy7 + 453600*cx1*cy8 - 7200*cx1*cy9 + 46332000*cx2*cy0 - 111196800*cx2*cy1 + 239500800*cx2*cy3 - 299376000*cx2*cy4 + 163296000*cx2*cy5 - 43545600*cx2*cy6 + 5184000*cx2*cy7 - 194400*cx2*cy8 - 86486400*cx3*cy0 + 259459200*cx3*cy1 - 239500800*cx3*cy2 + 127008000*cx3*cy4 - 76204800*cx3*cy5 + 16934400*cx3*cy6 - 1209600*cx3*cy7 + 86486400*cx4*cy0 - 269438400*cx4*cy1 + 299376000*cx4*cy2 - 127008000*cx4*cy3 + 12700800*cx4*cy5 - 2116800*cx4*cy6 - 49896000*cx5*cy0 + 149688000*cx5*cy1 - 163296000*cx5*cy2 + 76204800*cx5*cy3 - 12700800*cx5*cy4 + 16632000*cx6*cy0 - 45360000*cx6*cy1 + 43545600*cx6*cy2 - 16934400*cx6*cy3 + 2116800*cx6*cy4 - 3024000*cx7*cy0 + 6998400*cx7*cy1 - 5184000*cx7*cy2 + 1209600*cx7*cy3 + 259200*cx8*cy0 - 453600*cx8*cy1 + 194400*cx8*cy2 - 7200*cx9*cy0 + 7200*cx9*cy1,
-    -11583000*cx0*cy1 + 900*cx0*cy10 + 57915000*cx0*cy2 - 122007600*cx0*cy3 + 140540400*cx0*cy4 - 96049800*cx0*cy5 + 39501000*cx0*cy6 - 9450000*cx0*cy7 + 1198800*cx0*cy8 - 65700*cx0*cy9 + 11583000*cx1*cy0 - 900*cx1*cy10 - 155212200*cx1*cy2 + 413899200*cx1*cy3 - 503533800*cx1*cy4 + 339292800*cx1*cy5 - 131355000*cx1*cy6 + 28209600*cx1*cy7 - 3005100*cx1*cy8 + 122400*cx1*cy9 - 900*cx10*cy0 + 900*cx10*cy1 - 57915000*cx2*cy0 + 155212200*cx2*cy1 - 441579600*cx2*cy3 + 662369400*cx2*cy4 - 454167000*cx2*cy5 + 163976400*cx2*cy6 - 30294000*cx2*cy7 + 2454300*cx2*cy8 - 56700*cx2*cy9 + 122007600*cx3*cy0 - 413899200*cx3*cy1 + 441579600*cx3*cy2 - 347004000*cx3*cy4 + 277603200*cx3*cy5 - 93290400*cx3*cy6 + 13651200*cx3*cy7 - 648000*cx3*cy8 - 140540400*cx4*cy0 + 503533800*cx4*cy1 - 662369400*cx4*cy2 + 347004000*cx4*cy3 - 68266800*cx4*cy5 + 22755600*cx4*cy6 - 2116800*cx4*cy7 + 96049800*cx5*cy0 - 339292800*cx5*cy1 + 454167000*cx5*cy2 - 277603200*cx5*cy3 + 68266800*cx5*cy4 - 1587600*cx5*cy6 - 39501000*cx6*cy0 + 131355000*cx6*cy1 - 163976400*cx6*cy2 + 93290400*cx6*cy3 - 22755600*cx6*cy4 + 1587600*cx6*cy5 + 9450000*cx7*cy0 - 28209600*cx7*cy1 + 30294000*cx7*cy2 - 13651200*cx7*cy3 + 2116800*cx7*cy4 - 1198800*cx8*cy0 + 3005100*cx8*cy1 - 2454300*cx8*cy2 + 648000*cx8*cy3 + 65700*cx9*cy0 - 122400*cx9*cy1 + 56700*cx9*cy2,
-    10296000*cx0*cy1 - 7200*cx0*cy10 - 56628000*cx0*cy2 + 132818400*cx0*cy3 - 172972800*cx0*cy4 + 136382400*cx0*cy5 - 66528000*cx0*cy6 + 19656000*cx0*cy7 - 3283200*cx0*cy8 + 266400*cx0*cy9 - 10296000*cx1*cy0 + 14400*cx1*cy10 + 167824800*cx1*cy2 - 503474400*cx1*cy3 + 701870400*cx1*cy4 - 555508800*cx1*cy5 + 261576000*cx1*cy6 - 72014400*cx1*cy7 + 10735200*cx1*cy8 - 727200*cx1*cy9 + 7200*cx10*cy0 - 14400*cx10*cy1 + 7200*cx10*cy2 + 56628000*cx2*cy0 - 167824800*cx2*cy1 - 7200*cx2*cy10 + 610156800*cx2*cy3 - 1067774400*cx2*cy4 + 881798400*cx2*cy5 - 401889600*cx2*cy6 + 101088000*cx2*cy7 - 12830400*cx2*cy8 + 655200*cx2*cy9 - 132818400*cx3*cy0 + 503474400*cx3*cy1 - 610156800*cx3*cy2 + 665884800*cx3*cy4 - 665884800*cx3*cy5 + 299980800*cx3*cy6 - 66873600*cx3*cy7 + 6588000*cx3*cy8 - 194400*cx3*cy9 + 172972800*cx4*cy0 - 701870400*cx4*cy1 + 1067774400*cx4*cy2 - 665884800*cx4*cy3 + 215913600*cx4*cy5 - 107956800*cx4*cy6 + 20260800*cx4*cy7 - 1209600*cx4*cy8 - 136382400*cx5*cy0 + 555508800*cx5*cy1 - 881798400*cx5*cy2 + 665884800*cx5*cy3 - 215913600*cx5*cy4 + 14817600*cx5*cy6 - 2116800*cx5*cy7 + 66528000*cx6*cy0 - 261576000*cx6*cy1 + 401889600*cx6*cy2 - 299980800*cx6*cy3 + 107956800*cx6*cy4 - 14817600*cx6*cy5 - 19656000*cx7*cy0 + 72014400*cx7*cy1 - 101088000*cx7*cy2 + 66873600*cx7*cy3 - 20260800*cx7*cy4 + 2116800*cx7*cy5 + 3283200*cx8*cy0 - 10735200*cx8*cy1 + 12830400*cx8*cy2 - 6588000*cx8*cy3 + 1209600*cx8*cy4 - 266400*cx9*cy0 + 727200*cx9*cy1 - 655200*cx9*cy2 + 194400*cx9*cy3,
-    -7207200*cx0*cy1 + 25200*cx0*cy10 + 43243200*cx0*cy2 - 111711600*cx0*cy3 + 162162000*cx0*cy4 - 144698400*cx0*cy5 + 81496800*cx0*cy6 - 28576800*cx0*cy7 + 5896800*cx0*cy8 - 630000*cx0*cy9 + 7207200*cx1*cy0 - 75600*cx1*cy10 - 140540400*cx1*cy2 + 468468000*cx1*cy3 - 735966000*cx1*cy4 + 668606400*cx1*cy5 - 370440000*cx1*cy6 + 124286400*cx1*cy7 - 23814000*cx1*cy8 + 2268000*cx1*cy9 - 25200*cx10*cy0 + 75600*cx10*cy1 - 75600*cx10*cy2 + 25200*cx10*cy3 - 43243200*cx2*cy0 + 140540400*cx2*cy1 + 75600*cx2*cy10 - 636174000*cx2*cy3 + 1272348000*cx2*cy4 - 1228802400*cx2*cy5 + 676317600*cx2*cy6 - 215460000*cx2*cy7 + 37422000*cx2*cy8 - 3024000*cx2*cy9 + 111711600*cx3*cy0 - 468468000*cx3*cy1 - 25200*cx3*cy10 + 636174000*cx3*cy2 - 920808000*cx3*cy4 + 1104969600*cx3*cy5 - 624456000*cx3*cy6 + 187488000*cx3*cy7 - 28350000*cx3*cy8 + 1764000*cx3*cy9 - 162162000*cx4*cy0 + 735966000*cx4*cy1 - 1272348000*cx4*cy2 + 920808000*cx4*cy3 - 444528000*cx4*cy5 + 296352000*cx4*cy6 - 83916000*cx4*cy7 + 10206000*cx4*cy8 - 378000*cx4*cy9 + 144698400*cx5*cy0 - 668606400*cx5*cy1 + 1228802400*cx5*cy2 - 1104969600*cx5*cy3 + 444528000*cx5*cy4 - 60328800*cx5*cy6 + 17236800*cx5*cy7 - 1360800*cx5*cy8 - 81496800*cx6*cy0 + 370440000*cx6*cy1 - 676317600*cx6*cy2 + 624456000*cx6*cy3 - 296352000*cx6*cy4 + 60328800*cx6*cy5 - 1058400*cx6*cy7 + 28576800*cx7*cy0 - 124286400*cx7*cy1 + 215460000*cx7*cy2 - 187488000*cx7*cy3 + 83916000*cx7*cy4 - 17236800*cx7*cy5 + 1058400*cx7*cy6 - 5896800*cx8*cy0 + 23814000*cx8*cy1 - 37422000*cx8*cy2 + 28350000*cx8*cy3 - 10206000*cx8*cy4 + 1360800*cx8*cy5 + 630000*cx9*cy0 - 2268000*cx9*cy1 + 3024000*cx9*cy2 - 1764000*cx9*cy3 + 378000*cx9*cy4,
-    3931200*cx0*cy1 - 50400*cx0*cy10 - 25552800*cx0*cy2 + 72072000*cx0*cy3 - 115315200*cx0*cy4 + 114760800*cx0*cy5 - 73180800*cx0*cy6 + 29635200*cx0*cy7 - 7257600*cx0*cy8 + 957600*cx0*cy9 - 3931200*cx1*cy0 + 201600*cx1*cy10 + 90417600*cx1*cy2 - 331531200*cx1*cy3 + 579348000*cx1*cy4 - 593762400*cx1*cy5 + 378000000*cx1*cy6 - 149385600*cx1*cy7 + 34927200*cx1*cy8 - 4284000*cx1*cy9 + 50400*cx10*cy0 - 201600*cx10*cy1 + 302400*cx10*cy2 - 201600*cx10*cy3 + 50400*cx10*cy4 + 25552800*cx2*cy0 - 90417600*cx2*cy1 - 302400*cx2*cy10 + 498960000*cx2*cy3 - 1122660000*cx2*cy4 + 1241049600*cx2*cy5 - 800150400*cx2*cy6 + 308448000*cx2*cy7 - 68040000*cx2*cy8 + 7560000*cx2*cy9 - 72072000*cx3*cy0 + 331531200*cx3*cy1 + 201600*cx3*cy10 - 498960000*cx3*cy2 + 925344000*cx3*cy4 - 1295481600*cx3*cy5 + 880588800*cx3*cy6 - 332640000*cx3*cy7 + 68040000*cx3*cy8 - 6552000*cx3*cy9 + 115315200*cx4*cy0 - 579348000*cx4*cy1 - 50400*cx4*cy10 + 1122660000*cx4*cy2 - 925344000*cx4*cy3 + 622339200*cx4*cy5 - 518616000*cx4*cy6 + 196560000*cx4*cy7 - 36288000*cx4*cy8 + 2772000*cx4*cy9 - 114760800*cx5*cy0 + 593762400*cx5*cy1 - 1241049600*cx5*cy2 + 1295481600*cx5*cy3 - 622339200*cx5*cy4 + 139708800*cx5*cy6 - 59875200*cx5*cy7 + 9525600*cx5*cy8 - 453600*cx5*cy9 + 73180800*cx6*cy0 - 378000000*cx6*cy1 + 800150400*cx6*cy2 - 880588800*cx6*cy3 + 518616000*cx6*cy4 - 139708800*cx6*cy5 + 7257600*cx6*cy7 - 907200*cx6*cy8 - 29635200*cx7*cy0 + 149385600*cx7*cy1 - 308448000*cx7*cy2 + 332640000*cx7*cy3 - 196560000*cx7*cy4 + 59875200*cx7*cy5 - 7257600*cx7*cy6 + 7257600*cx8*cy0 - 34927200*cx8*cy1 + 68040000*cx8*cy2 - 68040000*cx8*cy3 + 36288000*cx8*cy4 - 9525600*cx8*cy5 + 907200*cx8*cy6 - 957600*cx9*cy0 + 4284000*cx9*cy1 - 7560000*cx9*cy2 + 6552000*cx9*cy3 - 2772000*cx9*cy4 + 453600*cx9*cy5,
-    -1638000*cx0*cy1 + 63000*cx0*cy10 + 11466000*cx0*cy2 - 35053200*cx0*cy3 + 61261200*cx0*cy4 - 67221000*cx0*cy5 + 47817000*cx0*cy6 - 21924000*cx0*cy7 + 6199200*cx0*cy8 - 970200*cx0*cy9 + 1638000*cx1*cy0 - 315000*cx1*cy10 - 43898400*cx1*cy2 + 175593600*cx1*cy3 - 337768200*cx1*cy4 + 385308000*cx1*cy5 - 276885000*cx1*cy6 + 125798400*cx1*cy7 - 34662600*cx1*cy8 + 5191200*cx1*cy9 - 63000*cx10*cy0 + 315000*cx10*cy1 - 630000*cx10*cy2 + 630000*cx10*cy3 - 315000*cx10*cy4 + 63000*cx10*cy5 - 11466000*cx2*cy0 + 43898400*cx2*cy1 + 630000*cx2*cy10 - 290228400*cx2*cy3 + 725571000*cx2*cy4 - 903231000*cx2*cy5 + 667245600*cx2*cy6 - 301644000*cx2*cy7 + 80627400*cx2*cy8 - 11403000*cx2*cy9 + 35053200*cx3*cy0 - 175593600*cx3*cy1 - 630000*cx3*cy10 + 290228400*cx3*cy2 - 671328000*cx3*cy4 + 1074124800*cx3*cy5 - 853070400*cx3*cy6 + 388281600*cx3*cy7 - 100170000*cx3*cy8 + 13104000*cx3*cy9 - 61261200*cx4*cy0 + 337768200*cx4*cy1 + 315000*cx4*cy10 - 725571000*cx4*cy2 + 671328000*cx4*cy3 - 600112800*cx4*cy5 + 600112800*cx4*cy6 - 285012000*cx4*cy7 + 70686000*cx4*cy8 - 8253000*cx4*cy9 + 67221000*cx5*cy0 - 385308000*cx5*cy1 - 63000*cx5*cy10 + 903231000*cx5*cy2 - 1074124800*cx5*cy3 + 600112800*cx5*cy4 - 201096000*cx5*cy6 + 114912000*cx5*cy7 - 27556200*cx5*cy8 + 2671200*cx5*cy9 - 47817000*cx6*cy0 + 276885000*cx6*cy1 - 667245600*cx6*cy2 + 853070400*cx6*cy3 - 600112800*cx6*cy4 + 201096000*cx6*cy5 - 20714400*cx6*cy7 + 5178600*cx6*cy8 - 340200*cx6*cy9 + 21924000*cx7*cy0 - 125798400*cx7*cy1 + 301644000*cx7*cy2 - 388281600*cx7*cy3 + 285012000*cx7*cy4 - 114912000*cx7*cy5 + 20714400*cx7*cy6 - 302400*cx7*cy8 - 6199200*cx8*cy0 + 34662600*cx8*cy1 - 80627400*cx8*cy2 + 100170000*cx8*cy3 - 70686000*cx8*cy4 + 27556200*cx8*cy5 - 5178600*cx8*cy6 + 302400*cx8*cy7 + 970200*cx9*cy0 - 5191200*cx9*cy1 + 11403000*cx9*cy2 - 13104000*cx9*cy3 + 8253000*cx9*cy4 - 2671200*cx9*cy5 + 340200*cx9*cy6,
-    504000*cx0*cy1 - 50400*cx0*cy10 - 3780000*cx0*cy2 + 12448800*cx0*cy3 - 23587200*cx0*cy4 + 28274400*cx0*cy5 - 22176000*cx0*cy6 + 11340000*cx0*cy7 - 3628800*cx0*cy8 + 655200*cx0*cy9 - 504000*cx1*cy0 + 302400*cx1*cy10 + 15573600*cx1*cy2 - 67485600*cx1*cy3 + 141674400*cx1*cy4 - 177962400*cx1*cy5 + 142380000*cx1*cy6 - 73029600*cx1*cy7 + 23133600*cx1*cy8 - 4082400*cx1*cy9 + 50400*cx10*cy0 - 302400*cx10*cy1 + 756000*cx10*cy2 - 1008000*cx10*cy3 + 756000*cx10*cy4 - 302400*cx10*cy5 + 50400*cx10*cy6 + 3780000*cx2*cy0 - 15573600*cx2*cy1 - 756000*cx2*cy10 + 121564800*cx2*cy3 - 334303200*cx2*cy4 + 462672000*cx2*cy5 - 385106400*cx2*cy6 + 199584000*cx2*cy7 - 62596800*cx2*cy8 + 10735200*cx2*cy9 - 12448800*cx3*cy0 + 67485600*cx3*cy1 + 1008000*cx3*cy10 - 121564800*cx3*cy2 + 343224000*cx3*cy4 - 617803200*cx3*cy5 + 561254400*cx3*cy6 - 298771200*cx3*cy7 + 92988000*cx3*cy8 - 15372000*cx3*cy9 + 23587200*cx4*cy0 - 141674400*cx4*cy1 - 756000*cx4*cy10 + 334303200*cx4*cy2 - 343224000*cx4*cy3 + 393724800*cx4*cy5 - 459345600*cx4*cy6 + 262180800*cx4*cy7 - 81648000*cx4*cy8 + 12852000*cx4*cy9 - 28274400*cx5*cy0 + 177962400*cx5*cy1 + 302400*cx5*cy10 - 462672000*cx5*cy2 + 617803200*cx5*cy3 - 393724800*cx5*cy4 + 184161600*cx5*cy6 - 131544000*cx5*cy7 + 42184800*cx5*cy8 - 6199200*cx5*cy9 + 22176000*cx6*cy0 - 142380000*cx6*cy1 - 50400*cx6*cy10 + 385106400*cx6*cy2 - 561254400*cx6*cy3 + 459345600*cx6*cy4 - 184161600*cx6*cy5 + 31449600*cx6*cy7 - 11793600*cx6*cy8 + 1562400*cx6*cy9 - 11340000*cx7*cy0 + 73029600*cx7*cy1 - 199584000*cx7*cy2 + 298771200*cx7*cy3 - 262180800*cx7*cy4 + 131544000*cx7*cy5 - 31449600*cx7*cy6 + 1360800*cx7*cy8 - 151200*cx7*cy9 + 3628800*cx8*cy0 - 23133600*cx8*cy1 + 62596800*cx8*cy2 - 92988000*cx8*cy3 + 81648000*cx8*cy4 - 42184800*cx8*cy5 + 11793600*cx8*cy6 - 1360800*cx8*cy7 - 655200*cx9*cy0 + 4082400*cx9*cy1 - 10735200*cx9*cy2 + 15372000*cx9*cy3 - 12852000*cx9*cy4 + 6199200*cx9*cy5 - 1562400*cx9*cy6 + 151200*cx9*cy7,
-    -108000*cx0*cy1 + 25200*cx0*cy10 + 864000*cx0*cy2 - 3049200*cx0*cy3 + 6224400*cx0*cy4 - 8089200*cx0*cy5 + 6930000*cx0*cy6 - 3906000*cx0*cy7 + 1393200*cx0*cy8 - 284400*cx0*cy9 + 108000*cx1*cy0 - 176400*cx1*cy10 - 3812400*cx1*cy2 + 17791200*cx1*cy3 - 40471200*cx1*cy4 + 55490400*cx1*cy5 - 48888000*cx1*cy6 + 27914400*cx1*cy7 - 9979200*cx1*cy8 + 2023200*cx1*cy9 - 25200*cx10*cy0 + 176400*cx10*cy1 - 529200*cx10*cy2 + 882000*cx10*cy3 - 882000*cx10*cy4 + 529200*cx10*cy5 - 176400*cx10*cy6 + 25200*cx10*cy7 - 864000*cx2*cy0 + 3812400*cx2*cy1 + 529200*cx2*cy10 - 34700400*cx2*cy3 + 104101200*cx2*cy4 - 158533200*cx2*cy5 + 146739600*cx2*cy6 - 85698000*cx2*cy7 + 30812400*cx2*cy8 - 6199200*cx2*cy9 + 3049200*cx3*cy0 - 17791200*cx3*cy1 - 882000*cx3*cy10 + 34700400*cx3*cy2 - 117482400*cx3*cy4 + 234964800*cx3*cy5 - 240256800*cx3*cy6 + 146361600*cx3*cy7 - 53298000*cx3*cy8 + 10634400*cx3*cy9 - 6224400*cx4*cy0 + 40471200*cx4*cy1 + 882000*cx4*cy10 - 104101200*cx4*cy2 + 117482400*cx4*cy3 - 168285600*cx4*cy5 + 224380800*cx4*cy6 - 149536800*cx4*cy7 + 56019600*cx4*cy8 - 11088000*cx4*cy9 + 8089200*cx5*cy0 - 55490400*cx5*cy1 - 529200*cx5*cy10 + 158533200*cx5*cy2 - 234964800*cx5*cy3 + 168285600*cx5*cy4 - 104781600*cx5*cy6 + 89812800*cx5*cy7 - 36061200*cx5*cy8 + 7106400*cx5*cy9 - 6930000*cx6*cy0 + 48888000*cx6*cy1 + 176400*cx6*cy10 - 146739600*cx6*cy2 + 240256800*cx6*cy3 - 224380800*cx6*cy4 + 104781600*cx6*cy5 - 26762400*cx6*cy7 + 13381200*cx6*cy8 - 2671200*cx6*cy9 + 3906000*cx7*cy0 - 27914400*cx7*cy1 - 25200*cx7*cy10 + 85698000*cx7*cy2 - 146361600*cx7*cy3 + 149536800*cx7*cy4 - 89812800*cx7*cy5 + 26762400*cx7*cy6 - 2300400*cx7*cy8 + 511200*cx7*cy9 - 1393200*cx8*cy0 + 9979200*cx8*cy1 - 30812400*cx8*cy2 + 53298000*cx8*cy3 - 56019600*cx8*cy4 + 36061200*cx8*cy5 - 13381200*cx8*cy6 + 2300400*cx8*cy7 - 32400*cx8*cy9 + 284400*cx9*cy0 - 2023200*cx9*cy1 + 6199200*cx9*cy2 - 10634400*cx9*cy3 + 11088000*cx9*cy4 - 7106400*cx9*cy5 + 2671200*cx9*cy6 - 511200*cx9*cy7 + 32400*cx9*cy8,
-    14400*cx0*cy1 - 7200*cx0*cy10 - 122400*cx0*cy2 + 460800*cx0*cy3 - 1008000*cx0*cy4 + 1411200*cx0*cy5 - 1310400*cx0*cy6 + 806400*cx0*cy7 - 316800*cx0*cy8 + 72000*cx0*cy9 - 14400*cx1*cy0 + 57600*cx1*cy10 + 576000*cx1*cy2 - 2880000*cx1*cy3 + 7056000*cx1*cy4 - 10483200*cx1*cy5 + 10080000*cx1*cy6 - 6336000*cx1*cy7 + 2520000*cx1*cy8 - 576000*cx1*cy9 + 7200*cx10*cy0 - 57600*cx10*cy1 + 201600*cx10*cy2 - 403200*cx10*cy3 + 504000*cx10*cy4 - 403200*cx10*cy5 + 201600*cx10*cy6 - 57600*cx10*cy7 + 7200*cx10*cy8 + 122400*cx2*cy0 - 576000*cx2*cy1 - 201600*cx2*cy10 + 6048000*cx2*cy3 - 19656000*cx2*cy4 + 32659200*cx2*cy5 - 33264000*cx2*cy6 + 21600000*cx2*cy7 - 8748000*cx2*cy8 + 2016000*cx2*cy9 - 460800*cx3*cy0 + 2880000*cx3*cy1 + 403200*cx3*cy10 - 6048000*cx3*cy2 + 24192000*cx3*cy4 - 53222400*cx3*cy5 + 60480000*cx3*cy6 - 41472000*cx3*cy7 + 17280000*cx3*cy8 - 4032000*cx3*cy9 + 1008000*cx4*cy0 - 7056000*cx4*cy1 - 504000*cx4*cy10 + 19656000*cx4*cy2 - 24192000*cx4*cy3 + 42336000*cx4*cy5 - 63504000*cx4*cy6 + 48384000*cx4*cy7 - 21168000*cx4*cy8 + 5040000*cx4*cy9 - 1411200*cx5*cy0 + 10483200*cx5*cy1 + 403200*cx5*cy10 - 32659200*cx5*cy2 + 53222400*cx5*cy3 - 42336000*cx5*cy4 + 33868800*cx5*cy6 - 33868800*cx5*cy7 + 16329600*cx5*cy8 - 4032000*cx5*cy9 + 1310400*cx6*cy0 - 10080000*cx6*cy1 - 201600*cx6*cy10 + 33264000*cx6*cy2 - 60480000*cx6*cy3 + 63504000*cx6*cy4 - 33868800*cx6*cy5 + 12096000*cx6*cy7 - 7560000*cx6*cy8 + 2016000*cx6*cy9 - 806400*cx7*cy0 + 6336000*cx7*cy1 + 57600*cx7*cy10 - 21600000*cx7*cy2 + 41472000*cx7*cy3 - 48384000*cx7*cy4 + 33868800*cx7*cy5 - 12096000*cx7*cy6 + 1728000*cx7*cy8 - 576000*cx7*cy9 + 316800*cx8*cy0 - 2520000*cx8*cy1 - 7200*cx8*cy10 + 8748000*cx8*cy2 - 17280000*cx8*cy3 + 21168000*cx8*cy4 - 16329600*cx8*cy5 + 7560000*cx8*cy6 - 1728000*cx8*cy7 + 72000*cx8*cy9 - 72000*cx9*cy0 + 576000*cx9*cy1 - 2016000*cx9*cy2 + 4032000*cx9*cy3 - 5040000*cx9*cy4 + 4032000*cx9*cy5 - 2016000*cx9*cy6 + 576000*cx9*cy7 - 72000*cx9*cy8,
-    -900*cx0*cy1 + 900*cx0*cy10 + 8100*cx0*cy2 - 32400*cx0*cy3 + 75600*cx0*cy4 - 113400*cx0*cy5 + 113400*cx0*cy6 - 75600*cx0*cy7 + 32400*cx0*cy8 - 8100*cx0*cy9 + 900*cx1*cy0 - 8100*cx1*cy10 - 40500*cx1*cy2 + 216000*cx1*cy3 - 567000*cx1*cy4 + 907200*cx1*cy5 - 945000*cx1*cy6 + 648000*cx1*cy7 - 283500*cx1*cy8 + 72000*cx1*cy9 - 900*cx10*cy0 + 8100*cx10*cy1 - 32400*cx10*cy2 + 75600*cx10*cy3 - 113400*cx10*cy4 + 113400*cx10*cy5 - 75600*cx10*cy6 + 32400*cx10*cy7 - 8100*cx10*cy8 + 900*cx10*cy9 - 8100*cx2*cy0 + 40500*cx2*cy1 + 32400*cx2*cy10 - 486000*cx2*cy3 + 1701000*cx2*cy4 - 3061800*cx2*cy5 + 3402000*cx2*cy6 - 2430000*cx2*cy7 + 1093500*cx2*cy8 - 283500*cx2*cy9 + 32400*cx3*cy0 - 216000*cx3*cy1 - 75600*cx3*cy10 + 486000*cx3*cy2 - 2268000*cx3*cy4 + 5443200*cx3*cy5 - 6804000*cx3*cy6 + 5184000*cx3*cy7 - 2430000*cx3*cy8 + 648000*cx3*cy9 - 75600*cx4*cy0 + 567000*cx4*cy1 + 113400*cx4*cy10 - 1701000*cx4*cy2 + 2268000*cx4*cy3 - 4762800*cx4*cy5 + 7938000*cx4*cy6 - 6804000*cx4*cy7 + 3402000*cx4*cy8 - 945000*cx4*cy9 + 113400*cx5*cy0 - 907200*cx5*cy1 - 113400*cx5*cy10 + 3061800*cx5*cy2 - 5443200*cx5*cy3 + 4762800*cx5*cy4 - 4762800*cx5*cy6 + 5443200*cx5*cy7 - 3061800*cx5*cy8 + 907200*cx5*cy9 - 113400*cx6*cy0 + 945000*cx6*cy1 + 75600*cx6*cy10 - 3402000*cx6*cy2 + 6804000*cx6*cy3 - 7938000*cx6*cy4 + 4762800*cx6*cy5 - 2268000*cx6*cy7 + 1701000*cx6*cy8 - 567000*cx6*cy9 + 75600*cx7*cy0 - 648000*cx7*cy1 - 32400*cx7*cy10 + 2430000*cx7*cy2 - 5184000*cx7*cy3 + 6804000*cx7*cy4 - 5443200*cx7*cy5 + 2268000*cx7*cy6 - 486000*cx7*cy8 + 216000*cx7*cy9 - 32400*cx8*cy0 + 283500*cx8*cy1 + 8100*cx8*cy10 - 1093500*cx8*cy2 + 2430000*cx8*cy3 - 3402000*cx8*cy4 + 3061800*cx8*cy5 - 1701000*cx8*cy6 + 486000*cx8*cy7 - 40500*cx8*cy9 + 8100*cx9*cy0 - 72000*cx9*cy1 - 900*cx9*cy10 + 283500*cx9*cy2 - 648000*cx9*cy3 + 945000*cx9*cy4 - 907200*cx9*cy5 + 567000*cx9*cy6 - 216000*cx9*cy7 + 40500*cx9*cy8
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Derived>
-std::vector<typename Derived::Scalar> compute_Bezier_inflections(
-        const Eigen::PlainObjectBase<Derived>& ctrl_pts,
-        typename Derived::Scalar t0 = 0,
-        typename Derived::Scalar t1 = 1) {
-    switch(ctrl_pts.rows()-1) {
-        case 2:
-            return compute_Bezier_degree_2_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), t0, t1);
-        case 3:
-            return compute_Bezier_degree_3_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), t0, t1);
-        case 4:
-            return compute_Bezier_degree_4_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), ctrl_pts(4,0), ctrl_pts(4,1), t0, t1);
-        #ifdef HIGH_DEGREE_SUPPORT
-        case 5:
-            return compute_Bezier_degree_5_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), ctrl_pts(4,0), ctrl_pts(4,1), ctrl_pts(5,0), ctrl_pts(5,1), t0, t1);
-        #endif // HIGH_DEGREE_SUPPORT
-        #ifdef HIGH_DEGREE_SUPPORT
-        case 6:
-            return compute_Bezier_degree_6_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), ctrl_pts(4,0), ctrl_pts(4,1), ctrl_pts(5,0), ctrl_pts(5,1), ctrl_pts(6,0), ctrl_pts(6,1), t0, t1);
-        #endif // HIGH_DEGREE_SUPPORT
-        #ifdef HIGH_DEGREE_SUPPORT
-        case 7:
-            return compute_Bezier_degree_7_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), ctrl_pts(4,0), ctrl_pts(4,1), ctrl_pts(5,0), ctrl_pts(5,1), ctrl_pts(6,0), ctrl_pts(6,1), ctrl_pts(7,0), ctrl_pts(7,1), t0, t1);
-        #endif // HIGH_DEGREE_SUPPORT
-        #ifdef HIGH_DEGREE_SUPPORT
-        case 8:
-            return compute_Bezier_degree_8_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), ctrl_pts(4,0), ctrl_pts(4,1), ctrl_pts(5,0), ctrl_pts(5,1), ctrl_pts(6,0), ctrl_pts(6,1), ctrl_pts(7,0), ctrl_pts(7,1), ctrl_pts(8,0), ctrl_pts(8,1), t0, t1);
-        #endif // HIGH_DEGREE_SUPPORT
-        #ifdef HIGH_DEGREE_SUPPORT
-        case 9:
-            return compute_Bezier_degree_9_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), ctrl_pts(4,0), ctrl_pts(4,1), ctrl_pts(5,0), ctrl_pts(5,1), ctrl_pts(6,0), ctrl_pts(6,1), ctrl_pts(7,0), ctrl_pts(7,1), ctrl_pts(8,0), ctrl_pts(8,1), ctrl_pts(9,0), ctrl_pts(9,1), t0, t1);
-        #endif // HIGH_DEGREE_SUPPORT
-        #ifdef HIGH_DEGREE_SUPPORT
-        case 10:
-            return compute_Bezier_degree_10_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), ctrl_pts(4,0), ctrl_pts(4,1), ctrl_pts(5,0), ctrl_pts(5,1), ctrl_pts(6,0), ctrl_pts(6,1), ctrl_pts(7,0), ctrl_pts(7,1), ctrl_pts(8,0), ctrl_pts(8,1), ctrl_pts(9,0), ctrl_pts(9,1), ctrl_pts(10,0), ctrl_pts(10,1), t0, t1);
-        #endif // HIGH_DEGREE_SUPPORT
-        default:
-            throw not_implemented_error(
-                "Inflection computation only works on Bezier curve with degree lower than 10");
-    }
-}
-
-
-
-} // End internal namespace
-} // End nanospline namespace
-
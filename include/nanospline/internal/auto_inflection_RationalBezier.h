@@ -1,121 +0,0 @@
-/**
- * This code is automatically generated by scripts/inflection.py
- */
-
-#pragma once
-#include <cassert>
-#include <vector>
-
-#include <nanospline/Exceptions.h>
-#include <nanospline/PolynomialRootFinder.h>
-#include <nanospline/BezierBase.h>
-
-namespace nanospline {
-namespace internal {
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_RationalBezier_degree_2_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2,
-        Scalar w0, Scalar w1, Scalar w2,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 4>::find_real_roots_in_interval({
-        -4*cx0*cy1*pow(w0, 3)*w1*w2 + 4*cx0*cy2*pow(w0, 3)*w1*w2 + 4*cx1*cy0*pow(w0, 3)*w1*w2 - 4*cx1*cy2*pow(w0, 3)*w1*w2 - 4*cx2*cy0*pow(w0, 3)*w1*w2 + 4*cx2*cy1*pow(w0, 3)*w1*w2,
-    16*cx0*cy1*pow(w0, 3)*w1*w2 - 16*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 16*cx0*cy2*pow(w0, 3)*w1*w2 + 16*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 16*cx1*cy0*pow(w0, 3)*w1*w2 + 16*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 16*cx1*cy2*pow(w0, 3)*w1*w2 - 16*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 16*cx2*cy0*pow(w0, 3)*w1*w2 - 16*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 16*cx2*cy1*pow(w0, 3)*w1*w2 + 16*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2,
-    -24*cx0*cy1*pow(w0, 3)*w1*w2 + 48*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 8*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 16*cx0*cy1*w0*pow(w1, 3)*w2 + 24*cx0*cy2*pow(w0, 3)*w1*w2 - 48*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 8*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 16*cx0*cy2*w0*pow(w1, 3)*w2 + 24*cx1*cy0*pow(w0, 3)*w1*w2 - 48*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 8*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 16*cx1*cy0*w0*pow(w1, 3)*w2 - 24*cx1*cy2*pow(w0, 3)*w1*w2 + 48*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 8*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 16*cx1*cy2*w0*pow(w1, 3)*w2 - 24*cx2*cy0*pow(w0, 3)*w1*w2 + 48*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 8*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 16*cx2*cy0*w0*pow(w1, 3)*w2 + 24*cx2*cy1*pow(w0, 3)*w1*w2 - 48*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 8*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 16*cx2*cy1*w0*pow(w1, 3)*w2,
-    16*cx0*cy1*pow(w0, 3)*w1*w2 - 48*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 16*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 32*cx0*cy1*w0*pow(w1, 3)*w2 - 16*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 16*cx0*cy2*pow(w0, 3)*w1*w2 + 48*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 16*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 32*cx0*cy2*w0*pow(w1, 3)*w2 + 16*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 16*cx1*cy0*pow(w0, 3)*w1*w2 + 48*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 16*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 32*cx1*cy0*w0*pow(w1, 3)*w2 + 16*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 16*cx1*cy2*pow(w0, 3)*w1*w2 - 48*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 16*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 32*cx1*cy2*w0*pow(w1, 3)*w2 - 16*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) + 16*cx2*cy0*pow(w0, 3)*w1*w2 - 48*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 16*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 32*cx2*cy0*w0*pow(w1, 3)*w2 - 16*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 16*cx2*cy1*pow(w0, 3)*w1*w2 + 48*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 16*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 32*cx2*cy1*w0*pow(w1, 3)*w2 + 16*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2),
-    -4*cx0*cy1*pow(w0, 3)*w1*w2 + 16*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 8*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 16*cx0*cy1*w0*pow(w1, 3)*w2 + 16*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 4*cx0*cy1*w0*w1*pow(w2, 3) + 4*cx0*cy2*pow(w0, 3)*w1*w2 - 16*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 8*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 16*cx0*cy2*w0*pow(w1, 3)*w2 - 16*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 4*cx0*cy2*w0*w1*pow(w2, 3) + 4*cx1*cy0*pow(w0, 3)*w1*w2 - 16*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 8*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 16*cx1*cy0*w0*pow(w1, 3)*w2 - 16*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 4*cx1*cy0*w0*w1*pow(w2, 3) - 4*cx1*cy2*pow(w0, 3)*w1*w2 + 16*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 8*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 16*cx1*cy2*w0*pow(w1, 3)*w2 + 16*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 4*cx1*cy2*w0*w1*pow(w2, 3) - 4*cx2*cy0*pow(w0, 3)*w1*w2 + 16*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 8*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 16*cx2*cy0*w0*pow(w1, 3)*w2 + 16*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 4*cx2*cy0*w0*w1*pow(w2, 3) + 4*cx2*cy1*pow(w0, 3)*w1*w2 - 16*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 8*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 16*cx2*cy1*w0*pow(w1, 3)*w2 - 16*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 4*cx2*cy1*w0*w1*pow(w2, 3)
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_RationalBezier_degree_3_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3,
-        Scalar w0, Scalar w1, Scalar w2, Scalar w3,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 9>::find_real_roots_in_interval({
-        -18*cx0*cy1*pow(w0, 3)*w1*w2 + 18*cx0*cy2*pow(w0, 3)*w1*w2 + 18*cx1*cy0*pow(w0, 3)*w1*w2 - 18*cx1*cy2*pow(w0, 3)*w1*w2 - 18*cx2*cy0*pow(w0, 3)*w1*w2 + 18*cx2*cy1*pow(w0, 3)*w1*w2,
-    162*cx0*cy1*pow(w0, 3)*w1*w2 - 18*cx0*cy1*pow(w0, 3)*w1*w3 - 108*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 162*cx0*cy2*pow(w0, 3)*w1*w2 + 108*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 18*cx0*cy3*pow(w0, 3)*w1*w3 - 162*cx1*cy0*pow(w0, 3)*w1*w2 + 18*cx1*cy0*pow(w0, 3)*w1*w3 + 108*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 162*cx1*cy2*pow(w0, 3)*w1*w2 - 108*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 18*cx1*cy3*pow(w0, 3)*w1*w3 + 162*cx2*cy0*pow(w0, 3)*w1*w2 - 108*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 162*cx2*cy1*pow(w0, 3)*w1*w2 + 108*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 18*cx3*cy0*pow(w0, 3)*w1*w3 + 18*cx3*cy1*pow(w0, 3)*w1*w3,
-    -648*cx0*cy1*pow(w0, 3)*w1*w2 + 144*cx0*cy1*pow(w0, 3)*w1*w3 + 864*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 108*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 108*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 162*cx0*cy1*w0*pow(w1, 3)*w2 + 648*cx0*cy2*pow(w0, 3)*w1*w2 - 18*cx0*cy2*pow(w0, 3)*w2*w3 - 864*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 108*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 162*cx0*cy2*w0*pow(w1, 3)*w2 - 144*cx0*cy3*pow(w0, 3)*w1*w3 + 18*cx0*cy3*pow(w0, 3)*w2*w3 + 108*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 648*cx1*cy0*pow(w0, 3)*w1*w2 - 144*cx1*cy0*pow(w0, 3)*w1*w3 - 864*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 108*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 108*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 162*cx1*cy0*w0*pow(w1, 3)*w2 - 648*cx1*cy2*pow(w0, 3)*w1*w2 + 864*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 108*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 162*cx1*cy2*w0*pow(w1, 3)*w2 + 144*cx1*cy3*pow(w0, 3)*w1*w3 - 108*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 648*cx2*cy0*pow(w0, 3)*w1*w2 + 18*cx2*cy0*pow(w0, 3)*w2*w3 + 864*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 108*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 162*cx2*cy0*w0*pow(w1, 3)*w2 + 648*cx2*cy1*pow(w0, 3)*w1*w2 - 864*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 108*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 162*cx2*cy1*w0*pow(w1, 3)*w2 - 18*cx2*cy3*pow(w0, 3)*w2*w3 + 144*cx3*cy0*pow(w0, 3)*w1*w3 - 18*cx3*cy0*pow(w0, 3)*w2*w3 - 108*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 144*cx3*cy1*pow(w0, 3)*w1*w3 + 108*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 18*cx3*cy2*pow(w0, 3)*w2*w3,
-    1512*cx0*cy1*pow(w0, 3)*w1*w2 - 504*cx0*cy1*pow(w0, 3)*w1*w3 - 3024*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 756*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 756*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 144*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 1134*cx0*cy1*w0*pow(w1, 3)*w2 - 162*cx0*cy1*w0*pow(w1, 3)*w3 - 324*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 1512*cx0*cy2*pow(w0, 3)*w1*w2 + 126*cx0*cy2*pow(w0, 3)*w2*w3 + 3024*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 756*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 72*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 1134*cx0*cy2*w0*pow(w1, 3)*w2 + 324*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 504*cx0*cy3*pow(w0, 3)*w1*w3 - 126*cx0*cy3*pow(w0, 3)*w2*w3 - 756*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 216*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 162*cx0*cy3*w0*pow(w1, 3)*w3 - 1512*cx1*cy0*pow(w0, 3)*w1*w2 + 504*cx1*cy0*pow(w0, 3)*w1*w3 + 3024*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 756*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 756*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 144*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 1134*cx1*cy0*w0*pow(w1, 3)*w2 + 162*cx1*cy0*w0*pow(w1, 3)*w3 + 324*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 1512*cx1*cy2*pow(w0, 3)*w1*w2 - 3024*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 756*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 54*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 1134*cx1*cy2*w0*pow(w1, 3)*w2 - 324*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 504*cx1*cy3*pow(w0, 3)*w1*w3 + 756*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 90*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 162*cx1*cy3*w0*pow(w1, 3)*w3 + 1512*cx2*cy0*pow(w0, 3)*w1*w2 - 126*cx2*cy0*pow(w0, 3)*w2*w3 - 3024*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 756*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 72*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 1134*cx2*cy0*w0*pow(w1, 3)*w2 - 324*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 1512*cx2*cy1*pow(w0, 3)*w1*w2 + 3024*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 756*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 54*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 1134*cx2*cy1*w0*pow(w1, 3)*w2 + 324*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 126*cx2*cy3*pow(w0, 3)*w2*w3 - 126*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 504*cx3*cy0*pow(w0, 3)*w1*w3 + 126*cx3*cy0*pow(w0, 3)*w2*w3 + 756*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 216*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 162*cx3*cy0*w0*pow(w1, 3)*w3 + 504*cx3*cy1*pow(w0, 3)*w1*w3 - 756*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 90*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 162*cx3*cy1*w0*pow(w1, 3)*w3 - 126*cx3*cy2*pow(w0, 3)*w2*w3 + 126*cx3*cy2*pow(w0, 2)*w1*w2*w3,
-    -2268*cx0*cy1*pow(w0, 3)*w1*w2 + 1008*cx0*cy1*pow(w0, 3)*w1*w3 + 6048*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 2268*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 2268*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 864*cx0*cy1*pow(w0, 2)*w1*w2*w3 - 36*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) - 3402*cx0*cy1*w0*pow(w1, 3)*w2 + 972*cx0*cy1*w0*pow(w1, 3)*w3 + 1944*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 432*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 162*cx0*cy1*w0*w1*pow(w2, 3) + 2268*cx0*cy2*pow(w0, 3)*w1*w2 - 378*cx0*cy2*pow(w0, 3)*w2*w3 - 6048*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 2268*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 432*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 108*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 3402*cx0*cy2*w0*pow(w1, 3)*w2 - 1944*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 54*cx0*cy2*w0*pow(w1, 2)*w2*w3 + 162*cx0*cy2*w0*w1*pow(w2, 3) - 1008*cx0*cy3*pow(w0, 3)*w1*w3 + 378*cx0*cy3*pow(w0, 3)*w2*w3 + 2268*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 1296*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 36*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) + 108*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 972*cx0*cy3*w0*pow(w1, 3)*w3 + 486*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 2268*cx1*cy0*pow(w0, 3)*w1*w2 - 1008*cx1*cy0*pow(w0, 3)*w1*w3 - 6048*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 2268*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 2268*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 864*cx1*cy0*pow(w0, 2)*w1*w2*w3 + 36*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) + 3402*cx1*cy0*w0*pow(w1, 3)*w2 - 972*cx1*cy0*w0*pow(w1, 3)*w3 - 1944*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 432*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 162*cx1*cy0*w0*w1*pow(w2, 3) - 2268*cx1*cy2*pow(w0, 3)*w1*w2 + 6048*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 2268*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 324*cx1*cy2*pow(w0, 2)*w1*w2*w3 - 3402*cx1*cy2*w0*pow(w1, 3)*w2 + 1944*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 216*cx1*cy2*w0*pow(w1, 2)*w2*w3 - 162*cx1*cy2*w0*w1*pow(w2, 3) + 1008*cx1*cy3*pow(w0, 3)*w1*w3 - 2268*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 540*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 36*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) + 972*cx1*cy3*w0*pow(w1, 3)*w3 - 216*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 2268*cx2*cy0*pow(w0, 3)*w1*w2 + 378*cx2*cy0*pow(w0, 3)*w2*w3 + 6048*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 2268*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 432*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 108*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 3402*cx2*cy0*w0*pow(w1, 3)*w2 + 1944*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) + 54*cx2*cy0*w0*pow(w1, 2)*w2*w3 - 162*cx2*cy0*w0*w1*pow(w2, 3) + 2268*cx2*cy1*pow(w0, 3)*w1*w2 - 6048*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 2268*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 324*cx2*cy1*pow(w0, 2)*w1*w2*w3 + 3402*cx2*cy1*w0*pow(w1, 3)*w2 - 1944*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 216*cx2*cy1*w0*pow(w1, 2)*w2*w3 + 162*cx2*cy1*w0*w1*pow(w2, 3) - 378*cx2*cy3*pow(w0, 3)*w2*w3 + 756*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 108*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 270*cx2*cy3*w0*pow(w1, 2)*w2*w3 + 1008*cx3*cy0*pow(w0, 3)*w1*w3 - 378*cx3*cy0*pow(w0, 3)*w2*w3 - 2268*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 1296*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 36*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) - 108*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 972*cx3*cy0*w0*pow(w1, 3)*w3 - 486*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 1008*cx3*cy1*pow(w0, 3)*w1*w3 + 2268*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 540*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 36*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) - 972*cx3*cy1*w0*pow(w1, 3)*w3 + 216*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 378*cx3*cy2*pow(w0, 3)*w2*w3 - 756*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 108*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 270*cx3*cy2*w0*pow(w1, 2)*w2*w3,
-    2268*cx0*cy1*pow(w0, 3)*w1*w2 - 1260*cx0*cy1*pow(w0, 3)*w1*w3 - 7560*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 3780*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 3780*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 2160*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 180*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) + 5670*cx0*cy1*w0*pow(w1, 3)*w2 - 2430*cx0*cy1*w0*pow(w1, 3)*w3 - 4860*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) + 2160*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 108*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) + 810*cx0*cy1*w0*w1*pow(w2, 3) - 270*cx0*cy1*w0*w1*pow(w2, 2)*w3 - 2268*cx0*cy2*pow(w0, 3)*w1*w2 + 630*cx0*cy2*pow(w0, 3)*w2*w3 + 7560*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 3780*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 1080*cx0*cy2*pow(w0, 2)*w1*w2*w3 + 540*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 36*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) - 5670*cx0*cy2*w0*pow(w1, 3)*w2 + 4860*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 270*cx0*cy2*w0*pow(w1, 2)*w2*w3 - 810*cx0*cy2*w0*w1*pow(w2, 3) - 216*cx0*cy2*w0*w1*pow(w2, 2)*w3 + 1260*cx0*cy3*pow(w0, 3)*w1*w3 - 630*cx0*cy3*pow(w0, 3)*w2*w3 - 3780*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 3240*cx0*cy3*pow(w0, 2)*w1*w2*w3 - 180*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) - 540*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 36*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) + 2430*cx0*cy3*w0*pow(w1, 3)*w3 - 2430*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 108*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) + 486*cx0*cy3*w0*w1*pow(w2, 2)*w3 - 2268*cx1*cy0*pow(w0, 3)*w1*w2 + 1260*cx1*cy0*pow(w0, 3)*w1*w3 + 7560*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 3780*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 3780*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 2160*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 180*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) - 5670*cx1*cy0*w0*pow(w1, 3)*w2 + 2430*cx1*cy0*w0*pow(w1, 3)*w3 + 4860*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) - 2160*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 108*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) - 810*cx1*cy0*w0*w1*pow(w2, 3) + 270*cx1*cy0*w0*w1*pow(w2, 2)*w3 + 2268*cx1*cy2*pow(w0, 3)*w1*w2 - 7560*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 3780*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 810*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 5670*cx1*cy2*w0*pow(w1, 3)*w2 - 4860*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) + 1080*cx1*cy2*w0*pow(w1, 2)*w2*w3 + 810*cx1*cy2*w0*w1*pow(w2, 3) - 216*cx1*cy2*w0*w1*pow(w2, 2)*w3 - 162*cx1*cy2*pow(w1, 3)*w2*w3 - 1260*cx1*cy3*pow(w0, 3)*w1*w3 + 3780*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 1350*cx1*cy3*pow(w0, 2)*w1*w2*w3 + 180*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) - 2430*cx1*cy3*w0*pow(w1, 3)*w3 + 1080*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 108*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) - 54*cx1*cy3*w0*w1*pow(w2, 2)*w3 + 162*cx1*cy3*pow(w1, 3)*w2*w3 + 2268*cx2*cy0*pow(w0, 3)*w1*w2 - 630*cx2*cy0*pow(w0, 3)*w2*w3 - 7560*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 3780*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 1080*cx2*cy0*pow(w0, 2)*w1*w2*w3 - 540*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 36*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) + 5670*cx2*cy0*w0*pow(w1, 3)*w2 - 4860*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 270*cx2*cy0*w0*pow(w1, 2)*w2*w3 + 810*cx2*cy0*w0*w1*pow(w2, 3) + 216*cx2*cy0*w0*w1*pow(w2, 2)*w3 - 2268*cx2*cy1*pow(w0, 3)*w1*w2 + 7560*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 3780*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 810*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 5670*cx2*cy1*w0*pow(w1, 3)*w2 + 4860*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) - 1080*cx2*cy1*w0*pow(w1, 2)*w2*w3 - 810*cx2*cy1*w0*w1*pow(w2, 3) + 216*cx2*cy1*w0*w1*pow(w2, 2)*w3 + 162*cx2*cy1*pow(w1, 3)*w2*w3 + 630*cx2*cy3*pow(w0, 3)*w2*w3 - 1890*cx2*cy3*pow(w0, 2)*w1*w2*w3 + 540*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 36*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) + 1350*cx2*cy3*w0*pow(w1, 2)*w2*w3 - 432*cx2*cy3*w0*w1*pow(w2, 2)*w3 - 162*cx2*cy3*pow(w1, 3)*w2*w3 - 1260*cx3*cy0*pow(w0, 3)*w1*w3 + 630*cx3*cy0*pow(w0, 3)*w2*w3 + 3780*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 3240*cx3*cy0*pow(w0, 2)*w1*w2*w3 + 180*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) + 540*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 36*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) - 2430*cx3*cy0*w0*pow(w1, 3)*w3 + 2430*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 108*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) - 486*cx3*cy0*w0*w1*pow(w2, 2)*w3 + 1260*cx3*cy1*pow(w0, 3)*w1*w3 - 3780*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 1350*cx3*cy1*pow(w0, 2)*w1*w2*w3 - 180*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) + 2430*cx3*cy1*w0*pow(w1, 3)*w3 - 1080*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 108*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) + 54*cx3*cy1*w0*w1*pow(w2, 2)*w3 - 162*cx3*cy1*pow(w1, 3)*w2*w3 - 630*cx3*cy2*pow(w0, 3)*w2*w3 + 1890*cx3*cy2*pow(w0, 2)*w1*w2*w3 - 540*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 36*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) - 1350*cx3*cy2*w0*pow(w1, 2)*w2*w3 + 432*cx3*cy2*w0*w1*pow(w2, 2)*w3 + 162*cx3*cy2*pow(w1, 3)*w2*w3,
-    -1512*cx0*cy1*pow(w0, 3)*w1*w2 + 1008*cx0*cy1*pow(w0, 3)*w1*w3 + 6048*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 3780*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 3780*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 2880*cx0*cy1*pow(w0, 2)*w1*w2*w3 - 360*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) - 5670*cx0*cy1*w0*pow(w1, 3)*w2 + 3240*cx0*cy1*w0*pow(w1, 3)*w3 + 6480*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 4320*cx0*cy1*w0*pow(w1, 2)*w2*w3 + 432*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) - 1620*cx0*cy1*w0*w1*pow(w2, 3) + 1080*cx0*cy1*w0*w1*pow(w2, 2)*w3 - 126*cx0*cy1*w0*w1*w2*pow(w3, 2) + 1512*cx0*cy2*pow(w0, 3)*w1*w2 - 630*cx0*cy2*pow(w0, 3)*w2*w3 - 6048*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 3780*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 1440*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 1080*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 144*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) + 5670*cx0*cy2*w0*pow(w1, 3)*w2 - 6480*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 540*cx0*cy2*w0*pow(w1, 2)*w2*w3 + 1620*cx0*cy2*w0*w1*pow(w2, 3) + 864*cx0*cy2*w0*w1*pow(w2, 2)*w3 - 90*cx0*cy2*w0*w1*w2*pow(w3, 2) - 162*cx0*cy2*w0*pow(w2, 3)*w3 - 1008*cx0*cy3*pow(w0, 3)*w1*w3 + 630*cx0*cy3*pow(w0, 3)*w2*w3 + 3780*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 4320*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 360*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) + 1080*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 144*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) - 3240*cx0*cy3*w0*pow(w1, 3)*w3 + 4860*cx0*cy3*w0*pow(w1, 2)*w2*w3 - 432*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) - 1944*cx0*cy3*w0*w1*pow(w2, 2)*w3 + 216*cx0*cy3*w0*w1*w2*pow(w3, 2) + 162*cx0*cy3*w0*pow(w2, 3)*w3 + 1512*cx1*cy0*pow(w0, 3)*w1*w2 - 1008*cx1*cy0*pow(w0, 3)*w1*w3 - 6048*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 3780*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 3780*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 2880*cx1*cy0*pow(w0, 2)*w1*w2*w3 + 360*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) + 5670*cx1*cy0*w0*pow(w1, 3)*w2 - 3240*cx1*cy0*w0*pow(w1, 3)*w3 - 6480*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 4320*cx1*cy0*w0*pow(w1, 2)*w2*w3 - 432*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) + 1620*cx1*cy0*w0*w1*pow(w2, 3) - 1080*cx1*cy0*w0*w1*pow(w2, 2)*w3 + 126*cx1*cy0*w0*w1*w2*pow(w3, 2) - 1512*cx1*cy2*pow(w0, 3)*w1*w2 + 6048*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 3780*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 1080*cx1*cy2*pow(w0, 2)*w1*w2*w3 - 5670*cx1*cy2*w0*pow(w1, 3)*w2 + 6480*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 2160*cx1*cy2*w0*pow(w1, 2)*w2*w3 - 1620*cx1*cy2*w0*w1*pow(w2, 3) + 864*cx1*cy2*w0*w1*pow(w2, 2)*w3 - 54*cx1*cy2*w0*w1*w2*pow(w3, 2) + 648*cx1*cy2*pow(w1, 3)*w2*w3 - 324*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 1008*cx1*cy3*pow(w0, 3)*w1*w3 - 3780*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 1800*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 360*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) + 3240*cx1*cy3*w0*pow(w1, 3)*w3 - 2160*cx1*cy3*w0*pow(w1, 2)*w2*w3 + 432*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) + 216*cx1*cy3*w0*w1*pow(w2, 2)*w3 - 72*cx1*cy3*w0*w1*w2*pow(w3, 2) - 648*cx1*cy3*pow(w1, 3)*w2*w3 + 324*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 1512*cx2*cy0*pow(w0, 3)*w1*w2 + 630*cx2*cy0*pow(w0, 3)*w2*w3 + 6048*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 3780*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 1440*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 1080*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 144*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) - 5670*cx2*cy0*w0*pow(w1, 3)*w2 + 6480*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) + 540*cx2*cy0*w0*pow(w1, 2)*w2*w3 - 1620*cx2*cy0*w0*w1*pow(w2, 3) - 864*cx2*cy0*w0*w1*pow(w2, 2)*w3 + 90*cx2*cy0*w0*w1*w2*pow(w3, 2) + 162*cx2*cy0*w0*pow(w2, 3)*w3 + 1512*cx2*cy1*pow(w0, 3)*w1*w2 - 6048*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 3780*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 1080*cx2*cy1*pow(w0, 2)*w1*w2*w3 + 5670*cx2*cy1*w0*pow(w1, 3)*w2 - 6480*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 2160*cx2*cy1*w0*pow(w1, 2)*w2*w3 + 1620*cx2*cy1*w0*w1*pow(w2, 3) - 864*cx2*cy1*w0*w1*pow(w2, 2)*w3 + 54*cx2*cy1*w0*w1*w2*pow(w3, 2) - 648*cx2*cy1*pow(w1, 3)*w2*w3 + 324*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 630*cx2*cy3*pow(w0, 3)*w2*w3 + 2520*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 1080*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 144*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) - 2700*cx2*cy3*w0*pow(w1, 2)*w2*w3 + 1728*cx2*cy3*w0*w1*pow(w2, 2)*w3 - 144*cx2*cy3*w0*w1*w2*pow(w3, 2) - 162*cx2*cy3*w0*pow(w2, 3)*w3 + 648*cx2*cy3*pow(w1, 3)*w2*w3 - 324*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 1008*cx3*cy0*pow(w0, 3)*w1*w3 - 630*cx3*cy0*pow(w0, 3)*w2*w3 - 3780*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 4320*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 360*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) - 1080*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 144*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) + 3240*cx3*cy0*w0*pow(w1, 3)*w3 - 4860*cx3*cy0*w0*pow(w1, 2)*w2*w3 + 432*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) + 1944*cx3*cy0*w0*w1*pow(w2, 2)*w3 - 216*cx3*cy0*w0*w1*w2*pow(w3, 2) - 162*cx3*cy0*w0*pow(w2, 3)*w3 - 1008*cx3*cy1*pow(w0, 3)*w1*w3 + 3780*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 1800*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 360*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) - 3240*cx3*cy1*w0*pow(w1, 3)*w3 + 2160*cx3*cy1*w0*pow(w1, 2)*w2*w3 - 432*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) - 216*cx3*cy1*w0*w1*pow(w2, 2)*w3 + 72*cx3*cy1*w0*w1*w2*pow(w3, 2) + 648*cx3*cy1*pow(w1, 3)*w2*w3 - 324*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 630*cx3*cy2*pow(w0, 3)*w2*w3 - 2520*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 1080*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 144*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) + 2700*cx3*cy2*w0*pow(w1, 2)*w2*w3 - 1728*cx3*cy2*w0*w1*pow(w2, 2)*w3 + 144*cx3*cy2*w0*w1*w2*pow(w3, 2) + 162*cx3*cy2*w0*pow(w2, 3)*w3 - 648*cx3*cy2*pow(w1, 3)*w2*w3 + 324*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3,
-    648*cx0*cy1*pow(w0, 3)*w1*w2 - 504*cx0*cy1*pow(w0, 3)*w1*w3 - 3024*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 2268*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 2268*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 2160*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 360*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) + 3402*cx0*cy1*w0*pow(w1, 3)*w2 - 2430*cx0*cy1*w0*pow(w1, 3)*w3 - 4860*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) + 4320*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 648*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) + 1620*cx0*cy1*w0*w1*pow(w2, 3) - 1620*cx0*cy1*w0*w1*pow(w2, 2)*w3 + 378*cx0*cy1*w0*w1*w2*pow(w3, 2) - 18*cx0*cy1*w0*w1*pow(w3, 3) - 648*cx0*cy2*pow(w0, 3)*w1*w2 + 378*cx0*cy2*pow(w0, 3)*w2*w3 + 3024*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 2268*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 1080*cx0*cy2*pow(w0, 2)*w1*w2*w3 + 1080*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 216*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) - 3402*cx0*cy2*w0*pow(w1, 3)*w2 + 4860*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 540*cx0*cy2*w0*pow(w1, 2)*w2*w3 - 1620*cx0*cy2*w0*w1*pow(w2, 3) - 1296*cx0*cy2*w0*w1*pow(w2, 2)*w3 + 270*cx0*cy2*w0*w1*w2*pow(w3, 2) + 486*cx0*cy2*w0*pow(w2, 3)*w3 - 108*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) + 504*cx0*cy3*pow(w0, 3)*w1*w3 - 378*cx0*cy3*pow(w0, 3)*w2*w3 - 2268*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 3240*cx0*cy3*pow(w0, 2)*w1*w2*w3 - 360*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) - 1080*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 216*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) + 2430*cx0*cy3*w0*pow(w1, 3)*w3 - 4860*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 648*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) + 2916*cx0*cy3*w0*w1*pow(w2, 2)*w3 - 648*cx0*cy3*w0*w1*w2*pow(w3, 2) + 18*cx0*cy3*w0*w1*pow(w3, 3) - 486*cx0*cy3*w0*pow(w2, 3)*w3 + 108*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) - 648*cx1*cy0*pow(w0, 3)*w1*w2 + 504*cx1*cy0*pow(w0, 3)*w1*w3 + 3024*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 2268*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 2268*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 2160*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 360*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) - 3402*cx1*cy0*w0*pow(w1, 3)*w2 + 2430*cx1*cy0*w0*pow(w1, 3)*w3 + 4860*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) - 4320*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 648*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) - 1620*cx1*cy0*w0*w1*pow(w2, 3) + 1620*cx1*cy0*w0*w1*pow(w2, 2)*w3 - 378*cx1*cy0*w0*w1*w2*pow(w3, 2) + 18*cx1*cy0*w0*w1*pow(w3, 3) + 648*cx1*cy2*pow(w0, 3)*w1*w2 - 3024*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 2268*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 810*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 3402*cx1*cy2*w0*pow(w1, 3)*w2 - 4860*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) + 2160*cx1*cy2*w0*pow(w1, 2)*w2*w3 + 1620*cx1*cy2*w0*w1*pow(w2, 3) - 1296*cx1*cy2*w0*w1*pow(w2, 2)*w3 + 162*cx1*cy2*w0*w1*w2*pow(w3, 2) - 972*cx1*cy2*pow(w1, 3)*w2*w3 + 972*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 108*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) - 162*cx1*cy2*w1*pow(w2, 3)*w3 - 504*cx1*cy3*pow(w0, 3)*w1*w3 + 2268*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 1350*cx1*cy3*pow(w0, 2)*w1*w2*w3 + 360*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) - 2430*cx1*cy3*w0*pow(w1, 3)*w3 + 2160*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 648*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) - 324*cx1*cy3*w0*w1*pow(w2, 2)*w3 + 216*cx1*cy3*w0*w1*w2*pow(w3, 2) - 18*cx1*cy3*w0*w1*pow(w3, 3) + 972*cx1*cy3*pow(w1, 3)*w2*w3 - 972*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 108*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) + 162*cx1*cy3*w1*pow(w2, 3)*w3 + 648*cx2*cy0*pow(w0, 3)*w1*w2 - 378*cx2*cy0*pow(w0, 3)*w2*w3 - 3024*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 2268*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 1080*cx2*cy0*pow(w0, 2)*w1*w2*w3 - 1080*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 216*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) + 3402*cx2*cy0*w0*pow(w1, 3)*w2 - 4860*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 540*cx2*cy0*w0*pow(w1, 2)*w2*w3 + 1620*cx2*cy0*w0*w1*pow(w2, 3) + 1296*cx2*cy0*w0*w1*pow(w2, 2)*w3 - 270*cx2*cy0*w0*w1*w2*pow(w3, 2) - 486*cx2*cy0*w0*pow(w2, 3)*w3 + 108*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) - 648*cx2*cy1*pow(w0, 3)*w1*w2 + 3024*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 2268*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 810*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 3402*cx2*cy1*w0*pow(w1, 3)*w2 + 4860*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) - 2160*cx2*cy1*w0*pow(w1, 2)*w2*w3 - 1620*cx2*cy1*w0*w1*pow(w2, 3) + 1296*cx2*cy1*w0*w1*pow(w2, 2)*w3 - 162*cx2*cy1*w0*w1*w2*pow(w3, 2) + 972*cx2*cy1*pow(w1, 3)*w2*w3 - 972*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 108*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) + 162*cx2*cy1*w1*pow(w2, 3)*w3 + 378*cx2*cy3*pow(w0, 3)*w2*w3 - 1890*cx2*cy3*pow(w0, 2)*w1*w2*w3 + 1080*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 216*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) + 2700*cx2*cy3*w0*pow(w1, 2)*w2*w3 - 2592*cx2*cy3*w0*w1*pow(w2, 2)*w3 + 432*cx2*cy3*w0*w1*w2*pow(w3, 2) + 486*cx2*cy3*w0*pow(w2, 3)*w3 - 108*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) - 972*cx2*cy3*pow(w1, 3)*w2*w3 + 972*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 108*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) - 162*cx2*cy3*w1*pow(w2, 3)*w3 - 504*cx3*cy0*pow(w0, 3)*w1*w3 + 378*cx3*cy0*pow(w0, 3)*w2*w3 + 2268*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 3240*cx3*cy0*pow(w0, 2)*w1*w2*w3 + 360*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) + 1080*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 216*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) - 2430*cx3*cy0*w0*pow(w1, 3)*w3 + 4860*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 648*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) - 2916*cx3*cy0*w0*w1*pow(w2, 2)*w3 + 648*cx3*cy0*w0*w1*w2*pow(w3, 2) - 18*cx3*cy0*w0*w1*pow(w3, 3) + 486*cx3*cy0*w0*pow(w2, 3)*w3 - 108*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) + 504*cx3*cy1*pow(w0, 3)*w1*w3 - 2268*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 1350*cx3*cy1*pow(w0, 2)*w1*w2*w3 - 360*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) + 2430*cx3*cy1*w0*pow(w1, 3)*w3 - 2160*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 648*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) + 324*cx3*cy1*w0*w1*pow(w2, 2)*w3 - 216*cx3*cy1*w0*w1*w2*pow(w3, 2) + 18*cx3*cy1*w0*w1*pow(w3, 3) - 972*cx3*cy1*pow(w1, 3)*w2*w3 + 972*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 108*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) - 162*cx3*cy1*w1*pow(w2, 3)*w3 - 378*cx3*cy2*pow(w0, 3)*w2*w3 + 1890*cx3*cy2*pow(w0, 2)*w1*w2*w3 - 1080*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 216*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) - 2700*cx3*cy2*w0*pow(w1, 2)*w2*w3 + 2592*cx3*cy2*w0*w1*pow(w2, 2)*w3 - 432*cx3*cy2*w0*w1*w2*pow(w3, 2) - 486*cx3*cy2*w0*pow(w2, 3)*w3 + 108*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) + 972*cx3*cy2*pow(w1, 3)*w2*w3 - 972*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 108*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) + 162*cx3*cy2*w1*pow(w2, 3)*w3,
-    -162*cx0*cy1*pow(w0, 3)*w1*w2 + 144*cx0*cy1*pow(w0, 3)*w1*w3 + 864*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 756*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 756*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 864*cx0*cy1*pow(w0, 2)*w1*w2*w3 - 180*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) - 1134*cx0*cy1*w0*pow(w1, 3)*w2 + 972*cx0*cy1*w0*pow(w1, 3)*w3 + 1944*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 2160*cx0*cy1*w0*pow(w1, 2)*w2*w3 + 432*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) - 810*cx0*cy1*w0*w1*pow(w2, 3) + 1080*cx0*cy1*w0*w1*pow(w2, 2)*w3 - 378*cx0*cy1*w0*w1*w2*pow(w3, 2) + 36*cx0*cy1*w0*w1*pow(w3, 3) + 162*cx0*cy2*pow(w0, 3)*w1*w2 - 126*cx0*cy2*pow(w0, 3)*w2*w3 - 864*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 756*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 432*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 540*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 144*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) + 1134*cx0*cy2*w0*pow(w1, 3)*w2 - 1944*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 270*cx0*cy2*w0*pow(w1, 2)*w2*w3 + 810*cx0*cy2*w0*w1*pow(w2, 3) + 864*cx0*cy2*w0*w1*pow(w2, 2)*w3 - 270*cx0*cy2*w0*w1*w2*pow(w3, 2) - 486*cx0*cy2*w0*pow(w2, 3)*w3 + 216*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) - 18*cx0*cy2*w0*w2*pow(w3, 3) - 144*cx0*cy3*pow(w0, 3)*w1*w3 + 126*cx0*cy3*pow(w0, 3)*w2*w3 + 756*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 1296*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 180*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) + 540*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 144*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) - 972*cx0*cy3*w0*pow(w1, 3)*w3 + 2430*cx0*cy3*w0*pow(w1, 2)*w2*w3 - 432*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) - 1944*cx0*cy3*w0*w1*pow(w2, 2)*w3 + 648*cx0*cy3*w0*w1*w2*pow(w3, 2) - 36*cx0*cy3*w0*w1*pow(w3, 3) + 486*cx0*cy3*w0*pow(w2, 3)*w3 - 216*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) + 18*cx0*cy3*w0*w2*pow(w3, 3) + 162*cx1*cy0*pow(w0, 3)*w1*w2 - 144*cx1*cy0*pow(w0, 3)*w1*w3 - 864*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 756*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 756*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 864*cx1*cy0*pow(w0, 2)*w1*w2*w3 + 180*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) + 1134*cx1*cy0*w0*pow(w1, 3)*w2 - 972*cx1*cy0*w0*pow(w1, 3)*w3 - 1944*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 2160*cx1*cy0*w0*pow(w1, 2)*w2*w3 - 432*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) + 810*cx1*cy0*w0*w1*pow(w2, 3) - 1080*cx1*cy0*w0*w1*pow(w2, 2)*w3 + 378*cx1*cy0*w0*w1*w2*pow(w3, 2) - 36*cx1*cy0*w0*w1*pow(w3, 3) - 162*cx1*cy2*pow(w0, 3)*w1*w2 + 864*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 756*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 324*cx1*cy2*pow(w0, 2)*w1*w2*w3 - 1134*cx1*cy2*w0*pow(w1, 3)*w2 + 1944*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 1080*cx1*cy2*w0*pow(w1, 2)*w2*w3 - 810*cx1*cy2*w0*w1*pow(w2, 3) + 864*cx1*cy2*w0*w1*pow(w2, 2)*w3 - 162*cx1*cy2*w0*w1*w2*pow(w3, 2) + 648*cx1*cy2*pow(w1, 3)*w2*w3 - 972*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 216*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) + 324*cx1*cy2*w1*pow(w2, 3)*w3 - 108*cx1*cy2*w1*pow(w2, 2)*pow(w3, 2) + 144*cx1*cy3*pow(w0, 3)*w1*w3 - 756*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 540*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 180*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) + 972*cx1*cy3*w0*pow(w1, 3)*w3 - 1080*cx1*cy3*w0*pow(w1, 2)*w2*w3 + 432*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) + 216*cx1*cy3*w0*w1*pow(w2, 2)*w3 - 216*cx1*cy3*w0*w1*w2*pow(w3, 2) + 36*cx1*cy3*w0*w1*pow(w3, 3) - 648*cx1*cy3*pow(w1, 3)*w2*w3 + 972*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 216*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) - 324*cx1*cy3*w1*pow(w2, 3)*w3 + 108*cx1*cy3*w1*pow(w2, 2)*pow(w3, 2) - 162*cx2*cy0*pow(w0, 3)*w1*w2 + 126*cx2*cy0*pow(w0, 3)*w2*w3 + 864*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 756*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 432*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 540*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 144*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) - 1134*cx2*cy0*w0*pow(w1, 3)*w2 + 1944*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) + 270*cx2*cy0*w0*pow(w1, 2)*w2*w3 - 810*cx2*cy0*w0*w1*pow(w2, 3) - 864*cx2*cy0*w0*w1*pow(w2, 2)*w3 + 270*cx2*cy0*w0*w1*w2*pow(w3, 2) + 486*cx2*cy0*w0*pow(w2, 3)*w3 - 216*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) + 18*cx2*cy0*w0*w2*pow(w3, 3) + 162*cx2*cy1*pow(w0, 3)*w1*w2 - 864*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 756*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 324*cx2*cy1*pow(w0, 2)*w1*w2*w3 + 1134*cx2*cy1*w0*pow(w1, 3)*w2 - 1944*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 1080*cx2*cy1*w0*pow(w1, 2)*w2*w3 + 810*cx2*cy1*w0*w1*pow(w2, 3) - 864*cx2*cy1*w0*w1*pow(w2, 2)*w3 + 162*cx2*cy1*w0*w1*w2*pow(w3, 2) - 648*cx2*cy1*pow(w1, 3)*w2*w3 + 972*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 216*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) - 324*cx2*cy1*w1*pow(w2, 3)*w3 + 108*cx2*cy1*w1*pow(w2, 2)*pow(w3, 2) - 126*cx2*cy3*pow(w0, 3)*w2*w3 + 756*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 540*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 144*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) - 1350*cx2*cy3*w0*pow(w1, 2)*w2*w3 + 1728*cx2*cy3*w0*w1*pow(w2, 2)*w3 - 432*cx2*cy3*w0*w1*w2*pow(w3, 2) - 486*cx2*cy3*w0*pow(w2, 3)*w3 + 216*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) - 18*cx2*cy3*w0*w2*pow(w3, 3) + 648*cx2*cy3*pow(w1, 3)*w2*w3 - 972*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 216*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) + 324*cx2*cy3*w1*pow(w2, 3)*w3 - 108*cx2*cy3*w1*pow(w2, 2)*pow(w3, 2) + 144*cx3*cy0*pow(w0, 3)*w1*w3 - 126*cx3*cy0*pow(w0, 3)*w2*w3 - 756*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 1296*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 180*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) - 540*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 144*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) + 972*cx3*cy0*w0*pow(w1, 3)*w3 - 2430*cx3*cy0*w0*pow(w1, 2)*w2*w3 + 432*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) + 1944*cx3*cy0*w0*w1*pow(w2, 2)*w3 - 648*cx3*cy0*w0*w1*w2*pow(w3, 2) + 36*cx3*cy0*w0*w1*pow(w3, 3) - 486*cx3*cy0*w0*pow(w2, 3)*w3 + 216*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) - 18*cx3*cy0*w0*w2*pow(w3, 3) - 144*cx3*cy1*pow(w0, 3)*w1*w3 + 756*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 540*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 180*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) - 972*cx3*cy1*w0*pow(w1, 3)*w3 + 1080*cx3*cy1*w0*pow(w1, 2)*w2*w3 - 432*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) - 216*cx3*cy1*w0*w1*pow(w2, 2)*w3 + 216*cx3*cy1*w0*w1*w2*pow(w3, 2) - 36*cx3*cy1*w0*w1*pow(w3, 3) + 648*cx3*cy1*pow(w1, 3)*w2*w3 - 972*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 216*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) + 324*cx3*cy1*w1*pow(w2, 3)*w3 - 108*cx3*cy1*w1*pow(w2, 2)*pow(w3, 2) + 126*cx3*cy2*pow(w0, 3)*w2*w3 - 756*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 540*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 144*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) + 1350*cx3*cy2*w0*pow(w1, 2)*w2*w3 - 1728*cx3*cy2*w0*w1*pow(w2, 2)*w3 + 432*cx3*cy2*w0*w1*w2*pow(w3, 2) + 486*cx3*cy2*w0*pow(w2, 3)*w3 - 216*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) + 18*cx3*cy2*w0*w2*pow(w3, 3) - 648*cx3*cy2*pow(w1, 3)*w2*w3 + 972*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 216*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) - 324*cx3*cy2*w1*pow(w2, 3)*w3 + 108*cx3*cy2*w1*pow(w2, 2)*pow(w3, 2),
-    18*cx0*cy1*pow(w0, 3)*w1*w2 - 18*cx0*cy1*pow(w0, 3)*w1*w3 - 108*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 108*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 108*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 144*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 36*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) + 162*cx0*cy1*w0*pow(w1, 3)*w2 - 162*cx0*cy1*w0*pow(w1, 3)*w3 - 324*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) + 432*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 108*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) + 162*cx0*cy1*w0*w1*pow(w2, 3) - 270*cx0*cy1*w0*w1*pow(w2, 2)*w3 + 126*cx0*cy1*w0*w1*w2*pow(w3, 2) - 18*cx0*cy1*w0*w1*pow(w3, 3) - 18*cx0*cy2*pow(w0, 3)*w1*w2 + 18*cx0*cy2*pow(w0, 3)*w2*w3 + 108*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 108*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 72*cx0*cy2*pow(w0, 2)*w1*w2*w3 + 108*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 36*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) - 162*cx0*cy2*w0*pow(w1, 3)*w2 + 324*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 54*cx0*cy2*w0*pow(w1, 2)*w2*w3 - 162*cx0*cy2*w0*w1*pow(w2, 3) - 216*cx0*cy2*w0*w1*pow(w2, 2)*w3 + 90*cx0*cy2*w0*w1*w2*pow(w3, 2) + 162*cx0*cy2*w0*pow(w2, 3)*w3 - 108*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) + 18*cx0*cy2*w0*w2*pow(w3, 3) + 18*cx0*cy3*pow(w0, 3)*w1*w3 - 18*cx0*cy3*pow(w0, 3)*w2*w3 - 108*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 216*cx0*cy3*pow(w0, 2)*w1*w2*w3 - 36*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) - 108*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 36*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) + 162*cx0*cy3*w0*pow(w1, 3)*w3 - 486*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 108*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) + 486*cx0*cy3*w0*w1*pow(w2, 2)*w3 - 216*cx0*cy3*w0*w1*w2*pow(w3, 2) + 18*cx0*cy3*w0*w1*pow(w3, 3) - 162*cx0*cy3*w0*pow(w2, 3)*w3 + 108*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) - 18*cx0*cy3*w0*w2*pow(w3, 3) - 18*cx1*cy0*pow(w0, 3)*w1*w2 + 18*cx1*cy0*pow(w0, 3)*w1*w3 + 108*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 108*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 108*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 144*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 36*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) - 162*cx1*cy0*w0*pow(w1, 3)*w2 + 162*cx1*cy0*w0*pow(w1, 3)*w3 + 324*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) - 432*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 108*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) - 162*cx1*cy0*w0*w1*pow(w2, 3) + 270*cx1*cy0*w0*w1*pow(w2, 2)*w3 - 126*cx1*cy0*w0*w1*w2*pow(w3, 2) + 18*cx1*cy0*w0*w1*pow(w3, 3) + 18*cx1*cy2*pow(w0, 3)*w1*w2 - 108*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 108*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 54*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 162*cx1*cy2*w0*pow(w1, 3)*w2 - 324*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) + 216*cx1*cy2*w0*pow(w1, 2)*w2*w3 + 162*cx1*cy2*w0*w1*pow(w2, 3) - 216*cx1*cy2*w0*w1*pow(w2, 2)*w3 + 54*cx1*cy2*w0*w1*w2*pow(w3, 2) - 162*cx1*cy2*pow(w1, 3)*w2*w3 + 324*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 108*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) - 162*cx1*cy2*w1*pow(w2, 3)*w3 + 108*cx1*cy2*w1*pow(w2, 2)*pow(w3, 2) - 18*cx1*cy2*w1*w2*pow(w3, 3) - 18*cx1*cy3*pow(w0, 3)*w1*w3 + 108*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 90*cx1*cy3*pow(w0, 2)*w1*w2*w3 + 36*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) - 162*cx1*cy3*w0*pow(w1, 3)*w3 + 216*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 108*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) - 54*cx1*cy3*w0*w1*pow(w2, 2)*w3 + 72*cx1*cy3*w0*w1*w2*pow(w3, 2) - 18*cx1*cy3*w0*w1*pow(w3, 3) + 162*cx1*cy3*pow(w1, 3)*w2*w3 - 324*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 108*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) + 162*cx1*cy3*w1*pow(w2, 3)*w3 - 108*cx1*cy3*w1*pow(w2, 2)*pow(w3, 2) + 18*cx1*cy3*w1*w2*pow(w3, 3) + 18*cx2*cy0*pow(w0, 3)*w1*w2 - 18*cx2*cy0*pow(w0, 3)*w2*w3 - 108*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 108*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 72*cx2*cy0*pow(w0, 2)*w1*w2*w3 - 108*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 36*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) + 162*cx2*cy0*w0*pow(w1, 3)*w2 - 324*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 54*cx2*cy0*w0*pow(w1, 2)*w2*w3 + 162*cx2*cy0*w0*w1*pow(w2, 3) + 216*cx2*cy0*w0*w1*pow(w2, 2)*w3 - 90*cx2*cy0*w0*w1*w2*pow(w3, 2) - 162*cx2*cy0*w0*pow(w2, 3)*w3 + 108*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) - 18*cx2*cy0*w0*w2*pow(w3, 3) - 18*cx2*cy1*pow(w0, 3)*w1*w2 + 108*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 108*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 54*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 162*cx2*cy1*w0*pow(w1, 3)*w2 + 324*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) - 216*cx2*cy1*w0*pow(w1, 2)*w2*w3 - 162*cx2*cy1*w0*w1*pow(w2, 3) + 216*cx2*cy1*w0*w1*pow(w2, 2)*w3 - 54*cx2*cy1*w0*w1*w2*pow(w3, 2) + 162*cx2*cy1*pow(w1, 3)*w2*w3 - 324*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 108*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) + 162*cx2*cy1*w1*pow(w2, 3)*w3 - 108*cx2*cy1*w1*pow(w2, 2)*pow(w3, 2) + 18*cx2*cy1*w1*w2*pow(w3, 3) + 18*cx2*cy3*pow(w0, 3)*w2*w3 - 126*cx2*cy3*pow(w0, 2)*w1*w2*w3 + 108*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 36*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) + 270*cx2*cy3*w0*pow(w1, 2)*w2*w3 - 432*cx2*cy3*w0*w1*pow(w2, 2)*w3 + 144*cx2*cy3*w0*w1*w2*pow(w3, 2) + 162*cx2*cy3*w0*pow(w2, 3)*w3 - 108*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) + 18*cx2*cy3*w0*w2*pow(w3, 3) - 162*cx2*cy3*pow(w1, 3)*w2*w3 + 324*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 108*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) - 162*cx2*cy3*w1*pow(w2, 3)*w3 + 108*cx2*cy3*w1*pow(w2, 2)*pow(w3, 2) - 18*cx2*cy3*w1*w2*pow(w3, 3) - 18*cx3*cy0*pow(w0, 3)*w1*w3 + 18*cx3*cy0*pow(w0, 3)*w2*w3 + 108*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 216*cx3*cy0*pow(w0, 2)*w1*w2*w3 + 36*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) + 108*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 36*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) - 162*cx3*cy0*w0*pow(w1, 3)*w3 + 486*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 108*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) - 486*cx3*cy0*w0*w1*pow(w2, 2)*w3 + 216*cx3*cy0*w0*w1*w2*pow(w3, 2) - 18*cx3*cy0*w0*w1*pow(w3, 3) + 162*cx3*cy0*w0*pow(w2, 3)*w3 - 108*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) + 18*cx3*cy0*w0*w2*pow(w3, 3) + 18*cx3*cy1*pow(w0, 3)*w1*w3 - 108*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 90*cx3*cy1*pow(w0, 2)*w1*w2*w3 - 36*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) + 162*cx3*cy1*w0*pow(w1, 3)*w3 - 216*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 108*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) + 54*cx3*cy1*w0*w1*pow(w2, 2)*w3 - 72*cx3*cy1*w0*w1*w2*pow(w3, 2) + 18*cx3*cy1*w0*w1*pow(w3, 3) - 162*cx3*cy1*pow(w1, 3)*w2*w3 + 324*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 108*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) - 162*cx3*cy1*w1*pow(w2, 3)*w3 + 108*cx3*cy1*w1*pow(w2, 2)*pow(w3, 2) - 18*cx3*cy1*w1*w2*pow(w3, 3) - 18*cx3*cy2*pow(w0, 3)*w2*w3 + 126*cx3*cy2*pow(w0, 2)*w1*w2*w3 - 108*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 36*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) - 270*cx3*cy2*w0*pow(w1, 2)*w2*w3 + 432*cx3*cy2*w0*w1*pow(w2, 2)*w3 - 144*cx3*cy2*w0*w1*w2*pow(w3, 2) - 162*cx3*cy2*w0*pow(w2, 3)*w3 + 108*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) - 18*cx3*cy2*w0*w2*pow(w3, 3) + 162*cx3*cy2*pow(w1, 3)*w2*w3 - 324*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 108*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) + 162*cx3*cy2*w1*pow(w2, 3)*w3 - 108*cx3*cy2*w1*pow(w2, 2)*pow(w3, 2) + 18*cx3*cy2*w1*w2*pow(w3, 3)
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Scalar>
-std::vector<Scalar> compute_RationalBezier_degree_4_inflections(
-        Scalar cx0, Scalar cy0, Scalar cx1, Scalar cy1, Scalar cx2, Scalar cy2, Scalar cx3, Scalar cy3, Scalar cx4, Scalar cy4,
-        Scalar w0, Scalar w1, Scalar w2, Scalar w3, Scalar w4,
-        Scalar t0 = 0,
-        Scalar t1 = 1) {
-    std::vector<Scalar> result;
-    constexpr Scalar tol = static_cast<Scalar>(1e-8);
-
-    PolynomialRootFinder<Scalar, 14>::find_real_roots_in_interval({
-        -48*cx0*cy1*pow(w0, 3)*w1*w2 + 48*cx0*cy2*pow(w0, 3)*w1*w2 + 48*cx1*cy0*pow(w0, 3)*w1*w2 - 48*cx1*cy2*pow(w0, 3)*w1*w2 - 48*cx2*cy0*pow(w0, 3)*w1*w2 + 48*cx2*cy1*pow(w0, 3)*w1*w2,
-    672*cx0*cy1*pow(w0, 3)*w1*w2 - 96*cx0*cy1*pow(w0, 3)*w1*w3 - 384*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 672*cx0*cy2*pow(w0, 3)*w1*w2 + 384*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 96*cx0*cy3*pow(w0, 3)*w1*w3 - 672*cx1*cy0*pow(w0, 3)*w1*w2 + 96*cx1*cy0*pow(w0, 3)*w1*w3 + 384*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 672*cx1*cy2*pow(w0, 3)*w1*w2 - 384*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 96*cx1*cy3*pow(w0, 3)*w1*w3 + 672*cx2*cy0*pow(w0, 3)*w1*w2 - 384*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 672*cx2*cy1*pow(w0, 3)*w1*w2 + 384*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 96*cx3*cy0*pow(w0, 3)*w1*w3 + 96*cx3*cy1*pow(w0, 3)*w1*w3,
-    -4368*cx0*cy1*pow(w0, 3)*w1*w2 + 1248*cx0*cy1*pow(w0, 3)*w1*w3 - 48*cx0*cy1*pow(w0, 3)*w1*w4 + 4992*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 768*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 576*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 768*cx0*cy1*w0*pow(w1, 3)*w2 + 4368*cx0*cy2*pow(w0, 3)*w1*w2 - 144*cx0*cy2*pow(w0, 3)*w2*w3 - 4992*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 576*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 768*cx0*cy2*w0*pow(w1, 3)*w2 - 1248*cx0*cy3*pow(w0, 3)*w1*w3 + 144*cx0*cy3*pow(w0, 3)*w2*w3 + 768*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 48*cx0*cy4*pow(w0, 3)*w1*w4 + 4368*cx1*cy0*pow(w0, 3)*w1*w2 - 1248*cx1*cy0*pow(w0, 3)*w1*w3 + 48*cx1*cy0*pow(w0, 3)*w1*w4 - 4992*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 768*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 576*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 768*cx1*cy0*w0*pow(w1, 3)*w2 - 4368*cx1*cy2*pow(w0, 3)*w1*w2 + 4992*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 576*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 768*cx1*cy2*w0*pow(w1, 3)*w2 + 1248*cx1*cy3*pow(w0, 3)*w1*w3 - 768*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 48*cx1*cy4*pow(w0, 3)*w1*w4 - 4368*cx2*cy0*pow(w0, 3)*w1*w2 + 144*cx2*cy0*pow(w0, 3)*w2*w3 + 4992*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 576*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 768*cx2*cy0*w0*pow(w1, 3)*w2 + 4368*cx2*cy1*pow(w0, 3)*w1*w2 - 4992*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 576*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 768*cx2*cy1*w0*pow(w1, 3)*w2 - 144*cx2*cy3*pow(w0, 3)*w2*w3 + 1248*cx3*cy0*pow(w0, 3)*w1*w3 - 144*cx3*cy0*pow(w0, 3)*w2*w3 - 768*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 1248*cx3*cy1*pow(w0, 3)*w1*w3 + 768*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 144*cx3*cy2*pow(w0, 3)*w2*w3 - 48*cx4*cy0*pow(w0, 3)*w1*w4 + 48*cx4*cy1*pow(w0, 3)*w1*w4,
-    17472*cx0*cy1*pow(w0, 3)*w1*w2 - 7488*cx0*cy1*pow(w0, 3)*w1*w3 + 576*cx0*cy1*pow(w0, 3)*w1*w4 - 29952*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 9216*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 384*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 6912*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 1536*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 9216*cx0*cy1*w0*pow(w1, 3)*w2 - 1536*cx0*cy1*w0*pow(w1, 3)*w3 - 2304*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 17472*cx0*cy2*pow(w0, 3)*w1*w2 + 1728*cx0*cy2*pow(w0, 3)*w2*w3 - 96*cx0*cy2*pow(w0, 3)*w2*w4 + 29952*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 6912*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 768*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 9216*cx0*cy2*w0*pow(w1, 3)*w2 + 2304*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 7488*cx0*cy3*pow(w0, 3)*w1*w3 - 1728*cx0*cy3*pow(w0, 3)*w2*w3 - 9216*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 2304*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 1536*cx0*cy3*w0*pow(w1, 3)*w3 - 576*cx0*cy4*pow(w0, 3)*w1*w4 + 96*cx0*cy4*pow(w0, 3)*w2*w4 + 384*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 17472*cx1*cy0*pow(w0, 3)*w1*w2 + 7488*cx1*cy0*pow(w0, 3)*w1*w3 - 576*cx1*cy0*pow(w0, 3)*w1*w4 + 29952*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 9216*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 384*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 6912*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 1536*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 9216*cx1*cy0*w0*pow(w1, 3)*w2 + 1536*cx1*cy0*w0*pow(w1, 3)*w3 + 2304*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 17472*cx1*cy2*pow(w0, 3)*w1*w2 - 29952*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 6912*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 576*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 9216*cx1*cy2*w0*pow(w1, 3)*w2 - 2304*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 7488*cx1*cy3*pow(w0, 3)*w1*w3 + 9216*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 960*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 1536*cx1*cy3*w0*pow(w1, 3)*w3 + 576*cx1*cy4*pow(w0, 3)*w1*w4 - 384*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 17472*cx2*cy0*pow(w0, 3)*w1*w2 - 1728*cx2*cy0*pow(w0, 3)*w2*w3 + 96*cx2*cy0*pow(w0, 3)*w2*w4 - 29952*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 6912*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 768*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 9216*cx2*cy0*w0*pow(w1, 3)*w2 - 2304*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 17472*cx2*cy1*pow(w0, 3)*w1*w2 + 29952*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 6912*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 576*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 9216*cx2*cy1*w0*pow(w1, 3)*w2 + 2304*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 1728*cx2*cy3*pow(w0, 3)*w2*w3 - 1344*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 96*cx2*cy4*pow(w0, 3)*w2*w4 - 7488*cx3*cy0*pow(w0, 3)*w1*w3 + 1728*cx3*cy0*pow(w0, 3)*w2*w3 + 9216*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 2304*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 1536*cx3*cy0*w0*pow(w1, 3)*w3 + 7488*cx3*cy1*pow(w0, 3)*w1*w3 - 9216*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 960*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 1536*cx3*cy1*w0*pow(w1, 3)*w3 - 1728*cx3*cy2*pow(w0, 3)*w2*w3 + 1344*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 576*cx4*cy0*pow(w0, 3)*w1*w4 - 96*cx4*cy0*pow(w0, 3)*w2*w4 - 384*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 576*cx4*cy1*pow(w0, 3)*w1*w4 + 384*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 96*cx4*cy2*pow(w0, 3)*w2*w4,
-    -48048*cx0*cy1*pow(w0, 3)*w1*w2 + 27456*cx0*cy1*pow(w0, 3)*w1*w3 - 3168*cx0*cy1*pow(w0, 3)*w1*w4 + 109824*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 50688*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 4224*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 38016*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 16896*cx0*cy1*pow(w0, 2)*w1*w2*w3 - 672*cx0*cy1*pow(w0, 2)*w1*w2*w4 - 768*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) - 50688*cx0*cy1*w0*pow(w1, 3)*w2 + 16896*cx0*cy1*w0*pow(w1, 3)*w3 - 768*cx0*cy1*w0*pow(w1, 3)*w4 + 25344*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 6144*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 1728*cx0*cy1*w0*w1*pow(w2, 3) + 48048*cx0*cy2*pow(w0, 3)*w1*w2 - 9504*cx0*cy2*pow(w0, 3)*w2*w3 + 1056*cx0*cy2*pow(w0, 3)*w2*w4 - 109824*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 38016*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 8448*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 672*cx0*cy2*pow(w0, 2)*w1*w2*w4 - 1728*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 50688*cx0*cy2*w0*pow(w1, 3)*w2 - 25344*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 768*cx0*cy2*w0*pow(w1, 2)*w2*w3 + 1728*cx0*cy2*w0*w1*pow(w2, 3) - 27456*cx0*cy3*pow(w0, 3)*w1*w3 + 9504*cx0*cy3*pow(w0, 3)*w2*w3 - 48*cx0*cy3*pow(w0, 3)*w3*w4 + 50688*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 25344*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 768*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) + 1728*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 16896*cx0*cy3*w0*pow(w1, 3)*w3 + 6912*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 3168*cx0*cy4*pow(w0, 3)*w1*w4 - 1056*cx0*cy4*pow(w0, 3)*w2*w4 + 48*cx0*cy4*pow(w0, 3)*w3*w4 - 4224*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 1344*cx0*cy4*pow(w0, 2)*w1*w2*w4 + 768*cx0*cy4*w0*pow(w1, 3)*w4 + 48048*cx1*cy0*pow(w0, 3)*w1*w2 - 27456*cx1*cy0*pow(w0, 3)*w1*w3 + 3168*cx1*cy0*pow(w0, 3)*w1*w4 - 109824*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 50688*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 4224*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 38016*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 16896*cx1*cy0*pow(w0, 2)*w1*w2*w3 + 672*cx1*cy0*pow(w0, 2)*w1*w2*w4 + 768*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) + 50688*cx1*cy0*w0*pow(w1, 3)*w2 - 16896*cx1*cy0*w0*pow(w1, 3)*w3 + 768*cx1*cy0*w0*pow(w1, 3)*w4 - 25344*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 6144*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 1728*cx1*cy0*w0*w1*pow(w2, 3) - 48048*cx1*cy2*pow(w0, 3)*w1*w2 + 109824*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 38016*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 6336*cx1*cy2*pow(w0, 2)*w1*w2*w3 - 240*cx1*cy2*pow(w0, 2)*w1*w2*w4 - 50688*cx1*cy2*w0*pow(w1, 3)*w2 + 25344*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 3072*cx1*cy2*w0*pow(w1, 2)*w2*w3 - 1728*cx1*cy2*w0*w1*pow(w2, 3) + 27456*cx1*cy3*pow(w0, 3)*w1*w3 - 50688*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 10560*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 768*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) + 16896*cx1*cy3*w0*pow(w1, 3)*w3 - 3072*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 3168*cx1*cy4*pow(w0, 3)*w1*w4 + 4224*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 432*cx1*cy4*pow(w0, 2)*w1*w2*w4 - 768*cx1*cy4*w0*pow(w1, 3)*w4 - 48048*cx2*cy0*pow(w0, 3)*w1*w2 + 9504*cx2*cy0*pow(w0, 3)*w2*w3 - 1056*cx2*cy0*pow(w0, 3)*w2*w4 + 109824*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 38016*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 8448*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 672*cx2*cy0*pow(w0, 2)*w1*w2*w4 + 1728*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 50688*cx2*cy0*w0*pow(w1, 3)*w2 + 25344*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) + 768*cx2*cy0*w0*pow(w1, 2)*w2*w3 - 1728*cx2*cy0*w0*w1*pow(w2, 3) + 48048*cx2*cy1*pow(w0, 3)*w1*w2 - 109824*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 38016*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 6336*cx2*cy1*pow(w0, 2)*w1*w2*w3 + 240*cx2*cy1*pow(w0, 2)*w1*w2*w4 + 50688*cx2*cy1*w0*pow(w1, 3)*w2 - 25344*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 3072*cx2*cy1*w0*pow(w1, 2)*w2*w3 + 1728*cx2*cy1*w0*w1*pow(w2, 3) - 9504*cx2*cy3*pow(w0, 3)*w2*w3 + 14784*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 1728*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 3840*cx2*cy3*w0*pow(w1, 2)*w2*w3 + 1056*cx2*cy4*pow(w0, 3)*w2*w4 - 912*cx2*cy4*pow(w0, 2)*w1*w2*w4 + 27456*cx3*cy0*pow(w0, 3)*w1*w3 - 9504*cx3*cy0*pow(w0, 3)*w2*w3 + 48*cx3*cy0*pow(w0, 3)*w3*w4 - 50688*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 25344*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 768*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) - 1728*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 16896*cx3*cy0*w0*pow(w1, 3)*w3 - 6912*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 27456*cx3*cy1*pow(w0, 3)*w1*w3 + 50688*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 10560*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 768*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) - 16896*cx3*cy1*w0*pow(w1, 3)*w3 + 3072*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 9504*cx3*cy2*pow(w0, 3)*w2*w3 - 14784*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 1728*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 3840*cx3*cy2*w0*pow(w1, 2)*w2*w3 - 48*cx3*cy4*pow(w0, 3)*w3*w4 - 3168*cx4*cy0*pow(w0, 3)*w1*w4 + 1056*cx4*cy0*pow(w0, 3)*w2*w4 - 48*cx4*cy0*pow(w0, 3)*w3*w4 + 4224*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 1344*cx4*cy0*pow(w0, 2)*w1*w2*w4 - 768*cx4*cy0*w0*pow(w1, 3)*w4 + 3168*cx4*cy1*pow(w0, 3)*w1*w4 - 4224*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 432*cx4*cy1*pow(w0, 2)*w1*w2*w4 + 768*cx4*cy1*w0*pow(w1, 3)*w4 - 1056*cx4*cy2*pow(w0, 3)*w2*w4 + 912*cx4*cy2*pow(w0, 2)*w1*w2*w4 + 48*cx4*cy3*pow(w0, 3)*w3*w4,
-    96096*cx0*cy1*pow(w0, 3)*w1*w2 - 68640*cx0*cy1*pow(w0, 3)*w1*w3 + 10560*cx0*cy1*pow(w0, 3)*w1*w4 - 274560*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 168960*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 21120*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 126720*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 84480*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 6720*cx0*cy1*pow(w0, 2)*w1*w2*w4 + 7680*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) - 576*cx0*cy1*pow(w0, 2)*w1*w3*w4 + 168960*cx0*cy1*w0*pow(w1, 3)*w2 - 84480*cx0*cy1*w0*pow(w1, 3)*w3 + 7680*cx0*cy1*w0*pow(w1, 3)*w4 - 126720*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) + 61440*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 2688*cx0*cy1*w0*pow(w1, 2)*w2*w4 - 3072*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) + 17280*cx0*cy1*w0*w1*pow(w2, 3) - 5760*cx0*cy1*w0*w1*pow(w2, 2)*w3 - 96096*cx0*cy2*pow(w0, 3)*w1*w2 + 31680*cx0*cy2*pow(w0, 3)*w2*w3 - 5280*cx0*cy2*pow(w0, 3)*w2*w4 + 274560*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 126720*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 42240*cx0*cy2*pow(w0, 2)*w1*w2*w3 + 6720*cx0*cy2*pow(w0, 2)*w1*w2*w4 + 17280*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 1152*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 - 1152*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) - 168960*cx0*cy2*w0*pow(w1, 3)*w2 + 126720*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 7680*cx0*cy2*w0*pow(w1, 2)*w2*w3 - 1152*cx0*cy2*w0*pow(w1, 2)*w2*w4 - 17280*cx0*cy2*w0*w1*pow(w2, 3) - 4608*cx0*cy2*w0*w1*pow(w2, 2)*w3 + 68640*cx0*cy3*pow(w0, 3)*w1*w3 - 31680*cx0*cy3*pow(w0, 3)*w2*w3 + 480*cx0*cy3*pow(w0, 3)*w3*w4 - 168960*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 126720*cx0*cy3*pow(w0, 2)*w1*w2*w3 - 7680*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) - 192*cx0*cy3*pow(w0, 2)*w1*w3*w4 - 17280*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 1152*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) + 84480*cx0*cy3*w0*pow(w1, 3)*w3 - 69120*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 3072*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) + 10368*cx0*cy3*w0*w1*pow(w2, 2)*w3 - 10560*cx0*cy4*pow(w0, 3)*w1*w4 + 5280*cx0*cy4*pow(w0, 3)*w2*w4 - 480*cx0*cy4*pow(w0, 3)*w3*w4 + 21120*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 13440*cx0*cy4*pow(w0, 2)*w1*w2*w4 + 768*cx0*cy4*pow(w0, 2)*w1*w3*w4 + 1152*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 7680*cx0*cy4*w0*pow(w1, 3)*w4 + 3840*cx0*cy4*w0*pow(w1, 2)*w2*w4 - 96096*cx1*cy0*pow(w0, 3)*w1*w2 + 68640*cx1*cy0*pow(w0, 3)*w1*w3 - 10560*cx1*cy0*pow(w0, 3)*w1*w4 + 274560*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 168960*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 21120*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 126720*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 84480*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 6720*cx1*cy0*pow(w0, 2)*w1*w2*w4 - 7680*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) + 576*cx1*cy0*pow(w0, 2)*w1*w3*w4 - 168960*cx1*cy0*w0*pow(w1, 3)*w2 + 84480*cx1*cy0*w0*pow(w1, 3)*w3 - 7680*cx1*cy0*w0*pow(w1, 3)*w4 + 126720*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) - 61440*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 2688*cx1*cy0*w0*pow(w1, 2)*w2*w4 + 3072*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) - 17280*cx1*cy0*w0*w1*pow(w2, 3) + 5760*cx1*cy0*w0*w1*pow(w2, 2)*w3 + 96096*cx1*cy2*pow(w0, 3)*w1*w2 - 274560*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 126720*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 31680*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 2400*cx1*cy2*pow(w0, 2)*w1*w2*w4 + 168960*cx1*cy2*w0*pow(w1, 3)*w2 - 126720*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) + 30720*cx1*cy2*w0*pow(w1, 2)*w2*w3 - 1536*cx1*cy2*w0*pow(w1, 2)*w2*w4 + 17280*cx1*cy2*w0*w1*pow(w2, 3) - 4608*cx1*cy2*w0*w1*pow(w2, 2)*w3 - 3072*cx1*cy2*pow(w1, 3)*w2*w3 - 68640*cx1*cy3*pow(w0, 3)*w1*w3 + 168960*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 52800*cx1*cy3*pow(w0, 2)*w1*w2*w3 + 7680*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) - 288*cx1*cy3*pow(w0, 2)*w1*w3*w4 - 84480*cx1*cy3*w0*pow(w1, 3)*w3 + 30720*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 3072*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) - 1152*cx1*cy3*w0*w1*pow(w2, 2)*w3 + 3072*cx1*cy3*pow(w1, 3)*w2*w3 + 10560*cx1*cy4*pow(w0, 3)*w1*w4 - 21120*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 4320*cx1*cy4*pow(w0, 2)*w1*w2*w4 - 288*cx1*cy4*pow(w0, 2)*w1*w3*w4 + 7680*cx1*cy4*w0*pow(w1, 3)*w4 - 1152*cx1*cy4*w0*pow(w1, 2)*w2*w4 + 96096*cx2*cy0*pow(w0, 3)*w1*w2 - 31680*cx2*cy0*pow(w0, 3)*w2*w3 + 5280*cx2*cy0*pow(w0, 3)*w2*w4 - 274560*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 126720*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 42240*cx2*cy0*pow(w0, 2)*w1*w2*w3 - 6720*cx2*cy0*pow(w0, 2)*w1*w2*w4 - 17280*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 1152*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 1152*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) + 168960*cx2*cy0*w0*pow(w1, 3)*w2 - 126720*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 7680*cx2*cy0*w0*pow(w1, 2)*w2*w3 + 1152*cx2*cy0*w0*pow(w1, 2)*w2*w4 + 17280*cx2*cy0*w0*w1*pow(w2, 3) + 4608*cx2*cy0*w0*w1*pow(w2, 2)*w3 - 96096*cx2*cy1*pow(w0, 3)*w1*w2 + 274560*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 126720*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 31680*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 2400*cx2*cy1*pow(w0, 2)*w1*w2*w4 - 168960*cx2*cy1*w0*pow(w1, 3)*w2 + 126720*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) - 30720*cx2*cy1*w0*pow(w1, 2)*w2*w3 + 1536*cx2*cy1*w0*pow(w1, 2)*w2*w4 - 17280*cx2*cy1*w0*w1*pow(w2, 3) + 4608*cx2*cy1*w0*w1*pow(w2, 2)*w3 + 3072*cx2*cy1*pow(w1, 3)*w2*w3 + 31680*cx2*cy3*pow(w0, 3)*w2*w3 - 73920*cx2*cy3*pow(w0, 2)*w1*w2*w3 + 17280*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 1152*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) + 38400*cx2*cy3*w0*pow(w1, 2)*w2*w3 - 9216*cx2*cy3*w0*w1*pow(w2, 2)*w3 - 3072*cx2*cy3*pow(w1, 3)*w2*w3 - 5280*cx2*cy4*pow(w0, 3)*w2*w4 + 9120*cx2*cy4*pow(w0, 2)*w1*w2*w4 - 1152*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 2688*cx2*cy4*w0*pow(w1, 2)*w2*w4 - 68640*cx3*cy0*pow(w0, 3)*w1*w3 + 31680*cx3*cy0*pow(w0, 3)*w2*w3 - 480*cx3*cy0*pow(w0, 3)*w3*w4 + 168960*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 126720*cx3*cy0*pow(w0, 2)*w1*w2*w3 + 7680*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) + 192*cx3*cy0*pow(w0, 2)*w1*w3*w4 + 17280*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 1152*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) - 84480*cx3*cy0*w0*pow(w1, 3)*w3 + 69120*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 3072*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) - 10368*cx3*cy0*w0*w1*pow(w2, 2)*w3 + 68640*cx3*cy1*pow(w0, 3)*w1*w3 - 168960*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 52800*cx3*cy1*pow(w0, 2)*w1*w2*w3 - 7680*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) + 288*cx3*cy1*pow(w0, 2)*w1*w3*w4 + 84480*cx3*cy1*w0*pow(w1, 3)*w3 - 30720*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 3072*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) + 1152*cx3*cy1*w0*w1*pow(w2, 2)*w3 - 3072*cx3*cy1*pow(w1, 3)*w2*w3 - 31680*cx3*cy2*pow(w0, 3)*w2*w3 + 73920*cx3*cy2*pow(w0, 2)*w1*w2*w3 - 17280*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 1152*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) - 38400*cx3*cy2*w0*pow(w1, 2)*w2*w3 + 9216*cx3*cy2*w0*w1*pow(w2, 2)*w3 + 3072*cx3*cy2*pow(w1, 3)*w2*w3 + 480*cx3*cy4*pow(w0, 3)*w3*w4 - 480*cx3*cy4*pow(w0, 2)*w1*w3*w4 + 10560*cx4*cy0*pow(w0, 3)*w1*w4 - 5280*cx4*cy0*pow(w0, 3)*w2*w4 + 480*cx4*cy0*pow(w0, 3)*w3*w4 - 21120*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 13440*cx4*cy0*pow(w0, 2)*w1*w2*w4 - 768*cx4*cy0*pow(w0, 2)*w1*w3*w4 - 1152*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 7680*cx4*cy0*w0*pow(w1, 3)*w4 - 3840*cx4*cy0*w0*pow(w1, 2)*w2*w4 - 10560*cx4*cy1*pow(w0, 3)*w1*w4 + 21120*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 4320*cx4*cy1*pow(w0, 2)*w1*w2*w4 + 288*cx4*cy1*pow(w0, 2)*w1*w3*w4 - 7680*cx4*cy1*w0*pow(w1, 3)*w4 + 1152*cx4*cy1*w0*pow(w1, 2)*w2*w4 + 5280*cx4*cy2*pow(w0, 3)*w2*w4 - 9120*cx4*cy2*pow(w0, 2)*w1*w2*w4 + 1152*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 2688*cx4*cy2*w0*pow(w1, 2)*w2*w4 - 480*cx4*cy3*pow(w0, 3)*w3*w4 + 480*cx4*cy3*pow(w0, 2)*w1*w3*w4,
-    -144144*cx0*cy1*pow(w0, 3)*w1*w2 + 123552*cx0*cy1*pow(w0, 3)*w1*w3 - 23760*cx0*cy1*pow(w0, 3)*w1*w4 + 494208*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 380160*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 63360*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 285120*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 253440*cx0*cy1*pow(w0, 2)*w1*w2*w3 - 30240*cx0*cy1*pow(w0, 2)*w1*w2*w4 - 34560*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) + 5184*cx0*cy1*pow(w0, 2)*w1*w3*w4 - 96*cx0*cy1*pow(w0, 2)*w1*pow(w4, 2) - 380160*cx0*cy1*w0*pow(w1, 3)*w2 + 253440*cx0*cy1*w0*pow(w1, 3)*w3 - 34560*cx0*cy1*w0*pow(w1, 3)*w4 + 380160*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 276480*cx0*cy1*w0*pow(w1, 2)*w2*w3 + 24192*cx0*cy1*w0*pow(w1, 2)*w2*w4 + 27648*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) - 2304*cx0*cy1*w0*pow(w1, 2)*w3*w4 - 77760*cx0*cy1*w0*w1*pow(w2, 3) + 51840*cx0*cy1*w0*w1*pow(w2, 2)*w3 - 2304*cx0*cy1*w0*w1*pow(w2, 2)*w4 - 5376*cx0*cy1*w0*w1*w2*pow(w3, 2) + 144144*cx0*cy2*pow(w0, 3)*w1*w2 - 71280*cx0*cy2*pow(w0, 3)*w2*w3 + 15840*cx0*cy2*pow(w0, 3)*w2*w4 - 494208*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 285120*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 126720*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 30240*cx0*cy2*pow(w0, 2)*w1*w2*w4 - 77760*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 10368*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 10368*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) - 1056*cx0*cy2*pow(w0, 2)*w2*w3*w4 + 380160*cx0*cy2*w0*pow(w1, 3)*w2 - 380160*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 34560*cx0*cy2*w0*pow(w1, 2)*w2*w3 + 10368*cx0*cy2*w0*pow(w1, 2)*w2*w4 + 77760*cx0*cy2*w0*w1*pow(w2, 3) + 41472*cx0*cy2*w0*w1*pow(w2, 2)*w3 - 4032*cx0*cy2*w0*w1*pow(w2, 2)*w4 - 3840*cx0*cy2*w0*w1*w2*pow(w3, 2) - 5184*cx0*cy2*w0*pow(w2, 3)*w3 - 123552*cx0*cy3*pow(w0, 3)*w1*w3 + 71280*cx0*cy3*pow(w0, 3)*w2*w3 - 2160*cx0*cy3*pow(w0, 3)*w3*w4 + 380160*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 380160*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 34560*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) + 1728*cx0*cy3*pow(w0, 2)*w1*w3*w4 + 77760*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 10368*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) - 288*cx0*cy3*pow(w0, 2)*w2*w3*w4 - 253440*cx0*cy3*w0*pow(w1, 3)*w3 + 311040*cx0*cy3*w0*pow(w1, 2)*w2*w3 - 27648*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) - 93312*cx0*cy3*w0*w1*pow(w2, 2)*w3 + 9216*cx0*cy3*w0*w1*w2*pow(w3, 2) + 5184*cx0*cy3*w0*pow(w2, 3)*w3 + 23760*cx0*cy4*pow(w0, 3)*w1*w4 - 15840*cx0*cy4*pow(w0, 3)*w2*w4 + 2160*cx0*cy4*pow(w0, 3)*w3*w4 - 63360*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 60480*cx0*cy4*pow(w0, 2)*w1*w2*w4 - 6912*cx0*cy4*pow(w0, 2)*w1*w3*w4 + 96*cx0*cy4*pow(w0, 2)*w1*pow(w4, 2) - 10368*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 + 1344*cx0*cy4*pow(w0, 2)*w2*w3*w4 + 34560*cx0*cy4*w0*pow(w1, 3)*w4 - 34560*cx0*cy4*w0*pow(w1, 2)*w2*w4 + 2304*cx0*cy4*w0*pow(w1, 2)*w3*w4 + 6336*cx0*cy4*w0*w1*pow(w2, 2)*w4 + 144144*cx1*cy0*pow(w0, 3)*w1*w2 - 123552*cx1*cy0*pow(w0, 3)*w1*w3 + 23760*cx1*cy0*pow(w0, 3)*w1*w4 - 494208*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 380160*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 63360*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 285120*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 253440*cx1*cy0*pow(w0, 2)*w1*w2*w3 + 30240*cx1*cy0*pow(w0, 2)*w1*w2*w4 + 34560*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) - 5184*cx1*cy0*pow(w0, 2)*w1*w3*w4 + 96*cx1*cy0*pow(w0, 2)*w1*pow(w4, 2) + 380160*cx1*cy0*w0*pow(w1, 3)*w2 - 253440*cx1*cy0*w0*pow(w1, 3)*w3 + 34560*cx1*cy0*w0*pow(w1, 3)*w4 - 380160*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 276480*cx1*cy0*w0*pow(w1, 2)*w2*w3 - 24192*cx1*cy0*w0*pow(w1, 2)*w2*w4 - 27648*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) + 2304*cx1*cy0*w0*pow(w1, 2)*w3*w4 + 77760*cx1*cy0*w0*w1*pow(w2, 3) - 51840*cx1*cy0*w0*w1*pow(w2, 2)*w3 + 2304*cx1*cy0*w0*w1*pow(w2, 2)*w4 + 5376*cx1*cy0*w0*w1*w2*pow(w3, 2) - 144144*cx1*cy2*pow(w0, 3)*w1*w2 + 494208*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 285120*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 95040*cx1*cy2*pow(w0, 2)*w1*w2*w3 - 10800*cx1*cy2*pow(w0, 2)*w1*w2*w4 - 380160*cx1*cy2*w0*pow(w1, 3)*w2 + 380160*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 138240*cx1*cy2*w0*pow(w1, 2)*w2*w3 + 13824*cx1*cy2*w0*pow(w1, 2)*w2*w4 - 77760*cx1*cy2*w0*w1*pow(w2, 3) + 41472*cx1*cy2*w0*w1*pow(w2, 2)*w3 - 2304*cx1*cy2*w0*w1*pow(w2, 2)*w4 - 2304*cx1*cy2*w0*w1*w2*pow(w3, 2) + 27648*cx1*cy2*pow(w1, 3)*w2*w3 - 2304*cx1*cy2*pow(w1, 3)*w2*w4 - 9216*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 123552*cx1*cy3*pow(w0, 3)*w1*w3 - 380160*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 158400*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 34560*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) + 2592*cx1*cy3*pow(w0, 2)*w1*w3*w4 + 253440*cx1*cy3*w0*pow(w1, 3)*w3 - 138240*cx1*cy3*w0*pow(w1, 2)*w2*w3 + 27648*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) - 1536*cx1*cy3*w0*pow(w1, 2)*w3*w4 + 10368*cx1*cy3*w0*w1*pow(w2, 2)*w3 - 3072*cx1*cy3*w0*w1*w2*pow(w3, 2) - 27648*cx1*cy3*pow(w1, 3)*w2*w3 + 9216*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 23760*cx1*cy4*pow(w0, 3)*w1*w4 + 63360*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 19440*cx1*cy4*pow(w0, 2)*w1*w2*w4 + 2592*cx1*cy4*pow(w0, 2)*w1*w3*w4 - 96*cx1*cy4*pow(w0, 2)*w1*pow(w4, 2) - 34560*cx1*cy4*w0*pow(w1, 3)*w4 + 10368*cx1*cy4*w0*pow(w1, 2)*w2*w4 - 768*cx1*cy4*w0*pow(w1, 2)*w3*w4 + 2304*cx1*cy4*pow(w1, 3)*w2*w4 - 144144*cx2*cy0*pow(w0, 3)*w1*w2 + 71280*cx2*cy0*pow(w0, 3)*w2*w3 - 15840*cx2*cy0*pow(w0, 3)*w2*w4 + 494208*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 285120*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 126720*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 30240*cx2*cy0*pow(w0, 2)*w1*w2*w4 + 77760*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 10368*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 10368*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) + 1056*cx2*cy0*pow(w0, 2)*w2*w3*w4 - 380160*cx2*cy0*w0*pow(w1, 3)*w2 + 380160*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) + 34560*cx2*cy0*w0*pow(w1, 2)*w2*w3 - 10368*cx2*cy0*w0*pow(w1, 2)*w2*w4 - 77760*cx2*cy0*w0*w1*pow(w2, 3) - 41472*cx2*cy0*w0*w1*pow(w2, 2)*w3 + 4032*cx2*cy0*w0*w1*pow(w2, 2)*w4 + 3840*cx2*cy0*w0*w1*w2*pow(w3, 2) + 5184*cx2*cy0*w0*pow(w2, 3)*w3 + 144144*cx2*cy1*pow(w0, 3)*w1*w2 - 494208*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 285120*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 95040*cx2*cy1*pow(w0, 2)*w1*w2*w3 + 10800*cx2*cy1*pow(w0, 2)*w1*w2*w4 + 380160*cx2*cy1*w0*pow(w1, 3)*w2 - 380160*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 138240*cx2*cy1*w0*pow(w1, 2)*w2*w3 - 13824*cx2*cy1*w0*pow(w1, 2)*w2*w4 + 77760*cx2*cy1*w0*w1*pow(w2, 3) - 41472*cx2*cy1*w0*w1*pow(w2, 2)*w3 + 2304*cx2*cy1*w0*w1*pow(w2, 2)*w4 + 2304*cx2*cy1*w0*w1*w2*pow(w3, 2) - 27648*cx2*cy1*pow(w1, 3)*w2*w3 + 2304*cx2*cy1*pow(w1, 3)*w2*w4 + 9216*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 71280*cx2*cy3*pow(w0, 3)*w2*w3 + 221760*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 77760*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 10368*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) - 336*cx2*cy3*pow(w0, 2)*w2*w3*w4 - 172800*cx2*cy3*w0*pow(w1, 2)*w2*w3 + 82944*cx2*cy3*w0*w1*pow(w2, 2)*w3 - 6144*cx2*cy3*w0*w1*w2*pow(w3, 2) - 5184*cx2*cy3*w0*pow(w2, 3)*w3 + 27648*cx2*cy3*pow(w1, 3)*w2*w3 - 9216*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 15840*cx2*cy4*pow(w0, 3)*w2*w4 - 41040*cx2*cy4*pow(w0, 2)*w1*w2*w4 + 10368*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 720*cx2*cy4*pow(w0, 2)*w2*w3*w4 + 24192*cx2*cy4*w0*pow(w1, 2)*w2*w4 - 6336*cx2*cy4*w0*w1*pow(w2, 2)*w4 - 2304*cx2*cy4*pow(w1, 3)*w2*w4 + 123552*cx3*cy0*pow(w0, 3)*w1*w3 - 71280*cx3*cy0*pow(w0, 3)*w2*w3 + 2160*cx3*cy0*pow(w0, 3)*w3*w4 - 380160*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 380160*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 34560*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) - 1728*cx3*cy0*pow(w0, 2)*w1*w3*w4 - 77760*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 10368*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) + 288*cx3*cy0*pow(w0, 2)*w2*w3*w4 + 253440*cx3*cy0*w0*pow(w1, 3)*w3 - 311040*cx3*cy0*w0*pow(w1, 2)*w2*w3 + 27648*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) + 93312*cx3*cy0*w0*w1*pow(w2, 2)*w3 - 9216*cx3*cy0*w0*w1*w2*pow(w3, 2) - 5184*cx3*cy0*w0*pow(w2, 3)*w3 - 123552*cx3*cy1*pow(w0, 3)*w1*w3 + 380160*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 158400*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 34560*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) - 2592*cx3*cy1*pow(w0, 2)*w1*w3*w4 - 253440*cx3*cy1*w0*pow(w1, 3)*w3 + 138240*cx3*cy1*w0*pow(w1, 2)*w2*w3 - 27648*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) + 1536*cx3*cy1*w0*pow(w1, 2)*w3*w4 - 10368*cx3*cy1*w0*w1*pow(w2, 2)*w3 + 3072*cx3*cy1*w0*w1*w2*pow(w3, 2) + 27648*cx3*cy1*pow(w1, 3)*w2*w3 - 9216*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 71280*cx3*cy2*pow(w0, 3)*w2*w3 - 221760*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 77760*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 10368*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) + 336*cx3*cy2*pow(w0, 2)*w2*w3*w4 + 172800*cx3*cy2*w0*pow(w1, 2)*w2*w3 - 82944*cx3*cy2*w0*w1*pow(w2, 2)*w3 + 6144*cx3*cy2*w0*w1*w2*pow(w3, 2) + 5184*cx3*cy2*w0*pow(w2, 3)*w3 - 27648*cx3*cy2*pow(w1, 3)*w2*w3 + 9216*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 2160*cx3*cy4*pow(w0, 3)*w3*w4 + 4320*cx3*cy4*pow(w0, 2)*w1*w3*w4 - 624*cx3*cy4*pow(w0, 2)*w2*w3*w4 - 1536*cx3*cy4*w0*pow(w1, 2)*w3*w4 - 23760*cx4*cy0*pow(w0, 3)*w1*w4 + 15840*cx4*cy0*pow(w0, 3)*w2*w4 - 2160*cx4*cy0*pow(w0, 3)*w3*w4 + 63360*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 60480*cx4*cy0*pow(w0, 2)*w1*w2*w4 + 6912*cx4*cy0*pow(w0, 2)*w1*w3*w4 - 96*cx4*cy0*pow(w0, 2)*w1*pow(w4, 2) + 10368*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 1344*cx4*cy0*pow(w0, 2)*w2*w3*w4 - 34560*cx4*cy0*w0*pow(w1, 3)*w4 + 34560*cx4*cy0*w0*pow(w1, 2)*w2*w4 - 2304*cx4*cy0*w0*pow(w1, 2)*w3*w4 - 6336*cx4*cy0*w0*w1*pow(w2, 2)*w4 + 23760*cx4*cy1*pow(w0, 3)*w1*w4 - 63360*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 19440*cx4*cy1*pow(w0, 2)*w1*w2*w4 - 2592*cx4*cy1*pow(w0, 2)*w1*w3*w4 + 96*cx4*cy1*pow(w0, 2)*w1*pow(w4, 2) + 34560*cx4*cy1*w0*pow(w1, 3)*w4 - 10368*cx4*cy1*w0*pow(w1, 2)*w2*w4 + 768*cx4*cy1*w0*pow(w1, 2)*w3*w4 - 2304*cx4*cy1*pow(w1, 3)*w2*w4 - 15840*cx4*cy2*pow(w0, 3)*w2*w4 + 41040*cx4*cy2*pow(w0, 2)*w1*w2*w4 - 10368*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 720*cx4*cy2*pow(w0, 2)*w2*w3*w4 - 24192*cx4*cy2*w0*pow(w1, 2)*w2*w4 + 6336*cx4*cy2*w0*w1*pow(w2, 2)*w4 + 2304*cx4*cy2*pow(w1, 3)*w2*w4 + 2160*cx4*cy3*pow(w0, 3)*w3*w4 - 4320*cx4*cy3*pow(w0, 2)*w1*w3*w4 + 624*cx4*cy3*pow(w0, 2)*w2*w3*w4 + 1536*cx4*cy3*w0*pow(w1, 2)*w3*w4,
-    164736*cx0*cy1*pow(w0, 3)*w1*w2 - 164736*cx0*cy1*pow(w0, 3)*w1*w3 + 38016*cx0*cy1*pow(w0, 3)*w1*w4 - 658944*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 608256*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 126720*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 456192*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 506880*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 80640*cx0*cy1*pow(w0, 2)*w1*w2*w4 + 92160*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) - 20736*cx0*cy1*pow(w0, 2)*w1*w3*w4 + 768*cx0*cy1*pow(w0, 2)*w1*pow(w4, 2) + 608256*cx0*cy1*w0*pow(w1, 3)*w2 - 506880*cx0*cy1*w0*pow(w1, 3)*w3 + 92160*cx0*cy1*w0*pow(w1, 3)*w4 - 760320*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) + 737280*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 96768*cx0*cy1*w0*pow(w1, 2)*w2*w4 - 110592*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) + 18432*cx0*cy1*w0*pow(w1, 2)*w3*w4 - 384*cx0*cy1*w0*pow(w1, 2)*pow(w4, 2) + 207360*cx0*cy1*w0*w1*pow(w2, 3) - 207360*cx0*cy1*w0*w1*pow(w2, 2)*w3 + 18432*cx0*cy1*w0*w1*pow(w2, 2)*w4 + 43008*cx0*cy1*w0*w1*w2*pow(w3, 2) - 3840*cx0*cy1*w0*w1*w2*w3*w4 - 1536*cx0*cy1*w0*w1*pow(w3, 3) - 164736*cx0*cy2*pow(w0, 3)*w1*w2 + 114048*cx0*cy2*pow(w0, 3)*w2*w3 - 31680*cx0*cy2*pow(w0, 3)*w2*w4 + 658944*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 456192*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 253440*cx0*cy2*pow(w0, 2)*w1*w2*w3 + 80640*cx0*cy2*pow(w0, 2)*w1*w2*w4 + 207360*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 41472*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 - 41472*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) + 8448*cx0*cy2*pow(w0, 2)*w2*w3*w4 - 192*cx0*cy2*pow(w0, 2)*w2*pow(w4, 2) - 608256*cx0*cy2*w0*pow(w1, 3)*w2 + 760320*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 92160*cx0*cy2*w0*pow(w1, 2)*w2*w3 - 41472*cx0*cy2*w0*pow(w1, 2)*w2*w4 - 207360*cx0*cy2*w0*w1*pow(w2, 3) - 165888*cx0*cy2*w0*w1*pow(w2, 2)*w3 + 32256*cx0*cy2*w0*w1*pow(w2, 2)*w4 + 30720*cx0*cy2*w0*w1*w2*pow(w3, 2) - 3840*cx0*cy2*w0*w1*w2*w3*w4 + 41472*cx0*cy2*w0*pow(w2, 3)*w3 - 3456*cx0*cy2*w0*pow(w2, 3)*w4 - 6912*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) + 164736*cx0*cy3*pow(w0, 3)*w1*w3 - 114048*cx0*cy3*pow(w0, 3)*w2*w3 + 5760*cx0*cy3*pow(w0, 3)*w3*w4 - 608256*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 760320*cx0*cy3*pow(w0, 2)*w1*w2*w3 - 92160*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) - 6912*cx0*cy3*pow(w0, 2)*w1*w3*w4 - 207360*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 41472*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) + 2304*cx0*cy3*pow(w0, 2)*w2*w3*w4 - 384*cx0*cy3*pow(w0, 2)*pow(w3, 2)*w4 + 506880*cx0*cy3*w0*pow(w1, 3)*w3 - 829440*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 110592*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) + 373248*cx0*cy3*w0*w1*pow(w2, 2)*w3 - 73728*cx0*cy3*w0*w1*w2*pow(w3, 2) + 1536*cx0*cy3*w0*w1*pow(w3, 3) - 41472*cx0*cy3*w0*pow(w2, 3)*w3 + 6912*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) - 38016*cx0*cy4*pow(w0, 3)*w1*w4 + 31680*cx0*cy4*pow(w0, 3)*w2*w4 - 5760*cx0*cy4*pow(w0, 3)*w3*w4 + 126720*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 161280*cx0*cy4*pow(w0, 2)*w1*w2*w4 + 27648*cx0*cy4*pow(w0, 2)*w1*w3*w4 - 768*cx0*cy4*pow(w0, 2)*w1*pow(w4, 2) + 41472*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 10752*cx0*cy4*pow(w0, 2)*w2*w3*w4 + 192*cx0*cy4*pow(w0, 2)*w2*pow(w4, 2) + 384*cx0*cy4*pow(w0, 2)*pow(w3, 2)*w4 - 92160*cx0*cy4*w0*pow(w1, 3)*w4 + 138240*cx0*cy4*w0*pow(w1, 2)*w2*w4 - 18432*cx0*cy4*w0*pow(w1, 2)*w3*w4 + 384*cx0*cy4*w0*pow(w1, 2)*pow(w4, 2) - 50688*cx0*cy4*w0*w1*pow(w2, 2)*w4 + 7680*cx0*cy4*w0*w1*w2*w3*w4 + 3456*cx0*cy4*w0*pow(w2, 3)*w4 - 164736*cx1*cy0*pow(w0, 3)*w1*w2 + 164736*cx1*cy0*pow(w0, 3)*w1*w3 - 38016*cx1*cy0*pow(w0, 3)*w1*w4 + 658944*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 608256*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 126720*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 456192*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 506880*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 80640*cx1*cy0*pow(w0, 2)*w1*w2*w4 - 92160*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) + 20736*cx1*cy0*pow(w0, 2)*w1*w3*w4 - 768*cx1*cy0*pow(w0, 2)*w1*pow(w4, 2) - 608256*cx1*cy0*w0*pow(w1, 3)*w2 + 506880*cx1*cy0*w0*pow(w1, 3)*w3 - 92160*cx1*cy0*w0*pow(w1, 3)*w4 + 760320*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) - 737280*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 96768*cx1*cy0*w0*pow(w1, 2)*w2*w4 + 110592*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) - 18432*cx1*cy0*w0*pow(w1, 2)*w3*w4 + 384*cx1*cy0*w0*pow(w1, 2)*pow(w4, 2) - 207360*cx1*cy0*w0*w1*pow(w2, 3) + 207360*cx1*cy0*w0*w1*pow(w2, 2)*w3 - 18432*cx1*cy0*w0*w1*pow(w2, 2)*w4 - 43008*cx1*cy0*w0*w1*w2*pow(w3, 2) + 3840*cx1*cy0*w0*w1*w2*w3*w4 + 1536*cx1*cy0*w0*w1*pow(w3, 3) + 164736*cx1*cy2*pow(w0, 3)*w1*w2 - 658944*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 456192*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 190080*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 28800*cx1*cy2*pow(w0, 2)*w1*w2*w4 + 608256*cx1*cy2*w0*pow(w1, 3)*w2 - 760320*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) + 368640*cx1*cy2*w0*pow(w1, 2)*w2*w3 - 55296*cx1*cy2*w0*pow(w1, 2)*w2*w4 + 207360*cx1*cy2*w0*w1*pow(w2, 3) - 165888*cx1*cy2*w0*w1*pow(w2, 2)*w3 + 18432*cx1*cy2*w0*w1*pow(w2, 2)*w4 + 18432*cx1*cy2*w0*w1*w2*pow(w3, 2) - 1920*cx1*cy2*w0*w1*w2*w3*w4 - 110592*cx1*cy2*pow(w1, 3)*w2*w3 + 18432*cx1*cy2*pow(w1, 3)*w2*w4 + 73728*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 6912*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w4 - 6144*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) - 6912*cx1*cy2*w1*pow(w2, 3)*w3 - 164736*cx1*cy3*pow(w0, 3)*w1*w3 + 608256*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 316800*cx1*cy3*pow(w0, 2)*w1*w2*w3 + 92160*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) - 10368*cx1*cy3*pow(w0, 2)*w1*w3*w4 - 506880*cx1*cy3*w0*pow(w1, 3)*w3 + 368640*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 110592*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) + 12288*cx1*cy3*w0*pow(w1, 2)*w3*w4 - 41472*cx1*cy3*w0*w1*pow(w2, 2)*w3 + 24576*cx1*cy3*w0*w1*w2*pow(w3, 2) - 1920*cx1*cy3*w0*w1*w2*w3*w4 - 1536*cx1*cy3*w0*w1*pow(w3, 3) + 110592*cx1*cy3*pow(w1, 3)*w2*w3 - 1536*cx1*cy3*pow(w1, 3)*w3*w4 - 73728*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 6144*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) + 6912*cx1*cy3*w1*pow(w2, 3)*w3 + 38016*cx1*cy4*pow(w0, 3)*w1*w4 - 126720*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 51840*cx1*cy4*pow(w0, 2)*w1*w2*w4 - 10368*cx1*cy4*pow(w0, 2)*w1*w3*w4 + 768*cx1*cy4*pow(w0, 2)*w1*pow(w4, 2) + 92160*cx1*cy4*w0*pow(w1, 3)*w4 - 41472*cx1*cy4*w0*pow(w1, 2)*w2*w4 + 6144*cx1*cy4*w0*pow(w1, 2)*w3*w4 - 384*cx1*cy4*w0*pow(w1, 2)*pow(w4, 2) - 18432*cx1*cy4*pow(w1, 3)*w2*w4 + 1536*cx1*cy4*pow(w1, 3)*w3*w4 + 6912*cx1*cy4*pow(w1, 2)*pow(w2, 2)*w4 + 164736*cx2*cy0*pow(w0, 3)*w1*w2 - 114048*cx2*cy0*pow(w0, 3)*w2*w3 + 31680*cx2*cy0*pow(w0, 3)*w2*w4 - 658944*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 456192*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 253440*cx2*cy0*pow(w0, 2)*w1*w2*w3 - 80640*cx2*cy0*pow(w0, 2)*w1*w2*w4 - 207360*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 41472*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 41472*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) - 8448*cx2*cy0*pow(w0, 2)*w2*w3*w4 + 192*cx2*cy0*pow(w0, 2)*w2*pow(w4, 2) + 608256*cx2*cy0*w0*pow(w1, 3)*w2 - 760320*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 92160*cx2*cy0*w0*pow(w1, 2)*w2*w3 + 41472*cx2*cy0*w0*pow(w1, 2)*w2*w4 + 207360*cx2*cy0*w0*w1*pow(w2, 3) + 165888*cx2*cy0*w0*w1*pow(w2, 2)*w3 - 32256*cx2*cy0*w0*w1*pow(w2, 2)*w4 - 30720*cx2*cy0*w0*w1*w2*pow(w3, 2) + 3840*cx2*cy0*w0*w1*w2*w3*w4 - 41472*cx2*cy0*w0*pow(w2, 3)*w3 + 3456*cx2*cy0*w0*pow(w2, 3)*w4 + 6912*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) - 164736*cx2*cy1*pow(w0, 3)*w1*w2 + 658944*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 456192*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 190080*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 28800*cx2*cy1*pow(w0, 2)*w1*w2*w4 - 608256*cx2*cy1*w0*pow(w1, 3)*w2 + 760320*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) - 368640*cx2*cy1*w0*pow(w1, 2)*w2*w3 + 55296*cx2*cy1*w0*pow(w1, 2)*w2*w4 - 207360*cx2*cy1*w0*w1*pow(w2, 3) + 165888*cx2*cy1*w0*w1*pow(w2, 2)*w3 - 18432*cx2*cy1*w0*w1*pow(w2, 2)*w4 - 18432*cx2*cy1*w0*w1*w2*pow(w3, 2) + 1920*cx2*cy1*w0*w1*w2*w3*w4 + 110592*cx2*cy1*pow(w1, 3)*w2*w3 - 18432*cx2*cy1*pow(w1, 3)*w2*w4 - 73728*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 6912*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w4 + 6144*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) + 6912*cx2*cy1*w1*pow(w2, 3)*w3 + 114048*cx2*cy3*pow(w0, 3)*w2*w3 - 443520*cx2*cy3*pow(w0, 2)*w1*w2*w3 + 207360*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 41472*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) + 2688*cx2*cy3*pow(w0, 2)*w2*w3*w4 + 460800*cx2*cy3*w0*pow(w1, 2)*w2*w3 - 331776*cx2*cy3*w0*w1*pow(w2, 2)*w3 + 49152*cx2*cy3*w0*w1*w2*pow(w3, 2) - 1920*cx2*cy3*w0*w1*w2*w3*w4 + 41472*cx2*cy3*w0*pow(w2, 3)*w3 - 6912*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) - 110592*cx2*cy3*pow(w1, 3)*w2*w3 + 73728*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 6144*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) - 6912*cx2*cy3*w1*pow(w2, 3)*w3 - 31680*cx2*cy4*pow(w0, 3)*w2*w4 + 109440*cx2*cy4*pow(w0, 2)*w1*w2*w4 - 41472*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 + 5760*cx2*cy4*pow(w0, 2)*w2*w3*w4 - 192*cx2*cy4*pow(w0, 2)*w2*pow(w4, 2) - 96768*cx2*cy4*w0*pow(w1, 2)*w2*w4 + 50688*cx2*cy4*w0*w1*pow(w2, 2)*w4 - 3840*cx2*cy4*w0*w1*w2*w3*w4 - 3456*cx2*cy4*w0*pow(w2, 3)*w4 + 18432*cx2*cy4*pow(w1, 3)*w2*w4 - 6912*cx2*cy4*pow(w1, 2)*pow(w2, 2)*w4 - 164736*cx3*cy0*pow(w0, 3)*w1*w3 + 114048*cx3*cy0*pow(w0, 3)*w2*w3 - 5760*cx3*cy0*pow(w0, 3)*w3*w4 + 608256*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 760320*cx3*cy0*pow(w0, 2)*w1*w2*w3 + 92160*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) + 6912*cx3*cy0*pow(w0, 2)*w1*w3*w4 + 207360*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 41472*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) - 2304*cx3*cy0*pow(w0, 2)*w2*w3*w4 + 384*cx3*cy0*pow(w0, 2)*pow(w3, 2)*w4 - 506880*cx3*cy0*w0*pow(w1, 3)*w3 + 829440*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 110592*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) - 373248*cx3*cy0*w0*w1*pow(w2, 2)*w3 + 73728*cx3*cy0*w0*w1*w2*pow(w3, 2) - 1536*cx3*cy0*w0*w1*pow(w3, 3) + 41472*cx3*cy0*w0*pow(w2, 3)*w3 - 6912*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) + 164736*cx3*cy1*pow(w0, 3)*w1*w3 - 608256*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 316800*cx3*cy1*pow(w0, 2)*w1*w2*w3 - 92160*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) + 10368*cx3*cy1*pow(w0, 2)*w1*w3*w4 + 506880*cx3*cy1*w0*pow(w1, 3)*w3 - 368640*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 110592*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) - 12288*cx3*cy1*w0*pow(w1, 2)*w3*w4 + 41472*cx3*cy1*w0*w1*pow(w2, 2)*w3 - 24576*cx3*cy1*w0*w1*w2*pow(w3, 2) + 1920*cx3*cy1*w0*w1*w2*w3*w4 + 1536*cx3*cy1*w0*w1*pow(w3, 3) - 110592*cx3*cy1*pow(w1, 3)*w2*w3 + 1536*cx3*cy1*pow(w1, 3)*w3*w4 + 73728*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 6144*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) - 6912*cx3*cy1*w1*pow(w2, 3)*w3 - 114048*cx3*cy2*pow(w0, 3)*w2*w3 + 443520*cx3*cy2*pow(w0, 2)*w1*w2*w3 - 207360*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 41472*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) - 2688*cx3*cy2*pow(w0, 2)*w2*w3*w4 - 460800*cx3*cy2*w0*pow(w1, 2)*w2*w3 + 331776*cx3*cy2*w0*w1*pow(w2, 2)*w3 - 49152*cx3*cy2*w0*w1*w2*pow(w3, 2) + 1920*cx3*cy2*w0*w1*w2*w3*w4 - 41472*cx3*cy2*w0*pow(w2, 3)*w3 + 6912*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) + 110592*cx3*cy2*pow(w1, 3)*w2*w3 - 73728*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 6144*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) + 6912*cx3*cy2*w1*pow(w2, 3)*w3 + 5760*cx3*cy4*pow(w0, 3)*w3*w4 - 17280*cx3*cy4*pow(w0, 2)*w1*w3*w4 + 4992*cx3*cy4*pow(w0, 2)*w2*w3*w4 - 384*cx3*cy4*pow(w0, 2)*pow(w3, 2)*w4 + 12288*cx3*cy4*w0*pow(w1, 2)*w3*w4 - 3840*cx3*cy4*w0*w1*w2*w3*w4 - 1536*cx3*cy4*pow(w1, 3)*w3*w4 + 38016*cx4*cy0*pow(w0, 3)*w1*w4 - 31680*cx4*cy0*pow(w0, 3)*w2*w4 + 5760*cx4*cy0*pow(w0, 3)*w3*w4 - 126720*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 161280*cx4*cy0*pow(w0, 2)*w1*w2*w4 - 27648*cx4*cy0*pow(w0, 2)*w1*w3*w4 + 768*cx4*cy0*pow(w0, 2)*w1*pow(w4, 2) - 41472*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 10752*cx4*cy0*pow(w0, 2)*w2*w3*w4 - 192*cx4*cy0*pow(w0, 2)*w2*pow(w4, 2) - 384*cx4*cy0*pow(w0, 2)*pow(w3, 2)*w4 + 92160*cx4*cy0*w0*pow(w1, 3)*w4 - 138240*cx4*cy0*w0*pow(w1, 2)*w2*w4 + 18432*cx4*cy0*w0*pow(w1, 2)*w3*w4 - 384*cx4*cy0*w0*pow(w1, 2)*pow(w4, 2) + 50688*cx4*cy0*w0*w1*pow(w2, 2)*w4 - 7680*cx4*cy0*w0*w1*w2*w3*w4 - 3456*cx4*cy0*w0*pow(w2, 3)*w4 - 38016*cx4*cy1*pow(w0, 3)*w1*w4 + 126720*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 51840*cx4*cy1*pow(w0, 2)*w1*w2*w4 + 10368*cx4*cy1*pow(w0, 2)*w1*w3*w4 - 768*cx4*cy1*pow(w0, 2)*w1*pow(w4, 2) - 92160*cx4*cy1*w0*pow(w1, 3)*w4 + 41472*cx4*cy1*w0*pow(w1, 2)*w2*w4 - 6144*cx4*cy1*w0*pow(w1, 2)*w3*w4 + 384*cx4*cy1*w0*pow(w1, 2)*pow(w4, 2) + 18432*cx4*cy1*pow(w1, 3)*w2*w4 - 1536*cx4*cy1*pow(w1, 3)*w3*w4 - 6912*cx4*cy1*pow(w1, 2)*pow(w2, 2)*w4 + 31680*cx4*cy2*pow(w0, 3)*w2*w4 - 109440*cx4*cy2*pow(w0, 2)*w1*w2*w4 + 41472*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 - 5760*cx4*cy2*pow(w0, 2)*w2*w3*w4 + 192*cx4*cy2*pow(w0, 2)*w2*pow(w4, 2) + 96768*cx4*cy2*w0*pow(w1, 2)*w2*w4 - 50688*cx4*cy2*w0*w1*pow(w2, 2)*w4 + 3840*cx4*cy2*w0*w1*w2*w3*w4 + 3456*cx4*cy2*w0*pow(w2, 3)*w4 - 18432*cx4*cy2*pow(w1, 3)*w2*w4 + 6912*cx4*cy2*pow(w1, 2)*pow(w2, 2)*w4 - 5760*cx4*cy3*pow(w0, 3)*w3*w4 + 17280*cx4*cy3*pow(w0, 2)*w1*w3*w4 - 4992*cx4*cy3*pow(w0, 2)*w2*w3*w4 + 384*cx4*cy3*pow(w0, 2)*pow(w3, 2)*w4 - 12288*cx4*cy3*w0*pow(w1, 2)*w3*w4 + 3840*cx4*cy3*w0*w1*w2*w3*w4 + 1536*cx4*cy3*pow(w1, 3)*w3*w4,
-    -144144*cx0*cy1*pow(w0, 3)*w1*w2 + 164736*cx0*cy1*pow(w0, 3)*w1*w3 - 44352*cx0*cy1*pow(w0, 3)*w1*w4 + 658944*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 709632*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 177408*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 532224*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 709632*cx0*cy1*pow(w0, 2)*w1*w2*w3 - 141120*cx0*cy1*pow(w0, 2)*w1*w2*w4 - 161280*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) + 48384*cx0*cy1*pow(w0, 2)*w1*w3*w4 - 2688*cx0*cy1*pow(w0, 2)*w1*pow(w4, 2) - 709632*cx0*cy1*w0*pow(w1, 3)*w2 + 709632*cx0*cy1*w0*pow(w1, 3)*w3 - 161280*cx0*cy1*w0*pow(w1, 3)*w4 + 1064448*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 1290240*cx0*cy1*w0*pow(w1, 2)*w2*w3 + 225792*cx0*cy1*w0*pow(w1, 2)*w2*w4 + 258048*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) - 64512*cx0*cy1*w0*pow(w1, 2)*w3*w4 + 2688*cx0*cy1*w0*pow(w1, 2)*pow(w4, 2) - 362880*cx0*cy1*w0*w1*pow(w2, 3) + 483840*cx0*cy1*w0*w1*pow(w2, 2)*w3 - 64512*cx0*cy1*w0*w1*pow(w2, 2)*w4 - 150528*cx0*cy1*w0*w1*w2*pow(w3, 2) + 26880*cx0*cy1*w0*w1*w2*w3*w4 - 624*cx0*cy1*w0*w1*w2*pow(w4, 2) + 10752*cx0*cy1*w0*w1*pow(w3, 3) - 1536*cx0*cy1*w0*w1*pow(w3, 2)*w4 + 144144*cx0*cy2*pow(w0, 3)*w1*w2 - 133056*cx0*cy2*pow(w0, 3)*w2*w3 + 44352*cx0*cy2*pow(w0, 3)*w2*w4 - 658944*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 532224*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 354816*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 141120*cx0*cy2*pow(w0, 2)*w1*w2*w4 - 362880*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 96768*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 96768*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) - 29568*cx0*cy2*pow(w0, 2)*w2*w3*w4 + 1344*cx0*cy2*pow(w0, 2)*w2*pow(w4, 2) + 709632*cx0*cy2*w0*pow(w1, 3)*w2 - 1064448*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 161280*cx0*cy2*w0*pow(w1, 2)*w2*w3 + 96768*cx0*cy2*w0*pow(w1, 2)*w2*w4 + 362880*cx0*cy2*w0*w1*pow(w2, 3) + 387072*cx0*cy2*w0*w1*pow(w2, 2)*w3 - 112896*cx0*cy2*w0*w1*pow(w2, 2)*w4 - 107520*cx0*cy2*w0*w1*w2*pow(w3, 2) + 26880*cx0*cy2*w0*w1*w2*w3*w4 - 720*cx0*cy2*w0*w1*w2*pow(w4, 2) - 145152*cx0*cy2*w0*pow(w2, 3)*w3 + 24192*cx0*cy2*w0*pow(w2, 3)*w4 + 48384*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) - 6336*cx0*cy2*w0*pow(w2, 2)*w3*w4 - 2304*cx0*cy2*w0*w2*pow(w3, 3) - 164736*cx0*cy3*pow(w0, 3)*w1*w3 + 133056*cx0*cy3*pow(w0, 3)*w2*w3 - 10080*cx0*cy3*pow(w0, 3)*w3*w4 + 709632*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 1064448*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 161280*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) + 16128*cx0*cy3*pow(w0, 2)*w1*w3*w4 + 362880*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 96768*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) - 8064*cx0*cy3*pow(w0, 2)*w2*w3*w4 + 2688*cx0*cy3*pow(w0, 2)*pow(w3, 2)*w4 - 96*cx0*cy3*pow(w0, 2)*w3*pow(w4, 2) - 709632*cx0*cy3*w0*pow(w1, 3)*w3 + 1451520*cx0*cy3*w0*pow(w1, 2)*w2*w3 - 258048*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) - 870912*cx0*cy3*w0*w1*pow(w2, 2)*w3 + 258048*cx0*cy3*w0*w1*w2*pow(w3, 2) - 10752*cx0*cy3*w0*w1*pow(w3, 3) - 768*cx0*cy3*w0*w1*pow(w3, 2)*w4 + 145152*cx0*cy3*w0*pow(w2, 3)*w3 - 48384*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) + 2304*cx0*cy3*w0*w2*pow(w3, 3) + 44352*cx0*cy4*pow(w0, 3)*w1*w4 - 44352*cx0*cy4*pow(w0, 3)*w2*w4 + 10080*cx0*cy4*pow(w0, 3)*w3*w4 - 177408*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 282240*cx0*cy4*pow(w0, 2)*w1*w2*w4 - 64512*cx0*cy4*pow(w0, 2)*w1*w3*w4 + 2688*cx0*cy4*pow(w0, 2)*w1*pow(w4, 2) - 96768*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 + 37632*cx0*cy4*pow(w0, 2)*w2*w3*w4 - 1344*cx0*cy4*pow(w0, 2)*w2*pow(w4, 2) - 2688*cx0*cy4*pow(w0, 2)*pow(w3, 2)*w4 + 96*cx0*cy4*pow(w0, 2)*w3*pow(w4, 2) + 161280*cx0*cy4*w0*pow(w1, 3)*w4 - 322560*cx0*cy4*w0*pow(w1, 2)*w2*w4 + 64512*cx0*cy4*w0*pow(w1, 2)*w3*w4 - 2688*cx0*cy4*w0*pow(w1, 2)*pow(w4, 2) + 177408*cx0*cy4*w0*w1*pow(w2, 2)*w4 - 53760*cx0*cy4*w0*w1*w2*w3*w4 + 1344*cx0*cy4*w0*w1*w2*pow(w4, 2) + 2304*cx0*cy4*w0*w1*pow(w3, 2)*w4 - 24192*cx0*cy4*w0*pow(w2, 3)*w4 + 6336*cx0*cy4*w0*pow(w2, 2)*w3*w4 + 144144*cx1*cy0*pow(w0, 3)*w1*w2 - 164736*cx1*cy0*pow(w0, 3)*w1*w3 + 44352*cx1*cy0*pow(w0, 3)*w1*w4 - 658944*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 709632*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 177408*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 532224*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 709632*cx1*cy0*pow(w0, 2)*w1*w2*w3 + 141120*cx1*cy0*pow(w0, 2)*w1*w2*w4 + 161280*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) - 48384*cx1*cy0*pow(w0, 2)*w1*w3*w4 + 2688*cx1*cy0*pow(w0, 2)*w1*pow(w4, 2) + 709632*cx1*cy0*w0*pow(w1, 3)*w2 - 709632*cx1*cy0*w0*pow(w1, 3)*w3 + 161280*cx1*cy0*w0*pow(w1, 3)*w4 - 1064448*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 1290240*cx1*cy0*w0*pow(w1, 2)*w2*w3 - 225792*cx1*cy0*w0*pow(w1, 2)*w2*w4 - 258048*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) + 64512*cx1*cy0*w0*pow(w1, 2)*w3*w4 - 2688*cx1*cy0*w0*pow(w1, 2)*pow(w4, 2) + 362880*cx1*cy0*w0*w1*pow(w2, 3) - 483840*cx1*cy0*w0*w1*pow(w2, 2)*w3 + 64512*cx1*cy0*w0*w1*pow(w2, 2)*w4 + 150528*cx1*cy0*w0*w1*w2*pow(w3, 2) - 26880*cx1*cy0*w0*w1*w2*w3*w4 + 624*cx1*cy0*w0*w1*w2*pow(w4, 2) - 10752*cx1*cy0*w0*w1*pow(w3, 3) + 1536*cx1*cy0*w0*w1*pow(w3, 2)*w4 - 144144*cx1*cy2*pow(w0, 3)*w1*w2 + 658944*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 532224*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 266112*cx1*cy2*pow(w0, 2)*w1*w2*w3 - 50400*cx1*cy2*pow(w0, 2)*w1*w2*w4 - 709632*cx1*cy2*w0*pow(w1, 3)*w2 + 1064448*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 645120*cx1*cy2*w0*pow(w1, 2)*w2*w3 + 129024*cx1*cy2*w0*pow(w1, 2)*w2*w4 - 362880*cx1*cy2*w0*w1*pow(w2, 3) + 387072*cx1*cy2*w0*w1*pow(w2, 2)*w3 - 64512*cx1*cy2*w0*w1*pow(w2, 2)*w4 - 64512*cx1*cy2*w0*w1*w2*pow(w3, 2) + 13440*cx1*cy2*w0*w1*w2*w3*w4 - 336*cx1*cy2*w0*w1*w2*pow(w4, 2) + 258048*cx1*cy2*pow(w1, 3)*w2*w3 - 64512*cx1*cy2*pow(w1, 3)*w2*w4 - 258048*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 48384*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w4 + 43008*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) - 6144*cx1*cy2*pow(w1, 2)*w2*w3*w4 + 48384*cx1*cy2*w1*pow(w2, 3)*w3 - 5184*cx1*cy2*w1*pow(w2, 3)*w4 - 9216*cx1*cy2*w1*pow(w2, 2)*pow(w3, 2) + 164736*cx1*cy3*pow(w0, 3)*w1*w3 - 709632*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 443520*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 161280*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) + 24192*cx1*cy3*pow(w0, 2)*w1*w3*w4 + 709632*cx1*cy3*w0*pow(w1, 3)*w3 - 645120*cx1*cy3*w0*pow(w1, 2)*w2*w3 + 258048*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) - 43008*cx1*cy3*w0*pow(w1, 2)*w3*w4 + 96768*cx1*cy3*w0*w1*pow(w2, 2)*w3 - 86016*cx1*cy3*w0*w1*w2*pow(w3, 2) + 13440*cx1*cy3*w0*w1*w2*w3*w4 + 10752*cx1*cy3*w0*w1*pow(w3, 3) - 1536*cx1*cy3*w0*w1*pow(w3, 2)*w4 - 258048*cx1*cy3*pow(w1, 3)*w2*w3 + 10752*cx1*cy3*pow(w1, 3)*w3*w4 + 258048*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 43008*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) - 3072*cx1*cy3*pow(w1, 2)*w2*w3*w4 - 48384*cx1*cy3*w1*pow(w2, 3)*w3 + 9216*cx1*cy3*w1*pow(w2, 2)*pow(w3, 2) - 44352*cx1*cy4*pow(w0, 3)*w1*w4 + 177408*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 90720*cx1*cy4*pow(w0, 2)*w1*w2*w4 + 24192*cx1*cy4*pow(w0, 2)*w1*w3*w4 - 2688*cx1*cy4*pow(w0, 2)*w1*pow(w4, 2) - 161280*cx1*cy4*w0*pow(w1, 3)*w4 + 96768*cx1*cy4*w0*pow(w1, 2)*w2*w4 - 21504*cx1*cy4*w0*pow(w1, 2)*w3*w4 + 2688*cx1*cy4*w0*pow(w1, 2)*pow(w4, 2) - 288*cx1*cy4*w0*w1*w2*pow(w4, 2) + 64512*cx1*cy4*pow(w1, 3)*w2*w4 - 10752*cx1*cy4*pow(w1, 3)*w3*w4 - 48384*cx1*cy4*pow(w1, 2)*pow(w2, 2)*w4 + 9216*cx1*cy4*pow(w1, 2)*w2*w3*w4 + 5184*cx1*cy4*w1*pow(w2, 3)*w4 - 144144*cx2*cy0*pow(w0, 3)*w1*w2 + 133056*cx2*cy0*pow(w0, 3)*w2*w3 - 44352*cx2*cy0*pow(w0, 3)*w2*w4 + 658944*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 532224*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 354816*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 141120*cx2*cy0*pow(w0, 2)*w1*w2*w4 + 362880*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 96768*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 96768*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) + 29568*cx2*cy0*pow(w0, 2)*w2*w3*w4 - 1344*cx2*cy0*pow(w0, 2)*w2*pow(w4, 2) - 709632*cx2*cy0*w0*pow(w1, 3)*w2 + 1064448*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) + 161280*cx2*cy0*w0*pow(w1, 2)*w2*w3 - 96768*cx2*cy0*w0*pow(w1, 2)*w2*w4 - 362880*cx2*cy0*w0*w1*pow(w2, 3) - 387072*cx2*cy0*w0*w1*pow(w2, 2)*w3 + 112896*cx2*cy0*w0*w1*pow(w2, 2)*w4 + 107520*cx2*cy0*w0*w1*w2*pow(w3, 2) - 26880*cx2*cy0*w0*w1*w2*w3*w4 + 720*cx2*cy0*w0*w1*w2*pow(w4, 2) + 145152*cx2*cy0*w0*pow(w2, 3)*w3 - 24192*cx2*cy0*w0*pow(w2, 3)*w4 - 48384*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) + 6336*cx2*cy0*w0*pow(w2, 2)*w3*w4 + 2304*cx2*cy0*w0*w2*pow(w3, 3) + 144144*cx2*cy1*pow(w0, 3)*w1*w2 - 658944*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 532224*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 266112*cx2*cy1*pow(w0, 2)*w1*w2*w3 + 50400*cx2*cy1*pow(w0, 2)*w1*w2*w4 + 709632*cx2*cy1*w0*pow(w1, 3)*w2 - 1064448*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 645120*cx2*cy1*w0*pow(w1, 2)*w2*w3 - 129024*cx2*cy1*w0*pow(w1, 2)*w2*w4 + 362880*cx2*cy1*w0*w1*pow(w2, 3) - 387072*cx2*cy1*w0*w1*pow(w2, 2)*w3 + 64512*cx2*cy1*w0*w1*pow(w2, 2)*w4 + 64512*cx2*cy1*w0*w1*w2*pow(w3, 2) - 13440*cx2*cy1*w0*w1*w2*w3*w4 + 336*cx2*cy1*w0*w1*w2*pow(w4, 2) - 258048*cx2*cy1*pow(w1, 3)*w2*w3 + 64512*cx2*cy1*pow(w1, 3)*w2*w4 + 258048*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 48384*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w4 - 43008*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) + 6144*cx2*cy1*pow(w1, 2)*w2*w3*w4 - 48384*cx2*cy1*w1*pow(w2, 3)*w3 + 5184*cx2*cy1*w1*pow(w2, 3)*w4 + 9216*cx2*cy1*w1*pow(w2, 2)*pow(w3, 2) - 133056*cx2*cy3*pow(w0, 3)*w2*w3 + 620928*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 362880*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 96768*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) - 9408*cx2*cy3*pow(w0, 2)*w2*w3*w4 - 806400*cx2*cy3*w0*pow(w1, 2)*w2*w3 + 774144*cx2*cy3*w0*w1*pow(w2, 2)*w3 - 172032*cx2*cy3*w0*w1*w2*pow(w3, 2) + 13440*cx2*cy3*w0*w1*w2*w3*w4 - 145152*cx2*cy3*w0*pow(w2, 3)*w3 + 48384*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) - 2304*cx2*cy3*w0*pow(w2, 2)*w3*w4 - 2304*cx2*cy3*w0*w2*pow(w3, 3) + 258048*cx2*cy3*pow(w1, 3)*w2*w3 - 258048*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 43008*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) - 2304*cx2*cy3*pow(w1, 2)*w2*w3*w4 + 48384*cx2*cy3*w1*pow(w2, 3)*w3 - 9216*cx2*cy3*w1*pow(w2, 2)*pow(w3, 2) + 44352*cx2*cy4*pow(w0, 3)*w2*w4 - 191520*cx2*cy4*pow(w0, 2)*w1*w2*w4 + 96768*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 20160*cx2*cy4*pow(w0, 2)*w2*w3*w4 + 1344*cx2*cy4*pow(w0, 2)*w2*pow(w4, 2) + 225792*cx2*cy4*w0*pow(w1, 2)*w2*w4 - 177408*cx2*cy4*w0*w1*pow(w2, 2)*w4 + 26880*cx2*cy4*w0*w1*w2*w3*w4 - 1056*cx2*cy4*w0*w1*w2*pow(w4, 2) + 24192*cx2*cy4*w0*pow(w2, 3)*w4 - 4032*cx2*cy4*w0*pow(w2, 2)*w3*w4 - 64512*cx2*cy4*pow(w1, 3)*w2*w4 + 48384*cx2*cy4*pow(w1, 2)*pow(w2, 2)*w4 - 3840*cx2*cy4*pow(w1, 2)*w2*w3*w4 - 5184*cx2*cy4*w1*pow(w2, 3)*w4 + 164736*cx3*cy0*pow(w0, 3)*w1*w3 - 133056*cx3*cy0*pow(w0, 3)*w2*w3 + 10080*cx3*cy0*pow(w0, 3)*w3*w4 - 709632*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 1064448*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 161280*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) - 16128*cx3*cy0*pow(w0, 2)*w1*w3*w4 - 362880*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 96768*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) + 8064*cx3*cy0*pow(w0, 2)*w2*w3*w4 - 2688*cx3*cy0*pow(w0, 2)*pow(w3, 2)*w4 + 96*cx3*cy0*pow(w0, 2)*w3*pow(w4, 2) + 709632*cx3*cy0*w0*pow(w1, 3)*w3 - 1451520*cx3*cy0*w0*pow(w1, 2)*w2*w3 + 258048*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) + 870912*cx3*cy0*w0*w1*pow(w2, 2)*w3 - 258048*cx3*cy0*w0*w1*w2*pow(w3, 2) + 10752*cx3*cy0*w0*w1*pow(w3, 3) + 768*cx3*cy0*w0*w1*pow(w3, 2)*w4 - 145152*cx3*cy0*w0*pow(w2, 3)*w3 + 48384*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) - 2304*cx3*cy0*w0*w2*pow(w3, 3) - 164736*cx3*cy1*pow(w0, 3)*w1*w3 + 709632*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 443520*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 161280*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) - 24192*cx3*cy1*pow(w0, 2)*w1*w3*w4 - 709632*cx3*cy1*w0*pow(w1, 3)*w3 + 645120*cx3*cy1*w0*pow(w1, 2)*w2*w3 - 258048*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) + 43008*cx3*cy1*w0*pow(w1, 2)*w3*w4 - 96768*cx3*cy1*w0*w1*pow(w2, 2)*w3 + 86016*cx3*cy1*w0*w1*w2*pow(w3, 2) - 13440*cx3*cy1*w0*w1*w2*w3*w4 - 10752*cx3*cy1*w0*w1*pow(w3, 3) + 1536*cx3*cy1*w0*w1*pow(w3, 2)*w4 + 258048*cx3*cy1*pow(w1, 3)*w2*w3 - 10752*cx3*cy1*pow(w1, 3)*w3*w4 - 258048*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 43008*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) + 3072*cx3*cy1*pow(w1, 2)*w2*w3*w4 + 48384*cx3*cy1*w1*pow(w2, 3)*w3 - 9216*cx3*cy1*w1*pow(w2, 2)*pow(w3, 2) + 133056*cx3*cy2*pow(w0, 3)*w2*w3 - 620928*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 362880*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 96768*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) + 9408*cx3*cy2*pow(w0, 2)*w2*w3*w4 + 806400*cx3*cy2*w0*pow(w1, 2)*w2*w3 - 774144*cx3*cy2*w0*w1*pow(w2, 2)*w3 + 172032*cx3*cy2*w0*w1*w2*pow(w3, 2) - 13440*cx3*cy2*w0*w1*w2*w3*w4 + 145152*cx3*cy2*w0*pow(w2, 3)*w3 - 48384*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) + 2304*cx3*cy2*w0*pow(w2, 2)*w3*w4 + 2304*cx3*cy2*w0*w2*pow(w3, 3) - 258048*cx3*cy2*pow(w1, 3)*w2*w3 + 258048*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 43008*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) + 2304*cx3*cy2*pow(w1, 2)*w2*w3*w4 - 48384*cx3*cy2*w1*pow(w2, 3)*w3 + 9216*cx3*cy2*w1*pow(w2, 2)*pow(w3, 2) - 10080*cx3*cy4*pow(w0, 3)*w3*w4 + 40320*cx3*cy4*pow(w0, 2)*w1*w3*w4 - 17472*cx3*cy4*pow(w0, 2)*w2*w3*w4 + 2688*cx3*cy4*pow(w0, 2)*pow(w3, 2)*w4 - 96*cx3*cy4*pow(w0, 2)*w3*pow(w4, 2) - 43008*cx3*cy4*w0*pow(w1, 2)*w3*w4 + 26880*cx3*cy4*w0*w1*w2*w3*w4 - 2304*cx3*cy4*w0*w1*pow(w3, 2)*w4 - 2304*cx3*cy4*w0*pow(w2, 2)*w3*w4 + 10752*cx3*cy4*pow(w1, 3)*w3*w4 - 5376*cx3*cy4*pow(w1, 2)*w2*w3*w4 - 44352*cx4*cy0*pow(w0, 3)*w1*w4 + 44352*cx4*cy0*pow(w0, 3)*w2*w4 - 10080*cx4*cy0*pow(w0, 3)*w3*w4 + 177408*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 282240*cx4*cy0*pow(w0, 2)*w1*w2*w4 + 64512*cx4*cy0*pow(w0, 2)*w1*w3*w4 - 2688*cx4*cy0*pow(w0, 2)*w1*pow(w4, 2) + 96768*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 37632*cx4*cy0*pow(w0, 2)*w2*w3*w4 + 1344*cx4*cy0*pow(w0, 2)*w2*pow(w4, 2) + 2688*cx4*cy0*pow(w0, 2)*pow(w3, 2)*w4 - 96*cx4*cy0*pow(w0, 2)*w3*pow(w4, 2) - 161280*cx4*cy0*w0*pow(w1, 3)*w4 + 322560*cx4*cy0*w0*pow(w1, 2)*w2*w4 - 64512*cx4*cy0*w0*pow(w1, 2)*w3*w4 + 2688*cx4*cy0*w0*pow(w1, 2)*pow(w4, 2) - 177408*cx4*cy0*w0*w1*pow(w2, 2)*w4 + 53760*cx4*cy0*w0*w1*w2*w3*w4 - 1344*cx4*cy0*w0*w1*w2*pow(w4, 2) - 2304*cx4*cy0*w0*w1*pow(w3, 2)*w4 + 24192*cx4*cy0*w0*pow(w2, 3)*w4 - 6336*cx4*cy0*w0*pow(w2, 2)*w3*w4 + 44352*cx4*cy1*pow(w0, 3)*w1*w4 - 177408*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 90720*cx4*cy1*pow(w0, 2)*w1*w2*w4 - 24192*cx4*cy1*pow(w0, 2)*w1*w3*w4 + 2688*cx4*cy1*pow(w0, 2)*w1*pow(w4, 2) + 161280*cx4*cy1*w0*pow(w1, 3)*w4 - 96768*cx4*cy1*w0*pow(w1, 2)*w2*w4 + 21504*cx4*cy1*w0*pow(w1, 2)*w3*w4 - 2688*cx4*cy1*w0*pow(w1, 2)*pow(w4, 2) + 288*cx4*cy1*w0*w1*w2*pow(w4, 2) - 64512*cx4*cy1*pow(w1, 3)*w2*w4 + 10752*cx4*cy1*pow(w1, 3)*w3*w4 + 48384*cx4*cy1*pow(w1, 2)*pow(w2, 2)*w4 - 9216*cx4*cy1*pow(w1, 2)*w2*w3*w4 - 5184*cx4*cy1*w1*pow(w2, 3)*w4 - 44352*cx4*cy2*pow(w0, 3)*w2*w4 + 191520*cx4*cy2*pow(w0, 2)*w1*w2*w4 - 96768*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 20160*cx4*cy2*pow(w0, 2)*w2*w3*w4 - 1344*cx4*cy2*pow(w0, 2)*w2*pow(w4, 2) - 225792*cx4*cy2*w0*pow(w1, 2)*w2*w4 + 177408*cx4*cy2*w0*w1*pow(w2, 2)*w4 - 26880*cx4*cy2*w0*w1*w2*w3*w4 + 1056*cx4*cy2*w0*w1*w2*pow(w4, 2) - 24192*cx4*cy2*w0*pow(w2, 3)*w4 + 4032*cx4*cy2*w0*pow(w2, 2)*w3*w4 + 64512*cx4*cy2*pow(w1, 3)*w2*w4 - 48384*cx4*cy2*pow(w1, 2)*pow(w2, 2)*w4 + 3840*cx4*cy2*pow(w1, 2)*w2*w3*w4 + 5184*cx4*cy2*w1*pow(w2, 3)*w4 + 10080*cx4*cy3*pow(w0, 3)*w3*w4 - 40320*cx4*cy3*pow(w0, 2)*w1*w3*w4 + 17472*cx4*cy3*pow(w0, 2)*w2*w3*w4 - 2688*cx4*cy3*pow(w0, 2)*pow(w3, 2)*w4 + 96*cx4*cy3*pow(w0, 2)*w3*pow(w4, 2) + 43008*cx4*cy3*w0*pow(w1, 2)*w3*w4 - 26880*cx4*cy3*w0*w1*w2*w3*w4 + 2304*cx4*cy3*w0*w1*pow(w3, 2)*w4 + 2304*cx4*cy3*w0*pow(w2, 2)*w3*w4 - 10752*cx4*cy3*pow(w1, 3)*w3*w4 + 5376*cx4*cy3*pow(w1, 2)*w2*w3*w4,
-    96096*cx0*cy1*pow(w0, 3)*w1*w2 - 123552*cx0*cy1*pow(w0, 3)*w1*w3 + 38016*cx0*cy1*pow(w0, 3)*w1*w4 - 494208*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 608256*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 177408*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 456192*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 709632*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 169344*cx0*cy1*pow(w0, 2)*w1*w2*w4 + 193536*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) - 72576*cx0*cy1*pow(w0, 2)*w1*w3*w4 + 5376*cx0*cy1*pow(w0, 2)*w1*pow(w4, 2) + 608256*cx0*cy1*w0*pow(w1, 3)*w2 - 709632*cx0*cy1*w0*pow(w1, 3)*w3 + 193536*cx0*cy1*w0*pow(w1, 3)*w4 - 1064448*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) + 1548288*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 338688*cx0*cy1*w0*pow(w1, 2)*w2*w4 - 387072*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) + 129024*cx0*cy1*w0*pow(w1, 2)*w3*w4 - 8064*cx0*cy1*w0*pow(w1, 2)*pow(w4, 2) + 435456*cx0*cy1*w0*w1*pow(w2, 3) - 725760*cx0*cy1*w0*w1*pow(w2, 2)*w3 + 129024*cx0*cy1*w0*w1*pow(w2, 2)*w4 + 301056*cx0*cy1*w0*w1*w2*pow(w3, 2) - 80640*cx0*cy1*w0*w1*w2*w3*w4 + 3744*cx0*cy1*w0*w1*w2*pow(w4, 2) - 32256*cx0*cy1*w0*w1*pow(w3, 3) + 9216*cx0*cy1*w0*w1*pow(w3, 2)*w4 - 480*cx0*cy1*w0*w1*w3*pow(w4, 2) - 96096*cx0*cy2*pow(w0, 3)*w1*w2 + 114048*cx0*cy2*pow(w0, 3)*w2*w3 - 44352*cx0*cy2*pow(w0, 3)*w2*w4 + 494208*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 456192*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 354816*cx0*cy2*pow(w0, 2)*w1*w2*w3 + 169344*cx0*cy2*pow(w0, 2)*w1*w2*w4 + 435456*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 145152*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 - 145152*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) + 59136*cx0*cy2*pow(w0, 2)*w2*w3*w4 - 4032*cx0*cy2*pow(w0, 2)*w2*pow(w4, 2) - 608256*cx0*cy2*w0*pow(w1, 3)*w2 + 1064448*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 193536*cx0*cy2*w0*pow(w1, 2)*w2*w3 - 145152*cx0*cy2*w0*pow(w1, 2)*w2*w4 - 435456*cx0*cy2*w0*w1*pow(w2, 3) - 580608*cx0*cy2*w0*w1*pow(w2, 2)*w3 + 225792*cx0*cy2*w0*w1*pow(w2, 2)*w4 + 215040*cx0*cy2*w0*w1*w2*pow(w3, 2) - 80640*cx0*cy2*w0*w1*w2*w3*w4 + 4320*cx0*cy2*w0*w1*w2*pow(w4, 2) + 290304*cx0*cy2*w0*pow(w2, 3)*w3 - 72576*cx0*cy2*w0*pow(w2, 3)*w4 - 145152*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) + 38016*cx0*cy2*w0*pow(w2, 2)*w3*w4 - 1152*cx0*cy2*w0*pow(w2, 2)*pow(w4, 2) + 13824*cx0*cy2*w0*w2*pow(w3, 3) - 2688*cx0*cy2*w0*w2*pow(w3, 2)*w4 + 123552*cx0*cy3*pow(w0, 3)*w1*w3 - 114048*cx0*cy3*pow(w0, 3)*w2*w3 + 12096*cx0*cy3*pow(w0, 3)*w3*w4 - 608256*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 1064448*cx0*cy3*pow(w0, 2)*w1*w2*w3 - 193536*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) - 24192*cx0*cy3*pow(w0, 2)*w1*w3*w4 - 435456*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 145152*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) + 16128*cx0*cy3*pow(w0, 2)*w2*w3*w4 - 8064*cx0*cy3*pow(w0, 2)*pow(w3, 2)*w4 + 576*cx0*cy3*pow(w0, 2)*w3*pow(w4, 2) + 709632*cx0*cy3*w0*pow(w1, 3)*w3 - 1741824*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 387072*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) + 1306368*cx0*cy3*w0*w1*pow(w2, 2)*w3 - 516096*cx0*cy3*w0*w1*w2*pow(w3, 2) + 32256*cx0*cy3*w0*w1*pow(w3, 3) + 4608*cx0*cy3*w0*w1*pow(w3, 2)*w4 - 288*cx0*cy3*w0*w1*w3*pow(w4, 2) - 290304*cx0*cy3*w0*pow(w2, 3)*w3 + 145152*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) - 13824*cx0*cy3*w0*w2*pow(w3, 3) - 1152*cx0*cy3*w0*w2*pow(w3, 2)*w4 - 38016*cx0*cy4*pow(w0, 3)*w1*w4 + 44352*cx0*cy4*pow(w0, 3)*w2*w4 - 12096*cx0*cy4*pow(w0, 3)*w3*w4 + 177408*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 338688*cx0*cy4*pow(w0, 2)*w1*w2*w4 + 96768*cx0*cy4*pow(w0, 2)*w1*w3*w4 - 5376*cx0*cy4*pow(w0, 2)*w1*pow(w4, 2) + 145152*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 75264*cx0*cy4*pow(w0, 2)*w2*w3*w4 + 4032*cx0*cy4*pow(w0, 2)*w2*pow(w4, 2) + 8064*cx0*cy4*pow(w0, 2)*pow(w3, 2)*w4 - 576*cx0*cy4*pow(w0, 2)*w3*pow(w4, 2) - 193536*cx0*cy4*w0*pow(w1, 3)*w4 + 483840*cx0*cy4*w0*pow(w1, 2)*w2*w4 - 129024*cx0*cy4*w0*pow(w1, 2)*w3*w4 + 8064*cx0*cy4*w0*pow(w1, 2)*pow(w4, 2) - 354816*cx0*cy4*w0*w1*pow(w2, 2)*w4 + 161280*cx0*cy4*w0*w1*w2*w3*w4 - 8064*cx0*cy4*w0*w1*w2*pow(w4, 2) - 13824*cx0*cy4*w0*w1*pow(w3, 2)*w4 + 768*cx0*cy4*w0*w1*w3*pow(w4, 2) + 72576*cx0*cy4*w0*pow(w2, 3)*w4 - 38016*cx0*cy4*w0*pow(w2, 2)*w3*w4 + 1152*cx0*cy4*w0*pow(w2, 2)*pow(w4, 2) + 3840*cx0*cy4*w0*w2*pow(w3, 2)*w4 - 96096*cx1*cy0*pow(w0, 3)*w1*w2 + 123552*cx1*cy0*pow(w0, 3)*w1*w3 - 38016*cx1*cy0*pow(w0, 3)*w1*w4 + 494208*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 608256*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 177408*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 456192*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 709632*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 169344*cx1*cy0*pow(w0, 2)*w1*w2*w4 - 193536*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) + 72576*cx1*cy0*pow(w0, 2)*w1*w3*w4 - 5376*cx1*cy0*pow(w0, 2)*w1*pow(w4, 2) - 608256*cx1*cy0*w0*pow(w1, 3)*w2 + 709632*cx1*cy0*w0*pow(w1, 3)*w3 - 193536*cx1*cy0*w0*pow(w1, 3)*w4 + 1064448*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) - 1548288*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 338688*cx1*cy0*w0*pow(w1, 2)*w2*w4 + 387072*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) - 129024*cx1*cy0*w0*pow(w1, 2)*w3*w4 + 8064*cx1*cy0*w0*pow(w1, 2)*pow(w4, 2) - 435456*cx1*cy0*w0*w1*pow(w2, 3) + 725760*cx1*cy0*w0*w1*pow(w2, 2)*w3 - 129024*cx1*cy0*w0*w1*pow(w2, 2)*w4 - 301056*cx1*cy0*w0*w1*w2*pow(w3, 2) + 80640*cx1*cy0*w0*w1*w2*w3*w4 - 3744*cx1*cy0*w0*w1*w2*pow(w4, 2) + 32256*cx1*cy0*w0*w1*pow(w3, 3) - 9216*cx1*cy0*w0*w1*pow(w3, 2)*w4 + 480*cx1*cy0*w0*w1*w3*pow(w4, 2) + 96096*cx1*cy2*pow(w0, 3)*w1*w2 - 494208*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 456192*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 266112*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 60480*cx1*cy2*pow(w0, 2)*w1*w2*w4 + 608256*cx1*cy2*w0*pow(w1, 3)*w2 - 1064448*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) + 774144*cx1*cy2*w0*pow(w1, 2)*w2*w3 - 193536*cx1*cy2*w0*pow(w1, 2)*w2*w4 + 435456*cx1*cy2*w0*w1*pow(w2, 3) - 580608*cx1*cy2*w0*w1*pow(w2, 2)*w3 + 129024*cx1*cy2*w0*w1*pow(w2, 2)*w4 + 129024*cx1*cy2*w0*w1*w2*pow(w3, 2) - 40320*cx1*cy2*w0*w1*w2*w3*w4 + 2016*cx1*cy2*w0*w1*w2*pow(w4, 2) - 387072*cx1*cy2*pow(w1, 3)*w2*w3 + 129024*cx1*cy2*pow(w1, 3)*w2*w4 + 516096*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 145152*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w4 - 129024*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) + 36864*cx1*cy2*pow(w1, 2)*w2*w3*w4 - 1152*cx1*cy2*pow(w1, 2)*w2*pow(w4, 2) - 145152*cx1*cy2*w1*pow(w2, 3)*w3 + 31104*cx1*cy2*w1*pow(w2, 3)*w4 + 55296*cx1*cy2*w1*pow(w2, 2)*pow(w3, 2) - 9216*cx1*cy2*w1*pow(w2, 2)*w3*w4 - 3072*cx1*cy2*w1*w2*pow(w3, 3) - 123552*cx1*cy3*pow(w0, 3)*w1*w3 + 608256*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 443520*cx1*cy3*pow(w0, 2)*w1*w2*w3 + 193536*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) - 36288*cx1*cy3*pow(w0, 2)*w1*w3*w4 - 709632*cx1*cy3*w0*pow(w1, 3)*w3 + 774144*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 387072*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) + 86016*cx1*cy3*w0*pow(w1, 2)*w3*w4 - 145152*cx1*cy3*w0*w1*pow(w2, 2)*w3 + 172032*cx1*cy3*w0*w1*w2*pow(w3, 2) - 40320*cx1*cy3*w0*w1*w2*w3*w4 - 32256*cx1*cy3*w0*w1*pow(w3, 3) + 9216*cx1*cy3*w0*w1*pow(w3, 2)*w4 - 288*cx1*cy3*w0*w1*w3*pow(w4, 2) + 387072*cx1*cy3*pow(w1, 3)*w2*w3 - 32256*cx1*cy3*pow(w1, 3)*w3*w4 - 516096*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 129024*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) + 18432*cx1*cy3*pow(w1, 2)*w2*w3*w4 - 3072*cx1*cy3*pow(w1, 2)*pow(w3, 2)*w4 + 145152*cx1*cy3*w1*pow(w2, 3)*w3 - 55296*cx1*cy3*w1*pow(w2, 2)*pow(w3, 2) - 1152*cx1*cy3*w1*pow(w2, 2)*w3*w4 + 3072*cx1*cy3*w1*w2*pow(w3, 3) + 38016*cx1*cy4*pow(w0, 3)*w1*w4 - 177408*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 108864*cx1*cy4*pow(w0, 2)*w1*w2*w4 - 36288*cx1*cy4*pow(w0, 2)*w1*w3*w4 + 5376*cx1*cy4*pow(w0, 2)*w1*pow(w4, 2) + 193536*cx1*cy4*w0*pow(w1, 3)*w4 - 145152*cx1*cy4*w0*pow(w1, 2)*w2*w4 + 43008*cx1*cy4*w0*pow(w1, 2)*w3*w4 - 8064*cx1*cy4*w0*pow(w1, 2)*pow(w4, 2) + 1728*cx1*cy4*w0*w1*w2*pow(w4, 2) - 192*cx1*cy4*w0*w1*w3*pow(w4, 2) - 129024*cx1*cy4*pow(w1, 3)*w2*w4 + 32256*cx1*cy4*pow(w1, 3)*w3*w4 + 145152*cx1*cy4*pow(w1, 2)*pow(w2, 2)*w4 - 55296*cx1*cy4*pow(w1, 2)*w2*w3*w4 + 1152*cx1*cy4*pow(w1, 2)*w2*pow(w4, 2) + 3072*cx1*cy4*pow(w1, 2)*pow(w3, 2)*w4 - 31104*cx1*cy4*w1*pow(w2, 3)*w4 + 10368*cx1*cy4*w1*pow(w2, 2)*w3*w4 + 96096*cx2*cy0*pow(w0, 3)*w1*w2 - 114048*cx2*cy0*pow(w0, 3)*w2*w3 + 44352*cx2*cy0*pow(w0, 3)*w2*w4 - 494208*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 456192*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 354816*cx2*cy0*pow(w0, 2)*w1*w2*w3 - 169344*cx2*cy0*pow(w0, 2)*w1*w2*w4 - 435456*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 145152*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 145152*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) - 59136*cx2*cy0*pow(w0, 2)*w2*w3*w4 + 4032*cx2*cy0*pow(w0, 2)*w2*pow(w4, 2) + 608256*cx2*cy0*w0*pow(w1, 3)*w2 - 1064448*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 193536*cx2*cy0*w0*pow(w1, 2)*w2*w3 + 145152*cx2*cy0*w0*pow(w1, 2)*w2*w4 + 435456*cx2*cy0*w0*w1*pow(w2, 3) + 580608*cx2*cy0*w0*w1*pow(w2, 2)*w3 - 225792*cx2*cy0*w0*w1*pow(w2, 2)*w4 - 215040*cx2*cy0*w0*w1*w2*pow(w3, 2) + 80640*cx2*cy0*w0*w1*w2*w3*w4 - 4320*cx2*cy0*w0*w1*w2*pow(w4, 2) - 290304*cx2*cy0*w0*pow(w2, 3)*w3 + 72576*cx2*cy0*w0*pow(w2, 3)*w4 + 145152*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) - 38016*cx2*cy0*w0*pow(w2, 2)*w3*w4 + 1152*cx2*cy0*w0*pow(w2, 2)*pow(w4, 2) - 13824*cx2*cy0*w0*w2*pow(w3, 3) + 2688*cx2*cy0*w0*w2*pow(w3, 2)*w4 - 96096*cx2*cy1*pow(w0, 3)*w1*w2 + 494208*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 456192*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 266112*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 60480*cx2*cy1*pow(w0, 2)*w1*w2*w4 - 608256*cx2*cy1*w0*pow(w1, 3)*w2 + 1064448*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) - 774144*cx2*cy1*w0*pow(w1, 2)*w2*w3 + 193536*cx2*cy1*w0*pow(w1, 2)*w2*w4 - 435456*cx2*cy1*w0*w1*pow(w2, 3) + 580608*cx2*cy1*w0*w1*pow(w2, 2)*w3 - 129024*cx2*cy1*w0*w1*pow(w2, 2)*w4 - 129024*cx2*cy1*w0*w1*w2*pow(w3, 2) + 40320*cx2*cy1*w0*w1*w2*w3*w4 - 2016*cx2*cy1*w0*w1*w2*pow(w4, 2) + 387072*cx2*cy1*pow(w1, 3)*w2*w3 - 129024*cx2*cy1*pow(w1, 3)*w2*w4 - 516096*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 145152*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w4 + 129024*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) - 36864*cx2*cy1*pow(w1, 2)*w2*w3*w4 + 1152*cx2*cy1*pow(w1, 2)*w2*pow(w4, 2) + 145152*cx2*cy1*w1*pow(w2, 3)*w3 - 31104*cx2*cy1*w1*pow(w2, 3)*w4 - 55296*cx2*cy1*w1*pow(w2, 2)*pow(w3, 2) + 9216*cx2*cy1*w1*pow(w2, 2)*w3*w4 + 3072*cx2*cy1*w1*w2*pow(w3, 3) + 114048*cx2*cy3*pow(w0, 3)*w2*w3 - 620928*cx2*cy3*pow(w0, 2)*w1*w2*w3 + 435456*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 145152*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) + 18816*cx2*cy3*pow(w0, 2)*w2*w3*w4 + 967680*cx2*cy3*w0*pow(w1, 2)*w2*w3 - 1161216*cx2*cy3*w0*w1*pow(w2, 2)*w3 + 344064*cx2*cy3*w0*w1*w2*pow(w3, 2) - 40320*cx2*cy3*w0*w1*w2*w3*w4 + 290304*cx2*cy3*w0*pow(w2, 3)*w3 - 145152*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) + 13824*cx2*cy3*w0*pow(w2, 2)*w3*w4 + 13824*cx2*cy3*w0*w2*pow(w3, 3) - 1536*cx2*cy3*w0*w2*pow(w3, 2)*w4 - 387072*cx2*cy3*pow(w1, 3)*w2*w3 + 516096*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 129024*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) + 13824*cx2*cy3*pow(w1, 2)*w2*w3*w4 - 145152*cx2*cy3*w1*pow(w2, 3)*w3 + 55296*cx2*cy3*w1*pow(w2, 2)*pow(w3, 2) - 4608*cx2*cy3*w1*pow(w2, 2)*w3*w4 - 3072*cx2*cy3*w1*w2*pow(w3, 3) - 44352*cx2*cy4*pow(w0, 3)*w2*w4 + 229824*cx2*cy4*pow(w0, 2)*w1*w2*w4 - 145152*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 + 40320*cx2*cy4*pow(w0, 2)*w2*w3*w4 - 4032*cx2*cy4*pow(w0, 2)*w2*pow(w4, 2) - 338688*cx2*cy4*w0*pow(w1, 2)*w2*w4 + 354816*cx2*cy4*w0*w1*pow(w2, 2)*w4 - 80640*cx2*cy4*w0*w1*w2*w3*w4 + 6336*cx2*cy4*w0*w1*w2*pow(w4, 2) - 72576*cx2*cy4*w0*pow(w2, 3)*w4 + 24192*cx2*cy4*w0*pow(w2, 2)*w3*w4 - 1152*cx2*cy4*w0*pow(w2, 2)*pow(w4, 2) - 1152*cx2*cy4*w0*w2*pow(w3, 2)*w4 + 129024*cx2*cy4*pow(w1, 3)*w2*w4 - 145152*cx2*cy4*pow(w1, 2)*pow(w2, 2)*w4 + 23040*cx2*cy4*pow(w1, 2)*w2*w3*w4 - 1152*cx2*cy4*pow(w1, 2)*w2*pow(w4, 2) + 31104*cx2*cy4*w1*pow(w2, 3)*w4 - 4608*cx2*cy4*w1*pow(w2, 2)*w3*w4 - 123552*cx3*cy0*pow(w0, 3)*w1*w3 + 114048*cx3*cy0*pow(w0, 3)*w2*w3 - 12096*cx3*cy0*pow(w0, 3)*w3*w4 + 608256*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 1064448*cx3*cy0*pow(w0, 2)*w1*w2*w3 + 193536*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) + 24192*cx3*cy0*pow(w0, 2)*w1*w3*w4 + 435456*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 145152*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) - 16128*cx3*cy0*pow(w0, 2)*w2*w3*w4 + 8064*cx3*cy0*pow(w0, 2)*pow(w3, 2)*w4 - 576*cx3*cy0*pow(w0, 2)*w3*pow(w4, 2) - 709632*cx3*cy0*w0*pow(w1, 3)*w3 + 1741824*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 387072*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) - 1306368*cx3*cy0*w0*w1*pow(w2, 2)*w3 + 516096*cx3*cy0*w0*w1*w2*pow(w3, 2) - 32256*cx3*cy0*w0*w1*pow(w3, 3) - 4608*cx3*cy0*w0*w1*pow(w3, 2)*w4 + 288*cx3*cy0*w0*w1*w3*pow(w4, 2) + 290304*cx3*cy0*w0*pow(w2, 3)*w3 - 145152*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) + 13824*cx3*cy0*w0*w2*pow(w3, 3) + 1152*cx3*cy0*w0*w2*pow(w3, 2)*w4 + 123552*cx3*cy1*pow(w0, 3)*w1*w3 - 608256*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 443520*cx3*cy1*pow(w0, 2)*w1*w2*w3 - 193536*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) + 36288*cx3*cy1*pow(w0, 2)*w1*w3*w4 + 709632*cx3*cy1*w0*pow(w1, 3)*w3 - 774144*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 387072*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) - 86016*cx3*cy1*w0*pow(w1, 2)*w3*w4 + 145152*cx3*cy1*w0*w1*pow(w2, 2)*w3 - 172032*cx3*cy1*w0*w1*w2*pow(w3, 2) + 40320*cx3*cy1*w0*w1*w2*w3*w4 + 32256*cx3*cy1*w0*w1*pow(w3, 3) - 9216*cx3*cy1*w0*w1*pow(w3, 2)*w4 + 288*cx3*cy1*w0*w1*w3*pow(w4, 2) - 387072*cx3*cy1*pow(w1, 3)*w2*w3 + 32256*cx3*cy1*pow(w1, 3)*w3*w4 + 516096*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 129024*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) - 18432*cx3*cy1*pow(w1, 2)*w2*w3*w4 + 3072*cx3*cy1*pow(w1, 2)*pow(w3, 2)*w4 - 145152*cx3*cy1*w1*pow(w2, 3)*w3 + 55296*cx3*cy1*w1*pow(w2, 2)*pow(w3, 2) + 1152*cx3*cy1*w1*pow(w2, 2)*w3*w4 - 3072*cx3*cy1*w1*w2*pow(w3, 3) - 114048*cx3*cy2*pow(w0, 3)*w2*w3 + 620928*cx3*cy2*pow(w0, 2)*w1*w2*w3 - 435456*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 145152*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) - 18816*cx3*cy2*pow(w0, 2)*w2*w3*w4 - 967680*cx3*cy2*w0*pow(w1, 2)*w2*w3 + 1161216*cx3*cy2*w0*w1*pow(w2, 2)*w3 - 344064*cx3*cy2*w0*w1*w2*pow(w3, 2) + 40320*cx3*cy2*w0*w1*w2*w3*w4 - 290304*cx3*cy2*w0*pow(w2, 3)*w3 + 145152*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) - 13824*cx3*cy2*w0*pow(w2, 2)*w3*w4 - 13824*cx3*cy2*w0*w2*pow(w3, 3) + 1536*cx3*cy2*w0*w2*pow(w3, 2)*w4 + 387072*cx3*cy2*pow(w1, 3)*w2*w3 - 516096*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 129024*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) - 13824*cx3*cy2*pow(w1, 2)*w2*w3*w4 + 145152*cx3*cy2*w1*pow(w2, 3)*w3 - 55296*cx3*cy2*w1*pow(w2, 2)*pow(w3, 2) + 4608*cx3*cy2*w1*pow(w2, 2)*w3*w4 + 3072*cx3*cy2*w1*w2*pow(w3, 3) + 12096*cx3*cy4*pow(w0, 3)*w3*w4 - 60480*cx3*cy4*pow(w0, 2)*w1*w3*w4 + 34944*cx3*cy4*pow(w0, 2)*w2*w3*w4 - 8064*cx3*cy4*pow(w0, 2)*pow(w3, 2)*w4 + 576*cx3*cy4*pow(w0, 2)*w3*pow(w4, 2) + 86016*cx3*cy4*w0*pow(w1, 2)*w3*w4 - 80640*cx3*cy4*w0*w1*w2*w3*w4 + 13824*cx3*cy4*w0*w1*pow(w3, 2)*w4 - 576*cx3*cy4*w0*w1*w3*pow(w4, 2) + 13824*cx3*cy4*w0*pow(w2, 2)*w3*w4 - 2688*cx3*cy4*w0*w2*pow(w3, 2)*w4 - 32256*cx3*cy4*pow(w1, 3)*w3*w4 + 32256*cx3*cy4*pow(w1, 2)*w2*w3*w4 - 3072*cx3*cy4*pow(w1, 2)*pow(w3, 2)*w4 - 5760*cx3*cy4*w1*pow(w2, 2)*w3*w4 + 38016*cx4*cy0*pow(w0, 3)*w1*w4 - 44352*cx4*cy0*pow(w0, 3)*w2*w4 + 12096*cx4*cy0*pow(w0, 3)*w3*w4 - 177408*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 338688*cx4*cy0*pow(w0, 2)*w1*w2*w4 - 96768*cx4*cy0*pow(w0, 2)*w1*w3*w4 + 5376*cx4*cy0*pow(w0, 2)*w1*pow(w4, 2) - 145152*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 75264*cx4*cy0*pow(w0, 2)*w2*w3*w4 - 4032*cx4*cy0*pow(w0, 2)*w2*pow(w4, 2) - 8064*cx4*cy0*pow(w0, 2)*pow(w3, 2)*w4 + 576*cx4*cy0*pow(w0, 2)*w3*pow(w4, 2) + 193536*cx4*cy0*w0*pow(w1, 3)*w4 - 483840*cx4*cy0*w0*pow(w1, 2)*w2*w4 + 129024*cx4*cy0*w0*pow(w1, 2)*w3*w4 - 8064*cx4*cy0*w0*pow(w1, 2)*pow(w4, 2) + 354816*cx4*cy0*w0*w1*pow(w2, 2)*w4 - 161280*cx4*cy0*w0*w1*w2*w3*w4 + 8064*cx4*cy0*w0*w1*w2*pow(w4, 2) + 13824*cx4*cy0*w0*w1*pow(w3, 2)*w4 - 768*cx4*cy0*w0*w1*w3*pow(w4, 2) - 72576*cx4*cy0*w0*pow(w2, 3)*w4 + 38016*cx4*cy0*w0*pow(w2, 2)*w3*w4 - 1152*cx4*cy0*w0*pow(w2, 2)*pow(w4, 2) - 3840*cx4*cy0*w0*w2*pow(w3, 2)*w4 - 38016*cx4*cy1*pow(w0, 3)*w1*w4 + 177408*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 108864*cx4*cy1*pow(w0, 2)*w1*w2*w4 + 36288*cx4*cy1*pow(w0, 2)*w1*w3*w4 - 5376*cx4*cy1*pow(w0, 2)*w1*pow(w4, 2) - 193536*cx4*cy1*w0*pow(w1, 3)*w4 + 145152*cx4*cy1*w0*pow(w1, 2)*w2*w4 - 43008*cx4*cy1*w0*pow(w1, 2)*w3*w4 + 8064*cx4*cy1*w0*pow(w1, 2)*pow(w4, 2) - 1728*cx4*cy1*w0*w1*w2*pow(w4, 2) + 192*cx4*cy1*w0*w1*w3*pow(w4, 2) + 129024*cx4*cy1*pow(w1, 3)*w2*w4 - 32256*cx4*cy1*pow(w1, 3)*w3*w4 - 145152*cx4*cy1*pow(w1, 2)*pow(w2, 2)*w4 + 55296*cx4*cy1*pow(w1, 2)*w2*w3*w4 - 1152*cx4*cy1*pow(w1, 2)*w2*pow(w4, 2) - 3072*cx4*cy1*pow(w1, 2)*pow(w3, 2)*w4 + 31104*cx4*cy1*w1*pow(w2, 3)*w4 - 10368*cx4*cy1*w1*pow(w2, 2)*w3*w4 + 44352*cx4*cy2*pow(w0, 3)*w2*w4 - 229824*cx4*cy2*pow(w0, 2)*w1*w2*w4 + 145152*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 - 40320*cx4*cy2*pow(w0, 2)*w2*w3*w4 + 4032*cx4*cy2*pow(w0, 2)*w2*pow(w4, 2) + 338688*cx4*cy2*w0*pow(w1, 2)*w2*w4 - 354816*cx4*cy2*w0*w1*pow(w2, 2)*w4 + 80640*cx4*cy2*w0*w1*w2*w3*w4 - 6336*cx4*cy2*w0*w1*w2*pow(w4, 2) + 72576*cx4*cy2*w0*pow(w2, 3)*w4 - 24192*cx4*cy2*w0*pow(w2, 2)*w3*w4 + 1152*cx4*cy2*w0*pow(w2, 2)*pow(w4, 2) + 1152*cx4*cy2*w0*w2*pow(w3, 2)*w4 - 129024*cx4*cy2*pow(w1, 3)*w2*w4 + 145152*cx4*cy2*pow(w1, 2)*pow(w2, 2)*w4 - 23040*cx4*cy2*pow(w1, 2)*w2*w3*w4 + 1152*cx4*cy2*pow(w1, 2)*w2*pow(w4, 2) - 31104*cx4*cy2*w1*pow(w2, 3)*w4 + 4608*cx4*cy2*w1*pow(w2, 2)*w3*w4 - 12096*cx4*cy3*pow(w0, 3)*w3*w4 + 60480*cx4*cy3*pow(w0, 2)*w1*w3*w4 - 34944*cx4*cy3*pow(w0, 2)*w2*w3*w4 + 8064*cx4*cy3*pow(w0, 2)*pow(w3, 2)*w4 - 576*cx4*cy3*pow(w0, 2)*w3*pow(w4, 2) - 86016*cx4*cy3*w0*pow(w1, 2)*w3*w4 + 80640*cx4*cy3*w0*w1*w2*w3*w4 - 13824*cx4*cy3*w0*w1*pow(w3, 2)*w4 + 576*cx4*cy3*w0*w1*w3*pow(w4, 2) - 13824*cx4*cy3*w0*pow(w2, 2)*w3*w4 + 2688*cx4*cy3*w0*w2*pow(w3, 2)*w4 + 32256*cx4*cy3*pow(w1, 3)*w3*w4 - 32256*cx4*cy3*pow(w1, 2)*w2*w3*w4 + 3072*cx4*cy3*pow(w1, 2)*pow(w3, 2)*w4 + 5760*cx4*cy3*w1*pow(w2, 2)*w3*w4,
-    -48048*cx0*cy1*pow(w0, 3)*w1*w2 + 68640*cx0*cy1*pow(w0, 3)*w1*w3 - 23760*cx0*cy1*pow(w0, 3)*w1*w4 + 274560*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 380160*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 126720*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 285120*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 506880*cx0*cy1*pow(w0, 2)*w1*w2*w3 - 141120*cx0*cy1*pow(w0, 2)*w1*w2*w4 - 161280*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) + 72576*cx0*cy1*pow(w0, 2)*w1*w3*w4 - 6720*cx0*cy1*pow(w0, 2)*w1*pow(w4, 2) - 380160*cx0*cy1*w0*pow(w1, 3)*w2 + 506880*cx0*cy1*w0*pow(w1, 3)*w3 - 161280*cx0*cy1*w0*pow(w1, 3)*w4 + 760320*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 1290240*cx0*cy1*w0*pow(w1, 2)*w2*w3 + 338688*cx0*cy1*w0*pow(w1, 2)*w2*w4 + 387072*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) - 161280*cx0*cy1*w0*pow(w1, 2)*w3*w4 + 13440*cx0*cy1*w0*pow(w1, 2)*pow(w4, 2) - 362880*cx0*cy1*w0*w1*pow(w2, 3) + 725760*cx0*cy1*w0*w1*pow(w2, 2)*w3 - 161280*cx0*cy1*w0*w1*pow(w2, 2)*w4 - 376320*cx0*cy1*w0*w1*w2*pow(w3, 2) + 134400*cx0*cy1*w0*w1*w2*w3*w4 - 9360*cx0*cy1*w0*w1*w2*pow(w4, 2) + 53760*cx0*cy1*w0*w1*pow(w3, 3) - 23040*cx0*cy1*w0*w1*pow(w3, 2)*w4 + 2400*cx0*cy1*w0*w1*w3*pow(w4, 2) - 48*cx0*cy1*w0*w1*pow(w4, 3) + 48048*cx0*cy2*pow(w0, 3)*w1*w2 - 71280*cx0*cy2*pow(w0, 3)*w2*w3 + 31680*cx0*cy2*pow(w0, 3)*w2*w4 - 274560*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 285120*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 253440*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 141120*cx0*cy2*pow(w0, 2)*w1*w2*w4 - 362880*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 145152*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 145152*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) - 73920*cx0*cy2*pow(w0, 2)*w2*w3*w4 + 6720*cx0*cy2*pow(w0, 2)*w2*pow(w4, 2) + 380160*cx0*cy2*w0*pow(w1, 3)*w2 - 760320*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 161280*cx0*cy2*w0*pow(w1, 2)*w2*w3 + 145152*cx0*cy2*w0*pow(w1, 2)*w2*w4 + 362880*cx0*cy2*w0*w1*pow(w2, 3) + 580608*cx0*cy2*w0*w1*pow(w2, 2)*w3 - 282240*cx0*cy2*w0*w1*pow(w2, 2)*w4 - 268800*cx0*cy2*w0*w1*w2*pow(w3, 2) + 134400*cx0*cy2*w0*w1*w2*w3*w4 - 10800*cx0*cy2*w0*w1*w2*pow(w4, 2) - 362880*cx0*cy2*w0*pow(w2, 3)*w3 + 120960*cx0*cy2*w0*pow(w2, 3)*w4 + 241920*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) - 95040*cx0*cy2*w0*pow(w2, 2)*w3*w4 + 5760*cx0*cy2*w0*pow(w2, 2)*pow(w4, 2) - 34560*cx0*cy2*w0*w2*pow(w3, 3) + 13440*cx0*cy2*w0*w2*pow(w3, 2)*w4 - 912*cx0*cy2*w0*w2*w3*pow(w4, 2) - 68640*cx0*cy3*pow(w0, 3)*w1*w3 + 71280*cx0*cy3*pow(w0, 3)*w2*w3 - 10080*cx0*cy3*pow(w0, 3)*w3*w4 + 380160*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 760320*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 161280*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) + 24192*cx0*cy3*pow(w0, 2)*w1*w3*w4 + 362880*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 145152*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) - 20160*cx0*cy3*pow(w0, 2)*w2*w3*w4 + 13440*cx0*cy3*pow(w0, 2)*pow(w3, 2)*w4 - 1440*cx0*cy3*pow(w0, 2)*w3*pow(w4, 2) - 506880*cx0*cy3*w0*pow(w1, 3)*w3 + 1451520*cx0*cy3*w0*pow(w1, 2)*w2*w3 - 387072*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) - 1306368*cx0*cy3*w0*w1*pow(w2, 2)*w3 + 645120*cx0*cy3*w0*w1*w2*pow(w3, 2) - 53760*cx0*cy3*w0*w1*pow(w3, 3) - 11520*cx0*cy3*w0*w1*pow(w3, 2)*w4 + 1440*cx0*cy3*w0*w1*w3*pow(w4, 2) + 362880*cx0*cy3*w0*pow(w2, 3)*w3 - 241920*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) + 34560*cx0*cy3*w0*w2*pow(w3, 3) + 5760*cx0*cy3*w0*w2*pow(w3, 2)*w4 - 432*cx0*cy3*w0*w2*w3*pow(w4, 2) - 768*cx0*cy3*w0*pow(w3, 3)*w4 + 23760*cx0*cy4*pow(w0, 3)*w1*w4 - 31680*cx0*cy4*pow(w0, 3)*w2*w4 + 10080*cx0*cy4*pow(w0, 3)*w3*w4 - 126720*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 282240*cx0*cy4*pow(w0, 2)*w1*w2*w4 - 96768*cx0*cy4*pow(w0, 2)*w1*w3*w4 + 6720*cx0*cy4*pow(w0, 2)*w1*pow(w4, 2) - 145152*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 + 94080*cx0*cy4*pow(w0, 2)*w2*w3*w4 - 6720*cx0*cy4*pow(w0, 2)*w2*pow(w4, 2) - 13440*cx0*cy4*pow(w0, 2)*pow(w3, 2)*w4 + 1440*cx0*cy4*pow(w0, 2)*w3*pow(w4, 2) + 161280*cx0*cy4*w0*pow(w1, 3)*w4 - 483840*cx0*cy4*w0*pow(w1, 2)*w2*w4 + 161280*cx0*cy4*w0*pow(w1, 2)*w3*w4 - 13440*cx0*cy4*w0*pow(w1, 2)*pow(w4, 2) + 443520*cx0*cy4*w0*w1*pow(w2, 2)*w4 - 268800*cx0*cy4*w0*w1*w2*w3*w4 + 20160*cx0*cy4*w0*w1*w2*pow(w4, 2) + 34560*cx0*cy4*w0*w1*pow(w3, 2)*w4 - 3840*cx0*cy4*w0*w1*w3*pow(w4, 2) + 48*cx0*cy4*w0*w1*pow(w4, 3) - 120960*cx0*cy4*w0*pow(w2, 3)*w4 + 95040*cx0*cy4*w0*pow(w2, 2)*w3*w4 - 5760*cx0*cy4*w0*pow(w2, 2)*pow(w4, 2) - 19200*cx0*cy4*w0*w2*pow(w3, 2)*w4 + 1344*cx0*cy4*w0*w2*w3*pow(w4, 2) + 768*cx0*cy4*w0*pow(w3, 3)*w4 + 48048*cx1*cy0*pow(w0, 3)*w1*w2 - 68640*cx1*cy0*pow(w0, 3)*w1*w3 + 23760*cx1*cy0*pow(w0, 3)*w1*w4 - 274560*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 380160*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 126720*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 285120*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 506880*cx1*cy0*pow(w0, 2)*w1*w2*w3 + 141120*cx1*cy0*pow(w0, 2)*w1*w2*w4 + 161280*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) - 72576*cx1*cy0*pow(w0, 2)*w1*w3*w4 + 6720*cx1*cy0*pow(w0, 2)*w1*pow(w4, 2) + 380160*cx1*cy0*w0*pow(w1, 3)*w2 - 506880*cx1*cy0*w0*pow(w1, 3)*w3 + 161280*cx1*cy0*w0*pow(w1, 3)*w4 - 760320*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 1290240*cx1*cy0*w0*pow(w1, 2)*w2*w3 - 338688*cx1*cy0*w0*pow(w1, 2)*w2*w4 - 387072*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) + 161280*cx1*cy0*w0*pow(w1, 2)*w3*w4 - 13440*cx1*cy0*w0*pow(w1, 2)*pow(w4, 2) + 362880*cx1*cy0*w0*w1*pow(w2, 3) - 725760*cx1*cy0*w0*w1*pow(w2, 2)*w3 + 161280*cx1*cy0*w0*w1*pow(w2, 2)*w4 + 376320*cx1*cy0*w0*w1*w2*pow(w3, 2) - 134400*cx1*cy0*w0*w1*w2*w3*w4 + 9360*cx1*cy0*w0*w1*w2*pow(w4, 2) - 53760*cx1*cy0*w0*w1*pow(w3, 3) + 23040*cx1*cy0*w0*w1*pow(w3, 2)*w4 - 2400*cx1*cy0*w0*w1*w3*pow(w4, 2) + 48*cx1*cy0*w0*w1*pow(w4, 3) - 48048*cx1*cy2*pow(w0, 3)*w1*w2 + 274560*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 285120*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 190080*cx1*cy2*pow(w0, 2)*w1*w2*w3 - 50400*cx1*cy2*pow(w0, 2)*w1*w2*w4 - 380160*cx1*cy2*w0*pow(w1, 3)*w2 + 760320*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 645120*cx1*cy2*w0*pow(w1, 2)*w2*w3 + 193536*cx1*cy2*w0*pow(w1, 2)*w2*w4 - 362880*cx1*cy2*w0*w1*pow(w2, 3) + 580608*cx1*cy2*w0*w1*pow(w2, 2)*w3 - 161280*cx1*cy2*w0*w1*pow(w2, 2)*w4 - 161280*cx1*cy2*w0*w1*w2*pow(w3, 2) + 67200*cx1*cy2*w0*w1*w2*w3*w4 - 5040*cx1*cy2*w0*w1*w2*pow(w4, 2) + 387072*cx1*cy2*pow(w1, 3)*w2*w3 - 161280*cx1*cy2*pow(w1, 3)*w2*w4 - 645120*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 241920*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w4 + 215040*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) - 92160*cx1*cy2*pow(w1, 2)*w2*w3*w4 + 5760*cx1*cy2*pow(w1, 2)*w2*pow(w4, 2) + 241920*cx1*cy2*w1*pow(w2, 3)*w3 - 77760*cx1*cy2*w1*pow(w2, 3)*w4 - 138240*cx1*cy2*w1*pow(w2, 2)*pow(w3, 2) + 46080*cx1*cy2*w1*pow(w2, 2)*w3*w4 - 1728*cx1*cy2*w1*pow(w2, 2)*pow(w4, 2) + 15360*cx1*cy2*w1*w2*pow(w3, 3) - 3840*cx1*cy2*w1*w2*pow(w3, 2)*w4 + 68640*cx1*cy3*pow(w0, 3)*w1*w3 - 380160*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 316800*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 161280*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) + 36288*cx1*cy3*pow(w0, 2)*w1*w3*w4 + 506880*cx1*cy3*w0*pow(w1, 3)*w3 - 645120*cx1*cy3*w0*pow(w1, 2)*w2*w3 + 387072*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) - 107520*cx1*cy3*w0*pow(w1, 2)*w3*w4 + 145152*cx1*cy3*w0*w1*pow(w2, 2)*w3 - 215040*cx1*cy3*w0*w1*w2*pow(w3, 2) + 67200*cx1*cy3*w0*w1*w2*w3*w4 + 53760*cx1*cy3*w0*w1*pow(w3, 3) - 23040*cx1*cy3*w0*w1*pow(w3, 2)*w4 + 1440*cx1*cy3*w0*w1*w3*pow(w4, 2) - 387072*cx1*cy3*pow(w1, 3)*w2*w3 + 53760*cx1*cy3*pow(w1, 3)*w3*w4 + 645120*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 215040*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) - 46080*cx1*cy3*pow(w1, 2)*w2*w3*w4 + 15360*cx1*cy3*pow(w1, 2)*pow(w3, 2)*w4 - 768*cx1*cy3*pow(w1, 2)*w3*pow(w4, 2) - 241920*cx1*cy3*w1*pow(w2, 3)*w3 + 138240*cx1*cy3*w1*pow(w2, 2)*pow(w3, 2) + 5760*cx1*cy3*w1*pow(w2, 2)*w3*w4 - 15360*cx1*cy3*w1*w2*pow(w3, 3) - 3072*cx1*cy3*w1*w2*pow(w3, 2)*w4 - 23760*cx1*cy4*pow(w0, 3)*w1*w4 + 126720*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 90720*cx1*cy4*pow(w0, 2)*w1*w2*w4 + 36288*cx1*cy4*pow(w0, 2)*w1*w3*w4 - 6720*cx1*cy4*pow(w0, 2)*w1*pow(w4, 2) - 161280*cx1*cy4*w0*pow(w1, 3)*w4 + 145152*cx1*cy4*w0*pow(w1, 2)*w2*w4 - 53760*cx1*cy4*w0*pow(w1, 2)*w3*w4 + 13440*cx1*cy4*w0*pow(w1, 2)*pow(w4, 2) - 4320*cx1*cy4*w0*w1*w2*pow(w4, 2) + 960*cx1*cy4*w0*w1*w3*pow(w4, 2) - 48*cx1*cy4*w0*w1*pow(w4, 3) + 161280*cx1*cy4*pow(w1, 3)*w2*w4 - 53760*cx1*cy4*pow(w1, 3)*w3*w4 - 241920*cx1*cy4*pow(w1, 2)*pow(w2, 2)*w4 + 138240*cx1*cy4*pow(w1, 2)*w2*w3*w4 - 5760*cx1*cy4*pow(w1, 2)*w2*pow(w4, 2) - 15360*cx1*cy4*pow(w1, 2)*pow(w3, 2)*w4 + 768*cx1*cy4*pow(w1, 2)*w3*pow(w4, 2) + 77760*cx1*cy4*w1*pow(w2, 3)*w4 - 51840*cx1*cy4*w1*pow(w2, 2)*w3*w4 + 1728*cx1*cy4*w1*pow(w2, 2)*pow(w4, 2) + 6912*cx1*cy4*w1*w2*pow(w3, 2)*w4 - 48048*cx2*cy0*pow(w0, 3)*w1*w2 + 71280*cx2*cy0*pow(w0, 3)*w2*w3 - 31680*cx2*cy0*pow(w0, 3)*w2*w4 + 274560*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 285120*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 253440*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 141120*cx2*cy0*pow(w0, 2)*w1*w2*w4 + 362880*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 145152*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 145152*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) + 73920*cx2*cy0*pow(w0, 2)*w2*w3*w4 - 6720*cx2*cy0*pow(w0, 2)*w2*pow(w4, 2) - 380160*cx2*cy0*w0*pow(w1, 3)*w2 + 760320*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) + 161280*cx2*cy0*w0*pow(w1, 2)*w2*w3 - 145152*cx2*cy0*w0*pow(w1, 2)*w2*w4 - 362880*cx2*cy0*w0*w1*pow(w2, 3) - 580608*cx2*cy0*w0*w1*pow(w2, 2)*w3 + 282240*cx2*cy0*w0*w1*pow(w2, 2)*w4 + 268800*cx2*cy0*w0*w1*w2*pow(w3, 2) - 134400*cx2*cy0*w0*w1*w2*w3*w4 + 10800*cx2*cy0*w0*w1*w2*pow(w4, 2) + 362880*cx2*cy0*w0*pow(w2, 3)*w3 - 120960*cx2*cy0*w0*pow(w2, 3)*w4 - 241920*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) + 95040*cx2*cy0*w0*pow(w2, 2)*w3*w4 - 5760*cx2*cy0*w0*pow(w2, 2)*pow(w4, 2) + 34560*cx2*cy0*w0*w2*pow(w3, 3) - 13440*cx2*cy0*w0*w2*pow(w3, 2)*w4 + 912*cx2*cy0*w0*w2*w3*pow(w4, 2) + 48048*cx2*cy1*pow(w0, 3)*w1*w2 - 274560*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 285120*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 190080*cx2*cy1*pow(w0, 2)*w1*w2*w3 + 50400*cx2*cy1*pow(w0, 2)*w1*w2*w4 + 380160*cx2*cy1*w0*pow(w1, 3)*w2 - 760320*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 645120*cx2*cy1*w0*pow(w1, 2)*w2*w3 - 193536*cx2*cy1*w0*pow(w1, 2)*w2*w4 + 362880*cx2*cy1*w0*w1*pow(w2, 3) - 580608*cx2*cy1*w0*w1*pow(w2, 2)*w3 + 161280*cx2*cy1*w0*w1*pow(w2, 2)*w4 + 161280*cx2*cy1*w0*w1*w2*pow(w3, 2) - 67200*cx2*cy1*w0*w1*w2*w3*w4 + 5040*cx2*cy1*w0*w1*w2*pow(w4, 2) - 387072*cx2*cy1*pow(w1, 3)*w2*w3 + 161280*cx2*cy1*pow(w1, 3)*w2*w4 + 645120*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 241920*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w4 - 215040*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) + 92160*cx2*cy1*pow(w1, 2)*w2*w3*w4 - 5760*cx2*cy1*pow(w1, 2)*w2*pow(w4, 2) - 241920*cx2*cy1*w1*pow(w2, 3)*w3 + 77760*cx2*cy1*w1*pow(w2, 3)*w4 + 138240*cx2*cy1*w1*pow(w2, 2)*pow(w3, 2) - 46080*cx2*cy1*w1*pow(w2, 2)*w3*w4 + 1728*cx2*cy1*w1*pow(w2, 2)*pow(w4, 2) - 15360*cx2*cy1*w1*w2*pow(w3, 3) + 3840*cx2*cy1*w1*w2*pow(w3, 2)*w4 - 71280*cx2*cy3*pow(w0, 3)*w2*w3 + 443520*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 362880*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 145152*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) - 23520*cx2*cy3*pow(w0, 2)*w2*w3*w4 - 806400*cx2*cy3*w0*pow(w1, 2)*w2*w3 + 1161216*cx2*cy3*w0*w1*pow(w2, 2)*w3 - 430080*cx2*cy3*w0*w1*w2*pow(w3, 2) + 67200*cx2*cy3*w0*w1*w2*w3*w4 - 362880*cx2*cy3*w0*pow(w2, 3)*w3 + 241920*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) - 34560*cx2*cy3*w0*pow(w2, 2)*w3*w4 - 34560*cx2*cy3*w0*w2*pow(w3, 3) + 7680*cx2*cy3*w0*w2*pow(w3, 2)*w4 - 240*cx2*cy3*w0*w2*w3*pow(w4, 2) + 387072*cx2*cy3*pow(w1, 3)*w2*w3 - 645120*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 215040*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) - 34560*cx2*cy3*pow(w1, 2)*w2*w3*w4 + 241920*cx2*cy3*w1*pow(w2, 3)*w3 - 138240*cx2*cy3*w1*pow(w2, 2)*pow(w3, 2) + 23040*cx2*cy3*w1*pow(w2, 2)*w3*w4 + 15360*cx2*cy3*w1*w2*pow(w3, 3) - 3072*cx2*cy3*w1*w2*pow(w3, 2)*w4 - 1728*cx2*cy3*pow(w2, 3)*w3*w4 + 31680*cx2*cy4*pow(w0, 3)*w2*w4 - 191520*cx2*cy4*pow(w0, 2)*w1*w2*w4 + 145152*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 50400*cx2*cy4*pow(w0, 2)*w2*w3*w4 + 6720*cx2*cy4*pow(w0, 2)*w2*pow(w4, 2) + 338688*cx2*cy4*w0*pow(w1, 2)*w2*w4 - 443520*cx2*cy4*w0*w1*pow(w2, 2)*w4 + 134400*cx2*cy4*w0*w1*w2*w3*w4 - 15840*cx2*cy4*w0*w1*w2*pow(w4, 2) + 120960*cx2*cy4*w0*pow(w2, 3)*w4 - 60480*cx2*cy4*w0*pow(w2, 2)*w3*w4 + 5760*cx2*cy4*w0*pow(w2, 2)*pow(w4, 2) + 5760*cx2*cy4*w0*w2*pow(w3, 2)*w4 - 672*cx2*cy4*w0*w2*w3*pow(w4, 2) - 161280*cx2*cy4*pow(w1, 3)*w2*w4 + 241920*cx2*cy4*pow(w1, 2)*pow(w2, 2)*w4 - 57600*cx2*cy4*pow(w1, 2)*w2*w3*w4 + 5760*cx2*cy4*pow(w1, 2)*w2*pow(w4, 2) - 77760*cx2*cy4*w1*pow(w2, 3)*w4 + 23040*cx2*cy4*w1*pow(w2, 2)*w3*w4 - 1728*cx2*cy4*w1*pow(w2, 2)*pow(w4, 2) - 768*cx2*cy4*w1*w2*pow(w3, 2)*w4 + 1728*cx2*cy4*pow(w2, 3)*w3*w4 + 68640*cx3*cy0*pow(w0, 3)*w1*w3 - 71280*cx3*cy0*pow(w0, 3)*w2*w3 + 10080*cx3*cy0*pow(w0, 3)*w3*w4 - 380160*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 760320*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 161280*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) - 24192*cx3*cy0*pow(w0, 2)*w1*w3*w4 - 362880*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 145152*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) + 20160*cx3*cy0*pow(w0, 2)*w2*w3*w4 - 13440*cx3*cy0*pow(w0, 2)*pow(w3, 2)*w4 + 1440*cx3*cy0*pow(w0, 2)*w3*pow(w4, 2) + 506880*cx3*cy0*w0*pow(w1, 3)*w3 - 1451520*cx3*cy0*w0*pow(w1, 2)*w2*w3 + 387072*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) + 1306368*cx3*cy0*w0*w1*pow(w2, 2)*w3 - 645120*cx3*cy0*w0*w1*w2*pow(w3, 2) + 53760*cx3*cy0*w0*w1*pow(w3, 3) + 11520*cx3*cy0*w0*w1*pow(w3, 2)*w4 - 1440*cx3*cy0*w0*w1*w3*pow(w4, 2) - 362880*cx3*cy0*w0*pow(w2, 3)*w3 + 241920*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) - 34560*cx3*cy0*w0*w2*pow(w3, 3) - 5760*cx3*cy0*w0*w2*pow(w3, 2)*w4 + 432*cx3*cy0*w0*w2*w3*pow(w4, 2) + 768*cx3*cy0*w0*pow(w3, 3)*w4 - 68640*cx3*cy1*pow(w0, 3)*w1*w3 + 380160*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 316800*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 161280*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) - 36288*cx3*cy1*pow(w0, 2)*w1*w3*w4 - 506880*cx3*cy1*w0*pow(w1, 3)*w3 + 645120*cx3*cy1*w0*pow(w1, 2)*w2*w3 - 387072*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) + 107520*cx3*cy1*w0*pow(w1, 2)*w3*w4 - 145152*cx3*cy1*w0*w1*pow(w2, 2)*w3 + 215040*cx3*cy1*w0*w1*w2*pow(w3, 2) - 67200*cx3*cy1*w0*w1*w2*w3*w4 - 53760*cx3*cy1*w0*w1*pow(w3, 3) + 23040*cx3*cy1*w0*w1*pow(w3, 2)*w4 - 1440*cx3*cy1*w0*w1*w3*pow(w4, 2) + 387072*cx3*cy1*pow(w1, 3)*w2*w3 - 53760*cx3*cy1*pow(w1, 3)*w3*w4 - 645120*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 215040*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) + 46080*cx3*cy1*pow(w1, 2)*w2*w3*w4 - 15360*cx3*cy1*pow(w1, 2)*pow(w3, 2)*w4 + 768*cx3*cy1*pow(w1, 2)*w3*pow(w4, 2) + 241920*cx3*cy1*w1*pow(w2, 3)*w3 - 138240*cx3*cy1*w1*pow(w2, 2)*pow(w3, 2) - 5760*cx3*cy1*w1*pow(w2, 2)*w3*w4 + 15360*cx3*cy1*w1*w2*pow(w3, 3) + 3072*cx3*cy1*w1*w2*pow(w3, 2)*w4 + 71280*cx3*cy2*pow(w0, 3)*w2*w3 - 443520*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 362880*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 145152*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) + 23520*cx3*cy2*pow(w0, 2)*w2*w3*w4 + 806400*cx3*cy2*w0*pow(w1, 2)*w2*w3 - 1161216*cx3*cy2*w0*w1*pow(w2, 2)*w3 + 430080*cx3*cy2*w0*w1*w2*pow(w3, 2) - 67200*cx3*cy2*w0*w1*w2*w3*w4 + 362880*cx3*cy2*w0*pow(w2, 3)*w3 - 241920*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) + 34560*cx3*cy2*w0*pow(w2, 2)*w3*w4 + 34560*cx3*cy2*w0*w2*pow(w3, 3) - 7680*cx3*cy2*w0*w2*pow(w3, 2)*w4 + 240*cx3*cy2*w0*w2*w3*pow(w4, 2) - 387072*cx3*cy2*pow(w1, 3)*w2*w3 + 645120*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 215040*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) + 34560*cx3*cy2*pow(w1, 2)*w2*w3*w4 - 241920*cx3*cy2*w1*pow(w2, 3)*w3 + 138240*cx3*cy2*w1*pow(w2, 2)*pow(w3, 2) - 23040*cx3*cy2*w1*pow(w2, 2)*w3*w4 - 15360*cx3*cy2*w1*w2*pow(w3, 3) + 3072*cx3*cy2*w1*w2*pow(w3, 2)*w4 + 1728*cx3*cy2*pow(w2, 3)*w3*w4 - 10080*cx3*cy4*pow(w0, 3)*w3*w4 + 60480*cx3*cy4*pow(w0, 2)*w1*w3*w4 - 43680*cx3*cy4*pow(w0, 2)*w2*w3*w4 + 13440*cx3*cy4*pow(w0, 2)*pow(w3, 2)*w4 - 1440*cx3*cy4*pow(w0, 2)*w3*pow(w4, 2) - 107520*cx3*cy4*w0*pow(w1, 2)*w3*w4 + 134400*cx3*cy4*w0*w1*w2*w3*w4 - 34560*cx3*cy4*w0*w1*pow(w3, 2)*w4 + 2880*cx3*cy4*w0*w1*w3*pow(w4, 2) - 34560*cx3*cy4*w0*pow(w2, 2)*w3*w4 + 13440*cx3*cy4*w0*w2*pow(w3, 2)*w4 - 672*cx3*cy4*w0*w2*w3*pow(w4, 2) - 768*cx3*cy4*w0*pow(w3, 3)*w4 + 53760*cx3*cy4*pow(w1, 3)*w3*w4 - 80640*cx3*cy4*pow(w1, 2)*w2*w3*w4 + 15360*cx3*cy4*pow(w1, 2)*pow(w3, 2)*w4 - 768*cx3*cy4*pow(w1, 2)*w3*pow(w4, 2) + 28800*cx3*cy4*w1*pow(w2, 2)*w3*w4 - 6144*cx3*cy4*w1*w2*pow(w3, 2)*w4 - 1728*cx3*cy4*pow(w2, 3)*w3*w4 - 23760*cx4*cy0*pow(w0, 3)*w1*w4 + 31680*cx4*cy0*pow(w0, 3)*w2*w4 - 10080*cx4*cy0*pow(w0, 3)*w3*w4 + 126720*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 282240*cx4*cy0*pow(w0, 2)*w1*w2*w4 + 96768*cx4*cy0*pow(w0, 2)*w1*w3*w4 - 6720*cx4*cy0*pow(w0, 2)*w1*pow(w4, 2) + 145152*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 94080*cx4*cy0*pow(w0, 2)*w2*w3*w4 + 6720*cx4*cy0*pow(w0, 2)*w2*pow(w4, 2) + 13440*cx4*cy0*pow(w0, 2)*pow(w3, 2)*w4 - 1440*cx4*cy0*pow(w0, 2)*w3*pow(w4, 2) - 161280*cx4*cy0*w0*pow(w1, 3)*w4 + 483840*cx4*cy0*w0*pow(w1, 2)*w2*w4 - 161280*cx4*cy0*w0*pow(w1, 2)*w3*w4 + 13440*cx4*cy0*w0*pow(w1, 2)*pow(w4, 2) - 443520*cx4*cy0*w0*w1*pow(w2, 2)*w4 + 268800*cx4*cy0*w0*w1*w2*w3*w4 - 20160*cx4*cy0*w0*w1*w2*pow(w4, 2) - 34560*cx4*cy0*w0*w1*pow(w3, 2)*w4 + 3840*cx4*cy0*w0*w1*w3*pow(w4, 2) - 48*cx4*cy0*w0*w1*pow(w4, 3) + 120960*cx4*cy0*w0*pow(w2, 3)*w4 - 95040*cx4*cy0*w0*pow(w2, 2)*w3*w4 + 5760*cx4*cy0*w0*pow(w2, 2)*pow(w4, 2) + 19200*cx4*cy0*w0*w2*pow(w3, 2)*w4 - 1344*cx4*cy0*w0*w2*w3*pow(w4, 2) - 768*cx4*cy0*w0*pow(w3, 3)*w4 + 23760*cx4*cy1*pow(w0, 3)*w1*w4 - 126720*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 90720*cx4*cy1*pow(w0, 2)*w1*w2*w4 - 36288*cx4*cy1*pow(w0, 2)*w1*w3*w4 + 6720*cx4*cy1*pow(w0, 2)*w1*pow(w4, 2) + 161280*cx4*cy1*w0*pow(w1, 3)*w4 - 145152*cx4*cy1*w0*pow(w1, 2)*w2*w4 + 53760*cx4*cy1*w0*pow(w1, 2)*w3*w4 - 13440*cx4*cy1*w0*pow(w1, 2)*pow(w4, 2) + 4320*cx4*cy1*w0*w1*w2*pow(w4, 2) - 960*cx4*cy1*w0*w1*w3*pow(w4, 2) + 48*cx4*cy1*w0*w1*pow(w4, 3) - 161280*cx4*cy1*pow(w1, 3)*w2*w4 + 53760*cx4*cy1*pow(w1, 3)*w3*w4 + 241920*cx4*cy1*pow(w1, 2)*pow(w2, 2)*w4 - 138240*cx4*cy1*pow(w1, 2)*w2*w3*w4 + 5760*cx4*cy1*pow(w1, 2)*w2*pow(w4, 2) + 15360*cx4*cy1*pow(w1, 2)*pow(w3, 2)*w4 - 768*cx4*cy1*pow(w1, 2)*w3*pow(w4, 2) - 77760*cx4*cy1*w1*pow(w2, 3)*w4 + 51840*cx4*cy1*w1*pow(w2, 2)*w3*w4 - 1728*cx4*cy1*w1*pow(w2, 2)*pow(w4, 2) - 6912*cx4*cy1*w1*w2*pow(w3, 2)*w4 - 31680*cx4*cy2*pow(w0, 3)*w2*w4 + 191520*cx4*cy2*pow(w0, 2)*w1*w2*w4 - 145152*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 50400*cx4*cy2*pow(w0, 2)*w2*w3*w4 - 6720*cx4*cy2*pow(w0, 2)*w2*pow(w4, 2) - 338688*cx4*cy2*w0*pow(w1, 2)*w2*w4 + 443520*cx4*cy2*w0*w1*pow(w2, 2)*w4 - 134400*cx4*cy2*w0*w1*w2*w3*w4 + 15840*cx4*cy2*w0*w1*w2*pow(w4, 2) - 120960*cx4*cy2*w0*pow(w2, 3)*w4 + 60480*cx4*cy2*w0*pow(w2, 2)*w3*w4 - 5760*cx4*cy2*w0*pow(w2, 2)*pow(w4, 2) - 5760*cx4*cy2*w0*w2*pow(w3, 2)*w4 + 672*cx4*cy2*w0*w2*w3*pow(w4, 2) + 161280*cx4*cy2*pow(w1, 3)*w2*w4 - 241920*cx4*cy2*pow(w1, 2)*pow(w2, 2)*w4 + 57600*cx4*cy2*pow(w1, 2)*w2*w3*w4 - 5760*cx4*cy2*pow(w1, 2)*w2*pow(w4, 2) + 77760*cx4*cy2*w1*pow(w2, 3)*w4 - 23040*cx4*cy2*w1*pow(w2, 2)*w3*w4 + 1728*cx4*cy2*w1*pow(w2, 2)*pow(w4, 2) + 768*cx4*cy2*w1*w2*pow(w3, 2)*w4 - 1728*cx4*cy2*pow(w2, 3)*w3*w4 + 10080*cx4*cy3*pow(w0, 3)*w3*w4 - 60480*cx4*cy3*pow(w0, 2)*w1*w3*w4 + 43680*cx4*cy3*pow(w0, 2)*w2*w3*w4 - 13440*cx4*cy3*pow(w0, 2)*pow(w3, 2)*w4 + 1440*cx4*cy3*pow(w0, 2)*w3*pow(w4, 2) + 107520*cx4*cy3*w0*pow(w1, 2)*w3*w4 - 134400*cx4*cy3*w0*w1*w2*w3*w4 + 34560*cx4*cy3*w0*w1*pow(w3, 2)*w4 - 2880*cx4*cy3*w0*w1*w3*pow(w4, 2) + 34560*cx4*cy3*w0*pow(w2, 2)*w3*w4 - 13440*cx4*cy3*w0*w2*pow(w3, 2)*w4 + 672*cx4*cy3*w0*w2*w3*pow(w4, 2) + 768*cx4*cy3*w0*pow(w3, 3)*w4 - 53760*cx4*cy3*pow(w1, 3)*w3*w4 + 80640*cx4*cy3*pow(w1, 2)*w2*w3*w4 - 15360*cx4*cy3*pow(w1, 2)*pow(w3, 2)*w4 + 768*cx4*cy3*pow(w1, 2)*w3*pow(w4, 2) - 28800*cx4*cy3*w1*pow(w2, 2)*w3*w4 + 6144*cx4*cy3*w1*w2*pow(w3, 2)*w4 + 1728*cx4*cy3*pow(w2, 3)*w3*w4,
-    17472*cx0*cy1*pow(w0, 3)*w1*w2 - 27456*cx0*cy1*pow(w0, 3)*w1*w3 + 10560*cx0*cy1*pow(w0, 3)*w1*w4 - 109824*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 168960*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 63360*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 126720*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 253440*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 80640*cx0*cy1*pow(w0, 2)*w1*w2*w4 + 92160*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) - 48384*cx0*cy1*pow(w0, 2)*w1*w3*w4 + 5376*cx0*cy1*pow(w0, 2)*w1*pow(w4, 2) + 168960*cx0*cy1*w0*pow(w1, 3)*w2 - 253440*cx0*cy1*w0*pow(w1, 3)*w3 + 92160*cx0*cy1*w0*pow(w1, 3)*w4 - 380160*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) + 737280*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 225792*cx0*cy1*w0*pow(w1, 2)*w2*w4 - 258048*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) + 129024*cx0*cy1*w0*pow(w1, 2)*w3*w4 - 13440*cx0*cy1*w0*pow(w1, 2)*pow(w4, 2) + 207360*cx0*cy1*w0*w1*pow(w2, 3) - 483840*cx0*cy1*w0*w1*pow(w2, 2)*w3 + 129024*cx0*cy1*w0*w1*pow(w2, 2)*w4 + 301056*cx0*cy1*w0*w1*w2*pow(w3, 2) - 134400*cx0*cy1*w0*w1*w2*w3*w4 + 12480*cx0*cy1*w0*w1*w2*pow(w4, 2) - 53760*cx0*cy1*w0*w1*pow(w3, 3) + 30720*cx0*cy1*w0*w1*pow(w3, 2)*w4 - 4800*cx0*cy1*w0*w1*w3*pow(w4, 2) + 192*cx0*cy1*w0*w1*pow(w4, 3) - 17472*cx0*cy2*pow(w0, 3)*w1*w2 + 31680*cx0*cy2*pow(w0, 3)*w2*w3 - 15840*cx0*cy2*pow(w0, 3)*w2*w4 + 109824*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 126720*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 126720*cx0*cy2*pow(w0, 2)*w1*w2*w3 + 80640*cx0*cy2*pow(w0, 2)*w1*w2*w4 + 207360*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 96768*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 - 96768*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) + 59136*cx0*cy2*pow(w0, 2)*w2*w3*w4 - 6720*cx0*cy2*pow(w0, 2)*w2*pow(w4, 2) - 168960*cx0*cy2*w0*pow(w1, 3)*w2 + 380160*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 92160*cx0*cy2*w0*pow(w1, 2)*w2*w3 - 96768*cx0*cy2*w0*pow(w1, 2)*w2*w4 - 207360*cx0*cy2*w0*w1*pow(w2, 3) - 387072*cx0*cy2*w0*w1*pow(w2, 2)*w3 + 225792*cx0*cy2*w0*w1*pow(w2, 2)*w4 + 215040*cx0*cy2*w0*w1*w2*pow(w3, 2) - 134400*cx0*cy2*w0*w1*w2*w3*w4 + 14400*cx0*cy2*w0*w1*w2*pow(w4, 2) + 290304*cx0*cy2*w0*pow(w2, 3)*w3 - 120960*cx0*cy2*w0*pow(w2, 3)*w4 - 241920*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) + 126720*cx0*cy2*w0*pow(w2, 2)*w3*w4 - 11520*cx0*cy2*w0*pow(w2, 2)*pow(w4, 2) + 46080*cx0*cy2*w0*w2*pow(w3, 3) - 26880*cx0*cy2*w0*w2*pow(w3, 2)*w4 + 3648*cx0*cy2*w0*w2*w3*pow(w4, 2) - 96*cx0*cy2*w0*w2*pow(w4, 3) + 27456*cx0*cy3*pow(w0, 3)*w1*w3 - 31680*cx0*cy3*pow(w0, 3)*w2*w3 + 5760*cx0*cy3*pow(w0, 3)*w3*w4 - 168960*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 380160*cx0*cy3*pow(w0, 2)*w1*w2*w3 - 92160*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) - 16128*cx0*cy3*pow(w0, 2)*w1*w3*w4 - 207360*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 96768*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) + 16128*cx0*cy3*pow(w0, 2)*w2*w3*w4 - 13440*cx0*cy3*pow(w0, 2)*pow(w3, 2)*w4 + 1920*cx0*cy3*pow(w0, 2)*w3*pow(w4, 2) + 253440*cx0*cy3*w0*pow(w1, 3)*w3 - 829440*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 258048*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) + 870912*cx0*cy3*w0*w1*pow(w2, 2)*w3 - 516096*cx0*cy3*w0*w1*w2*pow(w3, 2) + 53760*cx0*cy3*w0*w1*pow(w3, 3) + 15360*cx0*cy3*w0*w1*pow(w3, 2)*w4 - 2880*cx0*cy3*w0*w1*w3*pow(w4, 2) - 290304*cx0*cy3*w0*pow(w2, 3)*w3 + 241920*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) - 46080*cx0*cy3*w0*w2*pow(w3, 3) - 11520*cx0*cy3*w0*w2*pow(w3, 2)*w4 + 1728*cx0*cy3*w0*w2*w3*pow(w4, 2) + 3072*cx0*cy3*w0*pow(w3, 3)*w4 - 384*cx0*cy3*w0*pow(w3, 2)*pow(w4, 2) - 10560*cx0*cy4*pow(w0, 3)*w1*w4 + 15840*cx0*cy4*pow(w0, 3)*w2*w4 - 5760*cx0*cy4*pow(w0, 3)*w3*w4 + 63360*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 161280*cx0*cy4*pow(w0, 2)*w1*w2*w4 + 64512*cx0*cy4*pow(w0, 2)*w1*w3*w4 - 5376*cx0*cy4*pow(w0, 2)*w1*pow(w4, 2) + 96768*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 75264*cx0*cy4*pow(w0, 2)*w2*w3*w4 + 6720*cx0*cy4*pow(w0, 2)*w2*pow(w4, 2) + 13440*cx0*cy4*pow(w0, 2)*pow(w3, 2)*w4 - 1920*cx0*cy4*pow(w0, 2)*w3*pow(w4, 2) - 92160*cx0*cy4*w0*pow(w1, 3)*w4 + 322560*cx0*cy4*w0*pow(w1, 2)*w2*w4 - 129024*cx0*cy4*w0*pow(w1, 2)*w3*w4 + 13440*cx0*cy4*w0*pow(w1, 2)*pow(w4, 2) - 354816*cx0*cy4*w0*w1*pow(w2, 2)*w4 + 268800*cx0*cy4*w0*w1*w2*w3*w4 - 26880*cx0*cy4*w0*w1*w2*pow(w4, 2) - 46080*cx0*cy4*w0*w1*pow(w3, 2)*w4 + 7680*cx0*cy4*w0*w1*w3*pow(w4, 2) - 192*cx0*cy4*w0*w1*pow(w4, 3) + 120960*cx0*cy4*w0*pow(w2, 3)*w4 - 126720*cx0*cy4*w0*pow(w2, 2)*w3*w4 + 11520*cx0*cy4*w0*pow(w2, 2)*pow(w4, 2) + 38400*cx0*cy4*w0*w2*pow(w3, 2)*w4 - 5376*cx0*cy4*w0*w2*w3*pow(w4, 2) + 96*cx0*cy4*w0*w2*pow(w4, 3) - 3072*cx0*cy4*w0*pow(w3, 3)*w4 + 384*cx0*cy4*w0*pow(w3, 2)*pow(w4, 2) - 17472*cx1*cy0*pow(w0, 3)*w1*w2 + 27456*cx1*cy0*pow(w0, 3)*w1*w3 - 10560*cx1*cy0*pow(w0, 3)*w1*w4 + 109824*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 168960*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 63360*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 126720*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 253440*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 80640*cx1*cy0*pow(w0, 2)*w1*w2*w4 - 92160*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) + 48384*cx1*cy0*pow(w0, 2)*w1*w3*w4 - 5376*cx1*cy0*pow(w0, 2)*w1*pow(w4, 2) - 168960*cx1*cy0*w0*pow(w1, 3)*w2 + 253440*cx1*cy0*w0*pow(w1, 3)*w3 - 92160*cx1*cy0*w0*pow(w1, 3)*w4 + 380160*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) - 737280*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 225792*cx1*cy0*w0*pow(w1, 2)*w2*w4 + 258048*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) - 129024*cx1*cy0*w0*pow(w1, 2)*w3*w4 + 13440*cx1*cy0*w0*pow(w1, 2)*pow(w4, 2) - 207360*cx1*cy0*w0*w1*pow(w2, 3) + 483840*cx1*cy0*w0*w1*pow(w2, 2)*w3 - 129024*cx1*cy0*w0*w1*pow(w2, 2)*w4 - 301056*cx1*cy0*w0*w1*w2*pow(w3, 2) + 134400*cx1*cy0*w0*w1*w2*w3*w4 - 12480*cx1*cy0*w0*w1*w2*pow(w4, 2) + 53760*cx1*cy0*w0*w1*pow(w3, 3) - 30720*cx1*cy0*w0*w1*pow(w3, 2)*w4 + 4800*cx1*cy0*w0*w1*w3*pow(w4, 2) - 192*cx1*cy0*w0*w1*pow(w4, 3) + 17472*cx1*cy2*pow(w0, 3)*w1*w2 - 109824*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 126720*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 95040*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 28800*cx1*cy2*pow(w0, 2)*w1*w2*w4 + 168960*cx1*cy2*w0*pow(w1, 3)*w2 - 380160*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) + 368640*cx1*cy2*w0*pow(w1, 2)*w2*w3 - 129024*cx1*cy2*w0*pow(w1, 2)*w2*w4 + 207360*cx1*cy2*w0*w1*pow(w2, 3) - 387072*cx1*cy2*w0*w1*pow(w2, 2)*w3 + 129024*cx1*cy2*w0*w1*pow(w2, 2)*w4 + 129024*cx1*cy2*w0*w1*w2*pow(w3, 2) - 67200*cx1*cy2*w0*w1*w2*w3*w4 + 6720*cx1*cy2*w0*w1*w2*pow(w4, 2) - 258048*cx1*cy2*pow(w1, 3)*w2*w3 + 129024*cx1*cy2*pow(w1, 3)*w2*w4 + 516096*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 241920*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w4 - 215040*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) + 122880*cx1*cy2*pow(w1, 2)*w2*w3*w4 - 11520*cx1*cy2*pow(w1, 2)*w2*pow(w4, 2) - 241920*cx1*cy2*w1*pow(w2, 3)*w3 + 103680*cx1*cy2*w1*pow(w2, 3)*w4 + 184320*cx1*cy2*w1*pow(w2, 2)*pow(w3, 2) - 92160*cx1*cy2*w1*pow(w2, 2)*w3*w4 + 6912*cx1*cy2*w1*pow(w2, 2)*pow(w4, 2) - 30720*cx1*cy2*w1*w2*pow(w3, 3) + 15360*cx1*cy2*w1*w2*pow(w3, 2)*w4 - 1344*cx1*cy2*w1*w2*w3*pow(w4, 2) - 27456*cx1*cy3*pow(w0, 3)*w1*w3 + 168960*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 158400*cx1*cy3*pow(w0, 2)*w1*w2*w3 + 92160*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) - 24192*cx1*cy3*pow(w0, 2)*w1*w3*w4 - 253440*cx1*cy3*w0*pow(w1, 3)*w3 + 368640*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 258048*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) + 86016*cx1*cy3*w0*pow(w1, 2)*w3*w4 - 96768*cx1*cy3*w0*w1*pow(w2, 2)*w3 + 172032*cx1*cy3*w0*w1*w2*pow(w3, 2) - 67200*cx1*cy3*w0*w1*w2*w3*w4 - 53760*cx1*cy3*w0*w1*pow(w3, 3) + 30720*cx1*cy3*w0*w1*pow(w3, 2)*w4 - 2880*cx1*cy3*w0*w1*w3*pow(w4, 2) + 258048*cx1*cy3*pow(w1, 3)*w2*w3 - 53760*cx1*cy3*pow(w1, 3)*w3*w4 - 516096*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 215040*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) + 61440*cx1*cy3*pow(w1, 2)*w2*w3*w4 - 30720*cx1*cy3*pow(w1, 2)*pow(w3, 2)*w4 + 3072*cx1*cy3*pow(w1, 2)*w3*pow(w4, 2) + 241920*cx1*cy3*w1*pow(w2, 3)*w3 - 184320*cx1*cy3*w1*pow(w2, 2)*pow(w3, 2) - 11520*cx1*cy3*w1*pow(w2, 2)*w3*w4 + 30720*cx1*cy3*w1*w2*pow(w3, 3) + 12288*cx1*cy3*w1*w2*pow(w3, 2)*w4 - 960*cx1*cy3*w1*w2*w3*pow(w4, 2) - 1536*cx1*cy3*w1*pow(w3, 3)*w4 + 10560*cx1*cy4*pow(w0, 3)*w1*w4 - 63360*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 51840*cx1*cy4*pow(w0, 2)*w1*w2*w4 - 24192*cx1*cy4*pow(w0, 2)*w1*w3*w4 + 5376*cx1*cy4*pow(w0, 2)*w1*pow(w4, 2) + 92160*cx1*cy4*w0*pow(w1, 3)*w4 - 96768*cx1*cy4*w0*pow(w1, 2)*w2*w4 + 43008*cx1*cy4*w0*pow(w1, 2)*w3*w4 - 13440*cx1*cy4*w0*pow(w1, 2)*pow(w4, 2) + 5760*cx1*cy4*w0*w1*w2*pow(w4, 2) - 1920*cx1*cy4*w0*w1*w3*pow(w4, 2) + 192*cx1*cy4*w0*w1*pow(w4, 3) - 129024*cx1*cy4*pow(w1, 3)*w2*w4 + 53760*cx1*cy4*pow(w1, 3)*w3*w4 + 241920*cx1*cy4*pow(w1, 2)*pow(w2, 2)*w4 - 184320*cx1*cy4*pow(w1, 2)*w2*w3*w4 + 11520*cx1*cy4*pow(w1, 2)*w2*pow(w4, 2) + 30720*cx1*cy4*pow(w1, 2)*pow(w3, 2)*w4 - 3072*cx1*cy4*pow(w1, 2)*w3*pow(w4, 2) - 103680*cx1*cy4*w1*pow(w2, 3)*w4 + 103680*cx1*cy4*w1*pow(w2, 2)*w3*w4 - 6912*cx1*cy4*w1*pow(w2, 2)*pow(w4, 2) - 27648*cx1*cy4*w1*w2*pow(w3, 2)*w4 + 2304*cx1*cy4*w1*w2*w3*pow(w4, 2) + 1536*cx1*cy4*w1*pow(w3, 3)*w4 + 17472*cx2*cy0*pow(w0, 3)*w1*w2 - 31680*cx2*cy0*pow(w0, 3)*w2*w3 + 15840*cx2*cy0*pow(w0, 3)*w2*w4 - 109824*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 126720*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 126720*cx2*cy0*pow(w0, 2)*w1*w2*w3 - 80640*cx2*cy0*pow(w0, 2)*w1*w2*w4 - 207360*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 96768*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 96768*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) - 59136*cx2*cy0*pow(w0, 2)*w2*w3*w4 + 6720*cx2*cy0*pow(w0, 2)*w2*pow(w4, 2) + 168960*cx2*cy0*w0*pow(w1, 3)*w2 - 380160*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 92160*cx2*cy0*w0*pow(w1, 2)*w2*w3 + 96768*cx2*cy0*w0*pow(w1, 2)*w2*w4 + 207360*cx2*cy0*w0*w1*pow(w2, 3) + 387072*cx2*cy0*w0*w1*pow(w2, 2)*w3 - 225792*cx2*cy0*w0*w1*pow(w2, 2)*w4 - 215040*cx2*cy0*w0*w1*w2*pow(w3, 2) + 134400*cx2*cy0*w0*w1*w2*w3*w4 - 14400*cx2*cy0*w0*w1*w2*pow(w4, 2) - 290304*cx2*cy0*w0*pow(w2, 3)*w3 + 120960*cx2*cy0*w0*pow(w2, 3)*w4 + 241920*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) - 126720*cx2*cy0*w0*pow(w2, 2)*w3*w4 + 11520*cx2*cy0*w0*pow(w2, 2)*pow(w4, 2) - 46080*cx2*cy0*w0*w2*pow(w3, 3) + 26880*cx2*cy0*w0*w2*pow(w3, 2)*w4 - 3648*cx2*cy0*w0*w2*w3*pow(w4, 2) + 96*cx2*cy0*w0*w2*pow(w4, 3) - 17472*cx2*cy1*pow(w0, 3)*w1*w2 + 109824*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 126720*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 95040*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 28800*cx2*cy1*pow(w0, 2)*w1*w2*w4 - 168960*cx2*cy1*w0*pow(w1, 3)*w2 + 380160*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) - 368640*cx2*cy1*w0*pow(w1, 2)*w2*w3 + 129024*cx2*cy1*w0*pow(w1, 2)*w2*w4 - 207360*cx2*cy1*w0*w1*pow(w2, 3) + 387072*cx2*cy1*w0*w1*pow(w2, 2)*w3 - 129024*cx2*cy1*w0*w1*pow(w2, 2)*w4 - 129024*cx2*cy1*w0*w1*w2*pow(w3, 2) + 67200*cx2*cy1*w0*w1*w2*w3*w4 - 6720*cx2*cy1*w0*w1*w2*pow(w4, 2) + 258048*cx2*cy1*pow(w1, 3)*w2*w3 - 129024*cx2*cy1*pow(w1, 3)*w2*w4 - 516096*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 241920*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w4 + 215040*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) - 122880*cx2*cy1*pow(w1, 2)*w2*w3*w4 + 11520*cx2*cy1*pow(w1, 2)*w2*pow(w4, 2) + 241920*cx2*cy1*w1*pow(w2, 3)*w3 - 103680*cx2*cy1*w1*pow(w2, 3)*w4 - 184320*cx2*cy1*w1*pow(w2, 2)*pow(w3, 2) + 92160*cx2*cy1*w1*pow(w2, 2)*w3*w4 - 6912*cx2*cy1*w1*pow(w2, 2)*pow(w4, 2) + 30720*cx2*cy1*w1*w2*pow(w3, 3) - 15360*cx2*cy1*w1*w2*pow(w3, 2)*w4 + 1344*cx2*cy1*w1*w2*w3*pow(w4, 2) + 31680*cx2*cy3*pow(w0, 3)*w2*w3 - 221760*cx2*cy3*pow(w0, 2)*w1*w2*w3 + 207360*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 96768*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) + 18816*cx2*cy3*pow(w0, 2)*w2*w3*w4 + 460800*cx2*cy3*w0*pow(w1, 2)*w2*w3 - 774144*cx2*cy3*w0*w1*pow(w2, 2)*w3 + 344064*cx2*cy3*w0*w1*w2*pow(w3, 2) - 67200*cx2*cy3*w0*w1*w2*w3*w4 + 290304*cx2*cy3*w0*pow(w2, 3)*w3 - 241920*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) + 46080*cx2*cy3*w0*pow(w2, 2)*w3*w4 + 46080*cx2*cy3*w0*w2*pow(w3, 3) - 15360*cx2*cy3*w0*w2*pow(w3, 2)*w4 + 960*cx2*cy3*w0*w2*w3*pow(w4, 2) - 258048*cx2*cy3*pow(w1, 3)*w2*w3 + 516096*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 215040*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) + 46080*cx2*cy3*pow(w1, 2)*w2*w3*w4 - 241920*cx2*cy3*w1*pow(w2, 3)*w3 + 184320*cx2*cy3*w1*pow(w2, 2)*pow(w3, 2) - 46080*cx2*cy3*w1*pow(w2, 2)*w3*w4 - 30720*cx2*cy3*w1*w2*pow(w3, 3) + 12288*cx2*cy3*w1*w2*pow(w3, 2)*w4 - 576*cx2*cy3*w1*w2*w3*pow(w4, 2) + 6912*cx2*cy3*pow(w2, 3)*w3*w4 - 2304*cx2*cy3*pow(w2, 2)*pow(w3, 2)*w4 - 15840*cx2*cy4*pow(w0, 3)*w2*w4 + 109440*cx2*cy4*pow(w0, 2)*w1*w2*w4 - 96768*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 + 40320*cx2*cy4*pow(w0, 2)*w2*w3*w4 - 6720*cx2*cy4*pow(w0, 2)*w2*pow(w4, 2) - 225792*cx2*cy4*w0*pow(w1, 2)*w2*w4 + 354816*cx2*cy4*w0*w1*pow(w2, 2)*w4 - 134400*cx2*cy4*w0*w1*w2*w3*w4 + 21120*cx2*cy4*w0*w1*w2*pow(w4, 2) - 120960*cx2*cy4*w0*pow(w2, 3)*w4 + 80640*cx2*cy4*w0*pow(w2, 2)*w3*w4 - 11520*cx2*cy4*w0*pow(w2, 2)*pow(w4, 2) - 11520*cx2*cy4*w0*w2*pow(w3, 2)*w4 + 2688*cx2*cy4*w0*w2*w3*pow(w4, 2) - 96*cx2*cy4*w0*w2*pow(w4, 3) + 129024*cx2*cy4*pow(w1, 3)*w2*w4 - 241920*cx2*cy4*pow(w1, 2)*pow(w2, 2)*w4 + 76800*cx2*cy4*pow(w1, 2)*w2*w3*w4 - 11520*cx2*cy4*pow(w1, 2)*w2*pow(w4, 2) + 103680*cx2*cy4*w1*pow(w2, 3)*w4 - 46080*cx2*cy4*w1*pow(w2, 2)*w3*w4 + 6912*cx2*cy4*w1*pow(w2, 2)*pow(w4, 2) + 3072*cx2*cy4*w1*w2*pow(w3, 2)*w4 - 768*cx2*cy4*w1*w2*w3*pow(w4, 2) - 6912*cx2*cy4*pow(w2, 3)*w3*w4 + 2304*cx2*cy4*pow(w2, 2)*pow(w3, 2)*w4 - 27456*cx3*cy0*pow(w0, 3)*w1*w3 + 31680*cx3*cy0*pow(w0, 3)*w2*w3 - 5760*cx3*cy0*pow(w0, 3)*w3*w4 + 168960*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 380160*cx3*cy0*pow(w0, 2)*w1*w2*w3 + 92160*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) + 16128*cx3*cy0*pow(w0, 2)*w1*w3*w4 + 207360*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 96768*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) - 16128*cx3*cy0*pow(w0, 2)*w2*w3*w4 + 13440*cx3*cy0*pow(w0, 2)*pow(w3, 2)*w4 - 1920*cx3*cy0*pow(w0, 2)*w3*pow(w4, 2) - 253440*cx3*cy0*w0*pow(w1, 3)*w3 + 829440*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 258048*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) - 870912*cx3*cy0*w0*w1*pow(w2, 2)*w3 + 516096*cx3*cy0*w0*w1*w2*pow(w3, 2) - 53760*cx3*cy0*w0*w1*pow(w3, 3) - 15360*cx3*cy0*w0*w1*pow(w3, 2)*w4 + 2880*cx3*cy0*w0*w1*w3*pow(w4, 2) + 290304*cx3*cy0*w0*pow(w2, 3)*w3 - 241920*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) + 46080*cx3*cy0*w0*w2*pow(w3, 3) + 11520*cx3*cy0*w0*w2*pow(w3, 2)*w4 - 1728*cx3*cy0*w0*w2*w3*pow(w4, 2) - 3072*cx3*cy0*w0*pow(w3, 3)*w4 + 384*cx3*cy0*w0*pow(w3, 2)*pow(w4, 2) + 27456*cx3*cy1*pow(w0, 3)*w1*w3 - 168960*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 158400*cx3*cy1*pow(w0, 2)*w1*w2*w3 - 92160*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) + 24192*cx3*cy1*pow(w0, 2)*w1*w3*w4 + 253440*cx3*cy1*w0*pow(w1, 3)*w3 - 368640*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 258048*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) - 86016*cx3*cy1*w0*pow(w1, 2)*w3*w4 + 96768*cx3*cy1*w0*w1*pow(w2, 2)*w3 - 172032*cx3*cy1*w0*w1*w2*pow(w3, 2) + 67200*cx3*cy1*w0*w1*w2*w3*w4 + 53760*cx3*cy1*w0*w1*pow(w3, 3) - 30720*cx3*cy1*w0*w1*pow(w3, 2)*w4 + 2880*cx3*cy1*w0*w1*w3*pow(w4, 2) - 258048*cx3*cy1*pow(w1, 3)*w2*w3 + 53760*cx3*cy1*pow(w1, 3)*w3*w4 + 516096*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 215040*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) - 61440*cx3*cy1*pow(w1, 2)*w2*w3*w4 + 30720*cx3*cy1*pow(w1, 2)*pow(w3, 2)*w4 - 3072*cx3*cy1*pow(w1, 2)*w3*pow(w4, 2) - 241920*cx3*cy1*w1*pow(w2, 3)*w3 + 184320*cx3*cy1*w1*pow(w2, 2)*pow(w3, 2) + 11520*cx3*cy1*w1*pow(w2, 2)*w3*w4 - 30720*cx3*cy1*w1*w2*pow(w3, 3) - 12288*cx3*cy1*w1*w2*pow(w3, 2)*w4 + 960*cx3*cy1*w1*w2*w3*pow(w4, 2) + 1536*cx3*cy1*w1*pow(w3, 3)*w4 - 31680*cx3*cy2*pow(w0, 3)*w2*w3 + 221760*cx3*cy2*pow(w0, 2)*w1*w2*w3 - 207360*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 96768*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) - 18816*cx3*cy2*pow(w0, 2)*w2*w3*w4 - 460800*cx3*cy2*w0*pow(w1, 2)*w2*w3 + 774144*cx3*cy2*w0*w1*pow(w2, 2)*w3 - 344064*cx3*cy2*w0*w1*w2*pow(w3, 2) + 67200*cx3*cy2*w0*w1*w2*w3*w4 - 290304*cx3*cy2*w0*pow(w2, 3)*w3 + 241920*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) - 46080*cx3*cy2*w0*pow(w2, 2)*w3*w4 - 46080*cx3*cy2*w0*w2*pow(w3, 3) + 15360*cx3*cy2*w0*w2*pow(w3, 2)*w4 - 960*cx3*cy2*w0*w2*w3*pow(w4, 2) + 258048*cx3*cy2*pow(w1, 3)*w2*w3 - 516096*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 215040*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) - 46080*cx3*cy2*pow(w1, 2)*w2*w3*w4 + 241920*cx3*cy2*w1*pow(w2, 3)*w3 - 184320*cx3*cy2*w1*pow(w2, 2)*pow(w3, 2) + 46080*cx3*cy2*w1*pow(w2, 2)*w3*w4 + 30720*cx3*cy2*w1*w2*pow(w3, 3) - 12288*cx3*cy2*w1*w2*pow(w3, 2)*w4 + 576*cx3*cy2*w1*w2*w3*pow(w4, 2) - 6912*cx3*cy2*pow(w2, 3)*w3*w4 + 2304*cx3*cy2*pow(w2, 2)*pow(w3, 2)*w4 + 5760*cx3*cy4*pow(w0, 3)*w3*w4 - 40320*cx3*cy4*pow(w0, 2)*w1*w3*w4 + 34944*cx3*cy4*pow(w0, 2)*w2*w3*w4 - 13440*cx3*cy4*pow(w0, 2)*pow(w3, 2)*w4 + 1920*cx3*cy4*pow(w0, 2)*w3*pow(w4, 2) + 86016*cx3*cy4*w0*pow(w1, 2)*w3*w4 - 134400*cx3*cy4*w0*w1*w2*w3*w4 + 46080*cx3*cy4*w0*w1*pow(w3, 2)*w4 - 5760*cx3*cy4*w0*w1*w3*pow(w4, 2) + 46080*cx3*cy4*w0*pow(w2, 2)*w3*w4 - 26880*cx3*cy4*w0*w2*pow(w3, 2)*w4 + 2688*cx3*cy4*w0*w2*w3*pow(w4, 2) + 3072*cx3*cy4*w0*pow(w3, 3)*w4 - 384*cx3*cy4*w0*pow(w3, 2)*pow(w4, 2) - 53760*cx3*cy4*pow(w1, 3)*w3*w4 + 107520*cx3*cy4*pow(w1, 2)*w2*w3*w4 - 30720*cx3*cy4*pow(w1, 2)*pow(w3, 2)*w4 + 3072*cx3*cy4*pow(w1, 2)*w3*pow(w4, 2) - 57600*cx3*cy4*w1*pow(w2, 2)*w3*w4 + 24576*cx3*cy4*w1*w2*pow(w3, 2)*w4 - 1536*cx3*cy4*w1*w2*w3*pow(w4, 2) - 1536*cx3*cy4*w1*pow(w3, 3)*w4 + 6912*cx3*cy4*pow(w2, 3)*w3*w4 - 2304*cx3*cy4*pow(w2, 2)*pow(w3, 2)*w4 + 10560*cx4*cy0*pow(w0, 3)*w1*w4 - 15840*cx4*cy0*pow(w0, 3)*w2*w4 + 5760*cx4*cy0*pow(w0, 3)*w3*w4 - 63360*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 161280*cx4*cy0*pow(w0, 2)*w1*w2*w4 - 64512*cx4*cy0*pow(w0, 2)*w1*w3*w4 + 5376*cx4*cy0*pow(w0, 2)*w1*pow(w4, 2) - 96768*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 75264*cx4*cy0*pow(w0, 2)*w2*w3*w4 - 6720*cx4*cy0*pow(w0, 2)*w2*pow(w4, 2) - 13440*cx4*cy0*pow(w0, 2)*pow(w3, 2)*w4 + 1920*cx4*cy0*pow(w0, 2)*w3*pow(w4, 2) + 92160*cx4*cy0*w0*pow(w1, 3)*w4 - 322560*cx4*cy0*w0*pow(w1, 2)*w2*w4 + 129024*cx4*cy0*w0*pow(w1, 2)*w3*w4 - 13440*cx4*cy0*w0*pow(w1, 2)*pow(w4, 2) + 354816*cx4*cy0*w0*w1*pow(w2, 2)*w4 - 268800*cx4*cy0*w0*w1*w2*w3*w4 + 26880*cx4*cy0*w0*w1*w2*pow(w4, 2) + 46080*cx4*cy0*w0*w1*pow(w3, 2)*w4 - 7680*cx4*cy0*w0*w1*w3*pow(w4, 2) + 192*cx4*cy0*w0*w1*pow(w4, 3) - 120960*cx4*cy0*w0*pow(w2, 3)*w4 + 126720*cx4*cy0*w0*pow(w2, 2)*w3*w4 - 11520*cx4*cy0*w0*pow(w2, 2)*pow(w4, 2) - 38400*cx4*cy0*w0*w2*pow(w3, 2)*w4 + 5376*cx4*cy0*w0*w2*w3*pow(w4, 2) - 96*cx4*cy0*w0*w2*pow(w4, 3) + 3072*cx4*cy0*w0*pow(w3, 3)*w4 - 384*cx4*cy0*w0*pow(w3, 2)*pow(w4, 2) - 10560*cx4*cy1*pow(w0, 3)*w1*w4 + 63360*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 51840*cx4*cy1*pow(w0, 2)*w1*w2*w4 + 24192*cx4*cy1*pow(w0, 2)*w1*w3*w4 - 5376*cx4*cy1*pow(w0, 2)*w1*pow(w4, 2) - 92160*cx4*cy1*w0*pow(w1, 3)*w4 + 96768*cx4*cy1*w0*pow(w1, 2)*w2*w4 - 43008*cx4*cy1*w0*pow(w1, 2)*w3*w4 + 13440*cx4*cy1*w0*pow(w1, 2)*pow(w4, 2) - 5760*cx4*cy1*w0*w1*w2*pow(w4, 2) + 1920*cx4*cy1*w0*w1*w3*pow(w4, 2) - 192*cx4*cy1*w0*w1*pow(w4, 3) + 129024*cx4*cy1*pow(w1, 3)*w2*w4 - 53760*cx4*cy1*pow(w1, 3)*w3*w4 - 241920*cx4*cy1*pow(w1, 2)*pow(w2, 2)*w4 + 184320*cx4*cy1*pow(w1, 2)*w2*w3*w4 - 11520*cx4*cy1*pow(w1, 2)*w2*pow(w4, 2) - 30720*cx4*cy1*pow(w1, 2)*pow(w3, 2)*w4 + 3072*cx4*cy1*pow(w1, 2)*w3*pow(w4, 2) + 103680*cx4*cy1*w1*pow(w2, 3)*w4 - 103680*cx4*cy1*w1*pow(w2, 2)*w3*w4 + 6912*cx4*cy1*w1*pow(w2, 2)*pow(w4, 2) + 27648*cx4*cy1*w1*w2*pow(w3, 2)*w4 - 2304*cx4*cy1*w1*w2*w3*pow(w4, 2) - 1536*cx4*cy1*w1*pow(w3, 3)*w4 + 15840*cx4*cy2*pow(w0, 3)*w2*w4 - 109440*cx4*cy2*pow(w0, 2)*w1*w2*w4 + 96768*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 - 40320*cx4*cy2*pow(w0, 2)*w2*w3*w4 + 6720*cx4*cy2*pow(w0, 2)*w2*pow(w4, 2) + 225792*cx4*cy2*w0*pow(w1, 2)*w2*w4 - 354816*cx4*cy2*w0*w1*pow(w2, 2)*w4 + 134400*cx4*cy2*w0*w1*w2*w3*w4 - 21120*cx4*cy2*w0*w1*w2*pow(w4, 2) + 120960*cx4*cy2*w0*pow(w2, 3)*w4 - 80640*cx4*cy2*w0*pow(w2, 2)*w3*w4 + 11520*cx4*cy2*w0*pow(w2, 2)*pow(w4, 2) + 11520*cx4*cy2*w0*w2*pow(w3, 2)*w4 - 2688*cx4*cy2*w0*w2*w3*pow(w4, 2) + 96*cx4*cy2*w0*w2*pow(w4, 3) - 129024*cx4*cy2*pow(w1, 3)*w2*w4 + 241920*cx4*cy2*pow(w1, 2)*pow(w2, 2)*w4 - 76800*cx4*cy2*pow(w1, 2)*w2*w3*w4 + 11520*cx4*cy2*pow(w1, 2)*w2*pow(w4, 2) - 103680*cx4*cy2*w1*pow(w2, 3)*w4 + 46080*cx4*cy2*w1*pow(w2, 2)*w3*w4 - 6912*cx4*cy2*w1*pow(w2, 2)*pow(w4, 2) - 3072*cx4*cy2*w1*w2*pow(w3, 2)*w4 + 768*cx4*cy2*w1*w2*w3*pow(w4, 2) + 6912*cx4*cy2*pow(w2, 3)*w3*w4 - 2304*cx4*cy2*pow(w2, 2)*pow(w3, 2)*w4 - 5760*cx4*cy3*pow(w0, 3)*w3*w4 + 40320*cx4*cy3*pow(w0, 2)*w1*w3*w4 - 34944*cx4*cy3*pow(w0, 2)*w2*w3*w4 + 13440*cx4*cy3*pow(w0, 2)*pow(w3, 2)*w4 - 1920*cx4*cy3*pow(w0, 2)*w3*pow(w4, 2) - 86016*cx4*cy3*w0*pow(w1, 2)*w3*w4 + 134400*cx4*cy3*w0*w1*w2*w3*w4 - 46080*cx4*cy3*w0*w1*pow(w3, 2)*w4 + 5760*cx4*cy3*w0*w1*w3*pow(w4, 2) - 46080*cx4*cy3*w0*pow(w2, 2)*w3*w4 + 26880*cx4*cy3*w0*w2*pow(w3, 2)*w4 - 2688*cx4*cy3*w0*w2*w3*pow(w4, 2) - 3072*cx4*cy3*w0*pow(w3, 3)*w4 + 384*cx4*cy3*w0*pow(w3, 2)*pow(w4, 2) + 53760*cx4*cy3*pow(w1, 3)*w3*w4 - 107520*cx4*cy3*pow(w1, 2)*w2*w3*w4 + 30720*cx4*cy3*pow(w1, 2)*pow(w3, 2)*w4 - 3072*cx4*cy3*pow(w1, 2)*w3*pow(w4, 2) + 57600*cx4*cy3*w1*pow(w2, 2)*w3*w4 - 24576*cx4*cy3*w1*w2*pow(w3, 2)*w4 + 1536*cx4*cy3*w1*w2*w3*pow(w4, 2) + 1536*cx4*cy3*w1*pow(w3, 3)*w4 - 6912*cx4*cy3*pow(w2, 3)*w3*w4 + 2304*cx4*cy3*pow(w2, 2)*pow(w3, 2)*w4,
-    -4368*cx0*cy1*pow(w0, 3)*w1*w2 + 7488*cx0*cy1*pow(w0, 3)*w1*w3 - 3168*cx0*cy1*pow(w0, 3)*w1*w4 + 29952*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 50688*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 21120*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 38016*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 84480*cx0*cy1*pow(w0, 2)*w1*w2*w3 - 30240*cx0*cy1*pow(w0, 2)*w1*w2*w4 - 34560*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) + 20736*cx0*cy1*pow(w0, 2)*w1*w3*w4 - 2688*cx0*cy1*pow(w0, 2)*w1*pow(w4, 2) - 50688*cx0*cy1*w0*pow(w1, 3)*w2 + 84480*cx0*cy1*w0*pow(w1, 3)*w3 - 34560*cx0*cy1*w0*pow(w1, 3)*w4 + 126720*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 276480*cx0*cy1*w0*pow(w1, 2)*w2*w3 + 96768*cx0*cy1*w0*pow(w1, 2)*w2*w4 + 110592*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) - 64512*cx0*cy1*w0*pow(w1, 2)*w3*w4 + 8064*cx0*cy1*w0*pow(w1, 2)*pow(w4, 2) - 77760*cx0*cy1*w0*w1*pow(w2, 3) + 207360*cx0*cy1*w0*w1*pow(w2, 2)*w3 - 64512*cx0*cy1*w0*w1*pow(w2, 2)*w4 - 150528*cx0*cy1*w0*w1*w2*pow(w3, 2) + 80640*cx0*cy1*w0*w1*w2*w3*w4 - 9360*cx0*cy1*w0*w1*w2*pow(w4, 2) + 32256*cx0*cy1*w0*w1*pow(w3, 3) - 23040*cx0*cy1*w0*w1*pow(w3, 2)*w4 + 4800*cx0*cy1*w0*w1*w3*pow(w4, 2) - 288*cx0*cy1*w0*w1*pow(w4, 3) + 4368*cx0*cy2*pow(w0, 3)*w1*w2 - 9504*cx0*cy2*pow(w0, 3)*w2*w3 + 5280*cx0*cy2*pow(w0, 3)*w2*w4 - 29952*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 38016*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 42240*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 30240*cx0*cy2*pow(w0, 2)*w1*w2*w4 - 77760*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 41472*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 41472*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) - 29568*cx0*cy2*pow(w0, 2)*w2*w3*w4 + 4032*cx0*cy2*pow(w0, 2)*w2*pow(w4, 2) + 50688*cx0*cy2*w0*pow(w1, 3)*w2 - 126720*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 34560*cx0*cy2*w0*pow(w1, 2)*w2*w3 + 41472*cx0*cy2*w0*pow(w1, 2)*w2*w4 + 77760*cx0*cy2*w0*w1*pow(w2, 3) + 165888*cx0*cy2*w0*w1*pow(w2, 2)*w3 - 112896*cx0*cy2*w0*w1*pow(w2, 2)*w4 - 107520*cx0*cy2*w0*w1*w2*pow(w3, 2) + 80640*cx0*cy2*w0*w1*w2*w3*w4 - 10800*cx0*cy2*w0*w1*w2*pow(w4, 2) - 145152*cx0*cy2*w0*pow(w2, 3)*w3 + 72576*cx0*cy2*w0*pow(w2, 3)*w4 + 145152*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) - 95040*cx0*cy2*w0*pow(w2, 2)*w3*w4 + 11520*cx0*cy2*w0*pow(w2, 2)*pow(w4, 2) - 34560*cx0*cy2*w0*w2*pow(w3, 3) + 26880*cx0*cy2*w0*w2*pow(w3, 2)*w4 - 5472*cx0*cy2*w0*w2*w3*pow(w4, 2) + 288*cx0*cy2*w0*w2*pow(w4, 3) - 7488*cx0*cy3*pow(w0, 3)*w1*w3 + 9504*cx0*cy3*pow(w0, 3)*w2*w3 - 2160*cx0*cy3*pow(w0, 3)*w3*w4 + 50688*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 126720*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 34560*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) + 6912*cx0*cy3*pow(w0, 2)*w1*w3*w4 + 77760*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 41472*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) - 8064*cx0*cy3*pow(w0, 2)*w2*w3*w4 + 8064*cx0*cy3*pow(w0, 2)*pow(w3, 2)*w4 - 1440*cx0*cy3*pow(w0, 2)*w3*pow(w4, 2) - 84480*cx0*cy3*w0*pow(w1, 3)*w3 + 311040*cx0*cy3*w0*pow(w1, 2)*w2*w3 - 110592*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) - 373248*cx0*cy3*w0*w1*pow(w2, 2)*w3 + 258048*cx0*cy3*w0*w1*w2*pow(w3, 2) - 32256*cx0*cy3*w0*w1*pow(w3, 3) - 11520*cx0*cy3*w0*w1*pow(w3, 2)*w4 + 2880*cx0*cy3*w0*w1*w3*pow(w4, 2) + 145152*cx0*cy3*w0*pow(w2, 3)*w3 - 145152*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) + 34560*cx0*cy3*w0*w2*pow(w3, 3) + 11520*cx0*cy3*w0*w2*pow(w3, 2)*w4 - 2592*cx0*cy3*w0*w2*w3*pow(w4, 2) - 4608*cx0*cy3*w0*pow(w3, 3)*w4 + 1152*cx0*cy3*w0*pow(w3, 2)*pow(w4, 2) - 48*cx0*cy3*w0*w3*pow(w4, 3) + 3168*cx0*cy4*pow(w0, 3)*w1*w4 - 5280*cx0*cy4*pow(w0, 3)*w2*w4 + 2160*cx0*cy4*pow(w0, 3)*w3*w4 - 21120*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 60480*cx0*cy4*pow(w0, 2)*w1*w2*w4 - 27648*cx0*cy4*pow(w0, 2)*w1*w3*w4 + 2688*cx0*cy4*pow(w0, 2)*w1*pow(w4, 2) - 41472*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 + 37632*cx0*cy4*pow(w0, 2)*w2*w3*w4 - 4032*cx0*cy4*pow(w0, 2)*w2*pow(w4, 2) - 8064*cx0*cy4*pow(w0, 2)*pow(w3, 2)*w4 + 1440*cx0*cy4*pow(w0, 2)*w3*pow(w4, 2) + 34560*cx0*cy4*w0*pow(w1, 3)*w4 - 138240*cx0*cy4*w0*pow(w1, 2)*w2*w4 + 64512*cx0*cy4*w0*pow(w1, 2)*w3*w4 - 8064*cx0*cy4*w0*pow(w1, 2)*pow(w4, 2) + 177408*cx0*cy4*w0*w1*pow(w2, 2)*w4 - 161280*cx0*cy4*w0*w1*w2*w3*w4 + 20160*cx0*cy4*w0*w1*w2*pow(w4, 2) + 34560*cx0*cy4*w0*w1*pow(w3, 2)*w4 - 7680*cx0*cy4*w0*w1*w3*pow(w4, 2) + 288*cx0*cy4*w0*w1*pow(w4, 3) - 72576*cx0*cy4*w0*pow(w2, 3)*w4 + 95040*cx0*cy4*w0*pow(w2, 2)*w3*w4 - 11520*cx0*cy4*w0*pow(w2, 2)*pow(w4, 2) - 38400*cx0*cy4*w0*w2*pow(w3, 2)*w4 + 8064*cx0*cy4*w0*w2*w3*pow(w4, 2) - 288*cx0*cy4*w0*w2*pow(w4, 3) + 4608*cx0*cy4*w0*pow(w3, 3)*w4 - 1152*cx0*cy4*w0*pow(w3, 2)*pow(w4, 2) + 48*cx0*cy4*w0*w3*pow(w4, 3) + 4368*cx1*cy0*pow(w0, 3)*w1*w2 - 7488*cx1*cy0*pow(w0, 3)*w1*w3 + 3168*cx1*cy0*pow(w0, 3)*w1*w4 - 29952*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 50688*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 21120*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 38016*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 84480*cx1*cy0*pow(w0, 2)*w1*w2*w3 + 30240*cx1*cy0*pow(w0, 2)*w1*w2*w4 + 34560*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) - 20736*cx1*cy0*pow(w0, 2)*w1*w3*w4 + 2688*cx1*cy0*pow(w0, 2)*w1*pow(w4, 2) + 50688*cx1*cy0*w0*pow(w1, 3)*w2 - 84480*cx1*cy0*w0*pow(w1, 3)*w3 + 34560*cx1*cy0*w0*pow(w1, 3)*w4 - 126720*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 276480*cx1*cy0*w0*pow(w1, 2)*w2*w3 - 96768*cx1*cy0*w0*pow(w1, 2)*w2*w4 - 110592*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) + 64512*cx1*cy0*w0*pow(w1, 2)*w3*w4 - 8064*cx1*cy0*w0*pow(w1, 2)*pow(w4, 2) + 77760*cx1*cy0*w0*w1*pow(w2, 3) - 207360*cx1*cy0*w0*w1*pow(w2, 2)*w3 + 64512*cx1*cy0*w0*w1*pow(w2, 2)*w4 + 150528*cx1*cy0*w0*w1*w2*pow(w3, 2) - 80640*cx1*cy0*w0*w1*w2*w3*w4 + 9360*cx1*cy0*w0*w1*w2*pow(w4, 2) - 32256*cx1*cy0*w0*w1*pow(w3, 3) + 23040*cx1*cy0*w0*w1*pow(w3, 2)*w4 - 4800*cx1*cy0*w0*w1*w3*pow(w4, 2) + 288*cx1*cy0*w0*w1*pow(w4, 3) - 4368*cx1*cy2*pow(w0, 3)*w1*w2 + 29952*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 38016*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 31680*cx1*cy2*pow(w0, 2)*w1*w2*w3 - 10800*cx1*cy2*pow(w0, 2)*w1*w2*w4 - 50688*cx1*cy2*w0*pow(w1, 3)*w2 + 126720*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 138240*cx1*cy2*w0*pow(w1, 2)*w2*w3 + 55296*cx1*cy2*w0*pow(w1, 2)*w2*w4 - 77760*cx1*cy2*w0*w1*pow(w2, 3) + 165888*cx1*cy2*w0*w1*pow(w2, 2)*w3 - 64512*cx1*cy2*w0*w1*pow(w2, 2)*w4 - 64512*cx1*cy2*w0*w1*w2*pow(w3, 2) + 40320*cx1*cy2*w0*w1*w2*w3*w4 - 5040*cx1*cy2*w0*w1*w2*pow(w4, 2) + 110592*cx1*cy2*pow(w1, 3)*w2*w3 - 64512*cx1*cy2*pow(w1, 3)*w2*w4 - 258048*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 145152*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w4 + 129024*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) - 92160*cx1*cy2*pow(w1, 2)*w2*w3*w4 + 11520*cx1*cy2*pow(w1, 2)*w2*pow(w4, 2) + 145152*cx1*cy2*w1*pow(w2, 3)*w3 - 77760*cx1*cy2*w1*pow(w2, 3)*w4 - 138240*cx1*cy2*w1*pow(w2, 2)*pow(w3, 2) + 92160*cx1*cy2*w1*pow(w2, 2)*w3*w4 - 10368*cx1*cy2*w1*pow(w2, 2)*pow(w4, 2) + 30720*cx1*cy2*w1*w2*pow(w3, 3) - 23040*cx1*cy2*w1*w2*pow(w3, 2)*w4 + 4032*cx1*cy2*w1*w2*w3*pow(w4, 2) - 144*cx1*cy2*w1*w2*pow(w4, 3) + 7488*cx1*cy3*pow(w0, 3)*w1*w3 - 50688*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 52800*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 34560*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) + 10368*cx1*cy3*pow(w0, 2)*w1*w3*w4 + 84480*cx1*cy3*w0*pow(w1, 3)*w3 - 138240*cx1*cy3*w0*pow(w1, 2)*w2*w3 + 110592*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) - 43008*cx1*cy3*w0*pow(w1, 2)*w3*w4 + 41472*cx1*cy3*w0*w1*pow(w2, 2)*w3 - 86016*cx1*cy3*w0*w1*w2*pow(w3, 2) + 40320*cx1*cy3*w0*w1*w2*w3*w4 + 32256*cx1*cy3*w0*w1*pow(w3, 3) - 23040*cx1*cy3*w0*w1*pow(w3, 2)*w4 + 2880*cx1*cy3*w0*w1*w3*pow(w4, 2) - 110592*cx1*cy3*pow(w1, 3)*w2*w3 + 32256*cx1*cy3*pow(w1, 3)*w3*w4 + 258048*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 129024*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) - 46080*cx1*cy3*pow(w1, 2)*w2*w3*w4 + 30720*cx1*cy3*pow(w1, 2)*pow(w3, 2)*w4 - 4608*cx1*cy3*pow(w1, 2)*w3*pow(w4, 2) - 145152*cx1*cy3*w1*pow(w2, 3)*w3 + 138240*cx1*cy3*w1*pow(w2, 2)*pow(w3, 2) + 11520*cx1*cy3*w1*pow(w2, 2)*w3*w4 - 30720*cx1*cy3*w1*w2*pow(w3, 3) - 18432*cx1*cy3*w1*w2*pow(w3, 2)*w4 + 2880*cx1*cy3*w1*w2*w3*pow(w4, 2) + 4608*cx1*cy3*w1*pow(w3, 3)*w4 - 768*cx1*cy3*w1*pow(w3, 2)*pow(w4, 2) - 3168*cx1*cy4*pow(w0, 3)*w1*w4 + 21120*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 19440*cx1*cy4*pow(w0, 2)*w1*w2*w4 + 10368*cx1*cy4*pow(w0, 2)*w1*w3*w4 - 2688*cx1*cy4*pow(w0, 2)*w1*pow(w4, 2) - 34560*cx1*cy4*w0*pow(w1, 3)*w4 + 41472*cx1*cy4*w0*pow(w1, 2)*w2*w4 - 21504*cx1*cy4*w0*pow(w1, 2)*w3*w4 + 8064*cx1*cy4*w0*pow(w1, 2)*pow(w4, 2) - 4320*cx1*cy4*w0*w1*w2*pow(w4, 2) + 1920*cx1*cy4*w0*w1*w3*pow(w4, 2) - 288*cx1*cy4*w0*w1*pow(w4, 3) + 64512*cx1*cy4*pow(w1, 3)*w2*w4 - 32256*cx1*cy4*pow(w1, 3)*w3*w4 - 145152*cx1*cy4*pow(w1, 2)*pow(w2, 2)*w4 + 138240*cx1*cy4*pow(w1, 2)*w2*w3*w4 - 11520*cx1*cy4*pow(w1, 2)*w2*pow(w4, 2) - 30720*cx1*cy4*pow(w1, 2)*pow(w3, 2)*w4 + 4608*cx1*cy4*pow(w1, 2)*w3*pow(w4, 2) + 77760*cx1*cy4*w1*pow(w2, 3)*w4 - 103680*cx1*cy4*w1*pow(w2, 2)*w3*w4 + 10368*cx1*cy4*w1*pow(w2, 2)*pow(w4, 2) + 41472*cx1*cy4*w1*w2*pow(w3, 2)*w4 - 6912*cx1*cy4*w1*w2*w3*pow(w4, 2) + 144*cx1*cy4*w1*w2*pow(w4, 3) - 4608*cx1*cy4*w1*pow(w3, 3)*w4 + 768*cx1*cy4*w1*pow(w3, 2)*pow(w4, 2) - 4368*cx2*cy0*pow(w0, 3)*w1*w2 + 9504*cx2*cy0*pow(w0, 3)*w2*w3 - 5280*cx2*cy0*pow(w0, 3)*w2*w4 + 29952*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 38016*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 42240*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 30240*cx2*cy0*pow(w0, 2)*w1*w2*w4 + 77760*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 41472*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 41472*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) + 29568*cx2*cy0*pow(w0, 2)*w2*w3*w4 - 4032*cx2*cy0*pow(w0, 2)*w2*pow(w4, 2) - 50688*cx2*cy0*w0*pow(w1, 3)*w2 + 126720*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) + 34560*cx2*cy0*w0*pow(w1, 2)*w2*w3 - 41472*cx2*cy0*w0*pow(w1, 2)*w2*w4 - 77760*cx2*cy0*w0*w1*pow(w2, 3) - 165888*cx2*cy0*w0*w1*pow(w2, 2)*w3 + 112896*cx2*cy0*w0*w1*pow(w2, 2)*w4 + 107520*cx2*cy0*w0*w1*w2*pow(w3, 2) - 80640*cx2*cy0*w0*w1*w2*w3*w4 + 10800*cx2*cy0*w0*w1*w2*pow(w4, 2) + 145152*cx2*cy0*w0*pow(w2, 3)*w3 - 72576*cx2*cy0*w0*pow(w2, 3)*w4 - 145152*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) + 95040*cx2*cy0*w0*pow(w2, 2)*w3*w4 - 11520*cx2*cy0*w0*pow(w2, 2)*pow(w4, 2) + 34560*cx2*cy0*w0*w2*pow(w3, 3) - 26880*cx2*cy0*w0*w2*pow(w3, 2)*w4 + 5472*cx2*cy0*w0*w2*w3*pow(w4, 2) - 288*cx2*cy0*w0*w2*pow(w4, 3) + 4368*cx2*cy1*pow(w0, 3)*w1*w2 - 29952*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 38016*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 31680*cx2*cy1*pow(w0, 2)*w1*w2*w3 + 10800*cx2*cy1*pow(w0, 2)*w1*w2*w4 + 50688*cx2*cy1*w0*pow(w1, 3)*w2 - 126720*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 138240*cx2*cy1*w0*pow(w1, 2)*w2*w3 - 55296*cx2*cy1*w0*pow(w1, 2)*w2*w4 + 77760*cx2*cy1*w0*w1*pow(w2, 3) - 165888*cx2*cy1*w0*w1*pow(w2, 2)*w3 + 64512*cx2*cy1*w0*w1*pow(w2, 2)*w4 + 64512*cx2*cy1*w0*w1*w2*pow(w3, 2) - 40320*cx2*cy1*w0*w1*w2*w3*w4 + 5040*cx2*cy1*w0*w1*w2*pow(w4, 2) - 110592*cx2*cy1*pow(w1, 3)*w2*w3 + 64512*cx2*cy1*pow(w1, 3)*w2*w4 + 258048*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 145152*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w4 - 129024*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) + 92160*cx2*cy1*pow(w1, 2)*w2*w3*w4 - 11520*cx2*cy1*pow(w1, 2)*w2*pow(w4, 2) - 145152*cx2*cy1*w1*pow(w2, 3)*w3 + 77760*cx2*cy1*w1*pow(w2, 3)*w4 + 138240*cx2*cy1*w1*pow(w2, 2)*pow(w3, 2) - 92160*cx2*cy1*w1*pow(w2, 2)*w3*w4 + 10368*cx2*cy1*w1*pow(w2, 2)*pow(w4, 2) - 30720*cx2*cy1*w1*w2*pow(w3, 3) + 23040*cx2*cy1*w1*w2*pow(w3, 2)*w4 - 4032*cx2*cy1*w1*w2*w3*pow(w4, 2) + 144*cx2*cy1*w1*w2*pow(w4, 3) - 9504*cx2*cy3*pow(w0, 3)*w2*w3 + 73920*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 77760*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 41472*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) - 9408*cx2*cy3*pow(w0, 2)*w2*w3*w4 - 172800*cx2*cy3*w0*pow(w1, 2)*w2*w3 + 331776*cx2*cy3*w0*w1*pow(w2, 2)*w3 - 172032*cx2*cy3*w0*w1*w2*pow(w3, 2) + 40320*cx2*cy3*w0*w1*w2*w3*w4 - 145152*cx2*cy3*w0*pow(w2, 3)*w3 + 145152*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) - 34560*cx2*cy3*w0*pow(w2, 2)*w3*w4 - 34560*cx2*cy3*w0*w2*pow(w3, 3) + 15360*cx2*cy3*w0*w2*pow(w3, 2)*w4 - 1440*cx2*cy3*w0*w2*w3*pow(w4, 2) + 110592*cx2*cy3*pow(w1, 3)*w2*w3 - 258048*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 129024*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) - 34560*cx2*cy3*pow(w1, 2)*w2*w3*w4 + 145152*cx2*cy3*w1*pow(w2, 3)*w3 - 138240*cx2*cy3*w1*pow(w2, 2)*pow(w3, 2) + 46080*cx2*cy3*w1*pow(w2, 2)*w3*w4 + 30720*cx2*cy3*w1*w2*pow(w3, 3) - 18432*cx2*cy3*w1*w2*pow(w3, 2)*w4 + 1728*cx2*cy3*w1*w2*w3*pow(w4, 2) - 10368*cx2*cy3*pow(w2, 3)*w3*w4 + 6912*cx2*cy3*pow(w2, 2)*pow(w3, 2)*w4 - 576*cx2*cy3*pow(w2, 2)*w3*pow(w4, 2) - 768*cx2*cy3*w2*pow(w3, 3)*w4 + 5280*cx2*cy4*pow(w0, 3)*w2*w4 - 41040*cx2*cy4*pow(w0, 2)*w1*w2*w4 + 41472*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 20160*cx2*cy4*pow(w0, 2)*w2*w3*w4 + 4032*cx2*cy4*pow(w0, 2)*w2*pow(w4, 2) + 96768*cx2*cy4*w0*pow(w1, 2)*w2*w4 - 177408*cx2*cy4*w0*w1*pow(w2, 2)*w4 + 80640*cx2*cy4*w0*w1*w2*w3*w4 - 15840*cx2*cy4*w0*w1*w2*pow(w4, 2) + 72576*cx2*cy4*w0*pow(w2, 3)*w4 - 60480*cx2*cy4*w0*pow(w2, 2)*w3*w4 + 11520*cx2*cy4*w0*pow(w2, 2)*pow(w4, 2) + 11520*cx2*cy4*w0*w2*pow(w3, 2)*w4 - 4032*cx2*cy4*w0*w2*w3*pow(w4, 2) + 288*cx2*cy4*w0*w2*pow(w4, 3) - 64512*cx2*cy4*pow(w1, 3)*w2*w4 + 145152*cx2*cy4*pow(w1, 2)*pow(w2, 2)*w4 - 57600*cx2*cy4*pow(w1, 2)*w2*w3*w4 + 11520*cx2*cy4*pow(w1, 2)*w2*pow(w4, 2) - 77760*cx2*cy4*w1*pow(w2, 3)*w4 + 46080*cx2*cy4*w1*pow(w2, 2)*w3*w4 - 10368*cx2*cy4*w1*pow(w2, 2)*pow(w4, 2) - 4608*cx2*cy4*w1*w2*pow(w3, 2)*w4 + 2304*cx2*cy4*w1*w2*w3*pow(w4, 2) - 144*cx2*cy4*w1*w2*pow(w4, 3) + 10368*cx2*cy4*pow(w2, 3)*w3*w4 - 6912*cx2*cy4*pow(w2, 2)*pow(w3, 2)*w4 + 576*cx2*cy4*pow(w2, 2)*w3*pow(w4, 2) + 768*cx2*cy4*w2*pow(w3, 3)*w4 + 7488*cx3*cy0*pow(w0, 3)*w1*w3 - 9504*cx3*cy0*pow(w0, 3)*w2*w3 + 2160*cx3*cy0*pow(w0, 3)*w3*w4 - 50688*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 126720*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 34560*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) - 6912*cx3*cy0*pow(w0, 2)*w1*w3*w4 - 77760*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 41472*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) + 8064*cx3*cy0*pow(w0, 2)*w2*w3*w4 - 8064*cx3*cy0*pow(w0, 2)*pow(w3, 2)*w4 + 1440*cx3*cy0*pow(w0, 2)*w3*pow(w4, 2) + 84480*cx3*cy0*w0*pow(w1, 3)*w3 - 311040*cx3*cy0*w0*pow(w1, 2)*w2*w3 + 110592*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) + 373248*cx3*cy0*w0*w1*pow(w2, 2)*w3 - 258048*cx3*cy0*w0*w1*w2*pow(w3, 2) + 32256*cx3*cy0*w0*w1*pow(w3, 3) + 11520*cx3*cy0*w0*w1*pow(w3, 2)*w4 - 2880*cx3*cy0*w0*w1*w3*pow(w4, 2) - 145152*cx3*cy0*w0*pow(w2, 3)*w3 + 145152*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) - 34560*cx3*cy0*w0*w2*pow(w3, 3) - 11520*cx3*cy0*w0*w2*pow(w3, 2)*w4 + 2592*cx3*cy0*w0*w2*w3*pow(w4, 2) + 4608*cx3*cy0*w0*pow(w3, 3)*w4 - 1152*cx3*cy0*w0*pow(w3, 2)*pow(w4, 2) + 48*cx3*cy0*w0*w3*pow(w4, 3) - 7488*cx3*cy1*pow(w0, 3)*w1*w3 + 50688*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 52800*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 34560*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) - 10368*cx3*cy1*pow(w0, 2)*w1*w3*w4 - 84480*cx3*cy1*w0*pow(w1, 3)*w3 + 138240*cx3*cy1*w0*pow(w1, 2)*w2*w3 - 110592*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) + 43008*cx3*cy1*w0*pow(w1, 2)*w3*w4 - 41472*cx3*cy1*w0*w1*pow(w2, 2)*w3 + 86016*cx3*cy1*w0*w1*w2*pow(w3, 2) - 40320*cx3*cy1*w0*w1*w2*w3*w4 - 32256*cx3*cy1*w0*w1*pow(w3, 3) + 23040*cx3*cy1*w0*w1*pow(w3, 2)*w4 - 2880*cx3*cy1*w0*w1*w3*pow(w4, 2) + 110592*cx3*cy1*pow(w1, 3)*w2*w3 - 32256*cx3*cy1*pow(w1, 3)*w3*w4 - 258048*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 129024*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) + 46080*cx3*cy1*pow(w1, 2)*w2*w3*w4 - 30720*cx3*cy1*pow(w1, 2)*pow(w3, 2)*w4 + 4608*cx3*cy1*pow(w1, 2)*w3*pow(w4, 2) + 145152*cx3*cy1*w1*pow(w2, 3)*w3 - 138240*cx3*cy1*w1*pow(w2, 2)*pow(w3, 2) - 11520*cx3*cy1*w1*pow(w2, 2)*w3*w4 + 30720*cx3*cy1*w1*w2*pow(w3, 3) + 18432*cx3*cy1*w1*w2*pow(w3, 2)*w4 - 2880*cx3*cy1*w1*w2*w3*pow(w4, 2) - 4608*cx3*cy1*w1*pow(w3, 3)*w4 + 768*cx3*cy1*w1*pow(w3, 2)*pow(w4, 2) + 9504*cx3*cy2*pow(w0, 3)*w2*w3 - 73920*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 77760*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 41472*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) + 9408*cx3*cy2*pow(w0, 2)*w2*w3*w4 + 172800*cx3*cy2*w0*pow(w1, 2)*w2*w3 - 331776*cx3*cy2*w0*w1*pow(w2, 2)*w3 + 172032*cx3*cy2*w0*w1*w2*pow(w3, 2) - 40320*cx3*cy2*w0*w1*w2*w3*w4 + 145152*cx3*cy2*w0*pow(w2, 3)*w3 - 145152*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) + 34560*cx3*cy2*w0*pow(w2, 2)*w3*w4 + 34560*cx3*cy2*w0*w2*pow(w3, 3) - 15360*cx3*cy2*w0*w2*pow(w3, 2)*w4 + 1440*cx3*cy2*w0*w2*w3*pow(w4, 2) - 110592*cx3*cy2*pow(w1, 3)*w2*w3 + 258048*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 129024*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) + 34560*cx3*cy2*pow(w1, 2)*w2*w3*w4 - 145152*cx3*cy2*w1*pow(w2, 3)*w3 + 138240*cx3*cy2*w1*pow(w2, 2)*pow(w3, 2) - 46080*cx3*cy2*w1*pow(w2, 2)*w3*w4 - 30720*cx3*cy2*w1*w2*pow(w3, 3) + 18432*cx3*cy2*w1*w2*pow(w3, 2)*w4 - 1728*cx3*cy2*w1*w2*w3*pow(w4, 2) + 10368*cx3*cy2*pow(w2, 3)*w3*w4 - 6912*cx3*cy2*pow(w2, 2)*pow(w3, 2)*w4 + 576*cx3*cy2*pow(w2, 2)*w3*pow(w4, 2) + 768*cx3*cy2*w2*pow(w3, 3)*w4 - 2160*cx3*cy4*pow(w0, 3)*w3*w4 + 17280*cx3*cy4*pow(w0, 2)*w1*w3*w4 - 17472*cx3*cy4*pow(w0, 2)*w2*w3*w4 + 8064*cx3*cy4*pow(w0, 2)*pow(w3, 2)*w4 - 1440*cx3*cy4*pow(w0, 2)*w3*pow(w4, 2) - 43008*cx3*cy4*w0*pow(w1, 2)*w3*w4 + 80640*cx3*cy4*w0*w1*w2*w3*w4 - 34560*cx3*cy4*w0*w1*pow(w3, 2)*w4 + 5760*cx3*cy4*w0*w1*w3*pow(w4, 2) - 34560*cx3*cy4*w0*pow(w2, 2)*w3*w4 + 26880*cx3*cy4*w0*w2*pow(w3, 2)*w4 - 4032*cx3*cy4*w0*w2*w3*pow(w4, 2) - 4608*cx3*cy4*w0*pow(w3, 3)*w4 + 1152*cx3*cy4*w0*pow(w3, 2)*pow(w4, 2) - 48*cx3*cy4*w0*w3*pow(w4, 3) + 32256*cx3*cy4*pow(w1, 3)*w3*w4 - 80640*cx3*cy4*pow(w1, 2)*w2*w3*w4 + 30720*cx3*cy4*pow(w1, 2)*pow(w3, 2)*w4 - 4608*cx3*cy4*pow(w1, 2)*w3*pow(w4, 2) + 57600*cx3*cy4*w1*pow(w2, 2)*w3*w4 - 36864*cx3*cy4*w1*w2*pow(w3, 2)*w4 + 4608*cx3*cy4*w1*w2*w3*pow(w4, 2) + 4608*cx3*cy4*w1*pow(w3, 3)*w4 - 768*cx3*cy4*w1*pow(w3, 2)*pow(w4, 2) - 10368*cx3*cy4*pow(w2, 3)*w3*w4 + 6912*cx3*cy4*pow(w2, 2)*pow(w3, 2)*w4 - 576*cx3*cy4*pow(w2, 2)*w3*pow(w4, 2) - 768*cx3*cy4*w2*pow(w3, 3)*w4 - 3168*cx4*cy0*pow(w0, 3)*w1*w4 + 5280*cx4*cy0*pow(w0, 3)*w2*w4 - 2160*cx4*cy0*pow(w0, 3)*w3*w4 + 21120*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 60480*cx4*cy0*pow(w0, 2)*w1*w2*w4 + 27648*cx4*cy0*pow(w0, 2)*w1*w3*w4 - 2688*cx4*cy0*pow(w0, 2)*w1*pow(w4, 2) + 41472*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 37632*cx4*cy0*pow(w0, 2)*w2*w3*w4 + 4032*cx4*cy0*pow(w0, 2)*w2*pow(w4, 2) + 8064*cx4*cy0*pow(w0, 2)*pow(w3, 2)*w4 - 1440*cx4*cy0*pow(w0, 2)*w3*pow(w4, 2) - 34560*cx4*cy0*w0*pow(w1, 3)*w4 + 138240*cx4*cy0*w0*pow(w1, 2)*w2*w4 - 64512*cx4*cy0*w0*pow(w1, 2)*w3*w4 + 8064*cx4*cy0*w0*pow(w1, 2)*pow(w4, 2) - 177408*cx4*cy0*w0*w1*pow(w2, 2)*w4 + 161280*cx4*cy0*w0*w1*w2*w3*w4 - 20160*cx4*cy0*w0*w1*w2*pow(w4, 2) - 34560*cx4*cy0*w0*w1*pow(w3, 2)*w4 + 7680*cx4*cy0*w0*w1*w3*pow(w4, 2) - 288*cx4*cy0*w0*w1*pow(w4, 3) + 72576*cx4*cy0*w0*pow(w2, 3)*w4 - 95040*cx4*cy0*w0*pow(w2, 2)*w3*w4 + 11520*cx4*cy0*w0*pow(w2, 2)*pow(w4, 2) + 38400*cx4*cy0*w0*w2*pow(w3, 2)*w4 - 8064*cx4*cy0*w0*w2*w3*pow(w4, 2) + 288*cx4*cy0*w0*w2*pow(w4, 3) - 4608*cx4*cy0*w0*pow(w3, 3)*w4 + 1152*cx4*cy0*w0*pow(w3, 2)*pow(w4, 2) - 48*cx4*cy0*w0*w3*pow(w4, 3) + 3168*cx4*cy1*pow(w0, 3)*w1*w4 - 21120*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 19440*cx4*cy1*pow(w0, 2)*w1*w2*w4 - 10368*cx4*cy1*pow(w0, 2)*w1*w3*w4 + 2688*cx4*cy1*pow(w0, 2)*w1*pow(w4, 2) + 34560*cx4*cy1*w0*pow(w1, 3)*w4 - 41472*cx4*cy1*w0*pow(w1, 2)*w2*w4 + 21504*cx4*cy1*w0*pow(w1, 2)*w3*w4 - 8064*cx4*cy1*w0*pow(w1, 2)*pow(w4, 2) + 4320*cx4*cy1*w0*w1*w2*pow(w4, 2) - 1920*cx4*cy1*w0*w1*w3*pow(w4, 2) + 288*cx4*cy1*w0*w1*pow(w4, 3) - 64512*cx4*cy1*pow(w1, 3)*w2*w4 + 32256*cx4*cy1*pow(w1, 3)*w3*w4 + 145152*cx4*cy1*pow(w1, 2)*pow(w2, 2)*w4 - 138240*cx4*cy1*pow(w1, 2)*w2*w3*w4 + 11520*cx4*cy1*pow(w1, 2)*w2*pow(w4, 2) + 30720*cx4*cy1*pow(w1, 2)*pow(w3, 2)*w4 - 4608*cx4*cy1*pow(w1, 2)*w3*pow(w4, 2) - 77760*cx4*cy1*w1*pow(w2, 3)*w4 + 103680*cx4*cy1*w1*pow(w2, 2)*w3*w4 - 10368*cx4*cy1*w1*pow(w2, 2)*pow(w4, 2) - 41472*cx4*cy1*w1*w2*pow(w3, 2)*w4 + 6912*cx4*cy1*w1*w2*w3*pow(w4, 2) - 144*cx4*cy1*w1*w2*pow(w4, 3) + 4608*cx4*cy1*w1*pow(w3, 3)*w4 - 768*cx4*cy1*w1*pow(w3, 2)*pow(w4, 2) - 5280*cx4*cy2*pow(w0, 3)*w2*w4 + 41040*cx4*cy2*pow(w0, 2)*w1*w2*w4 - 41472*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 20160*cx4*cy2*pow(w0, 2)*w2*w3*w4 - 4032*cx4*cy2*pow(w0, 2)*w2*pow(w4, 2) - 96768*cx4*cy2*w0*pow(w1, 2)*w2*w4 + 177408*cx4*cy2*w0*w1*pow(w2, 2)*w4 - 80640*cx4*cy2*w0*w1*w2*w3*w4 + 15840*cx4*cy2*w0*w1*w2*pow(w4, 2) - 72576*cx4*cy2*w0*pow(w2, 3)*w4 + 60480*cx4*cy2*w0*pow(w2, 2)*w3*w4 - 11520*cx4*cy2*w0*pow(w2, 2)*pow(w4, 2) - 11520*cx4*cy2*w0*w2*pow(w3, 2)*w4 + 4032*cx4*cy2*w0*w2*w3*pow(w4, 2) - 288*cx4*cy2*w0*w2*pow(w4, 3) + 64512*cx4*cy2*pow(w1, 3)*w2*w4 - 145152*cx4*cy2*pow(w1, 2)*pow(w2, 2)*w4 + 57600*cx4*cy2*pow(w1, 2)*w2*w3*w4 - 11520*cx4*cy2*pow(w1, 2)*w2*pow(w4, 2) + 77760*cx4*cy2*w1*pow(w2, 3)*w4 - 46080*cx4*cy2*w1*pow(w2, 2)*w3*w4 + 10368*cx4*cy2*w1*pow(w2, 2)*pow(w4, 2) + 4608*cx4*cy2*w1*w2*pow(w3, 2)*w4 - 2304*cx4*cy2*w1*w2*w3*pow(w4, 2) + 144*cx4*cy2*w1*w2*pow(w4, 3) - 10368*cx4*cy2*pow(w2, 3)*w3*w4 + 6912*cx4*cy2*pow(w2, 2)*pow(w3, 2)*w4 - 576*cx4*cy2*pow(w2, 2)*w3*pow(w4, 2) - 768*cx4*cy2*w2*pow(w3, 3)*w4 + 2160*cx4*cy3*pow(w0, 3)*w3*w4 - 17280*cx4*cy3*pow(w0, 2)*w1*w3*w4 + 17472*cx4*cy3*pow(w0, 2)*w2*w3*w4 - 8064*cx4*cy3*pow(w0, 2)*pow(w3, 2)*w4 + 1440*cx4*cy3*pow(w0, 2)*w3*pow(w4, 2) + 43008*cx4*cy3*w0*pow(w1, 2)*w3*w4 - 80640*cx4*cy3*w0*w1*w2*w3*w4 + 34560*cx4*cy3*w0*w1*pow(w3, 2)*w4 - 5760*cx4*cy3*w0*w1*w3*pow(w4, 2) + 34560*cx4*cy3*w0*pow(w2, 2)*w3*w4 - 26880*cx4*cy3*w0*w2*pow(w3, 2)*w4 + 4032*cx4*cy3*w0*w2*w3*pow(w4, 2) + 4608*cx4*cy3*w0*pow(w3, 3)*w4 - 1152*cx4*cy3*w0*pow(w3, 2)*pow(w4, 2) + 48*cx4*cy3*w0*w3*pow(w4, 3) - 32256*cx4*cy3*pow(w1, 3)*w3*w4 + 80640*cx4*cy3*pow(w1, 2)*w2*w3*w4 - 30720*cx4*cy3*pow(w1, 2)*pow(w3, 2)*w4 + 4608*cx4*cy3*pow(w1, 2)*w3*pow(w4, 2) - 57600*cx4*cy3*w1*pow(w2, 2)*w3*w4 + 36864*cx4*cy3*w1*w2*pow(w3, 2)*w4 - 4608*cx4*cy3*w1*w2*w3*pow(w4, 2) - 4608*cx4*cy3*w1*pow(w3, 3)*w4 + 768*cx4*cy3*w1*pow(w3, 2)*pow(w4, 2) + 10368*cx4*cy3*pow(w2, 3)*w3*w4 - 6912*cx4*cy3*pow(w2, 2)*pow(w3, 2)*w4 + 576*cx4*cy3*pow(w2, 2)*w3*pow(w4, 2) + 768*cx4*cy3*w2*pow(w3, 3)*w4,
-    672*cx0*cy1*pow(w0, 3)*w1*w2 - 1248*cx0*cy1*pow(w0, 3)*w1*w3 + 576*cx0*cy1*pow(w0, 3)*w1*w4 - 4992*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 9216*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 4224*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 6912*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) - 16896*cx0*cy1*pow(w0, 2)*w1*w2*w3 + 6720*cx0*cy1*pow(w0, 2)*w1*w2*w4 + 7680*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) - 5184*cx0*cy1*pow(w0, 2)*w1*w3*w4 + 768*cx0*cy1*pow(w0, 2)*w1*pow(w4, 2) + 9216*cx0*cy1*w0*pow(w1, 3)*w2 - 16896*cx0*cy1*w0*pow(w1, 3)*w3 + 7680*cx0*cy1*w0*pow(w1, 3)*w4 - 25344*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) + 61440*cx0*cy1*w0*pow(w1, 2)*w2*w3 - 24192*cx0*cy1*w0*pow(w1, 2)*w2*w4 - 27648*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) + 18432*cx0*cy1*w0*pow(w1, 2)*w3*w4 - 2688*cx0*cy1*w0*pow(w1, 2)*pow(w4, 2) + 17280*cx0*cy1*w0*w1*pow(w2, 3) - 51840*cx0*cy1*w0*w1*pow(w2, 2)*w3 + 18432*cx0*cy1*w0*w1*pow(w2, 2)*w4 + 43008*cx0*cy1*w0*w1*w2*pow(w3, 2) - 26880*cx0*cy1*w0*w1*w2*w3*w4 + 3744*cx0*cy1*w0*w1*w2*pow(w4, 2) - 10752*cx0*cy1*w0*w1*pow(w3, 3) + 9216*cx0*cy1*w0*w1*pow(w3, 2)*w4 - 2400*cx0*cy1*w0*w1*w3*pow(w4, 2) + 192*cx0*cy1*w0*w1*pow(w4, 3) - 672*cx0*cy2*pow(w0, 3)*w1*w2 + 1728*cx0*cy2*pow(w0, 3)*w2*w3 - 1056*cx0*cy2*pow(w0, 3)*w2*w4 + 4992*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 6912*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) - 8448*cx0*cy2*pow(w0, 2)*w1*w2*w3 + 6720*cx0*cy2*pow(w0, 2)*w1*w2*w4 + 17280*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 10368*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 - 10368*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) + 8448*cx0*cy2*pow(w0, 2)*w2*w3*w4 - 1344*cx0*cy2*pow(w0, 2)*w2*pow(w4, 2) - 9216*cx0*cy2*w0*pow(w1, 3)*w2 + 25344*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) + 7680*cx0*cy2*w0*pow(w1, 2)*w2*w3 - 10368*cx0*cy2*w0*pow(w1, 2)*w2*w4 - 17280*cx0*cy2*w0*w1*pow(w2, 3) - 41472*cx0*cy2*w0*w1*pow(w2, 2)*w3 + 32256*cx0*cy2*w0*w1*pow(w2, 2)*w4 + 30720*cx0*cy2*w0*w1*w2*pow(w3, 2) - 26880*cx0*cy2*w0*w1*w2*w3*w4 + 4320*cx0*cy2*w0*w1*w2*pow(w4, 2) + 41472*cx0*cy2*w0*pow(w2, 3)*w3 - 24192*cx0*cy2*w0*pow(w2, 3)*w4 - 48384*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) + 38016*cx0*cy2*w0*pow(w2, 2)*w3*w4 - 5760*cx0*cy2*w0*pow(w2, 2)*pow(w4, 2) + 13824*cx0*cy2*w0*w2*pow(w3, 3) - 13440*cx0*cy2*w0*w2*pow(w3, 2)*w4 + 3648*cx0*cy2*w0*w2*w3*pow(w4, 2) - 288*cx0*cy2*w0*w2*pow(w4, 3) + 1248*cx0*cy3*pow(w0, 3)*w1*w3 - 1728*cx0*cy3*pow(w0, 3)*w2*w3 + 480*cx0*cy3*pow(w0, 3)*w3*w4 - 9216*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 25344*cx0*cy3*pow(w0, 2)*w1*w2*w3 - 7680*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) - 1728*cx0*cy3*pow(w0, 2)*w1*w3*w4 - 17280*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 10368*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) + 2304*cx0*cy3*pow(w0, 2)*w2*w3*w4 - 2688*cx0*cy3*pow(w0, 2)*pow(w3, 2)*w4 + 576*cx0*cy3*pow(w0, 2)*w3*pow(w4, 2) + 16896*cx0*cy3*w0*pow(w1, 3)*w3 - 69120*cx0*cy3*w0*pow(w1, 2)*w2*w3 + 27648*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) + 93312*cx0*cy3*w0*w1*pow(w2, 2)*w3 - 73728*cx0*cy3*w0*w1*w2*pow(w3, 2) + 10752*cx0*cy3*w0*w1*pow(w3, 3) + 4608*cx0*cy3*w0*w1*pow(w3, 2)*w4 - 1440*cx0*cy3*w0*w1*w3*pow(w4, 2) - 41472*cx0*cy3*w0*pow(w2, 3)*w3 + 48384*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) - 13824*cx0*cy3*w0*w2*pow(w3, 3) - 5760*cx0*cy3*w0*w2*pow(w3, 2)*w4 + 1728*cx0*cy3*w0*w2*w3*pow(w4, 2) + 3072*cx0*cy3*w0*pow(w3, 3)*w4 - 1152*cx0*cy3*w0*pow(w3, 2)*pow(w4, 2) + 96*cx0*cy3*w0*w3*pow(w4, 3) - 576*cx0*cy4*pow(w0, 3)*w1*w4 + 1056*cx0*cy4*pow(w0, 3)*w2*w4 - 480*cx0*cy4*pow(w0, 3)*w3*w4 + 4224*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 13440*cx0*cy4*pow(w0, 2)*w1*w2*w4 + 6912*cx0*cy4*pow(w0, 2)*w1*w3*w4 - 768*cx0*cy4*pow(w0, 2)*w1*pow(w4, 2) + 10368*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 10752*cx0*cy4*pow(w0, 2)*w2*w3*w4 + 1344*cx0*cy4*pow(w0, 2)*w2*pow(w4, 2) + 2688*cx0*cy4*pow(w0, 2)*pow(w3, 2)*w4 - 576*cx0*cy4*pow(w0, 2)*w3*pow(w4, 2) - 7680*cx0*cy4*w0*pow(w1, 3)*w4 + 34560*cx0*cy4*w0*pow(w1, 2)*w2*w4 - 18432*cx0*cy4*w0*pow(w1, 2)*w3*w4 + 2688*cx0*cy4*w0*pow(w1, 2)*pow(w4, 2) - 50688*cx0*cy4*w0*w1*pow(w2, 2)*w4 + 53760*cx0*cy4*w0*w1*w2*w3*w4 - 8064*cx0*cy4*w0*w1*w2*pow(w4, 2) - 13824*cx0*cy4*w0*w1*pow(w3, 2)*w4 + 3840*cx0*cy4*w0*w1*w3*pow(w4, 2) - 192*cx0*cy4*w0*w1*pow(w4, 3) + 24192*cx0*cy4*w0*pow(w2, 3)*w4 - 38016*cx0*cy4*w0*pow(w2, 2)*w3*w4 + 5760*cx0*cy4*w0*pow(w2, 2)*pow(w4, 2) + 19200*cx0*cy4*w0*w2*pow(w3, 2)*w4 - 5376*cx0*cy4*w0*w2*w3*pow(w4, 2) + 288*cx0*cy4*w0*w2*pow(w4, 3) - 3072*cx0*cy4*w0*pow(w3, 3)*w4 + 1152*cx0*cy4*w0*pow(w3, 2)*pow(w4, 2) - 96*cx0*cy4*w0*w3*pow(w4, 3) - 672*cx1*cy0*pow(w0, 3)*w1*w2 + 1248*cx1*cy0*pow(w0, 3)*w1*w3 - 576*cx1*cy0*pow(w0, 3)*w1*w4 + 4992*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 9216*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 4224*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 6912*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) + 16896*cx1*cy0*pow(w0, 2)*w1*w2*w3 - 6720*cx1*cy0*pow(w0, 2)*w1*w2*w4 - 7680*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) + 5184*cx1*cy0*pow(w0, 2)*w1*w3*w4 - 768*cx1*cy0*pow(w0, 2)*w1*pow(w4, 2) - 9216*cx1*cy0*w0*pow(w1, 3)*w2 + 16896*cx1*cy0*w0*pow(w1, 3)*w3 - 7680*cx1*cy0*w0*pow(w1, 3)*w4 + 25344*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) - 61440*cx1*cy0*w0*pow(w1, 2)*w2*w3 + 24192*cx1*cy0*w0*pow(w1, 2)*w2*w4 + 27648*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) - 18432*cx1*cy0*w0*pow(w1, 2)*w3*w4 + 2688*cx1*cy0*w0*pow(w1, 2)*pow(w4, 2) - 17280*cx1*cy0*w0*w1*pow(w2, 3) + 51840*cx1*cy0*w0*w1*pow(w2, 2)*w3 - 18432*cx1*cy0*w0*w1*pow(w2, 2)*w4 - 43008*cx1*cy0*w0*w1*w2*pow(w3, 2) + 26880*cx1*cy0*w0*w1*w2*w3*w4 - 3744*cx1*cy0*w0*w1*w2*pow(w4, 2) + 10752*cx1*cy0*w0*w1*pow(w3, 3) - 9216*cx1*cy0*w0*w1*pow(w3, 2)*w4 + 2400*cx1*cy0*w0*w1*w3*pow(w4, 2) - 192*cx1*cy0*w0*w1*pow(w4, 3) + 672*cx1*cy2*pow(w0, 3)*w1*w2 - 4992*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 6912*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) - 6336*cx1*cy2*pow(w0, 2)*w1*w2*w3 + 2400*cx1*cy2*pow(w0, 2)*w1*w2*w4 + 9216*cx1*cy2*w0*pow(w1, 3)*w2 - 25344*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) + 30720*cx1*cy2*w0*pow(w1, 2)*w2*w3 - 13824*cx1*cy2*w0*pow(w1, 2)*w2*w4 + 17280*cx1*cy2*w0*w1*pow(w2, 3) - 41472*cx1*cy2*w0*w1*pow(w2, 2)*w3 + 18432*cx1*cy2*w0*w1*pow(w2, 2)*w4 + 18432*cx1*cy2*w0*w1*w2*pow(w3, 2) - 13440*cx1*cy2*w0*w1*w2*w3*w4 + 2016*cx1*cy2*w0*w1*w2*pow(w4, 2) - 27648*cx1*cy2*pow(w1, 3)*w2*w3 + 18432*cx1*cy2*pow(w1, 3)*w2*w4 + 73728*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 48384*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w4 - 43008*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) + 36864*cx1*cy2*pow(w1, 2)*w2*w3*w4 - 5760*cx1*cy2*pow(w1, 2)*w2*pow(w4, 2) - 48384*cx1*cy2*w1*pow(w2, 3)*w3 + 31104*cx1*cy2*w1*pow(w2, 3)*w4 + 55296*cx1*cy2*w1*pow(w2, 2)*pow(w3, 2) - 46080*cx1*cy2*w1*pow(w2, 2)*w3*w4 + 6912*cx1*cy2*w1*pow(w2, 2)*pow(w4, 2) - 15360*cx1*cy2*w1*w2*pow(w3, 3) + 15360*cx1*cy2*w1*w2*pow(w3, 2)*w4 - 4032*cx1*cy2*w1*w2*w3*pow(w4, 2) + 288*cx1*cy2*w1*w2*pow(w4, 3) - 1248*cx1*cy3*pow(w0, 3)*w1*w3 + 9216*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 10560*cx1*cy3*pow(w0, 2)*w1*w2*w3 + 7680*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) - 2592*cx1*cy3*pow(w0, 2)*w1*w3*w4 - 16896*cx1*cy3*w0*pow(w1, 3)*w3 + 30720*cx1*cy3*w0*pow(w1, 2)*w2*w3 - 27648*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) + 12288*cx1*cy3*w0*pow(w1, 2)*w3*w4 - 10368*cx1*cy3*w0*w1*pow(w2, 2)*w3 + 24576*cx1*cy3*w0*w1*w2*pow(w3, 2) - 13440*cx1*cy3*w0*w1*w2*w3*w4 - 10752*cx1*cy3*w0*w1*pow(w3, 3) + 9216*cx1*cy3*w0*w1*pow(w3, 2)*w4 - 1440*cx1*cy3*w0*w1*w3*pow(w4, 2) + 27648*cx1*cy3*pow(w1, 3)*w2*w3 - 10752*cx1*cy3*pow(w1, 3)*w3*w4 - 73728*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 43008*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) + 18432*cx1*cy3*pow(w1, 2)*w2*w3*w4 - 15360*cx1*cy3*pow(w1, 2)*pow(w3, 2)*w4 + 3072*cx1*cy3*pow(w1, 2)*w3*pow(w4, 2) + 48384*cx1*cy3*w1*pow(w2, 3)*w3 - 55296*cx1*cy3*w1*pow(w2, 2)*pow(w3, 2) - 5760*cx1*cy3*w1*pow(w2, 2)*w3*w4 + 15360*cx1*cy3*w1*w2*pow(w3, 3) + 12288*cx1*cy3*w1*w2*pow(w3, 2)*w4 - 2880*cx1*cy3*w1*w2*w3*pow(w4, 2) - 4608*cx1*cy3*w1*pow(w3, 3)*w4 + 1536*cx1*cy3*w1*pow(w3, 2)*pow(w4, 2) - 96*cx1*cy3*w1*w3*pow(w4, 3) + 576*cx1*cy4*pow(w0, 3)*w1*w4 - 4224*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 4320*cx1*cy4*pow(w0, 2)*w1*w2*w4 - 2592*cx1*cy4*pow(w0, 2)*w1*w3*w4 + 768*cx1*cy4*pow(w0, 2)*w1*pow(w4, 2) + 7680*cx1*cy4*w0*pow(w1, 3)*w4 - 10368*cx1*cy4*w0*pow(w1, 2)*w2*w4 + 6144*cx1*cy4*w0*pow(w1, 2)*w3*w4 - 2688*cx1*cy4*w0*pow(w1, 2)*pow(w4, 2) + 1728*cx1*cy4*w0*w1*w2*pow(w4, 2) - 960*cx1*cy4*w0*w1*w3*pow(w4, 2) + 192*cx1*cy4*w0*w1*pow(w4, 3) - 18432*cx1*cy4*pow(w1, 3)*w2*w4 + 10752*cx1*cy4*pow(w1, 3)*w3*w4 + 48384*cx1*cy4*pow(w1, 2)*pow(w2, 2)*w4 - 55296*cx1*cy4*pow(w1, 2)*w2*w3*w4 + 5760*cx1*cy4*pow(w1, 2)*w2*pow(w4, 2) + 15360*cx1*cy4*pow(w1, 2)*pow(w3, 2)*w4 - 3072*cx1*cy4*pow(w1, 2)*w3*pow(w4, 2) - 31104*cx1*cy4*w1*pow(w2, 3)*w4 + 51840*cx1*cy4*w1*pow(w2, 2)*w3*w4 - 6912*cx1*cy4*w1*pow(w2, 2)*pow(w4, 2) - 27648*cx1*cy4*w1*w2*pow(w3, 2)*w4 + 6912*cx1*cy4*w1*w2*w3*pow(w4, 2) - 288*cx1*cy4*w1*w2*pow(w4, 3) + 4608*cx1*cy4*w1*pow(w3, 3)*w4 - 1536*cx1*cy4*w1*pow(w3, 2)*pow(w4, 2) + 96*cx1*cy4*w1*w3*pow(w4, 3) + 672*cx2*cy0*pow(w0, 3)*w1*w2 - 1728*cx2*cy0*pow(w0, 3)*w2*w3 + 1056*cx2*cy0*pow(w0, 3)*w2*w4 - 4992*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 6912*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) + 8448*cx2*cy0*pow(w0, 2)*w1*w2*w3 - 6720*cx2*cy0*pow(w0, 2)*w1*w2*w4 - 17280*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 10368*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 10368*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) - 8448*cx2*cy0*pow(w0, 2)*w2*w3*w4 + 1344*cx2*cy0*pow(w0, 2)*w2*pow(w4, 2) + 9216*cx2*cy0*w0*pow(w1, 3)*w2 - 25344*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) - 7680*cx2*cy0*w0*pow(w1, 2)*w2*w3 + 10368*cx2*cy0*w0*pow(w1, 2)*w2*w4 + 17280*cx2*cy0*w0*w1*pow(w2, 3) + 41472*cx2*cy0*w0*w1*pow(w2, 2)*w3 - 32256*cx2*cy0*w0*w1*pow(w2, 2)*w4 - 30720*cx2*cy0*w0*w1*w2*pow(w3, 2) + 26880*cx2*cy0*w0*w1*w2*w3*w4 - 4320*cx2*cy0*w0*w1*w2*pow(w4, 2) - 41472*cx2*cy0*w0*pow(w2, 3)*w3 + 24192*cx2*cy0*w0*pow(w2, 3)*w4 + 48384*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) - 38016*cx2*cy0*w0*pow(w2, 2)*w3*w4 + 5760*cx2*cy0*w0*pow(w2, 2)*pow(w4, 2) - 13824*cx2*cy0*w0*w2*pow(w3, 3) + 13440*cx2*cy0*w0*w2*pow(w3, 2)*w4 - 3648*cx2*cy0*w0*w2*w3*pow(w4, 2) + 288*cx2*cy0*w0*w2*pow(w4, 3) - 672*cx2*cy1*pow(w0, 3)*w1*w2 + 4992*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 6912*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) + 6336*cx2*cy1*pow(w0, 2)*w1*w2*w3 - 2400*cx2*cy1*pow(w0, 2)*w1*w2*w4 - 9216*cx2*cy1*w0*pow(w1, 3)*w2 + 25344*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) - 30720*cx2*cy1*w0*pow(w1, 2)*w2*w3 + 13824*cx2*cy1*w0*pow(w1, 2)*w2*w4 - 17280*cx2*cy1*w0*w1*pow(w2, 3) + 41472*cx2*cy1*w0*w1*pow(w2, 2)*w3 - 18432*cx2*cy1*w0*w1*pow(w2, 2)*w4 - 18432*cx2*cy1*w0*w1*w2*pow(w3, 2) + 13440*cx2*cy1*w0*w1*w2*w3*w4 - 2016*cx2*cy1*w0*w1*w2*pow(w4, 2) + 27648*cx2*cy1*pow(w1, 3)*w2*w3 - 18432*cx2*cy1*pow(w1, 3)*w2*w4 - 73728*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 48384*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w4 + 43008*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) - 36864*cx2*cy1*pow(w1, 2)*w2*w3*w4 + 5760*cx2*cy1*pow(w1, 2)*w2*pow(w4, 2) + 48384*cx2*cy1*w1*pow(w2, 3)*w3 - 31104*cx2*cy1*w1*pow(w2, 3)*w4 - 55296*cx2*cy1*w1*pow(w2, 2)*pow(w3, 2) + 46080*cx2*cy1*w1*pow(w2, 2)*w3*w4 - 6912*cx2*cy1*w1*pow(w2, 2)*pow(w4, 2) + 15360*cx2*cy1*w1*w2*pow(w3, 3) - 15360*cx2*cy1*w1*w2*pow(w3, 2)*w4 + 4032*cx2*cy1*w1*w2*w3*pow(w4, 2) - 288*cx2*cy1*w1*w2*pow(w4, 3) + 1728*cx2*cy3*pow(w0, 3)*w2*w3 - 14784*cx2*cy3*pow(w0, 2)*w1*w2*w3 + 17280*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 10368*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) + 2688*cx2*cy3*pow(w0, 2)*w2*w3*w4 + 38400*cx2*cy3*w0*pow(w1, 2)*w2*w3 - 82944*cx2*cy3*w0*w1*pow(w2, 2)*w3 + 49152*cx2*cy3*w0*w1*w2*pow(w3, 2) - 13440*cx2*cy3*w0*w1*w2*w3*w4 + 41472*cx2*cy3*w0*pow(w2, 3)*w3 - 48384*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) + 13824*cx2*cy3*w0*pow(w2, 2)*w3*w4 + 13824*cx2*cy3*w0*w2*pow(w3, 3) - 7680*cx2*cy3*w0*w2*pow(w3, 2)*w4 + 960*cx2*cy3*w0*w2*w3*pow(w4, 2) - 27648*cx2*cy3*pow(w1, 3)*w2*w3 + 73728*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 43008*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) + 13824*cx2*cy3*pow(w1, 2)*w2*w3*w4 - 48384*cx2*cy3*w1*pow(w2, 3)*w3 + 55296*cx2*cy3*w1*pow(w2, 2)*pow(w3, 2) - 23040*cx2*cy3*w1*pow(w2, 2)*w3*w4 - 15360*cx2*cy3*w1*w2*pow(w3, 3) + 12288*cx2*cy3*w1*w2*pow(w3, 2)*w4 - 1728*cx2*cy3*w1*w2*w3*pow(w4, 2) + 6912*cx2*cy3*pow(w2, 3)*w3*w4 - 6912*cx2*cy3*pow(w2, 2)*pow(w3, 2)*w4 + 1152*cx2*cy3*pow(w2, 2)*w3*pow(w4, 2) + 1536*cx2*cy3*w2*pow(w3, 3)*w4 - 384*cx2*cy3*w2*pow(w3, 2)*pow(w4, 2) - 1056*cx2*cy4*pow(w0, 3)*w2*w4 + 9120*cx2*cy4*pow(w0, 2)*w1*w2*w4 - 10368*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 + 5760*cx2*cy4*pow(w0, 2)*w2*w3*w4 - 1344*cx2*cy4*pow(w0, 2)*w2*pow(w4, 2) - 24192*cx2*cy4*w0*pow(w1, 2)*w2*w4 + 50688*cx2*cy4*w0*w1*pow(w2, 2)*w4 - 26880*cx2*cy4*w0*w1*w2*w3*w4 + 6336*cx2*cy4*w0*w1*w2*pow(w4, 2) - 24192*cx2*cy4*w0*pow(w2, 3)*w4 + 24192*cx2*cy4*w0*pow(w2, 2)*w3*w4 - 5760*cx2*cy4*w0*pow(w2, 2)*pow(w4, 2) - 5760*cx2*cy4*w0*w2*pow(w3, 2)*w4 + 2688*cx2*cy4*w0*w2*w3*pow(w4, 2) - 288*cx2*cy4*w0*w2*pow(w4, 3) + 18432*cx2*cy4*pow(w1, 3)*w2*w4 - 48384*cx2*cy4*pow(w1, 2)*pow(w2, 2)*w4 + 23040*cx2*cy4*pow(w1, 2)*w2*w3*w4 - 5760*cx2*cy4*pow(w1, 2)*w2*pow(w4, 2) + 31104*cx2*cy4*w1*pow(w2, 3)*w4 - 23040*cx2*cy4*w1*pow(w2, 2)*w3*w4 + 6912*cx2*cy4*w1*pow(w2, 2)*pow(w4, 2) + 3072*cx2*cy4*w1*w2*pow(w3, 2)*w4 - 2304*cx2*cy4*w1*w2*w3*pow(w4, 2) + 288*cx2*cy4*w1*w2*pow(w4, 3) - 6912*cx2*cy4*pow(w2, 3)*w3*w4 + 6912*cx2*cy4*pow(w2, 2)*pow(w3, 2)*w4 - 1152*cx2*cy4*pow(w2, 2)*w3*pow(w4, 2) - 1536*cx2*cy4*w2*pow(w3, 3)*w4 + 384*cx2*cy4*w2*pow(w3, 2)*pow(w4, 2) - 1248*cx3*cy0*pow(w0, 3)*w1*w3 + 1728*cx3*cy0*pow(w0, 3)*w2*w3 - 480*cx3*cy0*pow(w0, 3)*w3*w4 + 9216*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 25344*cx3*cy0*pow(w0, 2)*w1*w2*w3 + 7680*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) + 1728*cx3*cy0*pow(w0, 2)*w1*w3*w4 + 17280*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 10368*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) - 2304*cx3*cy0*pow(w0, 2)*w2*w3*w4 + 2688*cx3*cy0*pow(w0, 2)*pow(w3, 2)*w4 - 576*cx3*cy0*pow(w0, 2)*w3*pow(w4, 2) - 16896*cx3*cy0*w0*pow(w1, 3)*w3 + 69120*cx3*cy0*w0*pow(w1, 2)*w2*w3 - 27648*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) - 93312*cx3*cy0*w0*w1*pow(w2, 2)*w3 + 73728*cx3*cy0*w0*w1*w2*pow(w3, 2) - 10752*cx3*cy0*w0*w1*pow(w3, 3) - 4608*cx3*cy0*w0*w1*pow(w3, 2)*w4 + 1440*cx3*cy0*w0*w1*w3*pow(w4, 2) + 41472*cx3*cy0*w0*pow(w2, 3)*w3 - 48384*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) + 13824*cx3*cy0*w0*w2*pow(w3, 3) + 5760*cx3*cy0*w0*w2*pow(w3, 2)*w4 - 1728*cx3*cy0*w0*w2*w3*pow(w4, 2) - 3072*cx3*cy0*w0*pow(w3, 3)*w4 + 1152*cx3*cy0*w0*pow(w3, 2)*pow(w4, 2) - 96*cx3*cy0*w0*w3*pow(w4, 3) + 1248*cx3*cy1*pow(w0, 3)*w1*w3 - 9216*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 10560*cx3*cy1*pow(w0, 2)*w1*w2*w3 - 7680*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) + 2592*cx3*cy1*pow(w0, 2)*w1*w3*w4 + 16896*cx3*cy1*w0*pow(w1, 3)*w3 - 30720*cx3*cy1*w0*pow(w1, 2)*w2*w3 + 27648*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) - 12288*cx3*cy1*w0*pow(w1, 2)*w3*w4 + 10368*cx3*cy1*w0*w1*pow(w2, 2)*w3 - 24576*cx3*cy1*w0*w1*w2*pow(w3, 2) + 13440*cx3*cy1*w0*w1*w2*w3*w4 + 10752*cx3*cy1*w0*w1*pow(w3, 3) - 9216*cx3*cy1*w0*w1*pow(w3, 2)*w4 + 1440*cx3*cy1*w0*w1*w3*pow(w4, 2) - 27648*cx3*cy1*pow(w1, 3)*w2*w3 + 10752*cx3*cy1*pow(w1, 3)*w3*w4 + 73728*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 43008*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) - 18432*cx3*cy1*pow(w1, 2)*w2*w3*w4 + 15360*cx3*cy1*pow(w1, 2)*pow(w3, 2)*w4 - 3072*cx3*cy1*pow(w1, 2)*w3*pow(w4, 2) - 48384*cx3*cy1*w1*pow(w2, 3)*w3 + 55296*cx3*cy1*w1*pow(w2, 2)*pow(w3, 2) + 5760*cx3*cy1*w1*pow(w2, 2)*w3*w4 - 15360*cx3*cy1*w1*w2*pow(w3, 3) - 12288*cx3*cy1*w1*w2*pow(w3, 2)*w4 + 2880*cx3*cy1*w1*w2*w3*pow(w4, 2) + 4608*cx3*cy1*w1*pow(w3, 3)*w4 - 1536*cx3*cy1*w1*pow(w3, 2)*pow(w4, 2) + 96*cx3*cy1*w1*w3*pow(w4, 3) - 1728*cx3*cy2*pow(w0, 3)*w2*w3 + 14784*cx3*cy2*pow(w0, 2)*w1*w2*w3 - 17280*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 10368*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) - 2688*cx3*cy2*pow(w0, 2)*w2*w3*w4 - 38400*cx3*cy2*w0*pow(w1, 2)*w2*w3 + 82944*cx3*cy2*w0*w1*pow(w2, 2)*w3 - 49152*cx3*cy2*w0*w1*w2*pow(w3, 2) + 13440*cx3*cy2*w0*w1*w2*w3*w4 - 41472*cx3*cy2*w0*pow(w2, 3)*w3 + 48384*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) - 13824*cx3*cy2*w0*pow(w2, 2)*w3*w4 - 13824*cx3*cy2*w0*w2*pow(w3, 3) + 7680*cx3*cy2*w0*w2*pow(w3, 2)*w4 - 960*cx3*cy2*w0*w2*w3*pow(w4, 2) + 27648*cx3*cy2*pow(w1, 3)*w2*w3 - 73728*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 43008*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) - 13824*cx3*cy2*pow(w1, 2)*w2*w3*w4 + 48384*cx3*cy2*w1*pow(w2, 3)*w3 - 55296*cx3*cy2*w1*pow(w2, 2)*pow(w3, 2) + 23040*cx3*cy2*w1*pow(w2, 2)*w3*w4 + 15360*cx3*cy2*w1*w2*pow(w3, 3) - 12288*cx3*cy2*w1*w2*pow(w3, 2)*w4 + 1728*cx3*cy2*w1*w2*w3*pow(w4, 2) - 6912*cx3*cy2*pow(w2, 3)*w3*w4 + 6912*cx3*cy2*pow(w2, 2)*pow(w3, 2)*w4 - 1152*cx3*cy2*pow(w2, 2)*w3*pow(w4, 2) - 1536*cx3*cy2*w2*pow(w3, 3)*w4 + 384*cx3*cy2*w2*pow(w3, 2)*pow(w4, 2) + 480*cx3*cy4*pow(w0, 3)*w3*w4 - 4320*cx3*cy4*pow(w0, 2)*w1*w3*w4 + 4992*cx3*cy4*pow(w0, 2)*w2*w3*w4 - 2688*cx3*cy4*pow(w0, 2)*pow(w3, 2)*w4 + 576*cx3*cy4*pow(w0, 2)*w3*pow(w4, 2) + 12288*cx3*cy4*w0*pow(w1, 2)*w3*w4 - 26880*cx3*cy4*w0*w1*w2*w3*w4 + 13824*cx3*cy4*w0*w1*pow(w3, 2)*w4 - 2880*cx3*cy4*w0*w1*w3*pow(w4, 2) + 13824*cx3*cy4*w0*pow(w2, 2)*w3*w4 - 13440*cx3*cy4*w0*w2*pow(w3, 2)*w4 + 2688*cx3*cy4*w0*w2*w3*pow(w4, 2) + 3072*cx3*cy4*w0*pow(w3, 3)*w4 - 1152*cx3*cy4*w0*pow(w3, 2)*pow(w4, 2) + 96*cx3*cy4*w0*w3*pow(w4, 3) - 10752*cx3*cy4*pow(w1, 3)*w3*w4 + 32256*cx3*cy4*pow(w1, 2)*w2*w3*w4 - 15360*cx3*cy4*pow(w1, 2)*pow(w3, 2)*w4 + 3072*cx3*cy4*pow(w1, 2)*w3*pow(w4, 2) - 28800*cx3*cy4*w1*pow(w2, 2)*w3*w4 + 24576*cx3*cy4*w1*w2*pow(w3, 2)*w4 - 4608*cx3*cy4*w1*w2*w3*pow(w4, 2) - 4608*cx3*cy4*w1*pow(w3, 3)*w4 + 1536*cx3*cy4*w1*pow(w3, 2)*pow(w4, 2) - 96*cx3*cy4*w1*w3*pow(w4, 3) + 6912*cx3*cy4*pow(w2, 3)*w3*w4 - 6912*cx3*cy4*pow(w2, 2)*pow(w3, 2)*w4 + 1152*cx3*cy4*pow(w2, 2)*w3*pow(w4, 2) + 1536*cx3*cy4*w2*pow(w3, 3)*w4 - 384*cx3*cy4*w2*pow(w3, 2)*pow(w4, 2) + 576*cx4*cy0*pow(w0, 3)*w1*w4 - 1056*cx4*cy0*pow(w0, 3)*w2*w4 + 480*cx4*cy0*pow(w0, 3)*w3*w4 - 4224*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 13440*cx4*cy0*pow(w0, 2)*w1*w2*w4 - 6912*cx4*cy0*pow(w0, 2)*w1*w3*w4 + 768*cx4*cy0*pow(w0, 2)*w1*pow(w4, 2) - 10368*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 + 10752*cx4*cy0*pow(w0, 2)*w2*w3*w4 - 1344*cx4*cy0*pow(w0, 2)*w2*pow(w4, 2) - 2688*cx4*cy0*pow(w0, 2)*pow(w3, 2)*w4 + 576*cx4*cy0*pow(w0, 2)*w3*pow(w4, 2) + 7680*cx4*cy0*w0*pow(w1, 3)*w4 - 34560*cx4*cy0*w0*pow(w1, 2)*w2*w4 + 18432*cx4*cy0*w0*pow(w1, 2)*w3*w4 - 2688*cx4*cy0*w0*pow(w1, 2)*pow(w4, 2) + 50688*cx4*cy0*w0*w1*pow(w2, 2)*w4 - 53760*cx4*cy0*w0*w1*w2*w3*w4 + 8064*cx4*cy0*w0*w1*w2*pow(w4, 2) + 13824*cx4*cy0*w0*w1*pow(w3, 2)*w4 - 3840*cx4*cy0*w0*w1*w3*pow(w4, 2) + 192*cx4*cy0*w0*w1*pow(w4, 3) - 24192*cx4*cy0*w0*pow(w2, 3)*w4 + 38016*cx4*cy0*w0*pow(w2, 2)*w3*w4 - 5760*cx4*cy0*w0*pow(w2, 2)*pow(w4, 2) - 19200*cx4*cy0*w0*w2*pow(w3, 2)*w4 + 5376*cx4*cy0*w0*w2*w3*pow(w4, 2) - 288*cx4*cy0*w0*w2*pow(w4, 3) + 3072*cx4*cy0*w0*pow(w3, 3)*w4 - 1152*cx4*cy0*w0*pow(w3, 2)*pow(w4, 2) + 96*cx4*cy0*w0*w3*pow(w4, 3) - 576*cx4*cy1*pow(w0, 3)*w1*w4 + 4224*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 4320*cx4*cy1*pow(w0, 2)*w1*w2*w4 + 2592*cx4*cy1*pow(w0, 2)*w1*w3*w4 - 768*cx4*cy1*pow(w0, 2)*w1*pow(w4, 2) - 7680*cx4*cy1*w0*pow(w1, 3)*w4 + 10368*cx4*cy1*w0*pow(w1, 2)*w2*w4 - 6144*cx4*cy1*w0*pow(w1, 2)*w3*w4 + 2688*cx4*cy1*w0*pow(w1, 2)*pow(w4, 2) - 1728*cx4*cy1*w0*w1*w2*pow(w4, 2) + 960*cx4*cy1*w0*w1*w3*pow(w4, 2) - 192*cx4*cy1*w0*w1*pow(w4, 3) + 18432*cx4*cy1*pow(w1, 3)*w2*w4 - 10752*cx4*cy1*pow(w1, 3)*w3*w4 - 48384*cx4*cy1*pow(w1, 2)*pow(w2, 2)*w4 + 55296*cx4*cy1*pow(w1, 2)*w2*w3*w4 - 5760*cx4*cy1*pow(w1, 2)*w2*pow(w4, 2) - 15360*cx4*cy1*pow(w1, 2)*pow(w3, 2)*w4 + 3072*cx4*cy1*pow(w1, 2)*w3*pow(w4, 2) + 31104*cx4*cy1*w1*pow(w2, 3)*w4 - 51840*cx4*cy1*w1*pow(w2, 2)*w3*w4 + 6912*cx4*cy1*w1*pow(w2, 2)*pow(w4, 2) + 27648*cx4*cy1*w1*w2*pow(w3, 2)*w4 - 6912*cx4*cy1*w1*w2*w3*pow(w4, 2) + 288*cx4*cy1*w1*w2*pow(w4, 3) - 4608*cx4*cy1*w1*pow(w3, 3)*w4 + 1536*cx4*cy1*w1*pow(w3, 2)*pow(w4, 2) - 96*cx4*cy1*w1*w3*pow(w4, 3) + 1056*cx4*cy2*pow(w0, 3)*w2*w4 - 9120*cx4*cy2*pow(w0, 2)*w1*w2*w4 + 10368*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 - 5760*cx4*cy2*pow(w0, 2)*w2*w3*w4 + 1344*cx4*cy2*pow(w0, 2)*w2*pow(w4, 2) + 24192*cx4*cy2*w0*pow(w1, 2)*w2*w4 - 50688*cx4*cy2*w0*w1*pow(w2, 2)*w4 + 26880*cx4*cy2*w0*w1*w2*w3*w4 - 6336*cx4*cy2*w0*w1*w2*pow(w4, 2) + 24192*cx4*cy2*w0*pow(w2, 3)*w4 - 24192*cx4*cy2*w0*pow(w2, 2)*w3*w4 + 5760*cx4*cy2*w0*pow(w2, 2)*pow(w4, 2) + 5760*cx4*cy2*w0*w2*pow(w3, 2)*w4 - 2688*cx4*cy2*w0*w2*w3*pow(w4, 2) + 288*cx4*cy2*w0*w2*pow(w4, 3) - 18432*cx4*cy2*pow(w1, 3)*w2*w4 + 48384*cx4*cy2*pow(w1, 2)*pow(w2, 2)*w4 - 23040*cx4*cy2*pow(w1, 2)*w2*w3*w4 + 5760*cx4*cy2*pow(w1, 2)*w2*pow(w4, 2) - 31104*cx4*cy2*w1*pow(w2, 3)*w4 + 23040*cx4*cy2*w1*pow(w2, 2)*w3*w4 - 6912*cx4*cy2*w1*pow(w2, 2)*pow(w4, 2) - 3072*cx4*cy2*w1*w2*pow(w3, 2)*w4 + 2304*cx4*cy2*w1*w2*w3*pow(w4, 2) - 288*cx4*cy2*w1*w2*pow(w4, 3) + 6912*cx4*cy2*pow(w2, 3)*w3*w4 - 6912*cx4*cy2*pow(w2, 2)*pow(w3, 2)*w4 + 1152*cx4*cy2*pow(w2, 2)*w3*pow(w4, 2) + 1536*cx4*cy2*w2*pow(w3, 3)*w4 - 384*cx4*cy2*w2*pow(w3, 2)*pow(w4, 2) - 480*cx4*cy3*pow(w0, 3)*w3*w4 + 4320*cx4*cy3*pow(w0, 2)*w1*w3*w4 - 4992*cx4*cy3*pow(w0, 2)*w2*w3*w4 + 2688*cx4*cy3*pow(w0, 2)*pow(w3, 2)*w4 - 576*cx4*cy3*pow(w0, 2)*w3*pow(w4, 2) - 12288*cx4*cy3*w0*pow(w1, 2)*w3*w4 + 26880*cx4*cy3*w0*w1*w2*w3*w4 - 13824*cx4*cy3*w0*w1*pow(w3, 2)*w4 + 2880*cx4*cy3*w0*w1*w3*pow(w4, 2) - 13824*cx4*cy3*w0*pow(w2, 2)*w3*w4 + 13440*cx4*cy3*w0*w2*pow(w3, 2)*w4 - 2688*cx4*cy3*w0*w2*w3*pow(w4, 2) - 3072*cx4*cy3*w0*pow(w3, 3)*w4 + 1152*cx4*cy3*w0*pow(w3, 2)*pow(w4, 2) - 96*cx4*cy3*w0*w3*pow(w4, 3) + 10752*cx4*cy3*pow(w1, 3)*w3*w4 - 32256*cx4*cy3*pow(w1, 2)*w2*w3*w4 + 15360*cx4*cy3*pow(w1, 2)*pow(w3, 2)*w4 - 3072*cx4*cy3*pow(w1, 2)*w3*pow(w4, 2) + 28800*cx4*cy3*w1*pow(w2, 2)*w3*w4 - 24576*cx4*cy3*w1*w2*pow(w3, 2)*w4 + 4608*cx4*cy3*w1*w2*w3*pow(w4, 2) + 4608*cx4*cy3*w1*pow(w3, 3)*w4 - 1536*cx4*cy3*w1*pow(w3, 2)*pow(w4, 2) + 96*cx4*cy3*w1*w3*pow(w4, 3) - 6912*cx4*cy3*pow(w2, 3)*w3*w4 + 6912*cx4*cy3*pow(w2, 2)*pow(w3, 2)*w4 - 1152*cx4*cy3*pow(w2, 2)*w3*pow(w4, 2) - 1536*cx4*cy3*w2*pow(w3, 3)*w4 + 384*cx4*cy3*w2*pow(w3, 2)*pow(w4, 2),
-    -48*cx0*cy1*pow(w0, 3)*w1*w2 + 96*cx0*cy1*pow(w0, 3)*w1*w3 - 48*cx0*cy1*pow(w0, 3)*w1*w4 + 384*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w2 - 768*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w3 + 384*cx0*cy1*pow(w0, 2)*pow(w1, 2)*w4 - 576*cx0*cy1*pow(w0, 2)*w1*pow(w2, 2) + 1536*cx0*cy1*pow(w0, 2)*w1*w2*w3 - 672*cx0*cy1*pow(w0, 2)*w1*w2*w4 - 768*cx0*cy1*pow(w0, 2)*w1*pow(w3, 2) + 576*cx0*cy1*pow(w0, 2)*w1*w3*w4 - 96*cx0*cy1*pow(w0, 2)*w1*pow(w4, 2) - 768*cx0*cy1*w0*pow(w1, 3)*w2 + 1536*cx0*cy1*w0*pow(w1, 3)*w3 - 768*cx0*cy1*w0*pow(w1, 3)*w4 + 2304*cx0*cy1*w0*pow(w1, 2)*pow(w2, 2) - 6144*cx0*cy1*w0*pow(w1, 2)*w2*w3 + 2688*cx0*cy1*w0*pow(w1, 2)*w2*w4 + 3072*cx0*cy1*w0*pow(w1, 2)*pow(w3, 2) - 2304*cx0*cy1*w0*pow(w1, 2)*w3*w4 + 384*cx0*cy1*w0*pow(w1, 2)*pow(w4, 2) - 1728*cx0*cy1*w0*w1*pow(w2, 3) + 5760*cx0*cy1*w0*w1*pow(w2, 2)*w3 - 2304*cx0*cy1*w0*w1*pow(w2, 2)*w4 - 5376*cx0*cy1*w0*w1*w2*pow(w3, 2) + 3840*cx0*cy1*w0*w1*w2*w3*w4 - 624*cx0*cy1*w0*w1*w2*pow(w4, 2) + 1536*cx0*cy1*w0*w1*pow(w3, 3) - 1536*cx0*cy1*w0*w1*pow(w3, 2)*w4 + 480*cx0*cy1*w0*w1*w3*pow(w4, 2) - 48*cx0*cy1*w0*w1*pow(w4, 3) + 48*cx0*cy2*pow(w0, 3)*w1*w2 - 144*cx0*cy2*pow(w0, 3)*w2*w3 + 96*cx0*cy2*pow(w0, 3)*w2*w4 - 384*cx0*cy2*pow(w0, 2)*pow(w1, 2)*w2 + 576*cx0*cy2*pow(w0, 2)*w1*pow(w2, 2) + 768*cx0*cy2*pow(w0, 2)*w1*w2*w3 - 672*cx0*cy2*pow(w0, 2)*w1*w2*w4 - 1728*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w3 + 1152*cx0*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 1152*cx0*cy2*pow(w0, 2)*w2*pow(w3, 2) - 1056*cx0*cy2*pow(w0, 2)*w2*w3*w4 + 192*cx0*cy2*pow(w0, 2)*w2*pow(w4, 2) + 768*cx0*cy2*w0*pow(w1, 3)*w2 - 2304*cx0*cy2*w0*pow(w1, 2)*pow(w2, 2) - 768*cx0*cy2*w0*pow(w1, 2)*w2*w3 + 1152*cx0*cy2*w0*pow(w1, 2)*w2*w4 + 1728*cx0*cy2*w0*w1*pow(w2, 3) + 4608*cx0*cy2*w0*w1*pow(w2, 2)*w3 - 4032*cx0*cy2*w0*w1*pow(w2, 2)*w4 - 3840*cx0*cy2*w0*w1*w2*pow(w3, 2) + 3840*cx0*cy2*w0*w1*w2*w3*w4 - 720*cx0*cy2*w0*w1*w2*pow(w4, 2) - 5184*cx0*cy2*w0*pow(w2, 3)*w3 + 3456*cx0*cy2*w0*pow(w2, 3)*w4 + 6912*cx0*cy2*w0*pow(w2, 2)*pow(w3, 2) - 6336*cx0*cy2*w0*pow(w2, 2)*w3*w4 + 1152*cx0*cy2*w0*pow(w2, 2)*pow(w4, 2) - 2304*cx0*cy2*w0*w2*pow(w3, 3) + 2688*cx0*cy2*w0*w2*pow(w3, 2)*w4 - 912*cx0*cy2*w0*w2*w3*pow(w4, 2) + 96*cx0*cy2*w0*w2*pow(w4, 3) - 96*cx0*cy3*pow(w0, 3)*w1*w3 + 144*cx0*cy3*pow(w0, 3)*w2*w3 - 48*cx0*cy3*pow(w0, 3)*w3*w4 + 768*cx0*cy3*pow(w0, 2)*pow(w1, 2)*w3 - 2304*cx0*cy3*pow(w0, 2)*w1*w2*w3 + 768*cx0*cy3*pow(w0, 2)*w1*pow(w3, 2) + 192*cx0*cy3*pow(w0, 2)*w1*w3*w4 + 1728*cx0*cy3*pow(w0, 2)*pow(w2, 2)*w3 - 1152*cx0*cy3*pow(w0, 2)*w2*pow(w3, 2) - 288*cx0*cy3*pow(w0, 2)*w2*w3*w4 + 384*cx0*cy3*pow(w0, 2)*pow(w3, 2)*w4 - 96*cx0*cy3*pow(w0, 2)*w3*pow(w4, 2) - 1536*cx0*cy3*w0*pow(w1, 3)*w3 + 6912*cx0*cy3*w0*pow(w1, 2)*w2*w3 - 3072*cx0*cy3*w0*pow(w1, 2)*pow(w3, 2) - 10368*cx0*cy3*w0*w1*pow(w2, 2)*w3 + 9216*cx0*cy3*w0*w1*w2*pow(w3, 2) - 1536*cx0*cy3*w0*w1*pow(w3, 3) - 768*cx0*cy3*w0*w1*pow(w3, 2)*w4 + 288*cx0*cy3*w0*w1*w3*pow(w4, 2) + 5184*cx0*cy3*w0*pow(w2, 3)*w3 - 6912*cx0*cy3*w0*pow(w2, 2)*pow(w3, 2) + 2304*cx0*cy3*w0*w2*pow(w3, 3) + 1152*cx0*cy3*w0*w2*pow(w3, 2)*w4 - 432*cx0*cy3*w0*w2*w3*pow(w4, 2) - 768*cx0*cy3*w0*pow(w3, 3)*w4 + 384*cx0*cy3*w0*pow(w3, 2)*pow(w4, 2) - 48*cx0*cy3*w0*w3*pow(w4, 3) + 48*cx0*cy4*pow(w0, 3)*w1*w4 - 96*cx0*cy4*pow(w0, 3)*w2*w4 + 48*cx0*cy4*pow(w0, 3)*w3*w4 - 384*cx0*cy4*pow(w0, 2)*pow(w1, 2)*w4 + 1344*cx0*cy4*pow(w0, 2)*w1*w2*w4 - 768*cx0*cy4*pow(w0, 2)*w1*w3*w4 + 96*cx0*cy4*pow(w0, 2)*w1*pow(w4, 2) - 1152*cx0*cy4*pow(w0, 2)*pow(w2, 2)*w4 + 1344*cx0*cy4*pow(w0, 2)*w2*w3*w4 - 192*cx0*cy4*pow(w0, 2)*w2*pow(w4, 2) - 384*cx0*cy4*pow(w0, 2)*pow(w3, 2)*w4 + 96*cx0*cy4*pow(w0, 2)*w3*pow(w4, 2) + 768*cx0*cy4*w0*pow(w1, 3)*w4 - 3840*cx0*cy4*w0*pow(w1, 2)*w2*w4 + 2304*cx0*cy4*w0*pow(w1, 2)*w3*w4 - 384*cx0*cy4*w0*pow(w1, 2)*pow(w4, 2) + 6336*cx0*cy4*w0*w1*pow(w2, 2)*w4 - 7680*cx0*cy4*w0*w1*w2*w3*w4 + 1344*cx0*cy4*w0*w1*w2*pow(w4, 2) + 2304*cx0*cy4*w0*w1*pow(w3, 2)*w4 - 768*cx0*cy4*w0*w1*w3*pow(w4, 2) + 48*cx0*cy4*w0*w1*pow(w4, 3) - 3456*cx0*cy4*w0*pow(w2, 3)*w4 + 6336*cx0*cy4*w0*pow(w2, 2)*w3*w4 - 1152*cx0*cy4*w0*pow(w2, 2)*pow(w4, 2) - 3840*cx0*cy4*w0*w2*pow(w3, 2)*w4 + 1344*cx0*cy4*w0*w2*w3*pow(w4, 2) - 96*cx0*cy4*w0*w2*pow(w4, 3) + 768*cx0*cy4*w0*pow(w3, 3)*w4 - 384*cx0*cy4*w0*pow(w3, 2)*pow(w4, 2) + 48*cx0*cy4*w0*w3*pow(w4, 3) + 48*cx1*cy0*pow(w0, 3)*w1*w2 - 96*cx1*cy0*pow(w0, 3)*w1*w3 + 48*cx1*cy0*pow(w0, 3)*w1*w4 - 384*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w2 + 768*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w3 - 384*cx1*cy0*pow(w0, 2)*pow(w1, 2)*w4 + 576*cx1*cy0*pow(w0, 2)*w1*pow(w2, 2) - 1536*cx1*cy0*pow(w0, 2)*w1*w2*w3 + 672*cx1*cy0*pow(w0, 2)*w1*w2*w4 + 768*cx1*cy0*pow(w0, 2)*w1*pow(w3, 2) - 576*cx1*cy0*pow(w0, 2)*w1*w3*w4 + 96*cx1*cy0*pow(w0, 2)*w1*pow(w4, 2) + 768*cx1*cy0*w0*pow(w1, 3)*w2 - 1536*cx1*cy0*w0*pow(w1, 3)*w3 + 768*cx1*cy0*w0*pow(w1, 3)*w4 - 2304*cx1*cy0*w0*pow(w1, 2)*pow(w2, 2) + 6144*cx1*cy0*w0*pow(w1, 2)*w2*w3 - 2688*cx1*cy0*w0*pow(w1, 2)*w2*w4 - 3072*cx1*cy0*w0*pow(w1, 2)*pow(w3, 2) + 2304*cx1*cy0*w0*pow(w1, 2)*w3*w4 - 384*cx1*cy0*w0*pow(w1, 2)*pow(w4, 2) + 1728*cx1*cy0*w0*w1*pow(w2, 3) - 5760*cx1*cy0*w0*w1*pow(w2, 2)*w3 + 2304*cx1*cy0*w0*w1*pow(w2, 2)*w4 + 5376*cx1*cy0*w0*w1*w2*pow(w3, 2) - 3840*cx1*cy0*w0*w1*w2*w3*w4 + 624*cx1*cy0*w0*w1*w2*pow(w4, 2) - 1536*cx1*cy0*w0*w1*pow(w3, 3) + 1536*cx1*cy0*w0*w1*pow(w3, 2)*w4 - 480*cx1*cy0*w0*w1*w3*pow(w4, 2) + 48*cx1*cy0*w0*w1*pow(w4, 3) - 48*cx1*cy2*pow(w0, 3)*w1*w2 + 384*cx1*cy2*pow(w0, 2)*pow(w1, 2)*w2 - 576*cx1*cy2*pow(w0, 2)*w1*pow(w2, 2) + 576*cx1*cy2*pow(w0, 2)*w1*w2*w3 - 240*cx1*cy2*pow(w0, 2)*w1*w2*w4 - 768*cx1*cy2*w0*pow(w1, 3)*w2 + 2304*cx1*cy2*w0*pow(w1, 2)*pow(w2, 2) - 3072*cx1*cy2*w0*pow(w1, 2)*w2*w3 + 1536*cx1*cy2*w0*pow(w1, 2)*w2*w4 - 1728*cx1*cy2*w0*w1*pow(w2, 3) + 4608*cx1*cy2*w0*w1*pow(w2, 2)*w3 - 2304*cx1*cy2*w0*w1*pow(w2, 2)*w4 - 2304*cx1*cy2*w0*w1*w2*pow(w3, 2) + 1920*cx1*cy2*w0*w1*w2*w3*w4 - 336*cx1*cy2*w0*w1*w2*pow(w4, 2) + 3072*cx1*cy2*pow(w1, 3)*w2*w3 - 2304*cx1*cy2*pow(w1, 3)*w2*w4 - 9216*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w3 + 6912*cx1*cy2*pow(w1, 2)*pow(w2, 2)*w4 + 6144*cx1*cy2*pow(w1, 2)*w2*pow(w3, 2) - 6144*cx1*cy2*pow(w1, 2)*w2*w3*w4 + 1152*cx1*cy2*pow(w1, 2)*w2*pow(w4, 2) + 6912*cx1*cy2*w1*pow(w2, 3)*w3 - 5184*cx1*cy2*w1*pow(w2, 3)*w4 - 9216*cx1*cy2*w1*pow(w2, 2)*pow(w3, 2) + 9216*cx1*cy2*w1*pow(w2, 2)*w3*w4 - 1728*cx1*cy2*w1*pow(w2, 2)*pow(w4, 2) + 3072*cx1*cy2*w1*w2*pow(w3, 3) - 3840*cx1*cy2*w1*w2*pow(w3, 2)*w4 + 1344*cx1*cy2*w1*w2*w3*pow(w4, 2) - 144*cx1*cy2*w1*w2*pow(w4, 3) + 96*cx1*cy3*pow(w0, 3)*w1*w3 - 768*cx1*cy3*pow(w0, 2)*pow(w1, 2)*w3 + 960*cx1*cy3*pow(w0, 2)*w1*w2*w3 - 768*cx1*cy3*pow(w0, 2)*w1*pow(w3, 2) + 288*cx1*cy3*pow(w0, 2)*w1*w3*w4 + 1536*cx1*cy3*w0*pow(w1, 3)*w3 - 3072*cx1*cy3*w0*pow(w1, 2)*w2*w3 + 3072*cx1*cy3*w0*pow(w1, 2)*pow(w3, 2) - 1536*cx1*cy3*w0*pow(w1, 2)*w3*w4 + 1152*cx1*cy3*w0*w1*pow(w2, 2)*w3 - 3072*cx1*cy3*w0*w1*w2*pow(w3, 2) + 1920*cx1*cy3*w0*w1*w2*w3*w4 + 1536*cx1*cy3*w0*w1*pow(w3, 3) - 1536*cx1*cy3*w0*w1*pow(w3, 2)*w4 + 288*cx1*cy3*w0*w1*w3*pow(w4, 2) - 3072*cx1*cy3*pow(w1, 3)*w2*w3 + 1536*cx1*cy3*pow(w1, 3)*w3*w4 + 9216*cx1*cy3*pow(w1, 2)*pow(w2, 2)*w3 - 6144*cx1*cy3*pow(w1, 2)*w2*pow(w3, 2) - 3072*cx1*cy3*pow(w1, 2)*w2*w3*w4 + 3072*cx1*cy3*pow(w1, 2)*pow(w3, 2)*w4 - 768*cx1*cy3*pow(w1, 2)*w3*pow(w4, 2) - 6912*cx1*cy3*w1*pow(w2, 3)*w3 + 9216*cx1*cy3*w1*pow(w2, 2)*pow(w3, 2) + 1152*cx1*cy3*w1*pow(w2, 2)*w3*w4 - 3072*cx1*cy3*w1*w2*pow(w3, 3) - 3072*cx1*cy3*w1*w2*pow(w3, 2)*w4 + 960*cx1*cy3*w1*w2*w3*pow(w4, 2) + 1536*cx1*cy3*w1*pow(w3, 3)*w4 - 768*cx1*cy3*w1*pow(w3, 2)*pow(w4, 2) + 96*cx1*cy3*w1*w3*pow(w4, 3) - 48*cx1*cy4*pow(w0, 3)*w1*w4 + 384*cx1*cy4*pow(w0, 2)*pow(w1, 2)*w4 - 432*cx1*cy4*pow(w0, 2)*w1*w2*w4 + 288*cx1*cy4*pow(w0, 2)*w1*w3*w4 - 96*cx1*cy4*pow(w0, 2)*w1*pow(w4, 2) - 768*cx1*cy4*w0*pow(w1, 3)*w4 + 1152*cx1*cy4*w0*pow(w1, 2)*w2*w4 - 768*cx1*cy4*w0*pow(w1, 2)*w3*w4 + 384*cx1*cy4*w0*pow(w1, 2)*pow(w4, 2) - 288*cx1*cy4*w0*w1*w2*pow(w4, 2) + 192*cx1*cy4*w0*w1*w3*pow(w4, 2) - 48*cx1*cy4*w0*w1*pow(w4, 3) + 2304*cx1*cy4*pow(w1, 3)*w2*w4 - 1536*cx1*cy4*pow(w1, 3)*w3*w4 - 6912*cx1*cy4*pow(w1, 2)*pow(w2, 2)*w4 + 9216*cx1*cy4*pow(w1, 2)*w2*w3*w4 - 1152*cx1*cy4*pow(w1, 2)*w2*pow(w4, 2) - 3072*cx1*cy4*pow(w1, 2)*pow(w3, 2)*w4 + 768*cx1*cy4*pow(w1, 2)*w3*pow(w4, 2) + 5184*cx1*cy4*w1*pow(w2, 3)*w4 - 10368*cx1*cy4*w1*pow(w2, 2)*w3*w4 + 1728*cx1*cy4*w1*pow(w2, 2)*pow(w4, 2) + 6912*cx1*cy4*w1*w2*pow(w3, 2)*w4 - 2304*cx1*cy4*w1*w2*w3*pow(w4, 2) + 144*cx1*cy4*w1*w2*pow(w4, 3) - 1536*cx1*cy4*w1*pow(w3, 3)*w4 + 768*cx1*cy4*w1*pow(w3, 2)*pow(w4, 2) - 96*cx1*cy4*w1*w3*pow(w4, 3) - 48*cx2*cy0*pow(w0, 3)*w1*w2 + 144*cx2*cy0*pow(w0, 3)*w2*w3 - 96*cx2*cy0*pow(w0, 3)*w2*w4 + 384*cx2*cy0*pow(w0, 2)*pow(w1, 2)*w2 - 576*cx2*cy0*pow(w0, 2)*w1*pow(w2, 2) - 768*cx2*cy0*pow(w0, 2)*w1*w2*w3 + 672*cx2*cy0*pow(w0, 2)*w1*w2*w4 + 1728*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w3 - 1152*cx2*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 1152*cx2*cy0*pow(w0, 2)*w2*pow(w3, 2) + 1056*cx2*cy0*pow(w0, 2)*w2*w3*w4 - 192*cx2*cy0*pow(w0, 2)*w2*pow(w4, 2) - 768*cx2*cy0*w0*pow(w1, 3)*w2 + 2304*cx2*cy0*w0*pow(w1, 2)*pow(w2, 2) + 768*cx2*cy0*w0*pow(w1, 2)*w2*w3 - 1152*cx2*cy0*w0*pow(w1, 2)*w2*w4 - 1728*cx2*cy0*w0*w1*pow(w2, 3) - 4608*cx2*cy0*w0*w1*pow(w2, 2)*w3 + 4032*cx2*cy0*w0*w1*pow(w2, 2)*w4 + 3840*cx2*cy0*w0*w1*w2*pow(w3, 2) - 3840*cx2*cy0*w0*w1*w2*w3*w4 + 720*cx2*cy0*w0*w1*w2*pow(w4, 2) + 5184*cx2*cy0*w0*pow(w2, 3)*w3 - 3456*cx2*cy0*w0*pow(w2, 3)*w4 - 6912*cx2*cy0*w0*pow(w2, 2)*pow(w3, 2) + 6336*cx2*cy0*w0*pow(w2, 2)*w3*w4 - 1152*cx2*cy0*w0*pow(w2, 2)*pow(w4, 2) + 2304*cx2*cy0*w0*w2*pow(w3, 3) - 2688*cx2*cy0*w0*w2*pow(w3, 2)*w4 + 912*cx2*cy0*w0*w2*w3*pow(w4, 2) - 96*cx2*cy0*w0*w2*pow(w4, 3) + 48*cx2*cy1*pow(w0, 3)*w1*w2 - 384*cx2*cy1*pow(w0, 2)*pow(w1, 2)*w2 + 576*cx2*cy1*pow(w0, 2)*w1*pow(w2, 2) - 576*cx2*cy1*pow(w0, 2)*w1*w2*w3 + 240*cx2*cy1*pow(w0, 2)*w1*w2*w4 + 768*cx2*cy1*w0*pow(w1, 3)*w2 - 2304*cx2*cy1*w0*pow(w1, 2)*pow(w2, 2) + 3072*cx2*cy1*w0*pow(w1, 2)*w2*w3 - 1536*cx2*cy1*w0*pow(w1, 2)*w2*w4 + 1728*cx2*cy1*w0*w1*pow(w2, 3) - 4608*cx2*cy1*w0*w1*pow(w2, 2)*w3 + 2304*cx2*cy1*w0*w1*pow(w2, 2)*w4 + 2304*cx2*cy1*w0*w1*w2*pow(w3, 2) - 1920*cx2*cy1*w0*w1*w2*w3*w4 + 336*cx2*cy1*w0*w1*w2*pow(w4, 2) - 3072*cx2*cy1*pow(w1, 3)*w2*w3 + 2304*cx2*cy1*pow(w1, 3)*w2*w4 + 9216*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w3 - 6912*cx2*cy1*pow(w1, 2)*pow(w2, 2)*w4 - 6144*cx2*cy1*pow(w1, 2)*w2*pow(w3, 2) + 6144*cx2*cy1*pow(w1, 2)*w2*w3*w4 - 1152*cx2*cy1*pow(w1, 2)*w2*pow(w4, 2) - 6912*cx2*cy1*w1*pow(w2, 3)*w3 + 5184*cx2*cy1*w1*pow(w2, 3)*w4 + 9216*cx2*cy1*w1*pow(w2, 2)*pow(w3, 2) - 9216*cx2*cy1*w1*pow(w2, 2)*w3*w4 + 1728*cx2*cy1*w1*pow(w2, 2)*pow(w4, 2) - 3072*cx2*cy1*w1*w2*pow(w3, 3) + 3840*cx2*cy1*w1*w2*pow(w3, 2)*w4 - 1344*cx2*cy1*w1*w2*w3*pow(w4, 2) + 144*cx2*cy1*w1*w2*pow(w4, 3) - 144*cx2*cy3*pow(w0, 3)*w2*w3 + 1344*cx2*cy3*pow(w0, 2)*w1*w2*w3 - 1728*cx2*cy3*pow(w0, 2)*pow(w2, 2)*w3 + 1152*cx2*cy3*pow(w0, 2)*w2*pow(w3, 2) - 336*cx2*cy3*pow(w0, 2)*w2*w3*w4 - 3840*cx2*cy3*w0*pow(w1, 2)*w2*w3 + 9216*cx2*cy3*w0*w1*pow(w2, 2)*w3 - 6144*cx2*cy3*w0*w1*w2*pow(w3, 2) + 1920*cx2*cy3*w0*w1*w2*w3*w4 - 5184*cx2*cy3*w0*pow(w2, 3)*w3 + 6912*cx2*cy3*w0*pow(w2, 2)*pow(w3, 2) - 2304*cx2*cy3*w0*pow(w2, 2)*w3*w4 - 2304*cx2*cy3*w0*w2*pow(w3, 3) + 1536*cx2*cy3*w0*w2*pow(w3, 2)*w4 - 240*cx2*cy3*w0*w2*w3*pow(w4, 2) + 3072*cx2*cy3*pow(w1, 3)*w2*w3 - 9216*cx2*cy3*pow(w1, 2)*pow(w2, 2)*w3 + 6144*cx2*cy3*pow(w1, 2)*w2*pow(w3, 2) - 2304*cx2*cy3*pow(w1, 2)*w2*w3*w4 + 6912*cx2*cy3*w1*pow(w2, 3)*w3 - 9216*cx2*cy3*w1*pow(w2, 2)*pow(w3, 2) + 4608*cx2*cy3*w1*pow(w2, 2)*w3*w4 + 3072*cx2*cy3*w1*w2*pow(w3, 3) - 3072*cx2*cy3*w1*w2*pow(w3, 2)*w4 + 576*cx2*cy3*w1*w2*w3*pow(w4, 2) - 1728*cx2*cy3*pow(w2, 3)*w3*w4 + 2304*cx2*cy3*pow(w2, 2)*pow(w3, 2)*w4 - 576*cx2*cy3*pow(w2, 2)*w3*pow(w4, 2) - 768*cx2*cy3*w2*pow(w3, 3)*w4 + 384*cx2*cy3*w2*pow(w3, 2)*pow(w4, 2) - 48*cx2*cy3*w2*w3*pow(w4, 3) + 96*cx2*cy4*pow(w0, 3)*w2*w4 - 912*cx2*cy4*pow(w0, 2)*w1*w2*w4 + 1152*cx2*cy4*pow(w0, 2)*pow(w2, 2)*w4 - 720*cx2*cy4*pow(w0, 2)*w2*w3*w4 + 192*cx2*cy4*pow(w0, 2)*w2*pow(w4, 2) + 2688*cx2*cy4*w0*pow(w1, 2)*w2*w4 - 6336*cx2*cy4*w0*w1*pow(w2, 2)*w4 + 3840*cx2*cy4*w0*w1*w2*w3*w4 - 1056*cx2*cy4*w0*w1*w2*pow(w4, 2) + 3456*cx2*cy4*w0*pow(w2, 3)*w4 - 4032*cx2*cy4*w0*pow(w2, 2)*w3*w4 + 1152*cx2*cy4*w0*pow(w2, 2)*pow(w4, 2) + 1152*cx2*cy4*w0*w2*pow(w3, 2)*w4 - 672*cx2*cy4*w0*w2*w3*pow(w4, 2) + 96*cx2*cy4*w0*w2*pow(w4, 3) - 2304*cx2*cy4*pow(w1, 3)*w2*w4 + 6912*cx2*cy4*pow(w1, 2)*pow(w2, 2)*w4 - 3840*cx2*cy4*pow(w1, 2)*w2*w3*w4 + 1152*cx2*cy4*pow(w1, 2)*w2*pow(w4, 2) - 5184*cx2*cy4*w1*pow(w2, 3)*w4 + 4608*cx2*cy4*w1*pow(w2, 2)*w3*w4 - 1728*cx2*cy4*w1*pow(w2, 2)*pow(w4, 2) - 768*cx2*cy4*w1*w2*pow(w3, 2)*w4 + 768*cx2*cy4*w1*w2*w3*pow(w4, 2) - 144*cx2*cy4*w1*w2*pow(w4, 3) + 1728*cx2*cy4*pow(w2, 3)*w3*w4 - 2304*cx2*cy4*pow(w2, 2)*pow(w3, 2)*w4 + 576*cx2*cy4*pow(w2, 2)*w3*pow(w4, 2) + 768*cx2*cy4*w2*pow(w3, 3)*w4 - 384*cx2*cy4*w2*pow(w3, 2)*pow(w4, 2) + 48*cx2*cy4*w2*w3*pow(w4, 3) + 96*cx3*cy0*pow(w0, 3)*w1*w3 - 144*cx3*cy0*pow(w0, 3)*w2*w3 + 48*cx3*cy0*pow(w0, 3)*w3*w4 - 768*cx3*cy0*pow(w0, 2)*pow(w1, 2)*w3 + 2304*cx3*cy0*pow(w0, 2)*w1*w2*w3 - 768*cx3*cy0*pow(w0, 2)*w1*pow(w3, 2) - 192*cx3*cy0*pow(w0, 2)*w1*w3*w4 - 1728*cx3*cy0*pow(w0, 2)*pow(w2, 2)*w3 + 1152*cx3*cy0*pow(w0, 2)*w2*pow(w3, 2) + 288*cx3*cy0*pow(w0, 2)*w2*w3*w4 - 384*cx3*cy0*pow(w0, 2)*pow(w3, 2)*w4 + 96*cx3*cy0*pow(w0, 2)*w3*pow(w4, 2) + 1536*cx3*cy0*w0*pow(w1, 3)*w3 - 6912*cx3*cy0*w0*pow(w1, 2)*w2*w3 + 3072*cx3*cy0*w0*pow(w1, 2)*pow(w3, 2) + 10368*cx3*cy0*w0*w1*pow(w2, 2)*w3 - 9216*cx3*cy0*w0*w1*w2*pow(w3, 2) + 1536*cx3*cy0*w0*w1*pow(w3, 3) + 768*cx3*cy0*w0*w1*pow(w3, 2)*w4 - 288*cx3*cy0*w0*w1*w3*pow(w4, 2) - 5184*cx3*cy0*w0*pow(w2, 3)*w3 + 6912*cx3*cy0*w0*pow(w2, 2)*pow(w3, 2) - 2304*cx3*cy0*w0*w2*pow(w3, 3) - 1152*cx3*cy0*w0*w2*pow(w3, 2)*w4 + 432*cx3*cy0*w0*w2*w3*pow(w4, 2) + 768*cx3*cy0*w0*pow(w3, 3)*w4 - 384*cx3*cy0*w0*pow(w3, 2)*pow(w4, 2) + 48*cx3*cy0*w0*w3*pow(w4, 3) - 96*cx3*cy1*pow(w0, 3)*w1*w3 + 768*cx3*cy1*pow(w0, 2)*pow(w1, 2)*w3 - 960*cx3*cy1*pow(w0, 2)*w1*w2*w3 + 768*cx3*cy1*pow(w0, 2)*w1*pow(w3, 2) - 288*cx3*cy1*pow(w0, 2)*w1*w3*w4 - 1536*cx3*cy1*w0*pow(w1, 3)*w3 + 3072*cx3*cy1*w0*pow(w1, 2)*w2*w3 - 3072*cx3*cy1*w0*pow(w1, 2)*pow(w3, 2) + 1536*cx3*cy1*w0*pow(w1, 2)*w3*w4 - 1152*cx3*cy1*w0*w1*pow(w2, 2)*w3 + 3072*cx3*cy1*w0*w1*w2*pow(w3, 2) - 1920*cx3*cy1*w0*w1*w2*w3*w4 - 1536*cx3*cy1*w0*w1*pow(w3, 3) + 1536*cx3*cy1*w0*w1*pow(w3, 2)*w4 - 288*cx3*cy1*w0*w1*w3*pow(w4, 2) + 3072*cx3*cy1*pow(w1, 3)*w2*w3 - 1536*cx3*cy1*pow(w1, 3)*w3*w4 - 9216*cx3*cy1*pow(w1, 2)*pow(w2, 2)*w3 + 6144*cx3*cy1*pow(w1, 2)*w2*pow(w3, 2) + 3072*cx3*cy1*pow(w1, 2)*w2*w3*w4 - 3072*cx3*cy1*pow(w1, 2)*pow(w3, 2)*w4 + 768*cx3*cy1*pow(w1, 2)*w3*pow(w4, 2) + 6912*cx3*cy1*w1*pow(w2, 3)*w3 - 9216*cx3*cy1*w1*pow(w2, 2)*pow(w3, 2) - 1152*cx3*cy1*w1*pow(w2, 2)*w3*w4 + 3072*cx3*cy1*w1*w2*pow(w3, 3) + 3072*cx3*cy1*w1*w2*pow(w3, 2)*w4 - 960*cx3*cy1*w1*w2*w3*pow(w4, 2) - 1536*cx3*cy1*w1*pow(w3, 3)*w4 + 768*cx3*cy1*w1*pow(w3, 2)*pow(w4, 2) - 96*cx3*cy1*w1*w3*pow(w4, 3) + 144*cx3*cy2*pow(w0, 3)*w2*w3 - 1344*cx3*cy2*pow(w0, 2)*w1*w2*w3 + 1728*cx3*cy2*pow(w0, 2)*pow(w2, 2)*w3 - 1152*cx3*cy2*pow(w0, 2)*w2*pow(w3, 2) + 336*cx3*cy2*pow(w0, 2)*w2*w3*w4 + 3840*cx3*cy2*w0*pow(w1, 2)*w2*w3 - 9216*cx3*cy2*w0*w1*pow(w2, 2)*w3 + 6144*cx3*cy2*w0*w1*w2*pow(w3, 2) - 1920*cx3*cy2*w0*w1*w2*w3*w4 + 5184*cx3*cy2*w0*pow(w2, 3)*w3 - 6912*cx3*cy2*w0*pow(w2, 2)*pow(w3, 2) + 2304*cx3*cy2*w0*pow(w2, 2)*w3*w4 + 2304*cx3*cy2*w0*w2*pow(w3, 3) - 1536*cx3*cy2*w0*w2*pow(w3, 2)*w4 + 240*cx3*cy2*w0*w2*w3*pow(w4, 2) - 3072*cx3*cy2*pow(w1, 3)*w2*w3 + 9216*cx3*cy2*pow(w1, 2)*pow(w2, 2)*w3 - 6144*cx3*cy2*pow(w1, 2)*w2*pow(w3, 2) + 2304*cx3*cy2*pow(w1, 2)*w2*w3*w4 - 6912*cx3*cy2*w1*pow(w2, 3)*w3 + 9216*cx3*cy2*w1*pow(w2, 2)*pow(w3, 2) - 4608*cx3*cy2*w1*pow(w2, 2)*w3*w4 - 3072*cx3*cy2*w1*w2*pow(w3, 3) + 3072*cx3*cy2*w1*w2*pow(w3, 2)*w4 - 576*cx3*cy2*w1*w2*w3*pow(w4, 2) + 1728*cx3*cy2*pow(w2, 3)*w3*w4 - 2304*cx3*cy2*pow(w2, 2)*pow(w3, 2)*w4 + 576*cx3*cy2*pow(w2, 2)*w3*pow(w4, 2) + 768*cx3*cy2*w2*pow(w3, 3)*w4 - 384*cx3*cy2*w2*pow(w3, 2)*pow(w4, 2) + 48*cx3*cy2*w2*w3*pow(w4, 3) - 48*cx3*cy4*pow(w0, 3)*w3*w4 + 480*cx3*cy4*pow(w0, 2)*w1*w3*w4 - 624*cx3*cy4*pow(w0, 2)*w2*w3*w4 + 384*cx3*cy4*pow(w0, 2)*pow(w3, 2)*w4 - 96*cx3*cy4*pow(w0, 2)*w3*pow(w4, 2) - 1536*cx3*cy4*w0*pow(w1, 2)*w3*w4 + 3840*cx3*cy4*w0*w1*w2*w3*w4 - 2304*cx3*cy4*w0*w1*pow(w3, 2)*w4 + 576*cx3*cy4*w0*w1*w3*pow(w4, 2) - 2304*cx3*cy4*w0*pow(w2, 2)*w3*w4 + 2688*cx3*cy4*w0*w2*pow(w3, 2)*w4 - 672*cx3*cy4*w0*w2*w3*pow(w4, 2) - 768*cx3*cy4*w0*pow(w3, 3)*w4 + 384*cx3*cy4*w0*pow(w3, 2)*pow(w4, 2) - 48*cx3*cy4*w0*w3*pow(w4, 3) + 1536*cx3*cy4*pow(w1, 3)*w3*w4 - 5376*cx3*cy4*pow(w1, 2)*w2*w3*w4 + 3072*cx3*cy4*pow(w1, 2)*pow(w3, 2)*w4 - 768*cx3*cy4*pow(w1, 2)*w3*pow(w4, 2) + 5760*cx3*cy4*w1*pow(w2, 2)*w3*w4 - 6144*cx3*cy4*w1*w2*pow(w3, 2)*w4 + 1536*cx3*cy4*w1*w2*w3*pow(w4, 2) + 1536*cx3*cy4*w1*pow(w3, 3)*w4 - 768*cx3*cy4*w1*pow(w3, 2)*pow(w4, 2) + 96*cx3*cy4*w1*w3*pow(w4, 3) - 1728*cx3*cy4*pow(w2, 3)*w3*w4 + 2304*cx3*cy4*pow(w2, 2)*pow(w3, 2)*w4 - 576*cx3*cy4*pow(w2, 2)*w3*pow(w4, 2) - 768*cx3*cy4*w2*pow(w3, 3)*w4 + 384*cx3*cy4*w2*pow(w3, 2)*pow(w4, 2) - 48*cx3*cy4*w2*w3*pow(w4, 3) - 48*cx4*cy0*pow(w0, 3)*w1*w4 + 96*cx4*cy0*pow(w0, 3)*w2*w4 - 48*cx4*cy0*pow(w0, 3)*w3*w4 + 384*cx4*cy0*pow(w0, 2)*pow(w1, 2)*w4 - 1344*cx4*cy0*pow(w0, 2)*w1*w2*w4 + 768*cx4*cy0*pow(w0, 2)*w1*w3*w4 - 96*cx4*cy0*pow(w0, 2)*w1*pow(w4, 2) + 1152*cx4*cy0*pow(w0, 2)*pow(w2, 2)*w4 - 1344*cx4*cy0*pow(w0, 2)*w2*w3*w4 + 192*cx4*cy0*pow(w0, 2)*w2*pow(w4, 2) + 384*cx4*cy0*pow(w0, 2)*pow(w3, 2)*w4 - 96*cx4*cy0*pow(w0, 2)*w3*pow(w4, 2) - 768*cx4*cy0*w0*pow(w1, 3)*w4 + 3840*cx4*cy0*w0*pow(w1, 2)*w2*w4 - 2304*cx4*cy0*w0*pow(w1, 2)*w3*w4 + 384*cx4*cy0*w0*pow(w1, 2)*pow(w4, 2) - 6336*cx4*cy0*w0*w1*pow(w2, 2)*w4 + 7680*cx4*cy0*w0*w1*w2*w3*w4 - 1344*cx4*cy0*w0*w1*w2*pow(w4, 2) - 2304*cx4*cy0*w0*w1*pow(w3, 2)*w4 + 768*cx4*cy0*w0*w1*w3*pow(w4, 2) - 48*cx4*cy0*w0*w1*pow(w4, 3) + 3456*cx4*cy0*w0*pow(w2, 3)*w4 - 6336*cx4*cy0*w0*pow(w2, 2)*w3*w4 + 1152*cx4*cy0*w0*pow(w2, 2)*pow(w4, 2) + 3840*cx4*cy0*w0*w2*pow(w3, 2)*w4 - 1344*cx4*cy0*w0*w2*w3*pow(w4, 2) + 96*cx4*cy0*w0*w2*pow(w4, 3) - 768*cx4*cy0*w0*pow(w3, 3)*w4 + 384*cx4*cy0*w0*pow(w3, 2)*pow(w4, 2) - 48*cx4*cy0*w0*w3*pow(w4, 3) + 48*cx4*cy1*pow(w0, 3)*w1*w4 - 384*cx4*cy1*pow(w0, 2)*pow(w1, 2)*w4 + 432*cx4*cy1*pow(w0, 2)*w1*w2*w4 - 288*cx4*cy1*pow(w0, 2)*w1*w3*w4 + 96*cx4*cy1*pow(w0, 2)*w1*pow(w4, 2) + 768*cx4*cy1*w0*pow(w1, 3)*w4 - 1152*cx4*cy1*w0*pow(w1, 2)*w2*w4 + 768*cx4*cy1*w0*pow(w1, 2)*w3*w4 - 384*cx4*cy1*w0*pow(w1, 2)*pow(w4, 2) + 288*cx4*cy1*w0*w1*w2*pow(w4, 2) - 192*cx4*cy1*w0*w1*w3*pow(w4, 2) + 48*cx4*cy1*w0*w1*pow(w4, 3) - 2304*cx4*cy1*pow(w1, 3)*w2*w4 + 1536*cx4*cy1*pow(w1, 3)*w3*w4 + 6912*cx4*cy1*pow(w1, 2)*pow(w2, 2)*w4 - 9216*cx4*cy1*pow(w1, 2)*w2*w3*w4 + 1152*cx4*cy1*pow(w1, 2)*w2*pow(w4, 2) + 3072*cx4*cy1*pow(w1, 2)*pow(w3, 2)*w4 - 768*cx4*cy1*pow(w1, 2)*w3*pow(w4, 2) - 5184*cx4*cy1*w1*pow(w2, 3)*w4 + 10368*cx4*cy1*w1*pow(w2, 2)*w3*w4 - 1728*cx4*cy1*w1*pow(w2, 2)*pow(w4, 2) - 6912*cx4*cy1*w1*w2*pow(w3, 2)*w4 + 2304*cx4*cy1*w1*w2*w3*pow(w4, 2) - 144*cx4*cy1*w1*w2*pow(w4, 3) + 1536*cx4*cy1*w1*pow(w3, 3)*w4 - 768*cx4*cy1*w1*pow(w3, 2)*pow(w4, 2) + 96*cx4*cy1*w1*w3*pow(w4, 3) - 96*cx4*cy2*pow(w0, 3)*w2*w4 + 912*cx4*cy2*pow(w0, 2)*w1*w2*w4 - 1152*cx4*cy2*pow(w0, 2)*pow(w2, 2)*w4 + 720*cx4*cy2*pow(w0, 2)*w2*w3*w4 - 192*cx4*cy2*pow(w0, 2)*w2*pow(w4, 2) - 2688*cx4*cy2*w0*pow(w1, 2)*w2*w4 + 6336*cx4*cy2*w0*w1*pow(w2, 2)*w4 - 3840*cx4*cy2*w0*w1*w2*w3*w4 + 1056*cx4*cy2*w0*w1*w2*pow(w4, 2) - 3456*cx4*cy2*w0*pow(w2, 3)*w4 + 4032*cx4*cy2*w0*pow(w2, 2)*w3*w4 - 1152*cx4*cy2*w0*pow(w2, 2)*pow(w4, 2) - 1152*cx4*cy2*w0*w2*pow(w3, 2)*w4 + 672*cx4*cy2*w0*w2*w3*pow(w4, 2) - 96*cx4*cy2*w0*w2*pow(w4, 3) + 2304*cx4*cy2*pow(w1, 3)*w2*w4 - 6912*cx4*cy2*pow(w1, 2)*pow(w2, 2)*w4 + 3840*cx4*cy2*pow(w1, 2)*w2*w3*w4 - 1152*cx4*cy2*pow(w1, 2)*w2*pow(w4, 2) + 5184*cx4*cy2*w1*pow(w2, 3)*w4 - 4608*cx4*cy2*w1*pow(w2, 2)*w3*w4 + 1728*cx4*cy2*w1*pow(w2, 2)*pow(w4, 2) + 768*cx4*cy2*w1*w2*pow(w3, 2)*w4 - 768*cx4*cy2*w1*w2*w3*pow(w4, 2) + 144*cx4*cy2*w1*w2*pow(w4, 3) - 1728*cx4*cy2*pow(w2, 3)*w3*w4 + 2304*cx4*cy2*pow(w2, 2)*pow(w3, 2)*w4 - 576*cx4*cy2*pow(w2, 2)*w3*pow(w4, 2) - 768*cx4*cy2*w2*pow(w3, 3)*w4 + 384*cx4*cy2*w2*pow(w3, 2)*pow(w4, 2) - 48*cx4*cy2*w2*w3*pow(w4, 3) + 48*cx4*cy3*pow(w0, 3)*w3*w4 - 480*cx4*cy3*pow(w0, 2)*w1*w3*w4 + 624*cx4*cy3*pow(w0, 2)*w2*w3*w4 - 384*cx4*cy3*pow(w0, 2)*pow(w3, 2)*w4 + 96*cx4*cy3*pow(w0, 2)*w3*pow(w4, 2) + 1536*cx4*cy3*w0*pow(w1, 2)*w3*w4 - 3840*cx4*cy3*w0*w1*w2*w3*w4 + 2304*cx4*cy3*w0*w1*pow(w3, 2)*w4 - 576*cx4*cy3*w0*w1*w3*pow(w4, 2) + 2304*cx4*cy3*w0*pow(w2, 2)*w3*w4 - 2688*cx4*cy3*w0*w2*pow(w3, 2)*w4 + 672*cx4*cy3*w0*w2*w3*pow(w4, 2) + 768*cx4*cy3*w0*pow(w3, 3)*w4 - 384*cx4*cy3*w0*pow(w3, 2)*pow(w4, 2) + 48*cx4*cy3*w0*w3*pow(w4, 3) - 1536*cx4*cy3*pow(w1, 3)*w3*w4 + 5376*cx4*cy3*pow(w1, 2)*w2*w3*w4 - 3072*cx4*cy3*pow(w1, 2)*pow(w3, 2)*w4 + 768*cx4*cy3*pow(w1, 2)*w3*pow(w4, 2) - 5760*cx4*cy3*w1*pow(w2, 2)*w3*w4 + 6144*cx4*cy3*w1*w2*pow(w3, 2)*w4 - 1536*cx4*cy3*w1*w2*w3*pow(w4, 2) - 1536*cx4*cy3*w1*pow(w3, 3)*w4 + 768*cx4*cy3*w1*pow(w3, 2)*pow(w4, 2) - 96*cx4*cy3*w1*w3*pow(w4, 3) + 1728*cx4*cy3*pow(w2, 3)*w3*w4 - 2304*cx4*cy3*pow(w2, 2)*pow(w3, 2)*w4 + 576*cx4*cy3*pow(w2, 2)*w3*pow(w4, 2) + 768*cx4*cy3*w2*pow(w3, 3)*w4 - 384*cx4*cy3*w2*pow(w3, 2)*pow(w4, 2) + 48*cx4*cy3*w2*w3*pow(w4, 3)
-    },
-    result, t0, t1, tol);
-
-    return result;
-}
-
-
-template<typename Derived, typename Derived2>
-std::vector<typename Derived::Scalar> compute_RationalBezier_inflections(
-        const Eigen::PlainObjectBase<Derived>& ctrl_pts,
-        const Eigen::PlainObjectBase<Derived2>& weights,
-        typename Derived::Scalar t0 = 0,
-        typename Derived::Scalar t1 = 1) {
-    switch(ctrl_pts.rows()-1) {
-        case 2:
-            return compute_RationalBezier_degree_2_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), weights(0), weights(1), weights(2), t0, t1);
-        case 3:
-            return compute_RationalBezier_degree_3_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), weights(0), weights(1), weights(2), weights(3), t0, t1);
-        case 4:
-            return compute_RationalBezier_degree_4_inflections(ctrl_pts(0,0), ctrl_pts(0,1), ctrl_pts(1,0), ctrl_pts(1,1), ctrl_pts(2,0), ctrl_pts(2,1), ctrl_pts(3,0), ctrl_pts(3,1), ctrl_pts(4,0), ctrl_pts(4,1), weights(0), weights(1), weights(2), weights(3), weights(4), t0, t1);
-        default:
-            throw not_implemented_error(
-                "Inflection computation only works on RationalBezier curve with degree lower than 4");
-    }
-}
-
-
-
-} // End internal namespace
-} // End nanospline namespace
-
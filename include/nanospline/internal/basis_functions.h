@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cassert>
+#include <utility>
+
+#include <Eigen/Core>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Largest dynamic degree whose basis function scratch space is kept on the
+ * stack.  Higher degrees fall back to heap allocated scratch.
+ */
+constexpr int MAX_STACK_DEGREE = 15;
+
+/**
+ * Dense (p+1) x (p+1) scratch matrix used by the basis function routines.
+ * A negative `_max_degree` means no compile time bound (heap storage).
+ */
+template <typename Scalar, int _max_degree>
+using BasisScratch = Eigen::Matrix<Scalar,
+    Eigen::Dynamic,
+    Eigen::Dynamic,
+    Eigen::ColMajor,
+    _max_degree < 0 ? Eigen::Dynamic : _max_degree + 1,
+    _max_degree < 0 ? Eigen::Dynamic : _max_degree + 1>;
+
+/**
+ * Locate the knot span k such that knots[k] <= t < knots[k+1].
+ *
+ * Parameters outside of the domain [knots[p], knots[m-p-1]] are mapped to
+ * the first/last non-degenerate span so that evaluation extrapolates.
+ */
+template <typename Derived>
+int locate_knot_span(
+    const Eigen::MatrixBase<Derived>& knots, const int p, const typename Derived::Scalar t)
+{
+    const int num_knots = static_cast<int>(knots.size());
+    int low = p;
+    int high = num_knots - p - 1;
+
+    auto bypass_duplicates_after = [&knots, num_knots](int i) {
+        while (i + 1 < num_knots && knots[i] == knots[i + 1]) {
+            i = i + 1;
+        }
+        return i;
+    };
+
+    auto bypass_duplicates_before = [&knots](int i) {
+        while (i - 1 >= 0 && knots[i] == knots[i - 1]) {
+            i = i - 1;
+        }
+        return i;
+    };
+
+    // Handle out of domain cases.
+    if (t <= knots[low]) return low;
+
+    if (t >= knots[high]) return bypass_duplicates_before(high) - 1;
+
+    int mid = (high + low) / 2;
+    while (t < knots[mid] || t >= knots[mid + 1]) {
+        if (t < knots[mid])
+            high = mid;
+        else
+            low = mid;
+        mid = (high + low) / 2;
+    }
+
+    return bypass_duplicates_after(mid);
+}
+
+/**
+ * Compute the nonzero basis functions of degree p and their derivatives up
+ * to order n at t, where `span` is the knot span containing t (The NURBS
+ * Book, algorithm A2.3).
+ *
+ * On return, ders(k, j) is the k-th derivative of N_{span-p+j, p}(t).
+ * `ders` must be able to hold (n+1) x (p+1) entries, with n <= p.
+ */
+template <int _max_degree, typename KnotDerived, typename OutDerived>
+void compute_basis_function_derivatives(const Eigen::MatrixBase<KnotDerived>& knots,
+    const int span,
+    const int p,
+    const typename KnotDerived::Scalar t,
+    const int n,
+    Eigen::PlainObjectBase<OutDerived>& ders)
+{
+    using Scalar = typename KnotDerived::Scalar;
+    using Scratch = BasisScratch<Scalar, _max_degree>;
+    using ScratchVector = Eigen::Matrix<Scalar,
+        Eigen::Dynamic,
+        1,
+        Eigen::ColMajor,
+        _max_degree < 0 ? Eigen::Dynamic : _max_degree + 1,
+        1>;
+    using ScratchRows = Eigen::Matrix<Scalar,
+        2,
+        Eigen::Dynamic,
+        Eigen::ColMajor,
+        2,
+        _max_degree < 0 ? Eigen::Dynamic : _max_degree + 1>;
+    assert(p >= 0);
+    assert(n >= 0 && n <= p);
+    assert(_max_degree < 0 || p <= _max_degree);
+
+    ders.resize(n + 1, p + 1);
+
+    // ndu stores the basis functions (upper triangle) and the knot
+    // differences (lower triangle).
+    Scratch ndu(p + 1, p + 1);
+    ScratchVector left(p + 1), right(p + 1);
+    ndu(0, 0) = 1;
+    for (int j = 1; j <= p; j++) {
+        left[j] = t - knots[span + 1 - j];
+        right[j] = knots[span + j] - t;
+        Scalar saved = 0;
+        for (int r = 0; r < j; r++) {
+            ndu(j, r) = right[r + 1] + left[j - r];
+            const Scalar temp = ndu(r, j - 1) / ndu(j, r);
+            ndu(r, j) = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        ndu(j, j) = saved;
+    }
+
+    for (int j = 0; j <= p; j++) {
+        ders(0, j) = ndu(j, p);
+    }
+    if (n == 0) return;
+
+    ScratchRows a(2, p + 1);
+    for (int r = 0; r <= p; r++) {
+        int s1 = 0, s2 = 1;
+        a(0, 0) = 1;
+        for (int k = 1; k <= n; k++) {
+            Scalar d = 0;
+            const int rk = r - k;
+            const int pk = p - k;
+            if (r >= k) {
+                a(s2, 0) = a(s1, 0) / ndu(pk + 1, rk);
+                d = a(s2, 0) * ndu(rk, pk);
+            }
+            const int j1 = (rk >= -1) ? 1 : -rk;
+            const int j2 = (r - 1 <= pk) ? k - 1 : p - r;
+            for (int j = j1; j <= j2; j++) {
+                a(s2, j) = (a(s1, j) - a(s1, j - 1)) / ndu(pk + 1, rk + j);
+                d += a(s2, j) * ndu(rk + j, pk);
+            }
+            if (r <= pk) {
+                a(s2, k) = -a(s1, k - 1) / ndu(pk + 1, r);
+                d += a(s2, k) * ndu(r, pk);
+            }
+            ders(k, r) = d;
+            std::swap(s1, s2);
+        }
+    }
+
+    // Multiply through by the correct factors p!/(p-k)!.
+    Scalar factor = static_cast<Scalar>(p);
+    for (int k = 1; k <= n; k++) {
+        ders.row(k) *= factor;
+        factor *= static_cast<Scalar>(p - k);
+    }
+}
+
+/**
+ * Compute the Bernstein polynomials of degree p and their derivatives up to
+ * order n at t.  These are the B-spline basis functions over the clamped
+ * knot vector [0, ..., 0, 1, ..., 1], so the layout of `ders` is the same as
+ * for compute_basis_function_derivatives with span p.
+ */
+template <int _max_degree, typename Scalar, typename OutDerived>
+void compute_bernstein_derivatives(
+    const int p, const Scalar t, const int n, Eigen::PlainObjectBase<OutDerived>& ders)
+{
+    using KnotVector = Eigen::Matrix<Scalar,
+        Eigen::Dynamic,
+        1,
+        Eigen::ColMajor,
+        _max_degree < 0 ? Eigen::Dynamic : 2 * (_max_degree + 1),
+        1>;
+    KnotVector knots(2 * (p + 1));
+    knots.head(p + 1).setZero();
+    knots.tail(p + 1).setOnes();
+    compute_basis_function_derivatives<_max_degree>(knots, p, p, t, n, ders);
+}
+
+} // namespace internal
+} // namespace nanospline
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Binomial coefficients C(n, 0), ..., C(n, n).
+ */
+template <typename Scalar>
+std::vector<Scalar> binomial_coefficients(int n)
+{
+    std::vector<Scalar> c(static_cast<size_t>(n + 1));
+    c[0] = 1;
+    for (int k = 0; k < n; k++) {
+        c[static_cast<size_t>(k + 1)] = c[static_cast<size_t>(k)] * Scalar(n - k) / Scalar(k + 1);
+    }
+    return c;
+}
+
+template <typename Scalar>
+using BernsteinCoefficients = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+/**
+ * Bernstein coefficients of the product of a scalar polynomial `a` and a
+ * vector valued polynomial `b`, both given in Bernstein form on [0, 1]
+ * with one coefficient per row.  Uses
+ * c_k = sum_{i+j=k} C(m,i) C(n,j) / C(m+n,k) a_i b_j.
+ */
+template <typename DerivedA, typename DerivedB>
+BernsteinCoefficients<typename DerivedA::Scalar> bernstein_product(
+    const Eigen::MatrixBase<DerivedA>& a, const Eigen::MatrixBase<DerivedB>& b)
+{
+    using Scalar = typename DerivedA::Scalar;
+    const int m = static_cast<int>(a.rows()) - 1;
+    const int n = static_cast<int>(b.rows()) - 1;
+    const auto binom_m = binomial_coefficients<Scalar>(m);
+    const auto binom_n = binomial_coefficients<Scalar>(n);
+    const auto binom_mn = binomial_coefficients<Scalar>(m + n);
+    BernsteinCoefficients<Scalar> c = BernsteinCoefficients<Scalar>::Zero(m + n + 1, b.cols());
+    for (int i = 0; i <= m; i++) {
+        const Scalar ai = binom_m[static_cast<size_t>(i)] * a(i, 0);
+        for (int j = 0; j <= n; j++) {
+            c.row(i + j) += (ai * binom_n[static_cast<size_t>(j)]) * b.row(j);
+        }
+    }
+    for (int k = 0; k <= m + n; k++) {
+        c.row(k) /= binom_mn[static_cast<size_t>(k)];
+    }
+    return c;
+}
+
+/**
+ * Bernstein coefficients of the dot product of two vector valued
+ * polynomials in Bernstein form on [0, 1].
+ */
+template <typename DerivedA, typename DerivedB>
+std::vector<typename DerivedA::Scalar> bernstein_dot(
+    const Eigen::MatrixBase<DerivedA>& a, const Eigen::MatrixBase<DerivedB>& b)
+{
+    using Scalar = typename DerivedA::Scalar;
+    const int m = static_cast<int>(a.rows()) - 1;
+    const int n = static_cast<int>(b.rows()) - 1;
+    const auto binom_m = binomial_coefficients<Scalar>(m);
+    const auto binom_n = binomial_coefficients<Scalar>(n);
+    const auto binom_mn = binomial_coefficients<Scalar>(m + n);
+    std::vector<Scalar> c(static_cast<size_t>(m + n + 1), 0);
+    for (int i = 0; i <= m; i++) {
+        for (int j = 0; j <= n; j++) {
+            c[static_cast<size_t>(i + j)] += binom_m[static_cast<size_t>(i)] *
+                                             binom_n[static_cast<size_t>(j)] *
+                                             a.row(i).dot(b.row(j));
+        }
+    }
+    for (size_t k = 0; k < c.size(); k++) {
+        c[k] /= binom_mn[k];
+    }
+    return c;
+}
+
+/**
+ * Control points of the hodograph of a Bezier curve.
+ */
+template <typename Derived>
+BernsteinCoefficients<typename Derived::Scalar> bernstein_derivative(
+    const Eigen::MatrixBase<Derived>& ctrl_pts)
+{
+    using Scalar = typename Derived::Scalar;
+    const int d = static_cast<int>(ctrl_pts.rows()) - 1;
+    return Scalar(d) * (ctrl_pts.bottomRows(d) - ctrl_pts.topRows(d));
+}
+
+/**
+ * Evaluate a scalar polynomial in Bernstein form at s with de Casteljau's
+ * algorithm.  `scratch` must have the size of `coeffs`.
+ */
+template <typename Scalar>
+Scalar evaluate_bernstein(
+    const std::vector<Scalar>& coeffs, const Scalar s, std::vector<Scalar>& scratch)
+{
+    scratch = coeffs;
+    for (size_t r = 1; r < scratch.size(); r++) {
+        for (size_t i = 0; i + r < scratch.size(); i++) {
+            scratch[i] = (1 - s) * scratch[i] + s * scratch[i + 1];
+        }
+    }
+    return scratch[0];
+}
+
+/**
+ * Append to `roots` the roots in [a, b] of the polynomial whose Bernstein
+ * coefficients over [a, b] are `coeffs`.
+ *
+ * By the variation diminishing property, the number of sign changes in the
+ * coefficients bounds the number of roots from above, and the bound is
+ * exact when it is 0 or 1.  Intervals with no sign change are dropped,
+ * intervals with one are refined by bisection and the others are split in
+ * half.  Multiple roots never reach a single sign change; they are
+ * reported as the midpoint of an interval of width at most 2^-max_depth.
+ *
+ * Coefficients of magnitude at most `zero_tol` are treated as zero, so
+ * rounding noise neither creates sign changes nor drives the subdivision
+ * of a polynomial that vanishes identically, which is reported as the
+ * midpoint of [a, b].
+ */
+template <typename Scalar>
+void isolate_bernstein_roots(const std::vector<Scalar>& coeffs,
+    const Scalar a,
+    const Scalar b,
+    std::vector<Scalar>& roots,
+    const Scalar zero_tol = 0,
+    const int max_depth = 40)
+{
+    using std::abs;
+    const size_t n = coeffs.size();
+    if (n == 0) return;
+    const bool zero_at_a = abs(coeffs.front()) <= zero_tol;
+    const bool zero_at_b = abs(coeffs.back()) <= zero_tol;
+    if (zero_at_a) roots.push_back(a);
+    if (zero_at_b) roots.push_back(b);
+
+    int num_sign_changes = 0;
+    int num_nonzeros = 0;
+    Scalar prev = 0;
+    for (const Scalar c : coeffs) {
+        if (abs(c) <= zero_tol) continue;
+        if (num_nonzeros > 0 && (c > 0) != (prev > 0)) num_sign_changes++;
+        prev = c;
+        num_nonzeros++;
+    }
+    if (num_nonzeros == 0) {
+        roots.push_back((a + b) / 2);
+        return;
+    }
+    if (num_sign_changes == 0) return;
+
+    if (num_sign_changes == 1 && !zero_at_a && !zero_at_b) {
+        // Exactly one simple root inside (a, b), refined with the Illinois
+        // variant of regula falsi, which keeps the bracket but converges
+        // superlinearly.
+        std::vector<Scalar> scratch(n);
+        Scalar lo = 0, hi = 1;
+        Scalar f_lo = coeffs.front(), f_hi = coeffs.back();
+        Scalar s = Scalar(0.5);
+        int side = 0;
+        for (int i = 0; i < 2 * std::numeric_limits<Scalar>::digits; i++) {
+            s = (lo * f_hi - hi * f_lo) / (f_hi - f_lo);
+            if (!(s > lo && s < hi)) s = (lo + hi) / 2;
+            if (!(s > lo && s < hi)) break;
+            const Scalar f = evaluate_bernstein(coeffs, s, scratch);
+            if (f == 0) break;
+            if ((f > 0) == (f_lo > 0)) {
+                lo = s;
+                f_lo = f;
+                if (side == -1) f_hi /= 2;
+                side = -1;
+            } else {
+                hi = s;
+                f_hi = f;
+                if (side == 1) f_lo /= 2;
+                side = 1;
+            }
+        }
+        roots.push_back(a + (b - a) * s);
+        return;
+    }
+
+    if (max_depth <= 0) {
+        roots.push_back((a + b) / 2);
+        return;
+    }
+
+    // Subdivide at the midpoint: the first entries of the de Casteljau
+    // levels are the coefficients over [a, m], the last entries those over
+    // [m, b].  A root exactly at m is reported by both halves, which is
+    // harmless for the callers.
+    std::vector<Scalar> left(n), right(n), level(coeffs);
+    for (size_t r = 0; r < n; r++) {
+        left[r] = level[0];
+        right[n - 1 - r] = level[n - 1 - r];
+        for (size_t i = 0; i + r + 1 < n; i++) {
+            level[i] = (level[i] + level[i + 1]) / 2;
+        }
+    }
+    const Scalar m = (a + b) / 2;
+    isolate_bernstein_roots(left, a, m, roots, zero_tol, max_depth - 1);
+    isolate_bernstein_roots(right, m, b, roots, zero_tol, max_depth - 1);
+}
+
+/**
+ * Magnitude below which the coefficients of `coeffs` are dominated by the
+ * rounding error of computing them.
+ */
+template <typename Scalar>
+Scalar zero_tolerance(const std::vector<Scalar>& coeffs)
+{
+    Scalar max_coeff = 0;
+    for (const Scalar c : coeffs) {
+        max_coeff = std::max(max_coeff, std::abs(c));
+    }
+    return max_coeff * Scalar(coeffs.size()) * 16 * std::numeric_limits<Scalar>::epsilon();
+}
+
+/**
+ * Bernstein coefficients over [t0, t1] of the polynomial
+ * sum_j coeffs[j] * t^j.  The power basis is first shifted and scaled to
+ * s = (t - t0) / (t1 - t0) by Horner's scheme, then converted with
+ * b_i = sum_{j<=i} C(i, j) / C(n, j) a_j.
+ */
+template <typename Scalar>
+std::vector<Scalar> power_to_bernstein(
+    const std::vector<Scalar>& coeffs, const Scalar t0, const Scalar t1)
+{
+    const size_t n = coeffs.size();
+    std::vector<Scalar> a(coeffs);
+    if (n == 0) return a;
+    for (size_t k = 0; k + 1 < n; k++) {
+        for (size_t j = n - 1; j > k; j--) {
+            a[j - 1] += t0 * a[j];
+        }
+    }
+    const Scalar h = t1 - t0;
+    Scalar h_power = 1;
+    for (size_t j = 1; j < n; j++) {
+        h_power *= h;
+        a[j] *= h_power;
+    }
+
+    const int d = static_cast<int>(n) - 1;
+    const auto binom_d = binomial_coefficients<Scalar>(d);
+    std::vector<Scalar> b(n, 0);
+    for (int i = 0; i <= d; i++) {
+        const auto binom_i = binomial_coefficients<Scalar>(i);
+        for (int j = 0; j <= i; j++) {
+            b[static_cast<size_t>(i)] += binom_i[static_cast<size_t>(j)] /
+                                         binom_d[static_cast<size_t>(j)] *
+                                         a[static_cast<size_t>(j)];
+        }
+    }
+    return b;
+}
+
+} // namespace internal
+} // namespace nanospline
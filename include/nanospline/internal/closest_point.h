@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <nanospline/internal/bernstein.h>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Point of a (possibly homogeneous) Bezier curve given by its control
+ * points at s in [0, 1].
+ */
+template <typename Derived>
+Eigen::Matrix<typename Derived::Scalar, 1, Derived::ColsAtCompileTime> de_casteljau(
+    const Eigen::MatrixBase<Derived>& ctrl_pts, const typename Derived::Scalar s)
+{
+    using Scalar = typename Derived::Scalar;
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Derived::ColsAtCompileTime> pts = ctrl_pts;
+    const int d = static_cast<int>(pts.rows()) - 1;
+    for (int r = 1; r <= d; r++) {
+        for (int i = 0; i + r <= d; i++) {
+            pts.row(i) = (1 - s) * pts.row(i) + s * pts.row(i + 1);
+        }
+    }
+    return pts.row(0);
+}
+
+/**
+ * Update (best_t, best_sq_dist) with the point of the polynomial Bezier
+ * curve `ctrl_pts`, parameterized over [lower, upper], closest to q.
+ *
+ * The candidates are the end points and the roots of the degree 2d-1
+ * polynomial (C(s) - q) . C'(s), whose Bernstein coefficients follow from
+ * the control points directly.
+ */
+template <typename Derived, typename PointType>
+void bezier_closest_point(const Eigen::MatrixBase<Derived>& ctrl_pts,
+    const PointType& q,
+    const typename Derived::Scalar lower,
+    const typename Derived::Scalar upper,
+    typename Derived::Scalar& best_t,
+    typename Derived::Scalar& best_sq_dist)
+{
+    using Scalar = typename Derived::Scalar;
+    const int d = static_cast<int>(ctrl_pts.rows()) - 1;
+    std::vector<Scalar> candidates{0, 1};
+    if (d > 0) {
+        const BernsteinCoefficients<Scalar> offsets = ctrl_pts.rowwise() - q;
+        const auto f = bernstein_dot(offsets, bernstein_derivative(ctrl_pts));
+        isolate_bernstein_roots(f, Scalar(0), Scalar(1), candidates, zero_tolerance(f));
+    }
+
+    for (const Scalar s : candidates) {
+        const Scalar sq_dist = (de_casteljau(ctrl_pts, s) - q).squaredNorm();
+        if (sq_dist < best_sq_dist) {
+            best_sq_dist = sq_dist;
+            best_t = lower + s * (upper - lower);
+        }
+    }
+}
+
+/**
+ * Rational counterpart of bezier_closest_point, with the curve given by
+ * homogeneous control points (weighted coordinates followed by the weight).
+ *
+ * With C = P / w, the numerator of (C - q) . C' is
+ * (P - q w) . (P' w - P w'), a polynomial of degree 3d-1 with the same
+ * roots since w > 0.
+ */
+template <typename Derived, typename PointType>
+void rational_bezier_closest_point(const Eigen::MatrixBase<Derived>& homogeneous_ctrl_pts,
+    const PointType& q,
+    const typename Derived::Scalar lower,
+    const typename Derived::Scalar upper,
+    typename Derived::Scalar& best_t,
+    typename Derived::Scalar& best_sq_dist)
+{
+    using Scalar = typename Derived::Scalar;
+    const int d = static_cast<int>(homogeneous_ctrl_pts.rows()) - 1;
+    const int dim = static_cast<int>(homogeneous_ctrl_pts.cols()) - 1;
+    const auto P = homogeneous_ctrl_pts.leftCols(dim);
+    const auto w = homogeneous_ctrl_pts.rightCols(1);
+
+    std::vector<Scalar> candidates{0, 1};
+    if (d > 0) {
+        const BernsteinCoefficients<Scalar> dP = bernstein_derivative(P);
+        const BernsteinCoefficients<Scalar> dw = bernstein_derivative(w);
+        const BernsteinCoefficients<Scalar> tangent =
+            bernstein_product(w, dP) - bernstein_product(dw, P);
+        const BernsteinCoefficients<Scalar> offsets = P - w * q;
+        const auto f = bernstein_dot(offsets, tangent);
+        isolate_bernstein_roots(f, Scalar(0), Scalar(1), candidates, zero_tolerance(f));
+    }
+
+    for (const Scalar s : candidates) {
+        const auto h = de_casteljau(homogeneous_ctrl_pts, s);
+        const Scalar sq_dist = (h.leftCols(dim) / h[dim] - q).squaredNorm();
+        if (sq_dist < best_sq_dist) {
+            best_sq_dist = sq_dist;
+            best_t = lower + s * (upper - lower);
+        }
+    }
+}
+
+/**
+ * Closest point search over the knot spans of a B-spline.
+ *
+ * The control points of span k, rows k-p..k of `bound_pts`, contain that
+ * span of the curve, so the distance from q to their bounding box is a
+ * lower bound for it.  Spans are visited by increasing lower bound and
+ * the search stops once the bound exceeds the best distance found.
+ * `solve_span(k, best_t, best_sq_dist)` runs the exact search on span k.
+ */
+template <typename KnotDerived, typename PointDerived, typename PointType, typename SpanSolver>
+typename KnotDerived::Scalar bspline_closest_point(const Eigen::MatrixBase<KnotDerived>& knots,
+    const int degree,
+    const Eigen::MatrixBase<PointDerived>& bound_pts,
+    const PointType& q,
+    SpanSolver solve_span)
+{
+    using Scalar = typename KnotDerived::Scalar;
+    const int p = degree;
+    const int num_ctrl_pts = static_cast<int>(bound_pts.rows());
+
+    std::vector<std::pair<Scalar, int>> spans;
+    spans.reserve(static_cast<size_t>(num_ctrl_pts - p));
+    for (int k = p; k < num_ctrl_pts; k++) {
+        if (!(knots[k + 1] > knots[k])) continue;
+        const auto pts = bound_pts.middleRows(k - p, p + 1);
+        const auto bbox_min = pts.colwise().minCoeff();
+        const auto bbox_max = pts.colwise().maxCoeff();
+        const Scalar lower_bound = (q.cwiseMax(bbox_min).cwiseMin(bbox_max) - q).squaredNorm();
+        spans.emplace_back(lower_bound, k);
+    }
+    std::sort(spans.begin(), spans.end());
+
+    Scalar best_t = knots[p];
+    Scalar best_sq_dist = std::numeric_limits<Scalar>::max();
+    for (const auto& span : spans) {
+        if (span.first >= best_sq_dist) break;
+        solve_span(span.second, best_t, best_sq_dist);
+    }
+    return best_t;
+}
+
+} // namespace internal
+} // namespace nanospline
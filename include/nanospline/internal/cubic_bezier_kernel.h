@@ -0,0 +1,87 @@
+#pragma once
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Closed-form de Casteljau evaluation of a cubic Bezier curve.
+ *
+ * `Value` is the result type and `Param` the parameter type.  The kernels
+ * only use +, - and multiplication by a parameter, so the same code serves
+ * Eigen points (Param = Scalar), plain scalars, and SIMD packets holding one
+ * coordinate of several curves at once (Param = Value = Packet).
+ */
+template <typename Value, typename Param, typename Input>
+Value cubic_bezier_evaluate(
+    const Param& t, const Input& c0, const Input& c1, const Input& c2, const Input& c3)
+{
+    const Param s = Param(1) - t;
+    const Value q0 = s * c0 + t * c1;
+    const Value q1 = s * c1 + t * c2;
+    const Value q2 = s * c2 + t * c3;
+
+    const Value p0 = s * q0 + t * q1;
+    const Value p1 = s * q1 + t * q2;
+    return s * p0 + t * p1;
+}
+
+/**
+ * First derivative of a cubic Bezier curve, see cubic_bezier_evaluate.
+ */
+template <typename Value, typename Param, typename Input>
+Value cubic_bezier_derivative(
+    const Param& t, const Input& c0, const Input& c1, const Input& c2, const Input& c3)
+{
+    const Param s = Param(1) - t;
+    const Value q0 = s * c0 + t * c1;
+    const Value q1 = s * c1 + t * c2;
+    const Value q2 = s * c2 + t * c3;
+
+    const Value p0 = s * q0 + t * q1;
+    const Value p1 = s * q1 + t * q2;
+    return Param(3) * (p1 - p0);
+}
+
+/**
+ * Second derivative of a cubic Bezier curve, see cubic_bezier_evaluate.
+ */
+template <typename Value, typename Param, typename Input>
+Value cubic_bezier_2nd_derivative(
+    const Param& t, const Input& c0, const Input& c1, const Input& c2, const Input& c3)
+{
+    const Param s = Param(1) - t;
+    const Value q0 = s * c0 + t * c1;
+    const Value q1 = s * c1 + t * c2;
+    const Value q2 = s * c2 + t * c3;
+    return Param(6) * (q0 + q2 - Param(2) * q1);
+}
+
+/**
+ * Point and first two derivatives of a cubic Bezier curve from one shared
+ * de Casteljau pass, see cubic_bezier_evaluate.  Only the first `k + 1`
+ * outputs are written.
+ */
+template <typename Value, typename Param, typename Input>
+void cubic_bezier_derivatives(const Param& t,
+    const Input& c0,
+    const Input& c1,
+    const Input& c2,
+    const Input& c3,
+    int k,
+    Value& d0,
+    Value& d1,
+    Value& d2)
+{
+    const Param s = Param(1) - t;
+    const Value q0 = s * c0 + t * c1;
+    const Value q1 = s * c1 + t * c2;
+    const Value q2 = s * c2 + t * c3;
+    if (k >= 2) d2 = Param(6) * (q0 + q2 - Param(2) * q1);
+    const Value p0 = s * q0 + t * q1;
+    const Value p1 = s * q1 + t * q2;
+    if (k >= 1) d1 = Param(3) * (p1 - p0);
+    d0 = s * p0 + t * p1;
+}
+
+} // namespace internal
+} // namespace nanospline
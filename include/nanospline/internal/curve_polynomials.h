@@ -0,0 +1,262 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <nanospline/BernsteinPolynomial.h>
+#include <nanospline/PolynomialRootFinder.h>
+#include <nanospline/internal/bernstein.h>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Polynomials whose roots answer the inflection, singularity and tangent
+ * matching queries of a planar Bezier curve, in Bernstein form on [0, 1].
+ * They are built with BernsteinPolynomial arithmetic on the control
+ * points, so they exist for every degree.  Rational curves are given by
+ * their homogeneous control points (x w, y w, w), one per row.
+ *
+ * Their roots do not move when the curve is translated or scaled, so the
+ * control points are first normalized to unit extent.  The coefficients
+ * are then independent of the size of the curve, and a polynomial that
+ * vanishes up to rounding is told apart from a genuine one by the same
+ * tolerance for every curve, see bernstein_roots_in_range.
+ */
+
+template <typename Derived>
+std::vector<typename Derived::Scalar> to_std_vector(const Eigen::MatrixBase<Derived>& coeffs)
+{
+    std::vector<typename Derived::Scalar> result(static_cast<size_t>(coeffs.rows()));
+    for (Eigen::Index i = 0; i < coeffs.rows(); i++) {
+        result[static_cast<size_t>(i)] = coeffs(i, 0);
+    }
+    return result;
+}
+
+/**
+ * The control points translated to the first one and scaled to a largest
+ * coordinate of 1.
+ */
+template <typename Derived>
+BernsteinPolynomial<typename Derived::Scalar> to_normalized_polynomial(
+    const Eigen::MatrixBase<Derived>& ctrl_pts)
+{
+    using Scalar = typename Derived::Scalar;
+    using Polynomial = BernsteinPolynomial<Scalar>;
+    typename Polynomial::Coefficients coeffs = ctrl_pts.rowwise() - ctrl_pts.row(0);
+    const Scalar extent = coeffs.cwiseAbs().maxCoeff();
+    if (extent > 0) coeffs /= extent;
+    return Polynomial(std::move(coeffs));
+}
+
+/**
+ * Same as to_normalized_polynomial for homogeneous control points.  The
+ * weights are scaled to a largest weight of 1, the curve is translated to
+ * the first point by subtracting w P0 from (x w, y w), and the spatial
+ * part is scaled to a largest coordinate of 1.  Neither scaling changes
+ * the roots.
+ */
+template <typename Derived>
+BernsteinPolynomial<typename Derived::Scalar> to_normalized_homogeneous_polynomial(
+    const Eigen::MatrixBase<Derived>& homogeneous_ctrl_pts)
+{
+    using Scalar = typename Derived::Scalar;
+    using Polynomial = BernsteinPolynomial<Scalar>;
+    const Eigen::Index dim = homogeneous_ctrl_pts.cols() - 1;
+    typename Polynomial::Coefficients coeffs = homogeneous_ctrl_pts;
+    const Scalar max_weight = coeffs.col(dim).cwiseAbs().maxCoeff();
+    if (max_weight > 0) coeffs /= max_weight;
+    const Scalar w0 = coeffs(0, dim);
+    if (w0 != 0) {
+        const Eigen::Matrix<Scalar, 1, Eigen::Dynamic> p0 = coeffs.row(0).head(dim) / w0;
+        coeffs.leftCols(dim) -= coeffs.col(dim) * p0;
+    }
+    const Scalar extent = coeffs.leftCols(dim).cwiseAbs().maxCoeff();
+    if (extent > 0) coeffs.leftCols(dim) /= extent;
+    return Polynomial(std::move(coeffs));
+}
+
+/**
+ * The normal n scaled to unit length.
+ */
+template <typename Scalar, typename NormalType>
+Eigen::Matrix<Scalar, 2, 1> normalized_normal(const NormalType& n)
+{
+    Eigen::Matrix<Scalar, 2, 1> result(n[0], n[1]);
+    const Scalar length = result.norm();
+    if (length > 0) result /= length;
+    return result;
+}
+
+/**
+ * Numerator w P' - w' P of the derivative (w P' - w' P) / w^2 of a
+ * rational Bezier curve, of degree 2d - 1.
+ */
+template <typename Scalar>
+BernsteinPolynomial<Scalar> rational_bezier_derivative_numerator(
+    const BernsteinPolynomial<Scalar>& homogeneous)
+{
+    const int dim = homogeneous.get_dim() - 1;
+    const auto d_homogeneous = homogeneous.derivative();
+    return homogeneous.components(dim) * d_homogeneous.components(0, dim) -
+           d_homogeneous.components(dim) * homogeneous.components(0, dim);
+}
+
+/**
+ * x' y'' - y' x'', of degree 2d - 3, which changes sign at the
+ * inflections.
+ */
+template <typename Derived>
+std::vector<typename Derived::Scalar> bezier_inflection_polynomial(
+    const Eigen::MatrixBase<Derived>& ctrl_pts)
+{
+    const auto d1 = to_normalized_polynomial(ctrl_pts).derivative();
+    return to_std_vector(d1.cross(d1.derivative()).get_coefficients());
+}
+
+/**
+ * det[H, H', H''] of the homogeneous curve H, of degree 3d - 3, which is
+ * w^3 times x' y'' - y' x'' of the rational curve.
+ */
+template <typename Derived>
+std::vector<typename Derived::Scalar> rational_bezier_inflection_polynomial(
+    const Eigen::MatrixBase<Derived>& homogeneous_ctrl_pts)
+{
+    const auto h = to_normalized_homogeneous_polynomial(homogeneous_ctrl_pts);
+    const auto d1 = h.derivative();
+    const auto d2 = d1.derivative();
+    auto minor = [&](int i, int j) {
+        return d1.components(i) * d2.components(j) - d1.components(j) * d2.components(i);
+    };
+    return to_std_vector((h.components(0) * minor(1, 2) - h.components(1) * minor(0, 2) +
+                          h.components(2) * minor(0, 1))
+                             .get_coefficients());
+}
+
+/**
+ * Squared speed |C'|^2, of degree 2d - 2, whose roots are the
+ * singularities.  They are roots of even multiplicity.
+ */
+template <typename Derived>
+std::vector<typename Derived::Scalar> bezier_singularity_polynomial(
+    const Eigen::MatrixBase<Derived>& ctrl_pts)
+{
+    const auto d1 = to_normalized_polynomial(ctrl_pts).derivative();
+    return to_std_vector(d1.dot(d1).get_coefficients());
+}
+
+/**
+ * |w P' - w' P|^2, of degree 4d - 2, which is w^4 |C'|^2.
+ */
+template <typename Derived>
+std::vector<typename Derived::Scalar> rational_bezier_singularity_polynomial(
+    const Eigen::MatrixBase<Derived>& homogeneous_ctrl_pts)
+{
+    const auto numerator = rational_bezier_derivative_numerator(
+        to_normalized_homogeneous_polynomial(homogeneous_ctrl_pts));
+    return to_std_vector(numerator.dot(numerator).get_coefficients());
+}
+
+/**
+ * C' . n, of degree d - 1, which vanishes where the tangent is orthogonal
+ * to n.
+ */
+template <typename Derived, typename NormalType>
+std::vector<typename Derived::Scalar> bezier_tangent_polynomial(
+    const Eigen::MatrixBase<Derived>& ctrl_pts, const NormalType& n)
+{
+    using Scalar = typename Derived::Scalar;
+    const auto unit_n = normalized_normal<Scalar>(n);
+    const auto d1 = to_normalized_polynomial(ctrl_pts).derivative();
+    return to_std_vector(
+        (d1.components(0) * unit_n[0] + d1.components(1) * unit_n[1]).get_coefficients());
+}
+
+/**
+ * (w P' - w' P) . n, of degree 2d - 1, which is w^2 C' . n.
+ */
+template <typename Derived, typename NormalType>
+std::vector<typename Derived::Scalar> rational_bezier_tangent_polynomial(
+    const Eigen::MatrixBase<Derived>& homogeneous_ctrl_pts, const NormalType& n)
+{
+    using Scalar = typename Derived::Scalar;
+    const auto unit_n = normalized_normal<Scalar>(n);
+    const auto numerator = rational_bezier_derivative_numerator(
+        to_normalized_homogeneous_polynomial(homogeneous_ctrl_pts));
+    return to_std_vector((numerator.components(0) * unit_n[0] +
+                          numerator.components(1) * unit_n[1])
+                             .get_coefficients());
+}
+
+/**
+ * Drop from the sorted roots in [0, 1] of a polynomial in Bernstein form
+ * on [0, 1] those where it touches zero without changing sign, such as the
+ * flat points among the zeros of the inflection polynomial.  The sign is
+ * tested halfway to the neighbouring roots; roots at 0 and 1 are kept.
+ */
+template <typename Scalar>
+void remove_tangential_roots(const std::vector<Scalar>& coeffs, std::vector<Scalar>& roots)
+{
+    std::vector<Scalar> scratch(coeffs.size());
+    std::vector<Scalar> kept;
+    kept.reserve(roots.size());
+    for (size_t i = 0; i < roots.size(); i++) {
+        const Scalar t = roots[i];
+        const Scalar prev = i > 0 ? roots[i - 1] : Scalar(0);
+        const Scalar next = i + 1 < roots.size() ? roots[i + 1] : Scalar(1);
+        if (t <= 0 || t >= 1) {
+            kept.push_back(t);
+            continue;
+        }
+        const Scalar f0 = evaluate_bernstein(coeffs, (prev + t) / 2, scratch);
+        const Scalar f1 = evaluate_bernstein(coeffs, (t + next) / 2, scratch);
+        if ((f0 > 0 && f1 > 0) || (f0 < 0 && f1 < 0)) continue;
+        kept.push_back(t);
+    }
+    roots.swap(kept);
+}
+
+/**
+ * Coefficient magnitude below which a polynomial built by the functions
+ * above from normalized control points is taken to vanish identically.
+ * Relative to the extent of the control points, since those are
+ * normalized.
+ */
+template <typename Scalar>
+constexpr Scalar vanishing_tolerance()
+{
+    return static_cast<Scalar>(1e-8);
+}
+
+/**
+ * Sorted roots within [lower, upper] of a polynomial given in Bernstein
+ * form on [0, 1] and built by the functions above.  With
+ * `sign_changes_only`, roots where the polynomial does not change sign are
+ * dropped.  Throws infinite_root_error if it vanishes identically, see
+ * vanishing_tolerance.
+ */
+template <typename Scalar>
+std::vector<Scalar> bernstein_roots_in_range(const std::vector<Scalar>& coeffs,
+    const Scalar lower,
+    const Scalar upper,
+    bool sign_changes_only = false)
+{
+    std::vector<Scalar> roots;
+    BernsteinRootFinder<Scalar>::find_real_roots_in_bernstein_form(
+        coeffs, roots, 0, 1, vanishing_tolerance<Scalar>());
+    if (sign_changes_only) {
+        remove_tangential_roots(coeffs, roots);
+    }
+    roots.erase(std::remove_if(roots.begin(),
+                    roots.end(),
+                    [=](Scalar t) { return t < lower || t > upper; }),
+        roots.end());
+    return roots;
+}
+
+} // namespace internal
+} // namespace nanospline
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include <Eigen/Core>
+
+#include <nanospline/internal/basis_functions.h>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Accelerated replacement for locate_knot_span on a fixed knot vector.
+ *
+ * build() inspects the knot vector once.  If its distinct values are
+ * equally spaced and every interior value is simple (uniform and clamped
+ * uniform knots), the span of t is computed directly from
+ * (t - start) / spacing.  In addition, the caller may pass the span of its
+ * previous query as a hint; it is tried first together with the span that
+ * follows it, so monotonic query streams skip the search entirely.
+ *
+ * Every candidate is checked against knots[k] <= t < knots[k+1] before it
+ * is returned, and the binary search is used as fallback, so results are
+ * always identical to locate_knot_span.  The index holds no per-query
+ * state, so concurrent queries on a shared const curve do not write to it.
+ */
+template <typename _Scalar>
+class KnotSpanIndex
+{
+public:
+    using Scalar = _Scalar;
+
+public:
+    /**
+     * Analyze `knots`.  Must be called whenever the knot vector changes.
+     */
+    template <typename Derived>
+    void build(const Eigen::MatrixBase<Derived>& knots)
+    {
+        m_uniform = false;
+
+        const int num_knots = static_cast<int>(knots.size());
+        if (num_knots < 2) return;
+
+        // Skip the repeated start and end knots of clamped knot vectors.
+        int first = 0;
+        while (first + 1 < num_knots && knots[first + 1] == knots[first]) {
+            first++;
+        }
+        int last = num_knots - 1;
+        while (last - 1 > first && knots[last - 1] == knots[last]) {
+            last--;
+        }
+        if (last <= first) return;
+
+        const Scalar spacing = (knots[last] - knots[first]) / static_cast<Scalar>(last - first);
+        const Scalar tol = spacing * static_cast<Scalar>(1e-6);
+        for (int i = first; i < last; i++) {
+            if (std::abs(knots[i + 1] - knots[i] - spacing) > tol) return;
+        }
+
+        m_uniform = true;
+        m_first_span = first;
+        m_start = knots[first];
+        m_inv_spacing = Scalar(1) / spacing;
+    }
+
+    /**
+     * Same as locate_knot_span(knots, p, t), where `knots` is the vector
+     * passed to the last call of build().  `hint` is a guess of the span,
+     * typically the one found for the previous parameter, or -1.  The
+     * hinted span and the few after it are tried first, which covers sweeps
+     * over increasing parameters even across repeated knots.  A stale hint
+     * only costs those few checks before the binary search.
+     */
+    template <typename Derived>
+    int locate(const Eigen::MatrixBase<Derived>& knots,
+        const int p,
+        const Scalar t,
+        const int hint = -1) const
+    {
+        const int num_knots = static_cast<int>(knots.size());
+        const int low = p;
+        const int high = num_knots - p - 1;
+
+        // Out of domain and boundary cases are rare, leave them to the search.
+        if (t <= knots[low] || t >= knots[high]) {
+            return locate_knot_span(knots, p, t);
+        }
+
+        if (contains(knots, low, high, hint, t)) return hint;
+        if (contains(knots, low, high, hint + 1, t)) return hint + 1;
+
+        if (m_uniform) {
+            // Rounding may put t one span off near a knot.
+            const int guess = m_first_span + static_cast<int>((t - m_start) * m_inv_spacing);
+            for (int i = guess - 1; i <= guess + 1; i++) {
+                if (contains(knots, low, high, i, t)) return i;
+            }
+        }
+
+        if (hint >= low) {
+            const int last = std::min(high - 1, hint + 1 + MAX_HINT_STEPS);
+            for (int k = hint + 2; k <= last && knots[k] <= t; k++) {
+                if (t < knots[k + 1]) return k;
+            }
+        }
+
+        return locate_knot_span(knots, p, t);
+    }
+
+private:
+    template <typename Derived>
+    static bool contains(
+        const Eigen::MatrixBase<Derived>& knots, int low, int high, int k, const Scalar t)
+    {
+        return k >= low && k < high && knots[k] <= t && t < knots[k + 1];
+    }
+
+private:
+    // Spans tried past hint + 1 before falling back to the binary search.
+    static constexpr int MAX_HINT_STEPS = 2;
+
+    bool m_uniform = false;
+    int m_first_span = 0;
+    Scalar m_start = 0;
+    Scalar m_inv_spacing = 0;
+};
+
+} // namespace internal
+} // namespace nanospline
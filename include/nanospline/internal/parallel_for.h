@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Call fn(begin, end) on `num_threads` contiguous, evenly sized chunks of
+ * [0, num_items), each on its own thread.  0 threads means one per
+ * hardware thread.  Runs inline when a single thread would be used.
+ *
+ * An exception thrown by fn is caught on its worker thread and rethrown
+ * here once all threads have joined; if several chunks throw, the first
+ * chunk's exception wins.
+ */
+template <typename Fn>
+void parallel_for(int num_items, int num_threads, const Fn& fn)
+{
+    if (num_threads <= 0) {
+        num_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    num_threads = std::min(num_threads, num_items);
+
+    if (num_threads <= 1) {
+        fn(0, num_items);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(static_cast<size_t>(num_threads));
+    threads.reserve(static_cast<size_t>(num_threads));
+    for (int k = 0; k < num_threads; k++) {
+        const int begin = static_cast<int>(static_cast<long long>(num_items) * k / num_threads);
+        const int end =
+            static_cast<int>(static_cast<long long>(num_items) * (k + 1) / num_threads);
+        std::exception_ptr& error = errors[static_cast<size_t>(k)];
+        threads.emplace_back([&fn, &error, begin, end]() {
+            try {
+                fn(begin, end);
+            } catch (...) {
+                error = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
+} // namespace internal
+} // namespace nanospline
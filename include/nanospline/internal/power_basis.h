@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cassert>
+
+#include <Eigen/Core>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Convert the control points of a Bezier curve of degree d (one point per
+ * row) into power basis coefficients in place, so that on return
+ * C(t) = sum_j coeffs.row(j) * t^j.  Uses a_j = binom(d, j) * Δ^j P_0.
+ */
+template <typename Derived>
+void bezier_to_power_basis(Eigen::MatrixBase<Derived>& coeffs)
+{
+    using Scalar = typename Derived::Scalar;
+    const int d = static_cast<int>(coeffs.rows()) - 1;
+
+    // After step j, row i holds Δ^j P_{i-j} for i >= j.
+    for (int j = 1; j <= d; j++) {
+        for (int i = d; i >= j; i--) {
+            coeffs.row(i) -= coeffs.row(i - 1);
+        }
+    }
+
+    Scalar binomial = 1;
+    for (int j = 1; j <= d; j++) {
+        binomial = binomial * Scalar(d - j + 1) / Scalar(j);
+        coeffs.row(j) *= binomial;
+    }
+}
+
+/**
+ * Evaluate the `order`-th derivative of sum_j coeffs.row(j) * t^j with
+ * Horner's scheme.  Costs O(d * order) instead of the O(d^2) of de
+ * Casteljau's algorithm.
+ */
+template <typename Derived>
+Eigen::Matrix<typename Derived::Scalar, 1, Derived::ColsAtCompileTime> evaluate_power_basis(
+    const Eigen::MatrixBase<Derived>& coeffs, const typename Derived::Scalar t, const int order)
+{
+    using Scalar = typename Derived::Scalar;
+    using Point = Eigen::Matrix<Scalar, 1, Derived::ColsAtCompileTime>;
+    assert(order >= 0);
+    const int d = static_cast<int>(coeffs.rows()) - 1;
+    if (order > d) return Point::Zero(coeffs.cols());
+
+    // d/dt^order t^j = j! / (j-order)! t^(j-order).
+    auto factor = [order](int j) {
+        Scalar f = 1;
+        for (int r = 0; r < order; r++) {
+            f *= Scalar(j - r);
+        }
+        return f;
+    };
+
+    Point result = factor(d) * coeffs.row(d);
+    for (int j = d - 1; j >= order; j--) {
+        result = result * t + factor(j) * coeffs.row(j);
+    }
+    return result;
+}
+
+} // namespace internal
+} // namespace nanospline
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * A T that is allocated on first use and shared by copies until either one
+ * calls reset().  Nothing is allocated by construction or reset(), so
+ * objects that never use it pay for a null pointer only.
+ *
+ * get() may be called concurrently on a const object, and may race with
+ * copies of it: the pointer is always accessed atomically, and if several
+ * threads allocate at once all of them end up using the same T.
+ */
+template <typename T>
+class SharedLazy
+{
+public:
+    SharedLazy() = default;
+
+    SharedLazy(const SharedLazy& other)
+        : m_ptr(std::atomic_load(&other.m_ptr))
+    {}
+
+    SharedLazy& operator=(const SharedLazy& other)
+    {
+        std::atomic_store(&m_ptr, std::atomic_load(&other.m_ptr));
+        return *this;
+    }
+
+    T& get() const
+    {
+        std::shared_ptr<T> ptr = std::atomic_load(&m_ptr);
+        if (!ptr) {
+            std::shared_ptr<T> created = std::make_shared<T>();
+            // On failure ptr is set to the one another thread stored.
+            if (std::atomic_compare_exchange_strong(&m_ptr, &ptr, created)) {
+                ptr = created;
+            }
+        }
+        return *ptr;
+    }
+
+    void reset() { std::atomic_store(&m_ptr, std::shared_ptr<T>()); }
+
+private:
+    mutable std::shared_ptr<T> m_ptr;
+};
+
+} // namespace internal
+} // namespace nanospline
@@ -0,0 +1,188 @@
+#pragma once
+
+#if !defined(NANOSPLINE_NO_SIMD)
+#if defined(__AVX__)
+#include <immintrin.h>
+#define NANOSPLINE_SIMD_AVX 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define NANOSPLINE_SIMD_SSE2 1
+#endif
+#endif
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * A group of `SIZE` scalars processed in lockstep.
+ *
+ * The instruction set is chosen at compile time from the target flags:
+ * AVX (4 doubles / 8 floats) if `__AVX__` is defined, otherwise SSE2
+ * (2 doubles / 4 floats), which every x86-64 compiler enables by default.
+ * Other targets, other scalar types, and builds defining NANOSPLINE_NO_SIMD
+ * use this single-lane scalar fallback.
+ *
+ * Only the operations needed by the closed-form polynomial kernels are
+ * provided: broadcast, unaligned load/store, +, - and *.
+ */
+template <typename _Scalar>
+struct Packet
+{
+    using Scalar = _Scalar;
+    static constexpr int SIZE = 1;
+
+    Packet() = default;
+    explicit Packet(Scalar v)
+        : value(v)
+    {}
+
+    static Packet load(const Scalar* ptr) { return Packet(*ptr); }
+    void store(Scalar* ptr) const { *ptr = value; }
+
+    friend Packet operator+(const Packet& a, const Packet& b) { return Packet(a.value + b.value); }
+    friend Packet operator-(const Packet& a, const Packet& b) { return Packet(a.value - b.value); }
+    friend Packet operator*(const Packet& a, const Packet& b) { return Packet(a.value * b.value); }
+
+    Scalar value;
+};
+
+#if defined(NANOSPLINE_SIMD_AVX)
+
+template <>
+struct Packet<double>
+{
+    using Scalar = double;
+    static constexpr int SIZE = 4;
+
+    Packet() = default;
+    explicit Packet(double v)
+        : value(_mm256_set1_pd(v))
+    {}
+    explicit Packet(__m256d v)
+        : value(v)
+    {}
+
+    static Packet load(const double* ptr) { return Packet(_mm256_loadu_pd(ptr)); }
+    void store(double* ptr) const { _mm256_storeu_pd(ptr, value); }
+
+    friend Packet operator+(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm256_add_pd(a.value, b.value));
+    }
+    friend Packet operator-(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm256_sub_pd(a.value, b.value));
+    }
+    friend Packet operator*(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm256_mul_pd(a.value, b.value));
+    }
+
+    __m256d value;
+};
+
+template <>
+struct Packet<float>
+{
+    using Scalar = float;
+    static constexpr int SIZE = 8;
+
+    Packet() = default;
+    explicit Packet(float v)
+        : value(_mm256_set1_ps(v))
+    {}
+    explicit Packet(__m256 v)
+        : value(v)
+    {}
+
+    static Packet load(const float* ptr) { return Packet(_mm256_loadu_ps(ptr)); }
+    void store(float* ptr) const { _mm256_storeu_ps(ptr, value); }
+
+    friend Packet operator+(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm256_add_ps(a.value, b.value));
+    }
+    friend Packet operator-(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm256_sub_ps(a.value, b.value));
+    }
+    friend Packet operator*(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm256_mul_ps(a.value, b.value));
+    }
+
+    __m256 value;
+};
+
+#elif defined(NANOSPLINE_SIMD_SSE2)
+
+template <>
+struct Packet<double>
+{
+    using Scalar = double;
+    static constexpr int SIZE = 2;
+
+    Packet() = default;
+    explicit Packet(double v)
+        : value(_mm_set1_pd(v))
+    {}
+    explicit Packet(__m128d v)
+        : value(v)
+    {}
+
+    static Packet load(const double* ptr) { return Packet(_mm_loadu_pd(ptr)); }
+    void store(double* ptr) const { _mm_storeu_pd(ptr, value); }
+
+    friend Packet operator+(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm_add_pd(a.value, b.value));
+    }
+    friend Packet operator-(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm_sub_pd(a.value, b.value));
+    }
+    friend Packet operator*(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm_mul_pd(a.value, b.value));
+    }
+
+    __m128d value;
+};
+
+template <>
+struct Packet<float>
+{
+    using Scalar = float;
+    static constexpr int SIZE = 4;
+
+    Packet() = default;
+    explicit Packet(float v)
+        : value(_mm_set1_ps(v))
+    {}
+    explicit Packet(__m128 v)
+        : value(v)
+    {}
+
+    static Packet load(const float* ptr) { return Packet(_mm_loadu_ps(ptr)); }
+    void store(float* ptr) const { _mm_storeu_ps(ptr, value); }
+
+    friend Packet operator+(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm_add_ps(a.value, b.value));
+    }
+    friend Packet operator-(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm_sub_ps(a.value, b.value));
+    }
+    friend Packet operator*(const Packet& a, const Packet& b)
+    {
+        return Packet(_mm_mul_ps(a.value, b.value));
+    }
+
+    __m128 value;
+};
+
+#endif
+
+} // namespace internal
+} // namespace nanospline
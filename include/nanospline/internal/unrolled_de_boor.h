@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Eigen/Core>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Largest fixed B-spline degree evaluated with the unrolled de Boor kernel.
+ */
+constexpr int MAX_UNROLLED_DEGREE = 5;
+
+/**
+ * One step of de Boor's algorithm for a B-spline of compile time degree
+ * `_degree`, updating row `_j` at recursion level `_r` and then moving on to
+ * the next step.  The whole triangle of (_degree+1) * _degree / 2 updates is
+ * expanded at compile time.
+ */
+template <int _degree, int _r, int _j, bool _done = (_r > _degree), bool _next_level = (_j < _r)>
+struct DeBoorStep
+{
+    template <typename KnotDerived, typename PointsDerived>
+    static void apply(const Eigen::MatrixBase<KnotDerived>& knots,
+        const int k,
+        const typename KnotDerived::Scalar t,
+        Eigen::MatrixBase<PointsDerived>& ctrl_pts)
+    {
+        using Scalar = typename KnotDerived::Scalar;
+        const Scalar lower = knots[k - _degree + _j];
+        const Scalar diff = knots[k + 1 + _j - _r] - lower;
+        Scalar alpha = 0.0;
+        if (diff > 1e-16) {
+            alpha = (t - lower) / diff;
+        }
+        ctrl_pts.row(_j) = (1.0 - alpha) * ctrl_pts.row(_j - 1) + alpha * ctrl_pts.row(_j);
+        DeBoorStep<_degree, _r, _j - 1>::apply(knots, k, t, ctrl_pts);
+    }
+};
+
+// Level _r is complete, start the next level from the last row.
+template <int _degree, int _r, int _j>
+struct DeBoorStep<_degree, _r, _j, false, true>
+{
+    template <typename KnotDerived, typename PointsDerived>
+    static void apply(const Eigen::MatrixBase<KnotDerived>& knots,
+        const int k,
+        const typename KnotDerived::Scalar t,
+        Eigen::MatrixBase<PointsDerived>& ctrl_pts)
+    {
+        DeBoorStep<_degree, _r + 1, _degree>::apply(knots, k, t, ctrl_pts);
+    }
+};
+
+// All levels are complete.
+template <int _degree, int _r, int _j, bool _next_level>
+struct DeBoorStep<_degree, _r, _j, true, _next_level>
+{
+    template <typename KnotDerived, typename PointsDerived>
+    static void apply(const Eigen::MatrixBase<KnotDerived>&,
+        const int,
+        const typename KnotDerived::Scalar,
+        Eigen::MatrixBase<PointsDerived>&)
+    {}
+};
+
+/**
+ * Evaluate a B-spline of compile time degree `_degree` at t, where k is the
+ * knot span containing t and `ctrl_pts` holds the _degree+1 control points
+ * of that span.  On return, the point is stored in row _degree of
+ * `ctrl_pts`.  The knot differences and blending steps are the same as in
+ * the generic de Boor loop, so results match it exactly.
+ */
+template <int _degree, typename KnotDerived, typename PointsDerived>
+void unrolled_de_boor(const Eigen::MatrixBase<KnotDerived>& knots,
+    const int k,
+    const typename KnotDerived::Scalar t,
+    Eigen::MatrixBase<PointsDerived>& ctrl_pts)
+{
+    DeBoorStep<_degree, 1, _degree>::apply(knots, k, t, ctrl_pts);
+}
+
+} // namespace internal
+} // namespace nanospline
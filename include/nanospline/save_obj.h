@@ -3,28 +3,33 @@
 #include <Eigen/Core>
 #include <fstream>
 
+#include <nanospline/tessellate.h>
+
 namespace nanospline {
 namespace internal {
 
+/**
+ * Write the curve as a polyline with N vertices and return the updated
+ * vertex offset.
+ */
 template<typename CurveType>
 int export_obj(std::ofstream& fout, const CurveType& curve, const int N, const int offset) {
-    using Scalar = typename CurveType::Scalar;
-    for (int i=0; i<N; i++) {
-        const Scalar t = (Scalar)t / (Scalar)N;
-        const auto p = curve.evaluate(t);
+    const auto points = tessellate(curve, N-1);
+    const int num_points = static_cast<int>(points.rows());
+    for (int i=0; i<num_points; i++) {
         fout << "v ";
         for (int j=0; j<curve.get_dim(); j++) {
-            fout << p[j] << " ";
+            fout << points(i, j) << " ";
         }
         fout << std::endl;
     }
 
-    for (int i=0; i<N-1; i++) {
+    for (int i=0; i<num_points-1; i++) {
         // Note the obj uses 1-based index.
         fout << "l " << i+offset+1 << " " << i+offset+2 << std::endl;
     }
 
-    return offset+N;
+    return offset+num_points;
 }
 
 template<typename PatchType>
@@ -80,7 +85,7 @@ void save_obj(const std::string& filename, const std::vector<CurveType>& curves)
     std::ofstream fout(filename.c_str());
     int count = 0;
     for (const auto& c : curves) {
-        count += internal::export_obj(fout, c, 100, count);
+        count = internal::export_obj(fout, c, 100, count);
     }
     fout.close();
 }
@@ -98,7 +103,7 @@ void save_patch_obj(const std::string& filename,
     std::ofstream fout(filename.c_str());
     int count = 0;
     for (const auto& p : patches) {
-        count += internal::export_patch_obj(fout, p, 100, 100, count);
+        count = internal::export_patch_obj(fout, p, 100, 100, count);
     }
     fout.close();
 }
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <nanospline/BSpline.h>
+#include <nanospline/Bezier.h>
+#include <nanospline/Exceptions.h>
+#include <nanospline/NURBS.h>
+#include <nanospline/RationalBezier.h>
+#include <nanospline/internal/power_basis.h>
+
+namespace nanospline {
+namespace internal {
+
+/**
+ * Write the points of `curve` at t = i / num_segments, i = 0..num_segments,
+ * into consecutive rows of `out` by forward differencing: once the forward
+ * differences at t = 0 are known, each further point costs d additions per
+ * coordinate.  The last point is snapped to the end point of the curve so
+ * consecutive segments join exactly.
+ *
+ * The initial differences are computed from the power basis coefficients
+ * a_j as Δ^k C(0) = k! sum_j S(j, k) a_j h^j, where S are Stirling numbers
+ * of the second kind, rather than by differencing samples, which would
+ * lose most significant digits for high orders.  The remaining error grows
+ * with num_segments and degree, but stays far below display precision.
+ */
+template <typename Scalar, int dim, int degree, bool generic, typename Derived>
+void forward_difference(const Bezier<Scalar, dim, degree, generic>& curve,
+    const int num_segments,
+    Eigen::MatrixBase<Derived>& out)
+{
+    using ControlPoints = typename Bezier<Scalar, dim, degree, generic>::ControlPoints;
+    const int d = curve.get_degree();
+    const Scalar h = Scalar(1) / Scalar(num_segments);
+    assert(out.rows() == num_segments + 1);
+
+    ControlPoints coeffs = curve.get_control_points();
+    bezier_to_power_basis(coeffs);
+    Scalar h_power = 1;
+    for (int j = 1; j <= d; j++) {
+        h_power *= h;
+        coeffs.row(j) *= h_power;
+    }
+
+    // stirling[k] holds S(j, k) for the current j.
+    std::vector<Scalar> stirling(static_cast<size_t>(d + 1), 0);
+    stirling[0] = 1;
+    ControlPoints diff(d + 1, dim);
+    diff.setZero();
+    for (int j = 0; j <= d; j++) {
+        if (j > 0) {
+            for (int k = j; k >= 1; k--) {
+                const size_t uk = static_cast<size_t>(k);
+                stirling[uk] = Scalar(k) * stirling[uk] + stirling[uk - 1];
+            }
+            stirling[0] = 0;
+        }
+        for (int k = 0; k <= j; k++) {
+            diff.row(k) += stirling[static_cast<size_t>(k)] * coeffs.row(j);
+        }
+    }
+    Scalar factorial = 1;
+    for (int k = 2; k <= d; k++) {
+        factorial *= Scalar(k);
+        diff.row(k) *= factorial;
+    }
+
+    out.row(0) = diff.row(0);
+    for (int s = 1; s < num_segments; s++) {
+        for (int j = 0; j < d; j++) {
+            diff.row(j) += diff.row(j + 1);
+        }
+        out.row(s) = diff.row(0);
+    }
+    out.row(num_segments) = curve.get_control_points().row(d);
+}
+
+} // namespace internal
+
+/**
+ * Sample a Bézier curve at num_segments + 1 evenly spaced parameters
+ * t = i / num_segments using forward differencing.  Returns one point per
+ * row.
+ */
+template <typename Scalar, int dim, int degree, bool generic>
+Eigen::Matrix<Scalar, Eigen::Dynamic, dim> tessellate(
+    const Bezier<Scalar, dim, degree, generic>& curve, const int num_segments)
+{
+    if (num_segments < 1) {
+        throw invalid_setting_error("At least one segment is required.");
+    }
+    Eigen::Matrix<Scalar, Eigen::Dynamic, dim> points(num_segments + 1, dim);
+    internal::forward_difference(curve, num_segments, points);
+    return points;
+}
+
+/**
+ * Sample a BSpline curve at num_segments + 1 roughly evenly spaced
+ * parameters.  The curve is decomposed into Bézier segments, and the
+ * samples are distributed among them in proportion to their parameter
+ * length, so every knot is a sample and the spacing within a segment is
+ * uniform.  A segment much shorter than the spacing may get no interior
+ * sample and is then replaced by a straight line.
+ */
+template <typename Scalar, int dim, int degree, bool generic>
+Eigen::Matrix<Scalar, Eigen::Dynamic, dim> tessellate(
+    const BSpline<Scalar, dim, degree, generic>& curve, const int num_segments)
+{
+    if (num_segments < 1) {
+        throw invalid_setting_error("At least one segment is required.");
+    }
+    const auto beziers_and_bounds = curve.convert_to_Bezier();
+    const auto& beziers = std::get<0>(beziers_and_bounds);
+    const auto& bounds = std::get<1>(beziers_and_bounds);
+    const int num_beziers = static_cast<int>(beziers.size());
+    const Scalar t_min = bounds.front();
+    const Scalar t_max = bounds.back();
+
+    Eigen::Matrix<Scalar, Eigen::Dynamic, dim> points(num_segments + 1, dim);
+    points.row(0) = beziers.front().get_control_points().row(0);
+    int row = 0;
+    for (int i = 0; i < num_beziers; i++) {
+        // Round the cumulative count so the total is exactly num_segments.
+        const Scalar t_end = bounds[static_cast<size_t>(i + 1)];
+        const int next_row = i + 1 == num_beziers
+                                 ? num_segments
+                                 : static_cast<int>(std::round(
+                                       Scalar(num_segments) * (t_end - t_min) / (t_max - t_min)));
+        if (next_row <= row) continue;
+        // Consecutive segments share their end points.  Keep the one already
+        // written, which differs from this segment's start point if the
+        // segments in between were skipped.
+        const Eigen::Matrix<Scalar, 1, dim> start = points.row(row);
+        auto block = points.middleRows(row, next_row - row + 1);
+        internal::forward_difference(beziers[static_cast<size_t>(i)], next_row - row, block);
+        points.row(row) = start;
+        row = next_row;
+    }
+    // In case the last segments were skipped.
+    points.row(num_segments) = beziers.back().get_control_points().bottomRows(1);
+    return points;
+}
+
+/**
+ * Rational curves are tessellated in homogeneous coordinates, followed by
+ * one division per point.
+ */
+template <typename Scalar, int dim, int degree, bool generic>
+Eigen::Matrix<Scalar, Eigen::Dynamic, dim> tessellate(
+    const RationalBezier<Scalar, dim, degree, generic>& curve, const int num_segments)
+{
+    const auto homogeneous_points = tessellate(curve.get_homogeneous(), num_segments);
+    return homogeneous_points.template leftCols<dim>().array().colwise() /
+           homogeneous_points.col(dim).array();
+}
+
+template <typename Scalar, int dim, int degree, bool generic>
+Eigen::Matrix<Scalar, Eigen::Dynamic, dim> tessellate(
+    const NURBS<Scalar, dim, degree, generic>& curve, const int num_segments)
+{
+    const auto homogeneous_points = tessellate(curve.get_homogeneous(), num_segments);
+    return homogeneous_points.template leftCols<dim>().array().colwise() /
+           homogeneous_points.col(dim).array();
+}
+
+/**
+ * Any other curve type: evaluate it at num_segments + 1 evenly spaced
+ * parameters over its domain.
+ */
+template <typename CurveType>
+Eigen::Matrix<typename CurveType::Scalar, Eigen::Dynamic, Eigen::Dynamic> tessellate(
+    const CurveType& curve, const int num_segments)
+{
+    using Scalar = typename CurveType::Scalar;
+    if (num_segments < 1) {
+        throw invalid_setting_error("At least one segment is required.");
+    }
+    const Scalar t_min = curve.get_domain_lower_bound();
+    const Scalar t_max = curve.get_domain_upper_bound();
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> points(
+        num_segments + 1, curve.get_dim());
+    for (int i = 0; i <= num_segments; i++) {
+        const Scalar t = t_min + (t_max - t_min) * Scalar(i) / Scalar(num_segments);
+        points.row(i) = curve.evaluate(std::min(t, t_max));
+    }
+    return points;
+}
+
+} // namespace nanospline
@@ -3,10 +3,86 @@
 #include <nanospline/BSpline.h>
 #include <nanospline/Bezier.h>
 #include <nanospline/save_svg.h>
-#include <nanospline/forward_declaration.h>
 
 #include "validation_utils.h"
 
+namespace {
+
+template<int degree>
+void validate_unrolled_kernel() {
+    using namespace nanospline;
+    using Scalar = double;
+    constexpr int num_ctrl_pts = 9;
+
+    Eigen::Matrix<Scalar, num_ctrl_pts, 2> ctrl_pts;
+    ctrl_pts << 1, 4, .5, 6, 5, 4, 3, 12, 11, 14, 8, 4, 12, 3, 11, 9, 15, 10;
+    Eigen::Matrix<Scalar, num_ctrl_pts+degree+1, 1> knots;
+    for (int i=0; i<knots.size(); i++) {
+        knots[i] = std::min(std::max(i - degree, 0), num_ctrl_pts - degree);
+    }
+    knots /= knots.maxCoeff();
+
+    // Fixed degree curves use the unrolled kernel, generic ones do not.
+    BSpline<Scalar, 2, degree> curve;
+    curve.set_control_points(ctrl_pts);
+    curve.set_knots(knots);
+    BSpline<Scalar, 2, degree, true> generic_curve;
+    generic_curve.set_control_points(ctrl_pts);
+    generic_curve.set_knots(knots);
+
+    constexpr int num_samples = 20;
+    for (int i=0; i<=num_samples; i++) {
+        const Scalar t = Scalar(i) / num_samples;
+        REQUIRE((curve.evaluate(t) - generic_curve.evaluate(t)).norm() ==
+                Approx(0.0).margin(1e-12));
+        REQUIRE((curve.evaluate_derivative(t) -
+                    generic_curve.evaluate_derivative(t)).norm() ==
+                Approx(0.0).margin(1e-10));
+        REQUIRE((curve.evaluate_2nd_derivative(t) -
+                    generic_curve.evaluate_2nd_derivative(t)).norm() ==
+                Approx(0.0).margin(1e-8));
+    }
+    validate_batch_evaluation(curve, num_samples);
+}
+
+template<typename CurveType>
+void validate_span_lookup(const CurveType& curve) {
+    using Scalar = typename CurveType::Scalar;
+    const auto& knots = curve.get_knots();
+    const int p = curve.get_degree();
+    const Scalar t_min = curve.get_domain_lower_bound();
+    const Scalar t_max = curve.get_domain_upper_bound();
+    // The hint is the span of the previous query.
+    int hint = -1;
+    auto check = [&](Scalar t) {
+        const int k = nanospline::internal::locate_knot_span(knots, p, t);
+        REQUIRE(curve.locate_span(t) == k);
+        REQUIRE(curve.locate_span(t, hint) == k);
+        REQUIRE(curve.locate_span(t, hint + 3) == k);
+        // Far behind: a few steps, then the binary search.
+        REQUIRE(curve.locate_span(t, p) == k);
+        hint = k;
+    };
+
+    constexpr int num_samples = 100;
+    for (int i=-5; i<=num_samples+5; i++) {
+        check(t_min + (t_max - t_min) * i / num_samples);
+    }
+    for (int i=num_samples; i>=0; i--) {
+        check(t_min + (t_max - t_min) * i / num_samples);
+    }
+    for (int i=0; i<knots.size(); i++) {
+        check(knots[i]);
+    }
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 1> ts(num_samples);
+    ts.setRandom();
+    for (int i=0; i<num_samples; i++) {
+        check(t_min + (t_max - t_min) * (ts[i] + 1) / 2);
+    }
+}
+
+}
+
 TEST_CASE("BSpline", "[nonrational][bspline]") {
     using namespace nanospline;
     using Scalar = double;
@@ -40,6 +116,12 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Degree elevation") {
@@ -84,6 +166,12 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Knot insertion and removal") {
@@ -99,12 +187,10 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
         }
 
         SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
             auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(total_turning_angle == Approx(0));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
             REQUIRE(split_pts.size() == 0);
-#endif
         }
 
         SECTION("Split and combine") {
@@ -162,6 +248,12 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Knot insertion and removal") {
@@ -175,19 +267,15 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
         }
 
         SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
             auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(total_turning_angle == Approx(0));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
             REQUIRE(split_pts.size() == 0);
-#endif
         }
 
         SECTION("Singularity") {
-#if NANOSPLINE_SYMPY
             auto singular_pts = curve.compute_singularities(0, 1);
             REQUIRE(singular_pts.size() == 0);
-#endif
         }
 
         SECTION("Split and combine") {
@@ -232,6 +320,12 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Knot insertion") {
@@ -259,19 +353,15 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
         }
 
         SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
             auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(total_turning_angle == Approx(0));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
             REQUIRE(split_pts.size() == 0);
-#endif
         }
 
         SECTION("Singularity") {
-#if NANOSPLINE_SYMPY
             auto singular_pts = curve.compute_singularities(0, 1);
             REQUIRE(singular_pts.size() == 0);
-#endif
         }
 
         SECTION("Split and combine") {
@@ -317,6 +407,7 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
         curve.set_knots(knots);
 
         validate_approximate_inverse_evaluation(curve, 10);
+        validate_inverse_evaluation(curve, 10);
     }
 
     SECTION("Closed BSpline") {
@@ -743,6 +834,12 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Split and combine") {
@@ -758,6 +855,7 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
 
         SECTION("Approximate inverse evaluate") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
     }
 
@@ -775,10 +873,17 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
             SECTION("Derivative") {
                 validate_derivatives(curve, 10);
                 validate_2nd_derivatives(curve, 10);
+                validate_evaluate_derivatives(curve, 10);
+                validate_power_basis(curve, 10);
+            }
+
+            SECTION("Batch evaluation") {
+                validate_batch_evaluation(curve, 10);
             }
 
             SECTION("Approximate inverse evaluate") {
                 validate_approximate_inverse_evaluation(curve, 10);
+                validate_inverse_evaluation(curve, 10);
             }
 
             SECTION("Split and combine") {
@@ -809,6 +914,12 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
             SECTION("Derivative") {
                 validate_derivatives(curve, 10);
                 validate_2nd_derivatives(curve, 10);
+                validate_evaluate_derivatives(curve, 10);
+                validate_power_basis(curve, 10);
+            }
+
+            SECTION("Batch evaluation") {
+                validate_batch_evaluation(curve, 10);
             }
 
             SECTION("Knot insertion and removal") {
@@ -822,22 +933,19 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
 
             SECTION("Approximate inverse evaluate") {
                 validate_approximate_inverse_evaluation(curve, 10);
+                validate_inverse_evaluation(curve, 10);
             }
 
             SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
                 const auto min_t = curve.get_domain_lower_bound();
                 const auto max_t = curve.get_domain_upper_bound();
                 auto total_turning_angle = curve.get_turning_angle(min_t, max_t);
                 REQUIRE(std::abs(total_turning_angle) == Approx(2 * M_PI));
-#endif
             }
 
             SECTION("Singularity") {
-#if NANOSPLINE_SYMPY
                 auto singular_pts = curve.compute_singularities(0, 1);
                 REQUIRE(singular_pts.size() == 0);
-#endif
             }
 
             SECTION("Split and combine") {
@@ -854,8 +962,77 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
 
     }
 
+    SECTION("Unrolled kernel") {
+        validate_unrolled_kernel<1>();
+        validate_unrolled_kernel<2>();
+        validate_unrolled_kernel<3>();
+        validate_unrolled_kernel<4>();
+        validate_unrolled_kernel<5>();
+    }
+
+    SECTION("Span lookup") {
+        Eigen::Matrix<Scalar, 8, 2> ctrl_pts;
+        ctrl_pts.setRandom();
+        BSpline<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+
+        SECTION("Clamped uniform") {
+            Eigen::Matrix<Scalar, 12, 1> knots;
+            knots << 0.0, 0.0, 0.0, 0.0, 0.2, 0.4, 0.6, 0.8, 1.0, 1.0, 1.0, 1.0;
+            curve.set_knots(knots);
+            validate_span_lookup(curve);
+        }
+
+        SECTION("Uniform") {
+            Eigen::Matrix<Scalar, 12, 1> knots;
+            for (int i=0; i<12; i++) knots[i] = 0.1 * i - 0.3;
+            curve.set_knots(knots);
+            validate_span_lookup(curve);
+        }
+
+        SECTION("Non-uniform") {
+            Eigen::Matrix<Scalar, 12, 1> knots;
+            knots << 0.0, 0.0, 0.0, 0.0, 0.1, 0.5, 0.5, 0.7, 1.0, 1.0, 1.0, 1.0;
+            curve.set_knots(knots);
+            validate_span_lookup(curve);
+
+            // The index must follow knot vector updates.
+            knots << 0.0, 0.0, 0.0, 0.0, 0.2, 0.4, 0.6, 0.8, 1.0, 1.0, 1.0, 1.0;
+            curve.set_knots(knots);
+            validate_span_lookup(curve);
+            curve.insert_knot(0.3, 2);
+            validate_span_lookup(curve);
+            curve.remove_knot(0.3, 2);
+            validate_span_lookup(curve);
+        }
+    }
+
+    SECTION("Power basis cache") {
+        Eigen::Matrix<Scalar, 7, 2> ctrl_pts;
+        ctrl_pts.setRandom();
+        Eigen::Matrix<Scalar, 11, 1> knots;
+        knots << 0.0, 0.0, 0.0, 0.0, 0.1, 0.5, 0.5, 1.0, 1.0, 1.0, 1.0;
+        BSpline<Scalar, 2, 3> curve;
+        curve.set_evaluation_mode(EvaluationMode::PowerBasis);
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+        BSpline<Scalar, 2, 3> reference;
+        reference.set_control_points(ctrl_pts);
+        reference.set_knots(knots);
+        assert_same(curve, reference, 10, 1e-12);
+
+        // The cache follows control point and knot updates.
+        ctrl_pts.setRandom();
+        curve.set_control_points(ctrl_pts);
+        reference.set_control_points(ctrl_pts);
+        assert_same(curve, reference, 10, 1e-12);
+
+        curve.insert_knot(0.3);
+        reference.insert_knot(0.3);
+        assert_same(curve, reference, 10, 1e-12);
+    }
+
     SECTION("Inflection") {
-#if NANOSPLINE_SYMPY
         SECTION("Compare with Bezier") {
             Eigen::Matrix<Scalar, 4, 2> ctrl_pts;
             ctrl_pts << 0.0, 0.0,
@@ -936,6 +1113,5 @@ TEST_CASE("BSpline", "[nonrational][bspline]") {
             auto singular_pts = curve.compute_singularities(0, 2.0);
             REQUIRE(singular_pts.size() == 0);
         }
-#endif
     }
 }
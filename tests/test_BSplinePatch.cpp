@@ -3,7 +3,6 @@
 
 #include <nanospline/BSplinePatch.h>
 #include <nanospline/save_obj.h>
-#include <nanospline/forward_declaration.h>
 
 #include "validation_utils.h"
 
@@ -47,6 +46,7 @@ TEST_CASE("BSplinePatch", "[nonrational][bspline_patch]") {
 
         validate_iso_curves(patch, 10);
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_derivative_patches(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 5, 5);
@@ -71,6 +71,7 @@ TEST_CASE("BSplinePatch", "[nonrational][bspline_patch]") {
 
         validate_iso_curves(patch, 10);
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_derivative_patches(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 5,5);
@@ -93,6 +94,7 @@ TEST_CASE("BSplinePatch", "[nonrational][bspline_patch]") {
 
         validate_iso_curves(patch, 10);
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_derivative_patches(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 10,10);
@@ -119,6 +121,7 @@ TEST_CASE("BSplinePatch", "[nonrational][bspline_patch]") {
         REQUIRE(patch.get_degree_v() == 1);
         validate_iso_curves(patch, 10);
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_derivative_patches(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 5, 5);
@@ -168,6 +171,7 @@ TEST_CASE("BSplinePatch", "[nonrational][bspline_patch]") {
         REQUIRE(patch.get_degree_v() == 1);
         validate_iso_curves(patch, 10);
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_derivative_patches(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
     }
@@ -207,6 +211,7 @@ TEST_CASE("BSplinePatch", "[nonrational][bspline_patch]") {
         REQUIRE(patch.get_degree_v() == 1);
         validate_iso_curves(patch, 10);
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_derivative_patches(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
 
@@ -215,5 +220,38 @@ TEST_CASE("BSplinePatch", "[nonrational][bspline_patch]") {
         const auto p1 = patch.evaluate(1.5707963267948966, -16.000000000000004);
         REQUIRE((p0-p1).norm() == Approx(0.0).margin(1e-12));
     }
+
+    SECTION("High degree") {
+        // Degree above the stack scratch limit of the tensor product
+        // evaluation.
+        const int degree_u = 17;
+        const int degree_v = 2;
+        const int num_u = degree_u + 1;
+        const int num_v = degree_v + 1;
+
+        BSplinePatch<Scalar, 3, -1, -1> patch;
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 3> control_grid(num_u*num_v, 3);
+        for (int i=0; i<num_u; i++) {
+            for (int j=0; j<num_v; j++) {
+                control_grid.row(i*num_v+j) << i, j, std::sin(i+j);
+            }
+        }
+        patch.set_control_grid(control_grid);
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 1> u_knots(2*num_u, 1);
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 1> v_knots(2*num_v, 1);
+        u_knots.head(num_u).setZero();
+        u_knots.tail(num_u).setOnes();
+        v_knots.head(num_v).setZero();
+        v_knots.tail(num_v).setOnes();
+        patch.set_knots_u(u_knots);
+        patch.set_knots_v(v_knots);
+        patch.set_degree_u(degree_u);
+        patch.set_degree_v(degree_v);
+        patch.initialize();
+
+        validate_iso_curves(patch, 10);
+        validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
+    }
 }
 
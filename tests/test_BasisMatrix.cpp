@@ -0,0 +1,141 @@
+#include <catch2/catch.hpp>
+
+#include <nanospline/BSpline.h>
+#include <nanospline/BSplinePatch.h>
+#include <nanospline/BasisMatrix.h>
+#include <nanospline/NURBS.h>
+
+TEST_CASE("BasisMatrix", "[nonrational][bspline][basis_matrix]") {
+    using namespace nanospline;
+    using Scalar = double;
+
+    Eigen::Matrix<Scalar, 11, 1> knots;
+    knots << 0.0, 0.0, 0.0, 0.0, 0.2, 0.5, 0.5, 1.0, 1.0, 1.0, 1.0;
+    constexpr int degree = 3;
+    constexpr int num_control_pts = 7;
+
+    constexpr int num_samples = 31;
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 1> ts =
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 1>::LinSpaced(num_samples, 0.0, 1.0);
+
+    const BasisMatrix<Scalar> basis(knots, degree, ts);
+    REQUIRE(basis.get_num_parameters() == num_samples);
+    REQUIRE(basis.get_num_control_points() == num_control_pts);
+
+    SECTION("Sparsity and partition of unity") {
+        const auto& matrix = basis.get_matrix();
+        for (int i=0; i<num_samples; i++) {
+            REQUIRE(matrix.row(i).nonZeros() <= degree + 1);
+            REQUIRE(matrix.row(i).sum() == Approx(1.0));
+        }
+    }
+
+    SECTION("Curve evaluation") {
+        Eigen::Matrix<Scalar, num_control_pts, 2> ctrl_pts;
+        ctrl_pts.setRandom();
+        BSpline<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+
+        REQUIRE(basis.is_compatible(curve));
+        const auto values = basis.evaluate_curve(curve);
+        for (int i=0; i<num_samples; i++) {
+            REQUIRE((values.row(i) - curve.evaluate(ts[i])).norm() ==
+                    Approx(0.0).margin(1e-12));
+        }
+
+        const BasisMatrix<Scalar> d1(knots, degree, ts, 1);
+        const BasisMatrix<Scalar> d2(knots, degree, ts, 2);
+        const auto ders = d1.evaluate_curve(curve);
+        const auto second_ders = d2.evaluate_curve(curve);
+        for (int i=0; i<num_samples; i++) {
+            REQUIRE((ders.row(i) - curve.evaluate_derivative(ts[i])).norm() ==
+                    Approx(0.0).margin(1e-10));
+            REQUIRE((second_ders.row(i) -
+                        curve.evaluate_2nd_derivative(ts[i])).norm() ==
+                    Approx(0.0).margin(1e-9));
+        }
+
+        BSpline<Scalar, 2, 3> other;
+        Eigen::Matrix<Scalar, 8, 1> other_knots;
+        other_knots << 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0;
+        Eigen::Matrix<Scalar, 4, 2> other_ctrl_pts = ctrl_pts.topRows(4);
+        other.set_control_points(other_ctrl_pts);
+        other.set_knots(other_knots);
+        REQUIRE(!basis.is_compatible(other));
+        REQUIRE_THROWS(basis.evaluate_curve(other));
+    }
+
+    SECTION("Stacked curves") {
+        // Three 2D curves sharing the knot vector, stacked side by side.
+        Eigen::Matrix<Scalar, num_control_pts, 6> stacked;
+        stacked.setRandom();
+        const auto values = basis.evaluate(stacked);
+        REQUIRE(values.rows() == num_samples);
+        REQUIRE(values.cols() == 6);
+        for (int k=0; k<3; k++) {
+            BSpline<Scalar, 2, 3> curve;
+            Eigen::Matrix<Scalar, num_control_pts, 2> ctrl_pts =
+                stacked.middleCols(2*k, 2);
+            curve.set_control_points(ctrl_pts);
+            curve.set_knots(knots);
+            for (int i=0; i<num_samples; i++) {
+                REQUIRE((values.block(i, 2*k, 1, 2) - curve.evaluate(ts[i])).norm() ==
+                        Approx(0.0).margin(1e-12));
+            }
+        }
+
+        REQUIRE_THROWS(basis.evaluate(stacked.topRows(4)));
+    }
+
+    SECTION("NURBS through the homogeneous curve") {
+        Eigen::Matrix<Scalar, num_control_pts, 2> ctrl_pts;
+        ctrl_pts.setRandom();
+        Eigen::Matrix<Scalar, num_control_pts, 1> weights;
+        weights << 1.0, 0.5, 2.0, 1.5, 1.0, 0.8, 1.2;
+        NURBS<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+        curve.set_weights(weights);
+        curve.initialize();
+
+        // The weights would be ignored.
+        REQUIRE(!basis.is_compatible(curve));
+        REQUIRE_THROWS_AS(basis.evaluate_curve(curve), invalid_setting_error);
+
+        const auto homogeneous = basis.evaluate_curve(curve.get_homogeneous());
+        for (int i=0; i<num_samples; i++) {
+            const Eigen::Matrix<Scalar, 1, 2> p =
+                homogeneous.row(i).head<2>() / homogeneous(i, 2);
+            REQUIRE((p - curve.evaluate(ts[i])).norm() == Approx(0.0).margin(1e-12));
+        }
+    }
+
+    SECTION("Least squares matrices") {
+        const Eigen::MatrixXd dense = BSpline<Scalar, 2, 3>::form_least_squares_matrix(
+                num_control_pts, knots, ts);
+        REQUIRE((dense - Eigen::MatrixXd(basis.get_matrix())).norm() ==
+                Approx(0.0).margin(1e-14));
+
+        Eigen::Matrix<Scalar, 8, 1> knots_v;
+        knots_v << 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0;
+        Eigen::MatrixXd uvs(num_samples, 2);
+        uvs.col(0) = ts;
+        uvs.col(1) = ts.reverse();
+        const Eigen::MatrixXd patch_matrix =
+            BSplinePatch<Scalar, 1, 3, 3>::form_least_squares_matrix(
+                    num_control_pts, 4, knots, knots_v, uvs);
+
+        Eigen::Matrix<Scalar, num_control_pts * 4, 1> grid;
+        grid.setRandom();
+        BSplinePatch<Scalar, 1, 3, 3> patch;
+        patch.set_control_grid(grid);
+        patch.set_knots_u(knots);
+        patch.set_knots_v(knots_v);
+        patch.initialize();
+        const Eigen::MatrixXd values = patch_matrix * grid;
+        for (int i=0; i<num_samples; i++) {
+            REQUIRE(values(i, 0) == Approx(patch.evaluate(uvs(i, 0), uvs(i, 1))[0]));
+        }
+    }
+}
@@ -0,0 +1,162 @@
+#include <catch2/catch.hpp>
+
+#include <nanospline/BernsteinPolynomial.h>
+#include <nanospline/Bezier.h>
+#include <nanospline/RationalBezier.h>
+
+TEST_CASE("BernsteinPolynomial", "[bernstein]") {
+    using namespace nanospline;
+    using Scalar = double;
+    using Polynomial = BernsteinPolynomial<Scalar>;
+    using Coefficients = Polynomial::Coefficients;
+
+    Eigen::Matrix<Scalar, 5, 2> ctrl_pts;
+    ctrl_pts << 0.0, 0.0,
+                1.0, 2.0,
+                2.0,-1.0,
+                3.0, 1.5,
+                4.0, 0.5;
+    Bezier<Scalar, 2, 4> curve;
+    curve.set_control_points(ctrl_pts);
+    const Polynomial p(curve);
+    REQUIRE(p.get_degree() == 4);
+    REQUIRE(p.get_dim() == 2);
+
+    Coefficients line_coeffs(2, 1);
+    line_coeffs << -0.3, 0.7;
+    const Polynomial line(line_coeffs); // t - 0.3
+
+    SECTION("Curve and its derivatives") {
+        const auto d1 = p.derivative();
+        const auto d2 = d1.derivative();
+        for (int i=0; i<=10; i++) {
+            const Scalar t = i / 10.0;
+            REQUIRE((p.evaluate(t) - curve.evaluate(t)).norm() == Approx(0.0).margin(1e-12));
+            REQUIRE((d1.evaluate(t) - curve.evaluate_derivative(t)).norm() ==
+                    Approx(0.0).margin(1e-12));
+            REQUIRE((d2.evaluate(t) - curve.evaluate_2nd_derivative(t)).norm() ==
+                    Approx(0.0).margin(1e-12));
+        }
+        REQUIRE(p.derivative().derivative().derivative().derivative().derivative().get_degree()
+                == 0);
+        REQUIRE(p.derivative().derivative().derivative().derivative().derivative()
+                .get_coefficients().isZero());
+    }
+
+    SECTION("Arithmetic") {
+        const auto d1 = p.derivative();
+        const auto d2 = d1.derivative();
+        const auto speed2 = d1.dot(d1);
+        const auto cross = d1.cross(d2);
+        const auto scaled = line * p;
+        const auto sum = p + d1 * 2.0;
+        const auto difference = line - p.components(1);
+        const auto componentwise = p * d1;
+        REQUIRE(speed2.get_degree() == 6);
+        REQUIRE(cross.get_degree() == 5);
+        REQUIRE(scaled.get_degree() == 5);
+        REQUIRE(sum.get_degree() == 4);
+        REQUIRE(difference.get_degree() == 4);
+        REQUIRE(componentwise.get_degree() == 7);
+        for (int i=0; i<=10; i++) {
+            const Scalar t = i / 10.0;
+            const auto v0 = curve.evaluate(t);
+            const auto v1 = curve.evaluate_derivative(t);
+            const auto v2 = curve.evaluate_2nd_derivative(t);
+            REQUIRE(speed2.evaluate(t)[0] == Approx(v1.squaredNorm()));
+            REQUIRE(cross.evaluate(t)[0] ==
+                    Approx(v1[0] * v2[1] - v1[1] * v2[0]).margin(1e-12));
+            REQUIRE((scaled.evaluate(t) - (t - 0.3) * v0).norm() == Approx(0.0).margin(1e-12));
+            REQUIRE((sum.evaluate(t) - (v0 + 2 * v1)).norm() == Approx(0.0).margin(1e-12));
+            REQUIRE(difference.evaluate(t)[0] == Approx(t - 0.3 - v0[1]).margin(1e-12));
+            REQUIRE((componentwise.evaluate(t) - v0.cwiseProduct(v1)).norm() ==
+                    Approx(0.0).margin(1e-12));
+            REQUIRE(((-p).evaluate(t) + v0).norm() == Approx(0.0).margin(1e-12));
+        }
+    }
+
+    SECTION("Degree elevation") {
+        const auto q = p.elevate_degree(3);
+        REQUIRE(q.get_degree() == 7);
+        REQUIRE(q.get_coefficients().row(0) == p.get_coefficients().row(0));
+        REQUIRE(q.get_coefficients().row(7) == p.get_coefficients().row(4));
+        for (int i=0; i<=10; i++) {
+            const Scalar t = i / 10.0;
+            REQUIRE((q.evaluate(t) - p.evaluate(t)).norm() == Approx(0.0).margin(1e-12));
+        }
+        REQUIRE(q.elevate_degree(0).get_coefficients() == q.get_coefficients());
+    }
+
+    SECTION("Restriction") {
+        const auto q = p.subpolynomial(0.2, 0.7);
+        const auto r = p.subpolynomial(-0.5, 0.1);
+        REQUIRE(q.get_domain_lower_bound() == 0.2);
+        REQUIRE(q.get_domain_upper_bound() == 0.7);
+        REQUIRE(q.get_coefficients().row(0) == p.evaluate(0.2));
+        for (int i=0; i<=10; i++) {
+            const Scalar t = 0.2 + 0.05 * i;
+            REQUIRE((q.evaluate(t) - p.evaluate(t)).norm() == Approx(0.0).margin(1e-12));
+            REQUIRE((q.derivative().evaluate(t) - p.derivative().evaluate(t)).norm() ==
+                    Approx(0.0).margin(1e-12));
+            const Scalar s = -0.5 + 0.06 * i;
+            REQUIRE((r.evaluate(s) - p.evaluate(s)).norm() == Approx(0.0).margin(1e-12));
+        }
+
+        // The restriction of the curve is its subcurve.
+        const auto subcurve = curve.subcurve(0.2, 0.7);
+        REQUIRE((q.get_coefficients() - subcurve.get_control_points()).norm() ==
+                Approx(0.0).margin(1e-12));
+    }
+
+    SECTION("Rational curve") {
+        RationalBezier<Scalar, 2, 4> rational;
+        rational.set_control_points(ctrl_pts);
+        Eigen::Matrix<Scalar, 5, 1> weights;
+        weights << 1.0, 2.0, 0.5, 3.0, 1.0;
+        rational.set_weights(weights);
+        rational.initialize();
+
+        const Polynomial h(rational);
+        REQUIRE(h.get_dim() == 3);
+        const auto w = h.components(2);
+        const auto numerator = w * h.components(0, 2).derivative() -
+                               w.derivative() * h.components(0, 2);
+        for (int i=0; i<=10; i++) {
+            const Scalar t = i / 10.0;
+            const auto v = h.evaluate(t);
+            const Scalar wt = v[2];
+            REQUIRE((v.head(2) / wt - rational.evaluate(t)).norm() ==
+                    Approx(0.0).margin(1e-12));
+            REQUIRE((numerator.evaluate(t) / (wt * wt) - rational.evaluate_derivative(t)).norm()
+                    == Approx(0.0).margin(1e-9));
+        }
+    }
+
+    SECTION("Roots") {
+        Coefficients other_coeffs(2, 1);
+        other_coeffs << -0.6, 0.4;
+        const auto quadratic = line * Polynomial(other_coeffs); // (t - 0.3) (t - 0.6)
+        auto roots = quadratic.compute_roots();
+        REQUIRE(roots.size() == 2);
+        REQUIRE(roots[0] == Approx(0.3));
+        REQUIRE(roots[1] == Approx(0.6));
+
+        roots = quadratic.subpolynomial(0.5, 2.0).compute_roots();
+        REQUIRE(roots.size() == 1);
+        REQUIRE(roots[0] == Approx(0.6));
+
+        REQUIRE_THROWS_AS((line - line).compute_roots(), infinite_root_error);
+        REQUIRE_THROWS_AS(p.compute_roots(), invalid_setting_error);
+    }
+
+    SECTION("Invalid operations") {
+        const auto q = p.subpolynomial(0.0, 0.5);
+        REQUIRE_THROWS_AS(p + q, invalid_setting_error);
+        REQUIRE_THROWS_AS(p + line, invalid_setting_error);
+        REQUIRE_THROWS_AS(p.dot(line), invalid_setting_error);
+        REQUIRE_THROWS_AS(line.cross(line), invalid_setting_error);
+        REQUIRE_THROWS_AS(p.components(1, 2), invalid_setting_error);
+        REQUIRE_THROWS_AS(p.subpolynomial(0.5, 0.5), invalid_setting_error);
+        REQUIRE_THROWS_AS(Polynomial(Coefficients(0, 1)), invalid_setting_error);
+    }
+}
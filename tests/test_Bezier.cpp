@@ -3,7 +3,6 @@
 
 #include <nanospline/Bezier.h>
 #include <nanospline/save_svg.h>
-#include <nanospline/forward_declaration.h>
 
 #include "validation_utils.h"
 
@@ -28,6 +27,12 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("degree elevation") {
@@ -38,6 +43,7 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
 
         SECTION("Approximate inverse evaluation") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
     }
 
@@ -63,6 +69,12 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("degree elevation") {
@@ -73,6 +85,7 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
 
         SECTION("Approximate inverse evaluation") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
     }
 
@@ -102,20 +115,33 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
 
         SECTION("Inverse evaluation") {
             Eigen::Matrix<Scalar, 1, 2> p(0.0, 1.0);
-            REQUIRE_THROWS(curve.inverse_evaluate(p));
+            const auto t = curve.inverse_evaluate(p);
+            REQUIRE(t >= 0.0);
+            REQUIRE(t <= 1.0);
+            const auto dist = (curve.evaluate(t) - p).norm();
+            for (int i=0; i<=1000; i++) {
+                const auto q = curve.evaluate(i / 1000.0);
+                REQUIRE(dist <= (q - p).norm() + 1e-12);
+            }
         }
 
         SECTION("Approximate inverse evaluation") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
 
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
             const auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(std::abs(total_turning_angle) == Approx(M_PI/2));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
@@ -124,18 +150,14 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
             const auto turning_angle_2 = curve.get_turning_angle(split_pts[0], 1);
             REQUIRE(std::abs(turning_angle_1) == Approx(M_PI/4));
             REQUIRE(std::abs(turning_angle_2) == Approx(M_PI/4));
-#endif
         }
 
         SECTION("Singularity") {
-#if NANOSPLINE_SYMPY
             auto singular_pts = curve.compute_singularities(0, 1);
             REQUIRE(singular_pts.size() == 0);
-#endif
         }
 
         SECTION("Curve with singularity") {
-#if NANOSPLINE_SYMPY
             control_pts << 0.0, 0.0,
                            1.0, 1.0,
                            0.0, 1.0,
@@ -154,7 +176,6 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
             REQUIRE(singular_pts.size() == 1);
             REQUIRE(singular_pts[0] == Approx(0.5));
             REQUIRE(curve.evaluate_derivative(0.5).norm() == Approx(0.0));
-#endif
         }
 
         SECTION("degree elevation") {
@@ -190,20 +211,33 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
 
         SECTION("Inverse evaluation") {
             Eigen::Matrix<Scalar, 1, 2> p(0.0, 1.0);
-            REQUIRE_THROWS(curve.inverse_evaluate(p));
+            const auto t = curve.inverse_evaluate(p);
+            REQUIRE(t >= 0.0);
+            REQUIRE(t <= 1.0);
+            const auto dist = (curve.evaluate(t) - p).norm();
+            for (int i=0; i<=1000; i++) {
+                const auto q = curve.evaluate(i / 1000.0);
+                REQUIRE(dist <= (q - p).norm() + 1e-12);
+            }
         }
 
         SECTION("Approximate inverse evaluation") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
 
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
             const auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(std::abs(total_turning_angle) == Approx(M_PI/2));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
@@ -212,25 +246,20 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
             const auto turning_angle_2 = curve.get_turning_angle(split_pts[0], 1);
             REQUIRE(std::abs(turning_angle_1) == Approx(M_PI/4));
             REQUIRE(std::abs(turning_angle_2) == Approx(M_PI/4));
-#endif
         }
 
         SECTION("Turning angle of linear curve") {
-#if NANOSPLINE_SYMPY
             control_pts.col(1).setZero();
             curve.set_control_points(control_pts);
             const auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(total_turning_angle == Approx(0.0));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
             REQUIRE(split_pts.empty());
-#endif
         }
 
         SECTION("Singularity") {
-#if NANOSPLINE_SYMPY
             auto singular_pts = curve.compute_singularities(0, 1);
             REQUIRE(singular_pts.size() == 0);
-#endif
         }
 
         SECTION("degree elevation") {
@@ -238,6 +267,19 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
             REQUIRE(new_curve.get_degree() == 4);
             assert_same(curve, new_curve, 10);
         }
+
+        SECTION("High degree") {
+            // Exceeds the stack storage limit, exercising the heap fallback.
+            auto new_curve = curve.elevate_degree();
+            while (new_curve.get_degree() <= 20) {
+                new_curve = new_curve.elevate_degree();
+            }
+            assert_same(curve, new_curve, 10);
+            validate_derivatives(new_curve, 10);
+            validate_2nd_derivatives(new_curve, 10);
+            validate_evaluate_derivatives(new_curve, 10);
+            validate_power_basis(new_curve, 10);
+        }
     }
 
     SECTION("Specialized degree 0") {
@@ -258,6 +300,12 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("degree elevation") {
@@ -320,15 +368,19 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
             const auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(total_turning_angle == Approx(0.0).margin(1e-6));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
             REQUIRE(split_pts.size() == 0);
-#endif
         }
 
         SECTION("degree elevation") {
@@ -366,10 +418,15 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
             const auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(std::abs(total_turning_angle) == Approx(M_PI/2).margin(1e-6));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
@@ -379,11 +436,9 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
             const auto turning_angle_2 = curve.get_turning_angle(split_pts[0], 1);
             REQUIRE(std::abs(turning_angle_1) == Approx(M_PI/4));
             REQUIRE(std::abs(turning_angle_2) == Approx(M_PI/4));
-#endif
         }
 
         SECTION("Singularity") {
-#if NANOSPLINE_SYMPY
             auto singular_pts = curve.compute_singularities(0, 1);
             REQUIRE(singular_pts.size() == 0);
 
@@ -393,7 +448,6 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
             REQUIRE(singular_pts.size() == 1);
             REQUIRE(singular_pts[0] == Approx(0.5));
             REQUIRE(curve.evaluate_derivative(0.5).norm() == Approx(0.0));
-#endif
         }
 
         SECTION("degree elevation") {
@@ -404,6 +458,7 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
 
         SECTION("Approximate inverse evaluation") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
     }
 
@@ -436,10 +491,15 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
             const auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(std::abs(total_turning_angle) == Approx(M_PI/2).margin(1e-6));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
@@ -449,29 +509,23 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
             const auto turning_angle_2 = curve.get_turning_angle(split_pts[0], 1);
             REQUIRE(std::abs(turning_angle_1) == Approx(M_PI/4));
             REQUIRE(std::abs(turning_angle_2) == Approx(M_PI/4));
-#endif
         }
 
         SECTION("Turning angle of linear curve") {
-#if NANOSPLINE_SYMPY
             control_pts.col(1).setZero();
             curve.set_control_points(control_pts);
             const auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(total_turning_angle == Approx(0.0));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
             REQUIRE(split_pts.empty());
-#endif
         }
 
         SECTION("Singularity") {
-#if NANOSPLINE_SYMPY
             auto singular_pts = curve.compute_singularities(0, 1);
             REQUIRE(singular_pts.size() == 0);
-#endif
         }
 
         SECTION("Curve with singularity") {
-#if NANOSPLINE_SYMPY
             control_pts << 0.0, 0.0,
                            1.0, 1.0,
                            0.0, 1.0,
@@ -490,7 +544,6 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
             REQUIRE(singular_pts.size() == 1);
             REQUIRE(singular_pts[0] == Approx(0.5));
             REQUIRE(curve.evaluate_derivative(0.5).norm() == Approx(0.0));
-#endif
         }
 
         SECTION("degree elevation") {
@@ -500,4 +553,44 @@ TEST_CASE("Bezier", "[nonrational][bezier]") {
         }
     }
 
+    SECTION("Power basis cache") {
+        Eigen::Matrix<Scalar, 6, 2> control_pts;
+        control_pts.setRandom();
+        Bezier<Scalar, 2, -1> curve;
+        curve.set_evaluation_mode(EvaluationMode::PowerBasis);
+        curve.set_control_points(control_pts);
+
+        // The cache follows control point updates.
+        control_pts.setRandom();
+        curve.set_control_points(control_pts);
+        Bezier<Scalar, 2, -1> reference;
+        reference.set_control_points(control_pts);
+        assert_same(curve, reference, 10, 1e-12);
+
+        // Copies share the cache until either one is modified.
+        auto copy = curve;
+        Eigen::Matrix<Scalar, 6, 2> other_pts = control_pts * 2;
+        copy.set_control_points(other_pts);
+        assert_same(curve, reference, 10, 1e-12);
+        REQUIRE((copy.evaluate(0.3) - 2 * reference.evaluate(0.3)).norm() ==
+                Approx(0.0).margin(1e-12));
+
+        curve.set_evaluation_mode(EvaluationMode::Recursive);
+        REQUIRE(curve.get_evaluation_mode() == EvaluationMode::Recursive);
+        assert_same(curve, reference, 10, 0.0);
+    }
+
+    SECTION("Evaluation mode of closed form specializations") {
+        Bezier<Scalar, 2, 2> quadratic;
+        quadratic.set_evaluation_mode(EvaluationMode::PowerBasis);
+        REQUIRE(quadratic.get_evaluation_mode() == EvaluationMode::Recursive);
+
+        Bezier<Scalar, 2, 3> cubic;
+        cubic.set_evaluation_mode(EvaluationMode::PowerBasis);
+        REQUIRE(cubic.get_evaluation_mode() == EvaluationMode::PowerBasis);
+
+        Bezier<Scalar, 2, 2, true> generic_quadratic;
+        generic_quadratic.set_evaluation_mode(EvaluationMode::PowerBasis);
+        REQUIRE(generic_quadratic.get_evaluation_mode() == EvaluationMode::PowerBasis);
+    }
 }
@@ -3,7 +3,6 @@
 
 #include <nanospline/BezierPatch.h>
 #include <nanospline/save_obj.h>
-#include <nanospline/forward_declaration.h>
 
 #include "validation_utils.h"
 
@@ -40,6 +39,7 @@ TEST_CASE("BeizerPatch", "[nonrational][bezier_patch]") {
         REQUIRE(p_mid[2] == Approx(0.0));
 
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_derivative_patches(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 10, 10);
@@ -99,6 +99,7 @@ TEST_CASE("BeizerPatch", "[nonrational][bezier_patch]") {
         REQUIRE((corner_11 - control_grid.row(15)).norm() == Approx(0.0));
 
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_derivative_patches(patch, 10, 10);
         validate_iso_curves(patch, 10);
         validate_inverse_evaluation(patch, 10, 10);
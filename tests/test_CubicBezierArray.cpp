@@ -0,0 +1,96 @@
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+#include <nanospline/Bezier.h>
+#include <nanospline/CubicBezierArray.h>
+#include <nanospline/internal/simd_packet.h>
+
+namespace {
+
+template<typename Scalar, int dim>
+void validate_cubic_bezier_array(int num_curves, Scalar tol) {
+    using namespace nanospline;
+    using Curve = Bezier<Scalar, dim, 3>;
+    using ArrayType = CubicBezierArray<Scalar, dim>;
+
+    std::vector<Curve> curves(static_cast<size_t>(num_curves));
+    for (auto& curve : curves) {
+        typename Curve::ControlPoints ctrl_pts;
+        ctrl_pts.setRandom();
+        curve.set_control_points(ctrl_pts);
+    }
+
+    ArrayType curve_array(curves);
+    REQUIRE(curve_array.size() == num_curves);
+
+    typename ArrayType::ParameterArray ts(num_curves);
+    ts.setRandom();
+    ts = (ts.array() + 1) / 2;
+
+    typename ArrayType::PointArray points, derivatives, second_derivatives;
+    curve_array.evaluate(ts, points);
+    curve_array.evaluate_derivative(ts, derivatives);
+    curve_array.evaluate_2nd_derivative(ts, second_derivatives);
+    REQUIRE(points.rows() == num_curves);
+
+    for (int k=0; k<num_curves; k++) {
+        const auto& curve = curves[static_cast<size_t>(k)];
+        const Scalar t = ts[k];
+        REQUIRE((points.row(k) - curve.evaluate(t)).norm() ==
+                Approx(0.0).margin(tol));
+        REQUIRE((derivatives.row(k) - curve.evaluate_derivative(t)).norm() ==
+                Approx(0.0).margin(tol));
+        REQUIRE((second_derivatives.row(k) - curve.evaluate_2nd_derivative(t)).norm() ==
+                Approx(0.0).margin(tol));
+    }
+
+    if (num_curves > 0) {
+        REQUIRE(curve_array.get_curve(num_curves-1).get_control_points() ==
+                curves.back().get_control_points());
+    }
+}
+
+}
+
+TEST_CASE("CubicBezierArray", "[bezier]") {
+    using namespace nanospline;
+
+    // The instruction set follows the target flags, see NANOSPLINE_SIMD,
+    // NANOSPLINE_ENABLE_AVX and the nanospline_avx_test target.
+#if defined(NANOSPLINE_NO_SIMD) || !(defined(__AVX__) || defined(__SSE2__))
+    constexpr int num_double_lanes = 1;
+    constexpr int num_float_lanes = 1;
+#elif defined(__AVX__)
+    constexpr int num_double_lanes = 4;
+    constexpr int num_float_lanes = 8;
+#else
+    constexpr int num_double_lanes = 2;
+    constexpr int num_float_lanes = 4;
+#endif
+    static_assert(internal::Packet<double>::SIZE == num_double_lanes, "Unexpected packet size");
+    static_assert(internal::Packet<float>::SIZE == num_float_lanes, "Unexpected packet size");
+
+    SECTION("2D double") {
+        validate_cubic_bezier_array<double, 2>(37, 1e-12);
+    }
+
+    SECTION("3D double") {
+        validate_cubic_bezier_array<double, 3>(37, 1e-12);
+    }
+
+    SECTION("Fewer curves than lanes") {
+        validate_cubic_bezier_array<double, 2>(1, 1e-12);
+        validate_cubic_bezier_array<double, 2>(0, 1e-12);
+    }
+
+    SECTION("Size mismatch") {
+        Eigen::Matrix<double, 4, 2> ctrl_pts = Eigen::Matrix<double, 4, 2>::Random();
+        Bezier<double, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        CubicBezierArray<double, 2> curve_array(std::vector<Bezier<double, 2, 3>>(4, curve));
+        CubicBezierArray<double, 2>::ParameterArray ts(3);
+        CubicBezierArray<double, 2>::PointArray points;
+        REQUIRE_THROWS(curve_array.evaluate(ts, points));
+    }
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <nanospline/CurveBVH.h>
+
+TEST_CASE("CurveBVH", "[curve_bvh]") {
+    using namespace nanospline;
+    using Scalar = double;
+    using Point = Eigen::Matrix<Scalar, 1, 2>;
+
+    CurveBVH<Scalar, 2> bvh;
+    std::vector<std::shared_ptr<CurveBase<Scalar, 2>>> curves;
+
+    // A grid of random B-splines, plus one curve of each other type.
+    Eigen::Matrix<Scalar, 9, 1> knots;
+    knots << 0.0, 0.0, 0.0, 0.0, 0.5, 1.0, 1.0, 1.0, 1.0;
+    for (int i=0; i<5; i++) {
+        for (int j=0; j<5; j++) {
+            Eigen::Matrix<Scalar, 5, 2> ctrl_pts;
+            ctrl_pts.setRandom();
+            ctrl_pts.col(0).array() += 3 * i;
+            ctrl_pts.col(1).array() += 3 * j;
+            auto curve = std::make_shared<BSpline<Scalar, 2, 3>>();
+            curve->set_control_points(ctrl_pts);
+            curve->set_knots(knots);
+            REQUIRE(bvh.add_curve(*curve) == static_cast<int>(curves.size()));
+            curves.push_back(curve);
+        }
+    }
+
+    Eigen::Matrix<Scalar, 4, 2> bezier_ctrl_pts;
+    bezier_ctrl_pts << 0.0, 0.0,
+                       5.0, 8.0,
+                       10.0, -3.0,
+                       15.0, 6.0;
+    auto bezier = std::make_shared<Bezier<Scalar, 2, 3>>();
+    bezier->set_control_points(bezier_ctrl_pts);
+    bvh.add_curve(*bezier);
+    curves.push_back(bezier);
+
+    Eigen::Matrix<Scalar, 3, 2> arc_ctrl_pts;
+    arc_ctrl_pts << 7.0, 6.0,
+                    7.0, 7.0,
+                    6.0, 7.0;
+    Eigen::Matrix<Scalar, 3, 1> arc_weights;
+    arc_weights << 1.0, std::sqrt(2.0) / 2, 1.0;
+    auto arc = std::make_shared<RationalBezier<Scalar, 2, 2>>();
+    arc->set_control_points(arc_ctrl_pts);
+    arc->set_weights(arc_weights);
+    arc->initialize();
+    bvh.add_curve(*arc);
+    curves.push_back(arc);
+
+    Eigen::Matrix<Scalar, 5, 2> nurbs_ctrl_pts;
+    nurbs_ctrl_pts.setRandom();
+    nurbs_ctrl_pts.array() += 6;
+    Eigen::Matrix<Scalar, 5, 1> weights;
+    weights << 1.0, 0.5, 2.0, 1.5, 1.0;
+    auto nurbs = std::make_shared<NURBS<Scalar, 2, 3>>();
+    nurbs->set_control_points(nurbs_ctrl_pts);
+    nurbs->set_knots(knots);
+    nurbs->set_weights(weights);
+    nurbs->initialize();
+    bvh.add_curve(*nurbs);
+    curves.push_back(nurbs);
+
+    REQUIRE_THROWS(bvh.query(Point(0.0, 0.0)));
+    REQUIRE_THROWS(bvh.batch_query(Eigen::Matrix<Scalar, 8, 2>::Zero(), 4));
+    bvh.initialize();
+    REQUIRE(bvh.get_num_curves() == 28);
+    REQUIRE(bvh.get_num_pieces() == 25 * 2 + 1 + 1 + 2);
+
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 2> queries(200, 2);
+    queries.setRandom();
+    queries = (queries.array() + 1) * 8 - 2;
+
+    SECTION("Agrees with brute force") {
+        for (int i=0; i<queries.rows(); i++) {
+            const Point q = queries.row(i);
+            const auto result = bvh.query(q);
+            REQUIRE(result.curve_id >= 0);
+
+            Scalar min_dist = std::numeric_limits<Scalar>::max();
+            for (const auto& curve : curves) {
+                const auto t = curve->inverse_evaluate(q);
+                min_dist = std::min(min_dist, (curve->evaluate(t) - q).norm());
+            }
+            REQUIRE(result.distance == Approx(min_dist).margin(1e-10));
+
+            const auto& closest = curves[static_cast<size_t>(result.curve_id)];
+            REQUIRE((closest->evaluate(result.t) - q).norm() ==
+                    Approx(result.distance).margin(1e-10));
+        }
+    }
+
+    SECTION("Batch query") {
+        const auto serial = bvh.batch_query(queries, 1);
+        const auto parallel = bvh.batch_query(queries, 4);
+        REQUIRE(serial.size() == 200);
+        REQUIRE(parallel.size() == 200);
+        for (size_t i=0; i<serial.size(); i++) {
+            REQUIRE(serial[i].curve_id == parallel[i].curve_id);
+            REQUIRE(serial[i].t == parallel[i].t);
+            REQUIRE(serial[i].distance == parallel[i].distance);
+        }
+    }
+
+    SECTION("Empty") {
+        CurveBVH<Scalar, 2> empty;
+        empty.initialize();
+        REQUIRE(empty.query(Point(0.0, 0.0)).curve_id == -1);
+        REQUIRE(empty.batch_query(queries).size() == 200);
+    }
+}
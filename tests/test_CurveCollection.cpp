@@ -0,0 +1,257 @@
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <nanospline/CurveCollection.h>
+
+TEST_CASE("CurveCollection", "[curve_collection]") {
+    using namespace nanospline;
+    using Scalar = double;
+    using Point = Eigen::Matrix<Scalar, 1, 2>;
+
+    Eigen::Matrix<Scalar, 4, 2> cubic_ctrl_pts;
+    cubic_ctrl_pts << 0.0, 0.0,
+                      1.0, 2.0,
+                      2.0, -1.0,
+                      3.0, 0.5;
+    auto cubic = std::make_shared<Bezier<Scalar, 2, 3>>();
+    cubic->set_control_points(cubic_ctrl_pts);
+
+    Eigen::Matrix<Scalar, 5, 2> quartic_ctrl_pts;
+    quartic_ctrl_pts << 0.0, 0.0,
+                        1.0, 1.0,
+                        2.0, 0.0,
+                        3.0, 1.0,
+                        4.0, 0.0;
+    auto quartic = std::make_shared<Bezier<Scalar, 2, -1>>();
+    quartic->set_control_points(quartic_ctrl_pts);
+
+    Eigen::Matrix<Scalar, 3, 2> arc_ctrl_pts;
+    arc_ctrl_pts << 1.0, 0.0,
+                    1.0, 1.0,
+                    0.0, 1.0;
+    Eigen::Matrix<Scalar, 3, 1> arc_weights;
+    arc_weights << 1.0, std::sqrt(2.0) / 2, 1.0;
+    auto arc = std::make_shared<RationalBezier<Scalar, 2, 2>>();
+    arc->set_control_points(arc_ctrl_pts);
+    arc->set_weights(arc_weights);
+    arc->initialize();
+
+    Eigen::Matrix<Scalar, 5, 2> spline_ctrl_pts;
+    spline_ctrl_pts << 0.0, 0.0,
+                       1.0, 1.0,
+                       2.0, 0.0,
+                       3.0, 1.0,
+                       4.0, 0.0;
+    Eigen::Matrix<Scalar, 9, 1> knots;
+    knots << 0.0, 0.0, 0.0, 0.0, 0.5, 1.0, 1.0, 1.0, 1.0;
+    auto spline = std::make_shared<BSpline<Scalar, 2, 3>>();
+    spline->set_control_points(spline_ctrl_pts);
+    spline->set_knots(knots);
+
+    Eigen::Matrix<Scalar, 5, 1> weights;
+    weights << 1.0, 0.5, 2.0, 1.5, 1.0;
+    auto nurbs = std::make_shared<NURBS<Scalar, 2, 3>>();
+    nurbs->set_control_points(spline_ctrl_pts);
+    nurbs->set_knots(knots);
+    nurbs->set_weights(weights);
+    nurbs->initialize();
+
+    // Interleave types so that insertion order differs from bucket order.
+    std::vector<std::shared_ptr<CurveBase<Scalar, 2>>> curves{
+        cubic, spline, quartic, arc, cubic, nurbs, quartic};
+
+    CurveCollection<Scalar, 2> collection;
+    for (const auto& curve : curves) {
+        collection.add_curve(curve);
+    }
+    REQUIRE(collection.size() == 7);
+    REQUIRE(collection.get_num_buckets() == 5);
+
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 1> ts(7);
+    ts << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7;
+
+    SECTION("Evaluation in insertion order") {
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 2> values, ders, second_ders;
+        collection.evaluate(ts, values);
+        collection.evaluate_derivative(ts, ders);
+        collection.evaluate_2nd_derivative(ts, second_ders);
+        REQUIRE(values.rows() == 7);
+        for (size_t i=0; i<curves.size(); i++) {
+            const int row = static_cast<int>(i);
+            const Scalar t = ts[row];
+            REQUIRE((values.row(row) - curves[i]->evaluate(t)).norm() ==
+                    Approx(0.0).margin(1e-12));
+            REQUIRE((ders.row(row) - curves[i]->evaluate_derivative(t)).norm() ==
+                    Approx(0.0).margin(1e-12));
+            REQUIRE((second_ders.row(row) -
+                        curves[i]->evaluate_2nd_derivative(t)).norm() ==
+                    Approx(0.0).margin(1e-12));
+        }
+
+        REQUIRE_THROWS(collection.evaluate(ts.head(3), values));
+    }
+
+    SECTION("Bounding boxes") {
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 2> bbox_min, bbox_max;
+        collection.compute_bounding_boxes(bbox_min, bbox_max);
+        REQUIRE(bbox_min.row(0) == cubic_ctrl_pts.colwise().minCoeff());
+        REQUIRE(bbox_max.row(0) == cubic_ctrl_pts.colwise().maxCoeff());
+        for (size_t i=0; i<curves.size(); i++) {
+            const int row = static_cast<int>(i);
+            for (int j=0; j<=10; j++) {
+                const Point p = curves[i]->evaluate(Scalar(j) / 10);
+                REQUIRE((p.array() >= bbox_min.row(row).array() - 1e-12).all());
+                REQUIRE((p.array() <= bbox_max.row(row).array() + 1e-12).all());
+            }
+        }
+    }
+
+    SECTION("Closest point") {
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 2> queries;
+        collection.evaluate(ts, queries);
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 1> closest;
+        collection.approximate_inverse_evaluate(queries, closest);
+        REQUIRE(closest.rows() == 7);
+        for (int i=0; i<7; i++) {
+            REQUIRE(closest[i] == Approx(ts[i]).margin(1e-6));
+        }
+
+        // The exact search matches each curve's own inverse_evaluate, also
+        // for query points off the curves.
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 2> shift(7, 2);
+        shift.setConstant(0.05);
+        collection.inverse_evaluate(queries, closest);
+        REQUIRE(closest.rows() == 7);
+        for (int i=0; i<7; i++) {
+            REQUIRE(closest[i] == Approx(ts[i]).margin(1e-6));
+        }
+        const Eigen::Matrix<Scalar, Eigen::Dynamic, 2> off_curve = queries + shift;
+        collection.inverse_evaluate(off_curve, closest);
+        for (size_t i=0; i<curves.size(); i++) {
+            const int row = static_cast<int>(i);
+            REQUIRE(closest[row] ==
+                    Approx(curves[i]->inverse_evaluate(off_curve.row(row))).margin(1e-12));
+        }
+
+        REQUIRE_THROWS(collection.inverse_evaluate(queries.topRows(3), closest));
+    }
+
+    SECTION("Stored copies") {
+        const auto& stored = collection.get_curve(3);
+        REQUIRE((stored.evaluate(0.5) - arc->evaluate(0.5)).norm() ==
+                Approx(0.0).margin(1e-12));
+    }
+
+    SECTION("Batch root queries") {
+        auto cross = [](const Point& a, const Point& b) { return a[0] * b[1] - a[1] * b[0]; };
+
+        std::vector<int> offsets, offsets_serial;
+        std::vector<Scalar> inflections, inflections_serial;
+        collection.compute_inflections(offsets, inflections, 3);
+        collection.compute_inflections(offsets_serial, inflections_serial, 1);
+        REQUIRE(offsets == offsets_serial);
+        REQUIRE(inflections == inflections_serial);
+        REQUIRE(offsets.size() == 8);
+        REQUIRE(offsets.back() == static_cast<int>(inflections.size()));
+
+        // The curvature vanishes at the reported inflections and changes sign
+        // exactly there.  Flat points, where it vanishes without changing
+        // sign as in the middle of the quartic, are not inflections.
+        for (size_t i=0; i<curves.size(); i++) {
+            const auto& curve = *curves[i];
+            const int begin = offsets[i];
+            const int end = offsets[i + 1];
+            for (int k=begin; k<end; k++) {
+                const Scalar t = inflections[static_cast<size_t>(k)];
+                const Point d1 = curve.evaluate_derivative(t);
+                const Point d2 = curve.evaluate_2nd_derivative(t);
+                REQUIRE(cross(d1, d2) == Approx(0.0).margin(1e-9));
+            }
+            int num_sign_changes = 0;
+            Scalar prev = cross(curve.evaluate_derivative(0), curve.evaluate_2nd_derivative(0));
+            for (int j=1; j<=1000; j++) {
+                const Scalar t = Scalar(j) / 1000;
+                const Scalar c = cross(curve.evaluate_derivative(t), curve.evaluate_2nd_derivative(t));
+                if ((c > 0) != (prev > 0)) num_sign_changes++;
+                prev = c;
+            }
+            REQUIRE(num_sign_changes == end - begin);
+        }
+        REQUIRE(offsets[1] - offsets[0] == 1);
+        REQUIRE(offsets[3] == offsets[2]); // The quartic only has a flat point.
+        REQUIRE(offsets[4] == offsets[3]); // The arc has no inflection.
+
+        // None of the curves has a cusp.
+        std::vector<Scalar> singularities;
+        collection.compute_singularities(offsets, singularities);
+        REQUIRE(singularities.empty());
+
+        // Bezier curves are split where the tangent is orthogonal to the
+        // normal of the average end tangent.
+        std::vector<Scalar> splits;
+        collection.reduce_turning_angle(offsets, splits);
+        for (const size_t i : {size_t(0), size_t(2), size_t(3)}) {
+            const auto& curve = *curves[i];
+            const Point tan0 = curve.evaluate_derivative(0).normalized();
+            const Point tan1 = curve.evaluate_derivative(1).normalized();
+            const Point normal(-(tan0[1] + tan1[1]) / 2, (tan0[0] + tan1[0]) / 2);
+            REQUIRE(offsets[i + 1] > offsets[i]);
+            for (int k=offsets[i]; k<offsets[i + 1]; k++) {
+                const Point d = curve.evaluate_derivative(splits[static_cast<size_t>(k)]);
+                REQUIRE(d.dot(normal) == Approx(0.0).margin(1e-9 * d.norm()));
+            }
+        }
+    }
+
+    SECTION("Roots at knots") {
+        // Point symmetric about (2, 0), with the inflection at the knot.
+        Eigen::Matrix<Scalar, 5, 2> s_ctrl_pts;
+        s_ctrl_pts << 0.0, 0.0,
+                      1.0, 1.0,
+                      2.0, 0.0,
+                      3.0, -1.0,
+                      4.0, 0.0;
+        BSpline<Scalar, 2, 3> s_curve;
+        s_curve.set_control_points(s_ctrl_pts);
+        s_curve.set_knots(knots);
+
+        // Both pieces report the root at t = 0.5.
+        CurveCollection<Scalar, 2> s_curves;
+        s_curves.add_curve(s_curve);
+        std::vector<int> offsets;
+        std::vector<Scalar> inflections;
+        s_curves.compute_inflections(offsets, inflections);
+        REQUIRE(offsets == std::vector<int>{0, 1});
+        REQUIRE(inflections[0] == Approx(0.5).margin(1e-8));
+    }
+
+    SECTION("Batch singularities") {
+        Eigen::Matrix<Scalar, 4, 2> cusp_ctrl_pts;
+        cusp_ctrl_pts << 0.0, 0.0,
+                         1.0, 1.0,
+                         0.0, 1.0,
+                         1.0, 0.0;
+        Bezier<Scalar, 2, 3> cusp;
+        cusp.set_control_points(cusp_ctrl_pts);
+        RationalBezier<Scalar, 2, 3> rational_cusp;
+        rational_cusp.set_control_points(cusp_ctrl_pts);
+        Eigen::Matrix<Scalar, 4, 1> cusp_weights;
+        cusp_weights.setConstant(2.0);
+        rational_cusp.set_weights(cusp_weights);
+        rational_cusp.initialize();
+
+        CurveCollection<Scalar, 2> cusps;
+        cusps.add_curve(*cubic);
+        cusps.add_curve(cusp);
+        cusps.add_curve(rational_cusp);
+
+        std::vector<int> offsets;
+        std::vector<Scalar> singularities;
+        cusps.compute_singularities(offsets, singularities);
+        REQUIRE(offsets == std::vector<int>{0, 0, 1, 2});
+        REQUIRE(singularities[0] == Approx(0.5).margin(1e-6));
+        REQUIRE(singularities[1] == Approx(0.5).margin(1e-6));
+    }
+}
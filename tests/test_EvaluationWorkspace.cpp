@@ -0,0 +1,236 @@
+#include <catch2/catch.hpp>
+
+#include <nanospline/BSpline.h>
+#include <nanospline/Bezier.h>
+#include <nanospline/EvaluationWorkspace.h>
+#include <nanospline/NURBS.h>
+#include <nanospline/RationalBezier.h>
+
+#include "validation_utils.h"
+
+namespace {
+
+template<typename CurveType>
+void validate_workspace_evaluation(const CurveType& curve,
+        nanospline::EvaluationWorkspace<typename CurveType::Scalar>& workspace,
+        int num_samples) {
+    using Scalar = typename CurveType::Scalar;
+    const Scalar t_min = curve.get_domain_lower_bound();
+    const Scalar t_max = curve.get_domain_upper_bound();
+
+    for (int i=0; i<=num_samples; i++) {
+        const Scalar t = i * (t_max - t_min) / num_samples + t_min;
+        const auto p = curve.evaluate(t);
+        const auto q = curve.evaluate(t, workspace);
+        REQUIRE((p-q).norm() == Approx(0.0).margin(1e-12));
+    }
+
+    // Buffers reach a steady state after the first pass.
+    const auto capacity = workspace.capacity();
+    for (int i=0; i<=num_samples; i++) {
+        const Scalar t = i * (t_max - t_min) / num_samples + t_min;
+        curve.evaluate(t, workspace);
+    }
+    REQUIRE(workspace.capacity() == capacity);
+}
+
+}
+
+TEST_CASE("EvaluationWorkspace", "[workspace]") {
+    using namespace nanospline;
+    using Scalar = double;
+    EvaluationWorkspace<Scalar> workspace;
+
+    SECTION("Buffers") {
+        REQUIRE(workspace.capacity() == 0);
+        auto m = workspace.get_matrix<2>(0, 5);
+        REQUIRE(m.rows() == 5);
+        REQUIRE(m.cols() == 2);
+        auto v = workspace.get_vector(1, 3);
+        REQUIRE(v.size() == 3);
+        REQUIRE(workspace.capacity() == 13);
+
+        // Smaller requests reuse the existing storage.
+        workspace.get_matrix<3>(0, 2);
+        REQUIRE(workspace.capacity() == 13);
+        workspace.get_vector(1, 20);
+        REQUIRE(workspace.capacity() == 30);
+    }
+
+    SECTION("Bezier") {
+        Eigen::Matrix<Scalar, 6, 2> control_pts;
+        control_pts << 0.0, 0.0,
+                       1.0, 2.0,
+                       2.0, -1.0,
+                       3.0, 3.0,
+                       4.0, 0.5,
+                       5.0, 0.0;
+        Bezier<Scalar, 2, -1> curve;
+        curve.set_control_points(control_pts);
+
+        SECTION("Evaluation") {
+            validate_workspace_evaluation(curve, workspace, 10);
+        }
+
+        SECTION("Blossom") {
+            Eigen::Matrix<Scalar, Eigen::Dynamic, 1> blossom_vector(5);
+            blossom_vector.setConstant(0.3);
+            const auto p = curve.blossom(blossom_vector, workspace);
+            REQUIRE((p - curve.evaluate(0.3)).norm() == Approx(0.0).margin(1e-12));
+
+            // The blossom is symmetric in its arguments.
+            blossom_vector << 0.1, 0.2, 0.3, 0.4, 0.5;
+            const auto q0 = curve.blossom(blossom_vector, workspace);
+            blossom_vector.reverseInPlace();
+            const auto q1 = curve.blossom(blossom_vector, workspace);
+            REQUIRE((q0 - q1).norm() == Approx(0.0).margin(1e-12));
+        }
+
+        SECTION("Subcurve") {
+            const auto c0 = curve.subcurve(0.2, 0.7);
+            const auto c1 = curve.subcurve(0.2, 0.7, workspace);
+            REQUIRE((c0.get_control_points() - c1.get_control_points()).norm() ==
+                    Approx(0.0).margin(1e-12));
+            REQUIRE_THROWS(curve.subcurve(0.7, 0.2, workspace));
+        }
+    }
+
+    SECTION("Specialized Bezier") {
+        Eigen::Matrix<Scalar, 4, 2> control_pts;
+        control_pts << 0.0, 0.0,
+                       1.0, 1.0,
+                       2.0, 1.0,
+                       3.0, 0.0;
+        Bezier<Scalar, 2, 3> curve;
+        curve.set_control_points(control_pts);
+        validate_workspace_evaluation(curve, workspace, 10);
+    }
+
+    SECTION("RationalBezier") {
+        Eigen::Matrix<Scalar, 3, 2> control_pts;
+        control_pts << 1.0, 0.0,
+                       1.0, 1.0,
+                       0.0, 1.0;
+        Eigen::Matrix<Scalar, 3, 1> weights;
+        weights << 1.0, std::sqrt(2.0) / 2, 1.0;
+        RationalBezier<Scalar, 2, -1> curve;
+        curve.set_control_points(control_pts);
+        curve.set_weights(weights);
+        curve.initialize();
+        validate_workspace_evaluation(curve, workspace, 10);
+    }
+
+    SECTION("BSpline") {
+        Eigen::Matrix<Scalar, 6, 2> control_pts;
+        control_pts << 0.0, 0.0,
+                       1.0, 2.0,
+                       2.0, -1.0,
+                       3.0, 3.0,
+                       4.0, 0.5,
+                       5.0, 0.0;
+        Eigen::Matrix<Scalar, 10, 1> knots;
+        knots << 0.0, 0.0, 0.0, 0.0, 0.3, 0.6, 1.0, 1.0, 1.0, 1.0;
+        BSpline<Scalar, 2, -1> curve;
+        curve.set_control_points(control_pts);
+        curve.set_knots(knots);
+
+        SECTION("Evaluation") {
+            validate_workspace_evaluation(curve, workspace, 10);
+        }
+
+        SECTION("Span hint") {
+            REQUIRE(workspace.get_span_hint() == -1);
+            curve.evaluate(0.4, workspace);
+            REQUIRE(workspace.get_span_hint() == 4);
+            curve.evaluate(0.7, workspace);
+            REQUIRE(workspace.get_span_hint() == 5);
+
+            // A stale hint, e.g. from another curve, is only a hint.
+            workspace.set_span_hint(2);
+            REQUIRE((curve.evaluate(0.1, workspace) - curve.evaluate(0.1)).norm() ==
+                    Approx(0.0).margin(1e-12));
+            REQUIRE(workspace.get_span_hint() == 3);
+        }
+
+        SECTION("Knot insertion") {
+            auto curve1 = curve;
+            auto curve2 = curve;
+            curve1.insert_knot(0.45, 2);
+            curve2.insert_knot(0.45, 2, workspace);
+            REQUIRE(curve1.get_knots() == curve2.get_knots());
+            REQUIRE((curve1.get_control_points() - curve2.get_control_points()).norm() ==
+                    Approx(0.0).margin(1e-12));
+            assert_same(curve, curve2, 10);
+        }
+
+        SECTION("Blossom") {
+            Eigen::Matrix<Scalar, 3, 1> blossom_vector;
+            blossom_vector.setConstant(0.4);
+            REQUIRE((curve.blossom(blossom_vector, 4, workspace) - curve.evaluate(0.4)).norm() ==
+                    Approx(0.0).margin(1e-12));
+
+            Eigen::Matrix<Scalar, Eigen::Dynamic, 2> c0, c1;
+            curve.extract_bezier_control_points(5, c0);
+            curve.extract_bezier_control_points(5, c1, workspace);
+            REQUIRE((c0 - c1).norm() == Approx(0.0).margin(1e-12));
+        }
+
+        SECTION("Subcurve") {
+            auto check_subcurve = [&](const BSpline<Scalar, 2, -1>& c, Scalar t0, Scalar t1) {
+                const auto c0 = c.subcurve(t0, t1);
+                const auto c1 = c.subcurve(t0, t1, workspace);
+                REQUIRE(c0.get_knots() == c1.get_knots());
+                REQUIRE((c0.get_control_points() - c1.get_control_points()).norm() ==
+                        Approx(0.0).margin(1e-12));
+                REQUIRE(c1.get_domain_lower_bound() == t0);
+                REQUIRE(c1.get_domain_upper_bound() == t1);
+                for (int i = 0; i <= 10; i++) {
+                    const Scalar t = t0 + (t1 - t0) * i / 10;
+                    REQUIRE((c1.evaluate(t) - c.evaluate(t)).norm() ==
+                            Approx(0.0).margin(1e-12));
+                }
+            };
+            check_subcurve(curve, 0.2, 0.7);
+            check_subcurve(curve, 0.0, 1.0);
+            check_subcurve(curve, 0.3, 0.6);
+            check_subcurve(curve, 0.35, 0.5);
+
+            // Repeated internal knots leave empty spans.
+            knots << 0.0, 0.0, 0.0, 0.0, 0.5, 0.5, 1.0, 1.0, 1.0, 1.0;
+            auto curve2 = curve;
+            curve2.set_knots(knots);
+            check_subcurve(curve2, 0.1, 0.9);
+            check_subcurve(curve2, 0.5, 0.9);
+
+            REQUIRE_THROWS(curve.subcurve(0.7, 0.2, workspace));
+            REQUIRE_THROWS(curve.subcurve(0.2, 1.5, workspace));
+        }
+    }
+
+    SECTION("NURBS") {
+        Eigen::Matrix<Scalar, 3, 2> control_pts;
+        control_pts << 1.0, 0.0,
+                       1.0, 1.0,
+                       0.0, 1.0;
+        Eigen::Matrix<Scalar, 6, 1> knots;
+        knots << 0.0, 0.0, 0.0, 1.0, 1.0, 1.0;
+        Eigen::Matrix<Scalar, 3, 1> weights;
+        weights << 1.0, std::sqrt(2.0) / 2, 1.0;
+        NURBS<Scalar, 2, -1> curve;
+        curve.set_control_points(control_pts);
+        curve.set_knots(knots);
+        curve.set_weights(weights);
+        curve.initialize();
+
+        SECTION("Evaluation") {
+            validate_workspace_evaluation(curve, workspace, 10);
+        }
+
+        SECTION("Knot insertion") {
+            auto curve2 = curve;
+            curve2.insert_knot(0.5, 1, workspace);
+            REQUIRE(curve2.get_knots().size() == 7);
+            assert_same(curve, curve2, 10);
+        }
+    }
+}
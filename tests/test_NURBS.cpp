@@ -4,7 +4,6 @@
 #include <iostream>
 #include <nanospline/NURBS.h>
 #include <nanospline/save_svg.h>
-#include <nanospline/forward_declaration.h>
 
 #include "validation_utils.h"
 
@@ -46,10 +45,17 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Approximate inverse evaluate") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
     }
 
@@ -83,10 +89,17 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Approximate inverse evaluate") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
     }
 
@@ -135,10 +148,17 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
 
         SECTION("Approximate inverse evaluate") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
     }
 
@@ -178,9 +198,16 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
             SECTION("Derivative") {
                 validate_derivatives(curve, 10);
                 validate_2nd_derivatives(curve, 10);
+                validate_evaluate_derivatives(curve, 10);
+                validate_power_basis(curve, 10);
+            }
+
+            SECTION("Batch evaluation") {
+                validate_batch_evaluation(curve, 10);
             }
             SECTION("Approximate inverse evaluate") {
                 validate_approximate_inverse_evaluation(curve, 10);
+                validate_inverse_evaluation(curve, 10);
             }
             SECTION("Curvature") {
                 auto k = curve.evaluate_curvature(0.4);
@@ -196,10 +223,8 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
             }
 
             SECTION("Inflections") {
-#if NANOSPLINE_SYMPY
                 auto inflections = curve.compute_inflections(0, 1);
                 REQUIRE(inflections.size() == 0);
-#endif
             }
 
             SECTION("Degree elevation") {
@@ -250,9 +275,16 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
             SECTION("Derivative") {
                 validate_derivatives(curve, 10);
                 validate_2nd_derivatives(curve, 10);
+                validate_evaluate_derivatives(curve, 10);
+                validate_power_basis(curve, 10);
+            }
+
+            SECTION("Batch evaluation") {
+                validate_batch_evaluation(curve, 10);
             }
             SECTION("Approximate inverse evaluate") {
                 validate_approximate_inverse_evaluation(curve, 10);
+                validate_inverse_evaluation(curve, 10);
             }
 
             SECTION("Insert and remove knot") {
@@ -287,17 +319,13 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
             }
 
             SECTION("Inflections") {
-#if NANOSPLINE_SYMPY
                 auto inflections = curve.compute_inflections(0, 1);
                 REQUIRE(inflections.size() == 0);
-#endif
             }
 
             SECTION("Singularities") {
-#if NANOSPLINE_SYMPY
                 auto singular_pts = curve.compute_singularities(0, 1);
                 REQUIRE(singular_pts.size() == 0);
-#endif
             }
 
             SECTION("Degree elevation") {
@@ -308,7 +336,6 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
     }
 
     SECTION("Inflection points") {
-#if NANOSPLINE_SYMPY
         Eigen::Matrix<Scalar, 4, 2> ctrl_pts;
         ctrl_pts << 0.0, 0.0,
                     1.0, 1.0,
@@ -343,12 +370,11 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
 
         SECTION("Approximate inverse evaluate") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
-#endif
     }
 
     SECTION("Inflection points of closed NURBS curve") {
-#if NANOSPLINE_SYMPY
         Eigen::Matrix<Scalar, 14, 2> ctrl_pts;
         ctrl_pts << 1, 4, .5, 6, 5, 4, 3, 12, 11, 14, 8, 4, 12, 3, 11, 9, 15, 10, 17, 8,
                  1, 4, .5, 6, 5, 4, 3, 12 ;
@@ -387,7 +413,7 @@ TEST_CASE("NURBS", "[rational][nurbs][bspline]") {
 
         SECTION("Approximate inverse evaluate") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
-#endif
     }
 }
@@ -3,7 +3,6 @@
 
 #include <nanospline/NURBSPatch.h>
 #include <nanospline/save_obj.h>
-#include <nanospline/forward_declaration.h>
 
 #include "validation_utils.h"
 
@@ -50,6 +49,7 @@ TEST_CASE("NURBSPatch", "[rational][bspline_patch]") {
         REQUIRE(p_mid[2] == Approx(0.5));
 
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 10, 10);
     }
@@ -85,6 +85,7 @@ TEST_CASE("NURBSPatch", "[rational][bspline_patch]") {
 
         validate_iso_curves(patch, 10);
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 10, 10);
     }
@@ -140,6 +141,7 @@ TEST_CASE("NURBSPatch", "[rational][bspline_patch]") {
 
         validate_iso_curves(patch, 10);
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 10,10);
     }
@@ -197,6 +199,7 @@ TEST_CASE("NURBSPatch", "[rational][bspline_patch]") {
         REQUIRE(patch.get_degree_v() == 1);
         validate_iso_curves(patch, 10);
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
     }
 }
@@ -0,0 +1,137 @@
+#include <catch2/catch.hpp>
+
+#include <limits>
+
+#include <nanospline/BSplinePatch.h>
+#include <nanospline/BezierPatch.h>
+#include <nanospline/NURBSPatch.h>
+#include <nanospline/PatchProjector.h>
+
+namespace {
+
+template <typename PatchType>
+void validate_projector(const PatchType& patch, int num_queries)
+{
+    using namespace nanospline;
+    using Scalar = typename PatchType::Scalar;
+    using Point = typename PatchType::Point;
+    const PatchProjector<PatchType> projector(patch);
+
+    const Scalar u_min = patch.get_u_lower_bound();
+    const Scalar u_max = patch.get_u_upper_bound();
+    const Scalar v_min = patch.get_v_lower_bound();
+    const Scalar v_max = patch.get_v_upper_bound();
+
+    // Points on the patch project onto themselves.
+    for (int i=0; i<=num_queries; i++) {
+        for (int j=0; j<=num_queries; j++) {
+            const Scalar u = u_min + (u_max - u_min) * i / num_queries;
+            const Scalar v = v_min + (v_max - v_min) * j / num_queries;
+            const Point p = patch.evaluate(u, v);
+            const auto result = projector.project(p);
+            REQUIRE(result.distance == Approx(0.0).margin(1e-6));
+            REQUIRE((patch.evaluate(result.uv[0], result.uv[1]) - p).norm() ==
+                    Approx(0.0).margin(1e-6));
+        }
+    }
+
+    // Off-surface points are at least as close as a dense sampling.
+    constexpr int N = 100;
+    typename PatchProjector<PatchType>::PointMatrix samples((N + 1) * (N + 1), 3);
+    for (int i=0; i<=N; i++) {
+        for (int j=0; j<=N; j++) {
+            samples.row(i * (N + 1) + j) = patch.evaluate(
+                    u_min + (u_max - u_min) * i / N, v_min + (v_max - v_min) * j / N);
+        }
+    }
+    typename PatchProjector<PatchType>::PointMatrix queries(num_queries, 3);
+    queries.setRandom();
+    queries *= 2 * (samples.colwise().maxCoeff() - samples.colwise().minCoeff()).norm();
+    const auto uvs = projector.batch_inverse_evaluate(queries, 2);
+    for (int i=0; i<num_queries; i++) {
+        const Point q = queries.row(i);
+        const auto result = projector.project(q);
+        const Scalar brute_force = (samples.rowwise() - q).rowwise().norm().minCoeff();
+        REQUIRE(result.distance <= brute_force + 1e-9);
+        REQUIRE(result.uv[0] >= u_min);
+        REQUIRE(result.uv[0] <= u_max);
+        REQUIRE(result.uv[1] >= v_min);
+        REQUIRE(result.uv[1] <= v_max);
+        REQUIRE((patch.evaluate(result.uv[0], result.uv[1]) - q).norm() ==
+                Approx(result.distance));
+        REQUIRE(uvs(i, 0) == result.uv[0]);
+        REQUIRE(uvs(i, 1) == result.uv[1]);
+
+        // Warm-started from the answer itself.
+        const auto uv = projector.inverse_evaluate(q, result.uv, 0.01);
+        REQUIRE((patch.evaluate(uv[0], uv[1]) - q).norm() ==
+                Approx(result.distance).margin(1e-9));
+    }
+}
+
+}
+
+TEST_CASE("PatchProjector", "[patch_projector]") {
+    using namespace nanospline;
+    using Scalar = double;
+
+    Eigen::Matrix<Scalar, 25, 3> control_grid;
+    for (int i=0; i<5; i++) {
+        for (int j=0; j<5; j++) {
+            control_grid.row(i*5+j) << j, i, ((i+j)%2==0)?-1:1;
+        }
+    }
+
+    SECTION("Bezier patch") {
+        BezierPatch<Scalar, 3, 3, 3> patch;
+        Eigen::Matrix<Scalar, 16, 3> bezier_grid;
+        for (int i=0; i<4; i++) {
+            bezier_grid.middleRows(i*4, 4) = control_grid.middleRows(i*5, 4);
+        }
+        patch.set_control_grid(bezier_grid);
+        patch.initialize();
+
+        const PatchProjector<BezierPatch<Scalar, 3, 3, 3>> projector(patch, 2);
+        REQUIRE(projector.get_num_leaves() == 16);
+        validate_projector(patch, 10);
+    }
+
+    SECTION("B-spline patch") {
+        BSplinePatch<Scalar, 3, 3, 3> patch;
+        patch.set_control_grid(control_grid);
+        Eigen::Matrix<Scalar, 9, 1> knots_u, knots_v;
+        knots_u << 0.0, 0.0, 0.0, 0.0, 0.3, 1.0, 1.0, 1.0, 1.0;
+        knots_v << 0.0, 0.0, 0.0, 0.0, 1.5, 2.5, 2.5, 2.5, 2.5;
+        patch.set_knots_u(knots_u);
+        patch.set_knots_v(knots_v);
+        patch.initialize();
+
+        // 2x2 Bezier pieces, 4 leaves each.
+        const PatchProjector<BSplinePatch<Scalar, 3, 3, 3>> projector(patch, 1);
+        REQUIRE(projector.get_num_leaves() == 16);
+        validate_projector(patch, 10);
+    }
+
+    SECTION("NURBS patch") {
+        NURBSPatch<Scalar, 3, 3, 3> patch;
+        patch.set_control_grid(control_grid);
+        Eigen::Matrix<Scalar, 25, 1> weights;
+        weights.setRandom();
+        weights.array() += 1.5;
+        patch.set_weights(weights);
+        Eigen::Matrix<Scalar, 9, 1> knots_u, knots_v;
+        knots_u << 0.0, 0.0, 0.0, 0.0, 0.5, 1.0, 1.0, 1.0, 1.0;
+        knots_v << 0.0, 0.0, 0.0, 0.0, 0.5, 1.0, 1.0, 1.0, 1.0;
+        patch.set_knots_u(knots_u);
+        patch.set_knots_v(knots_v);
+        patch.initialize();
+        validate_projector(patch, 10);
+    }
+
+    SECTION("Uninitialized") {
+        PatchProjector<BezierPatch<Scalar, 3, 3, 3>> projector;
+        REQUIRE_THROWS(projector.project(Eigen::Matrix<Scalar, 1, 3>::Zero()));
+        REQUIRE_THROWS(projector.batch_inverse_evaluate(
+                    Eigen::Matrix<Scalar, 8, 3>::Zero(), 4));
+    }
+}
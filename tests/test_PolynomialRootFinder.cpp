@@ -0,0 +1,380 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include <Eigen/Eigenvalues>
+
+#include <nanospline/BatchPolynomialRootFinder.h>
+#include <nanospline/PolynomialRootFinder.h>
+
+namespace {
+
+// Power basis coefficients of prod_i (t - roots[i]).
+std::vector<double> from_roots(const std::vector<double>& roots)
+{
+    std::vector<double> coeffs{1.0};
+    for (const double r : roots) {
+        std::vector<double> next(coeffs.size() + 1, 0.0);
+        for (size_t j=0; j<coeffs.size(); j++) {
+            next[j] -= r * coeffs[j];
+            next[j+1] += coeffs[j];
+        }
+        coeffs.swap(next);
+    }
+    return coeffs;
+}
+
+// Real eigenvalues in [t0, t1] of the companion matrix of coeffs, with the
+// same realness test as PolynomialRootFinder, sorted and with roots closer
+// than margin merged.
+std::vector<double> companion_roots(const std::vector<double>& coeffs,
+        double t0, double t1, double eps, double margin)
+{
+    const int degree = static_cast<int>(coeffs.size()) - 1;
+    Eigen::MatrixXd companion = Eigen::MatrixXd::Zero(degree, degree);
+    for (int i=0; i<degree; i++) {
+        if (i > 0) companion(i, i-1) = 1.0;
+        companion(i, degree-1) = -coeffs[static_cast<size_t>(i)] / coeffs.back();
+    }
+    Eigen::EigenSolver<Eigen::MatrixXd> solver(companion, false);
+    std::vector<double> roots;
+    for (int i=0; i<degree; i++) {
+        const auto lambda = solver.eigenvalues()(i);
+        if (std::abs(std::abs(lambda) - std::abs(lambda.real())) > eps) continue;
+        if (lambda.real() >= t0 && lambda.real() <= t1) roots.push_back(lambda.real());
+    }
+    std::sort(roots.begin(), roots.end());
+    roots.erase(std::unique(roots.begin(), roots.end(), [margin](double a, double b) {
+        return std::abs(a - b) <= margin; }), roots.end());
+    return roots;
+}
+
+}
+
+TEST_CASE("BernsteinRootFinder", "[root_finder]") {
+    using namespace nanospline;
+    using Scalar = double;
+    constexpr Scalar eps = 1e-8;
+
+    SECTION("Simple roots up to degree 16") {
+        for (int degree=3; degree<=16; degree++) {
+            // Evenly spaced roots, half of them outside [0, 1].
+            std::vector<Scalar> expected_roots;
+            for (int i=0; i<degree; i++) {
+                expected_roots.push_back(-0.5 + 2.0 * (i + 0.5) / degree);
+            }
+            std::vector<Scalar> roots;
+            BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                    from_roots(expected_roots), roots, 0.0, 1.0, eps);
+
+            std::vector<Scalar> inside;
+            for (const Scalar r : expected_roots) {
+                if (r >= 0.0 && r <= 1.0) inside.push_back(r);
+            }
+            REQUIRE(roots.size() == inside.size());
+            for (size_t i=0; i<roots.size(); i++) {
+                REQUIRE(roots[i] == Approx(inside[i]).margin(1e-8));
+            }
+        }
+    }
+
+    SECTION("Complex roots are skipped") {
+        // (t^2 + 1) (t - 0.3) (t - 2.5)
+        std::vector<Scalar> coeffs = from_roots({0.3, 2.5});
+        std::vector<Scalar> product(coeffs.size() + 2, 0.0);
+        for (size_t j=0; j<coeffs.size(); j++) {
+            product[j] += coeffs[j];
+            product[j+2] += coeffs[j];
+        }
+        std::vector<Scalar> roots;
+        BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                product, roots, -1.0, 3.0, eps);
+        REQUIRE(roots.size() == 2);
+        REQUIRE(roots[0] == Approx(0.3));
+        REQUIRE(roots[1] == Approx(2.5));
+    }
+
+    SECTION("Double root") {
+        std::vector<Scalar> roots;
+        BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                from_roots({0.25, 0.6, 0.6}), roots, 0.0, 1.0, eps);
+        REQUIRE(roots.size() == 2);
+        REQUIRE(roots[0] == Approx(0.25));
+        REQUIRE(roots[1] == Approx(0.6).margin(1e-6));
+    }
+
+    SECTION("Squared polynomial") {
+        // Like the squared speed solved for singularities, nowhere negative.
+        std::vector<Scalar> roots;
+        BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                from_roots({0.3, 0.3, 0.7, 0.7, 1.2, 1.2}), roots, 0.0, 1.0, eps);
+        REQUIRE(roots.size() == 2);
+        REQUIRE(roots[0] == Approx(0.3).margin(1e-6));
+        REQUIRE(roots[1] == Approx(0.7).margin(1e-6));
+    }
+
+    SECTION("Roots at the interval ends") {
+        std::vector<Scalar> roots;
+        BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                from_roots({-1.0, 0.5, 2.0}), roots, -1.0, 0.5, eps);
+        REQUIRE(roots.size() == 2);
+        REQUIRE(roots[0] == Approx(-1.0));
+        REQUIRE(roots[1] == Approx(0.5));
+    }
+
+    SECTION("Vanishing leading coefficients") {
+        std::vector<Scalar> coeffs = from_roots({0.2, 0.7});
+        coeffs.resize(6, 0.0);
+        std::vector<Scalar> roots;
+        BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                coeffs, roots, 0.0, 1.0, eps);
+        REQUIRE(roots.size() == 2);
+        REQUIRE(roots[0] == Approx(0.2));
+        REQUIRE(roots[1] == Approx(0.7));
+
+        std::vector<Scalar> zero(4, 0.0);
+        REQUIRE_THROWS_AS(BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                zero, roots, 0.0, 1.0, eps), infinite_root_error);
+    }
+
+    SECTION("Agrees with the companion matrix") {
+        const std::vector<Scalar> coeffs = from_roots({-0.4, 0.1, 0.35, 0.8, 1.3});
+        std::vector<Scalar> companion_roots, bernstein_roots;
+        PolynomialRootFinder<Scalar, 5>::find_real_roots_in_interval(
+                coeffs, companion_roots, 0.0, 1.0, eps);
+        BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                coeffs, bernstein_roots, 0.0, 1.0, eps);
+        std::sort(companion_roots.begin(), companion_roots.end());
+        REQUIRE(companion_roots.size() == bernstein_roots.size());
+        for (size_t i=0; i<bernstein_roots.size(); i++) {
+            REQUIRE(bernstein_roots[i] == Approx(companion_roots[i]));
+        }
+    }
+}
+
+TEST_CASE("PolynomialRootFinder", "[root_finder]") {
+    using namespace nanospline;
+    using Scalar = double;
+    constexpr Scalar eps = 1e-8;
+
+    auto check_roots = [](std::vector<Scalar> roots, const std::vector<Scalar>& expected,
+            Scalar margin) {
+        std::sort(roots.begin(), roots.end());
+        roots.erase(std::unique(roots.begin(), roots.end(), [margin](Scalar a, Scalar b) {
+            return std::abs(a - b) <= margin; }), roots.end());
+        REQUIRE(roots.size() == expected.size());
+        for (size_t i=0; i<roots.size(); i++) {
+            REQUIRE(roots[i] == Approx(expected[i]).margin(margin));
+        }
+    };
+
+    SECTION("Cubic") {
+        std::vector<Scalar> roots;
+        PolynomialRootFinder<Scalar, 3>::find_real_roots_in_interval(
+                from_roots({0.1, 0.5, 0.9}), roots, 0.0, 1.0, eps);
+        check_roots(roots, {0.1, 0.5, 0.9}, 1e-12);
+
+        // One real root: (t - 0.4) (t^2 + 1).
+        roots.clear();
+        PolynomialRootFinder<Scalar, 3>::find_real_roots_in_interval(
+                {-0.4, 1.0, -0.4, 1.0}, roots, 0.0, 1.0, eps);
+        check_roots(roots, {0.4}, 1e-12);
+
+        // Roots outside of the interval are dropped.
+        roots.clear();
+        PolynomialRootFinder<Scalar, 3>::find_real_roots_in_interval(
+                from_roots({-2.0, 0.5, 3.0}), roots, 0.0, 1.0, eps);
+        check_roots(roots, {0.5}, 1e-12);
+    }
+
+    SECTION("Quartic") {
+        std::vector<Scalar> roots;
+        PolynomialRootFinder<Scalar, 4>::find_real_roots_in_interval(
+                from_roots({0.1, 0.35, 0.6, 0.95}), roots, 0.0, 1.0, eps);
+        check_roots(roots, {0.1, 0.35, 0.6, 0.95}, 1e-12);
+
+        // Biquadratic: (t^2 - 0.25) (t^2 + 1).
+        roots.clear();
+        PolynomialRootFinder<Scalar, 4>::find_real_roots_in_interval(
+                {-0.25, 0.0, 0.75, 0.0, 1.0}, roots, -1.0, 1.0, eps);
+        check_roots(roots, {-0.5, 0.5}, 1e-12);
+
+        // No real root: (t^2 + 1) (t^2 + 2).
+        roots.clear();
+        PolynomialRootFinder<Scalar, 4>::find_real_roots_in_interval(
+                {2.0, 0.0, 3.0, 0.0, 1.0}, roots, -10.0, 10.0, eps);
+        REQUIRE(roots.empty());
+
+        roots.clear();
+        PolynomialRootFinder<Scalar, 4>::find_real_roots_in_interval(
+                {0.0, 1.0, -3.0, 0.0, 1e-12}, roots, -1.0, 1.0, eps);
+        check_roots(roots, {0.0, 1.0 / 3.0}, 1e-12);
+    }
+
+    SECTION("Above degree 4") {
+        // Solved by BernsteinRootFinder if NANOSPLINE_BERNSTEIN_ROOT_FINDER
+        // is defined (see the nanospline_bernstein_test target), with the
+        // companion matrix otherwise.
+        std::vector<Scalar> roots;
+        PolynomialRootFinder<Scalar, 5>::find_real_roots_in_interval(
+                from_roots({-0.4, 0.1, 0.35, 0.8, 1.3}), roots, 0.0, 1.0, eps);
+        check_roots(roots, {0.1, 0.35, 0.8}, 1e-9);
+
+        roots.clear();
+        PolynomialRootFinder<Scalar, 8>::find_real_roots_in_interval(
+                from_roots({-0.9, -0.5, -0.2, 0.05, 0.3, 0.55, 0.7, 0.95}),
+                roots, -1.0, 1.0, eps);
+        check_roots(roots, {-0.9, -0.5, -0.2, 0.05, 0.3, 0.55, 0.7, 0.95}, 1e-8);
+
+        // Only the real roots count: (t^2 + 1) (t - 0.25) (t - 0.5) (t - 0.75).
+        std::vector<Scalar> coeffs = from_roots({0.25, 0.5, 0.75});
+        std::vector<Scalar> with_complex(coeffs.size() + 2, 0.0);
+        for (size_t j=0; j<coeffs.size(); j++) {
+            with_complex[j] += coeffs[j];
+            with_complex[j+2] += coeffs[j];
+        }
+        roots.clear();
+        PolynomialRootFinder<Scalar, 5>::find_real_roots_in_interval(
+                with_complex, roots, -2.0, 2.0, eps);
+        check_roots(roots, {0.25, 0.5, 0.75}, 1e-9);
+
+        // A vanishing leading coefficient drops the degree.
+        coeffs = from_roots({0.2, 0.4, 0.6, 0.8, 0.9});
+        coeffs.push_back(0.0);
+        roots.clear();
+        PolynomialRootFinder<Scalar, 6>::find_real_roots_in_interval(
+                coeffs, roots, 0.0, 1.0, eps);
+        check_roots(roots, {0.2, 0.4, 0.6, 0.8, 0.9}, 1e-9);
+    }
+
+    SECTION("Double roots agree with the companion matrix") {
+        // Rounding turns a double root into a pair of close real roots or a
+        // complex pair with an imaginary part of about sqrt(ulp).  Squared
+        // speed polynomials of curves with cusps look like this.
+        constexpr Scalar margin = 1e-5;
+        auto check = [&](const std::vector<Scalar>& true_roots, Scalar scale) {
+            std::vector<Scalar> coeffs = from_roots(true_roots);
+            for (auto& c : coeffs) c *= scale;
+            const std::vector<Scalar> expected =
+                companion_roots(coeffs, 0.0, 1.0, eps, margin);
+            REQUIRE(expected.size() == 2);
+            std::vector<Scalar> roots;
+            if (true_roots.size() == 3) {
+                PolynomialRootFinder<Scalar, 3>::find_real_roots_in_interval(
+                        coeffs, roots, 0.0, 1.0, eps);
+            } else {
+                PolynomialRootFinder<Scalar, 4>::find_real_roots_in_interval(
+                        coeffs, roots, 0.0, 1.0, eps);
+            }
+            check_roots(roots, expected, margin);
+        };
+
+        check({0.4, 0.4, 0.2}, 1.0);
+        check({0.5, 0.5, 0.6}, 1.0);
+        check({0.5, 0.5, 0.9}, 1.0);
+        check({0.5, 0.5, 0.8, 0.8}, 1.0);
+        check({0.6, 0.6, 0.8, 0.8}, 1.0);
+        check({0.7, 0.7, 0.9, 0.9}, 1.0);
+        check({0.8, 0.8, 0.9, 0.9}, 1.0);
+
+        std::srand(11);
+        for (int i=0; i<500; i++) {
+            const Eigen::Matrix<Scalar, 3, 1> r =
+                (Eigen::Matrix<Scalar, 3, 1>::Random().array() + 1) / 2;
+            const Scalar a = 0.05 + 0.9 * r[0];
+            const Scalar b = 0.05 + 0.9 * r[1];
+            const Scalar scale = 0.1 + 2 * r[2];
+            // Keep the roots apart so that both solvers resolve them.
+            if (std::abs(a - b) < 0.05) continue;
+            check({a, a, b}, scale);
+            check({a, a, b, b}, -scale);
+        }
+    }
+
+    SECTION("Agrees with the Bernstein root finder") {
+        std::srand(7);
+        for (int i=0; i<200; i++) {
+            const Eigen::Matrix<Scalar, 5, 1> c = Eigen::Matrix<Scalar, 5, 1>::Random();
+            const std::vector<Scalar> coeffs(c.data(), c.data() + 5);
+            std::vector<Scalar> quartic_roots, cubic_roots, expected;
+            PolynomialRootFinder<Scalar, 4>::find_real_roots_in_interval(
+                    coeffs, quartic_roots, -1.0, 1.0, eps);
+            BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                    coeffs, expected, -1.0, 1.0, eps);
+            check_roots(quartic_roots, expected, 1e-9);
+
+            const std::vector<Scalar> cubic(coeffs.begin(), coeffs.begin() + 4);
+            expected.clear();
+            PolynomialRootFinder<Scalar, 3>::find_real_roots_in_interval(
+                    cubic, cubic_roots, -1.0, 1.0, eps);
+            BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                    cubic, expected, -1.0, 1.0, eps);
+            check_roots(cubic_roots, expected, 1e-9);
+        }
+    }
+}
+
+TEST_CASE("BatchPolynomialRootFinder", "[root_finder]") {
+    using namespace nanospline;
+    using Scalar = double;
+    constexpr Scalar eps = 1e-8;
+    constexpr int num_polynomials = 100;
+
+    for (const int degree : {3, 4, 7}) {
+        std::srand(11);
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 1> c =
+            Eigen::Matrix<Scalar, Eigen::Dynamic, 1>::Random((degree + 1) * num_polynomials);
+        std::vector<Scalar> coeffs(c.data(), c.data() + c.size());
+        // One polynomial vanishes identically.
+        std::fill(coeffs.begin(), coeffs.begin() + degree + 1, 0.0);
+
+        std::vector<int> offsets, offsets_serial;
+        std::vector<Scalar> roots, roots_serial;
+        BatchPolynomialRootFinder<Scalar>::find_real_roots_in_interval(
+                degree, coeffs, offsets, roots, -1.0, 1.0, eps, 4);
+        BatchPolynomialRootFinder<Scalar>::find_real_roots_in_interval(
+                degree, coeffs, offsets_serial, roots_serial, -1.0, 1.0, eps, 1);
+        REQUIRE(offsets == offsets_serial);
+        REQUIRE(roots == roots_serial);
+        REQUIRE(offsets.size() == num_polynomials + 1);
+        REQUIRE(offsets[1] == 0);
+
+        for (int i=1; i<num_polynomials; i++) {
+            const std::vector<Scalar> poly(coeffs.begin() + (degree + 1) * i,
+                    coeffs.begin() + (degree + 1) * (i + 1));
+            std::vector<Scalar> expected;
+            BernsteinRootFinder<Scalar>::find_real_roots_in_interval(
+                    poly, expected, -1.0, 1.0, eps);
+            REQUIRE(offsets[i + 1] - offsets[i] == static_cast<int>(expected.size()));
+            for (size_t k=0; k<expected.size(); k++) {
+                REQUIRE(roots[static_cast<size_t>(offsets[i]) + k] ==
+                        Approx(expected[k]).margin(1e-9));
+            }
+        }
+
+        // The same polynomials in Bernstein form over [-1, 1].
+        std::vector<Scalar> bernstein;
+        for (int i=0; i<num_polynomials; i++) {
+            const std::vector<Scalar> poly(coeffs.begin() + (degree + 1) * i,
+                    coeffs.begin() + (degree + 1) * (i + 1));
+            const auto b = internal::power_to_bernstein(poly, -1.0, 1.0);
+            bernstein.insert(bernstein.end(), b.begin(), b.end());
+        }
+        std::vector<Scalar> bernstein_roots;
+        BatchPolynomialRootFinder<Scalar>::find_real_roots_in_bernstein_form(
+                degree, bernstein, offsets_serial, bernstein_roots, -1.0, 1.0, eps);
+        REQUIRE(offsets_serial == offsets);
+        for (size_t k=0; k<roots.size(); k++) {
+            REQUIRE(bernstein_roots[k] == Approx(roots[k]).margin(1e-9));
+        }
+    }
+
+    std::vector<int> offsets;
+    std::vector<Scalar> roots;
+    REQUIRE_THROWS_AS(BatchPolynomialRootFinder<Scalar>::find_real_roots_in_interval(
+            3, std::vector<Scalar>(5, 1.0), offsets, roots, 0.0, 1.0, eps),
+            invalid_setting_error);
+}
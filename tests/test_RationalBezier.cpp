@@ -4,7 +4,6 @@
 
 #include <nanospline/RationalBezier.h>
 #include <nanospline/save_svg.h>
-#include <nanospline/forward_declaration.h>
 
 #include "validation_utils.h"
 
@@ -34,6 +33,12 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
         SECTION("Curvature") {
             auto k = curve.evaluate_curvature(0.4);
@@ -46,6 +51,7 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
         }
         SECTION("Approximate inverse evaluate") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
     }
 
@@ -72,18 +78,22 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
         SECTION("Derivative") {
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
+        }
+
+        SECTION("Batch evaluation") {
+            validate_batch_evaluation(curve, 10);
         }
         SECTION("Curvature") {
             auto k = curve.evaluate_curvature(0.4);
             REQUIRE(k.norm() == Approx(0.0));
         }
         SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
             const auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(total_turning_angle == Approx(0));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
             REQUIRE(split_pts.size() == 0);
-#endif
         }
         SECTION("Degree elevation") {
             const auto new_curve = curve.elevate_degree();
@@ -92,6 +102,7 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
         }
         SECTION("Approximate inverse evaluate") {
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
         }
     }
 
@@ -122,9 +133,11 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
             assert_same(curve, regular_bezier, 10);
             validate_derivatives(curve, 10);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
 
-#if NANOSPLINE_SYMPY
             const auto total_turning_angle = curve.get_turning_angle(0, 1);
             REQUIRE(std::abs(total_turning_angle) == Approx(M_PI/2));
             const auto split_pts = curve.reduce_turning_angle(0, 1);
@@ -136,7 +149,6 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
 
             const auto singular_pts = curve.compute_singularities(0, 1);
             REQUIRE(singular_pts.size() == 0);
-#endif
 
             const auto new_curve = curve.elevate_degree();
             REQUIRE(new_curve.get_degree() == curve.get_degree()+1);
@@ -168,9 +180,11 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
             REQUIRE((end-control_pts.row(2)).norm() == Approx(0.0));
             validate_derivatives(curve, 10, 1e-5);
             validate_2nd_derivatives(curve, 10);
+            validate_evaluate_derivatives(curve, 10);
+            validate_power_basis(curve, 10);
             validate_approximate_inverse_evaluation(curve, 10);
+            validate_inverse_evaluation(curve, 10);
 
-#if NANOSPLINE_SYMPY
             const auto split_pts = curve.reduce_turning_angle(0, 1);
             if (weights[1] > 0) {
                 REQUIRE(split_pts.size() == 1);
@@ -190,7 +204,6 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
             } else {
                 REQUIRE(singular_pts.size() == 0);
             }
-#endif
 
             const auto new_curve = curve.elevate_degree();
             REQUIRE(new_curve.get_degree() == curve.get_degree()+1);
@@ -224,9 +237,16 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
             SECTION("Derivative") {
                 validate_derivatives(curve, 10);
                 validate_2nd_derivatives(curve, 10);
+                validate_evaluate_derivatives(curve, 10);
+                validate_power_basis(curve, 10);
+            }
+
+            SECTION("Batch evaluation") {
+                validate_batch_evaluation(curve, 10);
             }
             SECTION("Approximate inverse evaluate") {
                 validate_approximate_inverse_evaluation(curve, 10);
+                validate_inverse_evaluation(curve, 10);
             }
             SECTION("Curvature") {
                 auto k = curve.evaluate_curvature(0.4);
@@ -241,7 +261,6 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
                 REQUIRE(k.norm() == Approx(1.0/R));
             }
             SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
                 const auto total_turning_angle = curve.get_turning_angle(0, 1);
                 REQUIRE(std::abs(total_turning_angle) == Approx(M_PI/2));
                 const auto split_pts = curve.reduce_turning_angle(0, 1);
@@ -250,7 +269,6 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
                 const auto turning_angle_2 = curve.get_turning_angle(split_pts[0], 1);
                 REQUIRE(std::abs(turning_angle_1) == Approx(M_PI/4));
                 REQUIRE(std::abs(turning_angle_2) == Approx(M_PI/4));
-#endif
             }
             SECTION("Degree elevation") {
                 const auto new_curve = curve.elevate_degree();
@@ -283,9 +301,16 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
             SECTION("Derivative") {
                 validate_derivatives(curve, 10);
                 validate_2nd_derivatives(curve, 10);
+                validate_evaluate_derivatives(curve, 10);
+                validate_power_basis(curve, 10);
+            }
+
+            SECTION("Batch evaluation") {
+                validate_batch_evaluation(curve, 10);
             }
             SECTION("Approximate inverse evaluate") {
                 validate_approximate_inverse_evaluation(curve, 10);
+                validate_inverse_evaluation(curve, 10);
             }
             SECTION("Curvature") {
                 auto k = curve.evaluate_curvature(0.4);
@@ -300,7 +325,6 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
                 REQUIRE(k.norm() == Approx(1.0/R));
             }
             SECTION("Turning angle") {
-#if NANOSPLINE_SYMPY
                 const auto total_turning_angle = curve.get_turning_angle(0, 1);
                 REQUIRE(std::abs(total_turning_angle) == Approx(2*M_PI/3));
                 const auto split_pts = curve.reduce_turning_angle(0, 1);
@@ -309,7 +333,6 @@ TEST_CASE("RationalBezier", "[rational][bezier]") {
                 const auto turning_angle_2 = curve.get_turning_angle(split_pts[0], 1);
                 REQUIRE(std::abs(turning_angle_1) == Approx(2*M_PI/6));
                 REQUIRE(std::abs(turning_angle_2) == Approx(2*M_PI/6));
-#endif
             }
             SECTION("Degree elevation") {
                 const auto new_curve = curve.elevate_degree();
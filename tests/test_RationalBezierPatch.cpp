@@ -3,7 +3,6 @@
 #include <iostream>
 
 #include <nanospline/RationalBezierPatch.h>
-#include <nanospline/forward_declaration.h>
 
 #include "validation_utils.h"
 
@@ -43,6 +42,7 @@ TEST_CASE("RationalBezierPatch", "[rational][rational_bezier_patch]") {
         REQUIRE(p_mid[2] == Approx(0.5));
 
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 10, 10);
     }
@@ -86,6 +86,7 @@ TEST_CASE("RationalBezierPatch", "[rational][rational_bezier_patch]") {
         REQUIRE((corner_11 - control_grid.row(15)).norm() == Approx(0.0));
 
         validate_derivative(patch, 10, 10);
+        validate_evaluate_all(patch, 10, 10);
         validate_iso_curves(patch, 10);
         validate_inverse_evaluation(patch, 10, 10);
         validate_inverse_evaluation_3d(patch, 10, 10);
@@ -0,0 +1,109 @@
+// Built into nanospline_no_malloc_test with EIGEN_RUNTIME_NO_MALLOC, see
+// CMakeLists.txt.  Elsewhere there is nothing to check.
+#ifdef EIGEN_RUNTIME_NO_MALLOC
+
+#include <stdexcept>
+
+// Report a forbidden allocation as an exception, in release builds too.
+#define eigen_assert(x) ((x) ? (void)0 : throw std::logic_error(#x))
+
+#include <catch2/catch.hpp>
+
+#include <nanospline/BSpline.h>
+#include <nanospline/Bezier.h>
+#include <nanospline/NURBS.h>
+#include <nanospline/RationalBezier.h>
+#include <nanospline/generic_algorithms.h>
+
+namespace {
+
+struct NoMallocScope {
+    NoMallocScope() { Eigen::internal::set_is_malloc_allowed(false); }
+    ~NoMallocScope() { Eigen::internal::set_is_malloc_allowed(true); }
+};
+
+template<typename CurveType>
+void check_no_allocation(const CurveType& curve) {
+    using Scalar = typename CurveType::Scalar;
+    using Point = typename CurveType::Point;
+    const typename CurveType::Base& base = curve;
+    const Scalar lower = curve.get_domain_lower_bound();
+    const Scalar upper = curve.get_domain_upper_bound();
+    const Scalar t = lower + (upper - lower) * Scalar(0.35);
+    const Point p = curve.evaluate(t) + Point::Constant(Scalar(0.01));
+    typename CurveType::DerivativeMatrix ders;
+
+    NoMallocScope scope;
+    REQUIRE_NOTHROW(curve.evaluate_derivatives(t, 2, ders));
+    REQUIRE_NOTHROW(base.evaluate_derivatives(t, 2, ders));
+    REQUIRE_NOTHROW(nanospline::evaluate_curvature(curve, t));
+    REQUIRE_NOTHROW(base.evaluate_curvature(t));
+    REQUIRE_NOTHROW(nanospline::newton_raphson(curve, p, t, 20, Scalar(1e-12), lower, upper));
+    Scalar t_local = 0;
+    REQUIRE_NOTHROW(nanospline::local_inverse_evaluate(
+                curve, p, t, Scalar(0.1) * (upper - lower), t_local));
+}
+
+}
+
+TEST_CASE("no_allocation", "[generic_algorithms][allocation]") {
+    using namespace nanospline;
+    using Scalar = double;
+
+    Eigen::Matrix<Scalar, 4, 2> ctrl_pts;
+    ctrl_pts << 0.0, 0.0,
+                1.0, 2.0,
+                2.0, -1.0,
+                3.0, 0.5;
+    Eigen::Matrix<Scalar, 4, 1> weights;
+    weights << 1.0, 2.0, 0.5, 1.0;
+
+    SECTION("Bezier") {
+        Bezier<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        check_no_allocation(curve);
+    }
+
+    SECTION("Bezier with power basis") {
+        Bezier<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_evaluation_mode(EvaluationMode::PowerBasis);
+        check_no_allocation(curve);
+    }
+
+    SECTION("Generic Bezier") {
+        Bezier<Scalar, 2, -1> curve;
+        curve.set_control_points(ctrl_pts);
+        check_no_allocation(curve);
+    }
+
+    SECTION("BSpline") {
+        Eigen::Matrix<Scalar, 8, 1> knots;
+        knots << 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0;
+        BSpline<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+        check_no_allocation(curve);
+    }
+
+    SECTION("RationalBezier") {
+        RationalBezier<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_weights(weights);
+        curve.initialize();
+        check_no_allocation(curve);
+    }
+
+    SECTION("NURBS") {
+        Eigen::Matrix<Scalar, 8, 1> knots;
+        knots << 0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0;
+        NURBS<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+        curve.set_weights(weights);
+        curve.initialize();
+        check_no_allocation(curve);
+    }
+}
+
+#endif
@@ -2,7 +2,6 @@
 
 #include <nanospline/conversion.h>
 #include <nanospline/save_svg.h>
-#include <nanospline/forward_declaration.h>
 #include "validation_utils.h"
 
 TEST_CASE("conversion", "[conversion]") {
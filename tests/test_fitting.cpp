@@ -7,7 +7,6 @@
 #include <nanospline/BSplinePatch.h>
 #include <nanospline/Bezier.h>
 #include <nanospline/BezierPatch.h>
-#include <nanospline/forward_declaration.h>
 #include <nanospline/save_svg.h>
 #include <Eigen/Core>
 #include <Eigen/Dense>
@@ -0,0 +1,316 @@
+#include <catch2/catch.hpp>
+
+#include <nanospline/BSpline.h>
+#include <nanospline/Bezier.h>
+#include <nanospline/BezierPatch.h>
+#include <nanospline/generic_algorithms.h>
+
+TEST_CASE("generic_algorithms", "[generic_algorithms]") {
+    using namespace nanospline;
+    using Scalar = double;
+
+    SECTION("Bezier") {
+        Eigen::Matrix<Scalar, 4, 2> ctrl_pts;
+        ctrl_pts << 0.0, 0.0,
+                    1.0, 2.0,
+                    2.0, -1.0,
+                    3.0, 0.5;
+        Bezier<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        const CurveBase<Scalar, 2>& base = curve;
+
+        for (int i=0; i<=10; i++) {
+            const Scalar t = Scalar(i) / 10;
+            REQUIRE((nanospline::evaluate_curvature(curve, t) -
+                        base.evaluate_curvature(t)).norm() == Approx(0.0));
+        }
+
+        // Static and virtual dispatch run the same code.
+        const Scalar t0 = 0.2, t1 = 0.4;
+        REQUIRE(nanospline::get_turning_angle(curve, t0, t1) ==
+                Approx(base.CurveBase<Scalar, 2>::get_turning_angle(t0, t1)));
+
+        const Scalar t = 0.35;
+        const Eigen::Matrix<Scalar, 1, 2> p = curve.evaluate(t);
+        const Scalar t_approx = nanospline::approximate_inverse_evaluate(
+                curve, p, 10, 0.0, 1.0, 3);
+        REQUIRE(t_approx == Approx(t).margin(1e-6));
+        REQUIRE(t_approx == Approx(base.approximate_inverse_evaluate(p)));
+
+        const Scalar t_newton = nanospline::newton_raphson(
+                curve, p, 0.3, 20, 1e-12, 0.0, 1.0);
+        REQUIRE(t_newton == Approx(t).margin(1e-6));
+
+        // The closed-form derivatives match the de Casteljau ones.
+        Bezier<Scalar, 2, -1> generic_curve;
+        generic_curve.set_control_points(ctrl_pts);
+        Bezier<Scalar, 2, 3>::DerivativeMatrix ders;
+        for (int k=0; k<=2; k++) {
+            curve.evaluate_derivatives(t, k, ders);
+            const auto expected = generic_curve.evaluate_derivatives(t, k);
+            REQUIRE(ders.rows() == k+1);
+            REQUIRE((ders - expected).norm() == Approx(0.0).margin(1e-12));
+        }
+        REQUIRE_THROWS(curve.evaluate_derivatives(t, 3, ders));
+    }
+
+    SECTION("BSpline") {
+        Eigen::Matrix<Scalar, 5, 3> ctrl_pts;
+        ctrl_pts << 0.0, 0.0, 0.0,
+                    1.0, 1.0, 0.0,
+                    2.0, 0.0, 1.0,
+                    3.0, 1.0, 1.0,
+                    4.0, 0.0, 0.0;
+        Eigen::Matrix<Scalar, 9, 1> knots;
+        knots << 0.0, 0.0, 0.0, 0.0, 0.5, 1.0, 1.0, 1.0, 1.0;
+        BSpline<Scalar, 3, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+        const CurveBase<Scalar, 3>& base = curve;
+
+        for (int i=0; i<=10; i++) {
+            const Scalar t = Scalar(i) / 10;
+            REQUIRE((nanospline::evaluate_curvature(curve, t) -
+                        base.evaluate_curvature(t)).norm() == Approx(0.0));
+        }
+
+        const Scalar t = 0.7;
+        const Eigen::Matrix<Scalar, 1, 3> p = curve.evaluate(t);
+        const Scalar t_approx = nanospline::approximate_inverse_evaluate(
+                curve, p, 10, 0.0, 1.0, 3);
+        REQUIRE(t_approx == Approx(t).margin(1e-6));
+        REQUIRE(t_approx == Approx(base.approximate_inverse_evaluate(p)));
+
+        REQUIRE_THROWS(nanospline::get_turning_angle(curve, 0.1, 0.2));
+
+        BSpline<Scalar, 3, 3>::DerivativeMatrix ders;
+        curve.evaluate_derivatives(t, 2, ders);
+        REQUIRE((ders - curve.evaluate_derivatives(t, 2)).norm() ==
+                Approx(0.0).margin(1e-12));
+    }
+
+    SECTION("BezierPatch") {
+        BezierPatch<Scalar, 3, 2, 2> patch;
+        Eigen::Matrix<Scalar, 9, 3> control_grid;
+        control_grid <<
+            0.0, 0.0, 0.0,
+            0.0, 0.5, 0.5,
+            0.0, 1.0, 0.0,
+            0.5, 0.0, 0.5,
+            0.5, 0.5, 1.0,
+            0.5, 1.0, 0.5,
+            1.0, 0.0, 0.0,
+            1.0, 0.5, 0.5,
+            1.0, 1.0, 0.0;
+        patch.set_control_grid(control_grid);
+        patch.initialize();
+        const PatchBase<Scalar, 3>& base = patch;
+
+        const Eigen::Matrix<Scalar, 1, 3> p = patch.evaluate(0.3, 0.6);
+        const Eigen::Matrix<Scalar, 1, 2> uv0(0.5, 0.5);
+        const auto uv = nanospline::newton_raphson(
+                patch, p, uv0, 20, 1e-12, 0.0, 1.0, 0.0, 1.0);
+        REQUIRE(uv[0] == Approx(0.3).margin(1e-6));
+        REQUIRE(uv[1] == Approx(0.6).margin(1e-6));
+
+        const auto uv_base = base.inverse_evaluate(p, 0.0, 1.0, 0.0, 1.0);
+        REQUIRE((uv - uv_base).norm() == Approx(0.0).margin(1e-6));
+    }
+
+    SECTION("Trust region Newton-Raphson") {
+        BezierPatch<Scalar, 3, 3, 3> patch;
+        Eigen::Matrix<Scalar, 16, 3> control_grid;
+        for (int i=0; i<4; i++) {
+            for (int j=0; j<4; j++) {
+                control_grid.row(i*4+j) << j, i, ((i+j)%2==0)?-1:1;
+            }
+        }
+        patch.set_control_grid(control_grid);
+        patch.initialize();
+        const PatchBase<Scalar, 3>& base = patch;
+        using UVPoint = Eigen::Matrix<Scalar, 1, 2>;
+
+        // A point on the patch, from a distant start.
+        const Eigen::Matrix<Scalar, 1, 3> p = patch.evaluate(0.3, 0.6);
+        auto result = nanospline::trust_region_newton_raphson(
+                patch, p, UVPoint(0.9, 0.1), 0.0, 1.0, 0.0, 1.0);
+        REQUIRE(result.converged);
+        REQUIRE(result.residual == Approx(0.0).margin(1e-12));
+        REQUIRE(result.num_iterations > 0);
+        REQUIRE(result.num_iterations <= 20);
+        REQUIRE(result.uv[0] == Approx(0.3).margin(1e-8));
+        REQUIRE(result.uv[1] == Approx(0.6).margin(1e-8));
+
+        const auto base_result = base.trust_region_newton_raphson(
+                p, UVPoint(0.9, 0.1), 0.0, 1.0, 0.0, 1.0);
+        REQUIRE((base_result.uv - result.uv).norm() == 0.0);
+        REQUIRE(base_result.num_iterations == result.num_iterations);
+
+        // Off the patch: the residual is orthogonal to both tangents.
+        const Eigen::Matrix<Scalar, 1, 3> n =
+            patch.evaluate_derivative_u(0.4, 0.5).cross(
+                    patch.evaluate_derivative_v(0.4, 0.5)).normalized();
+        const Eigen::Matrix<Scalar, 1, 3> q = patch.evaluate(0.4, 0.5) + 0.05 * n;
+        result = nanospline::trust_region_newton_raphson(
+                patch, q, UVPoint(0.5, 0.5), 0.0, 1.0, 0.0, 1.0);
+        REQUIRE(result.converged);
+        REQUIRE(result.residual == Approx(0.05).margin(1e-8));
+        REQUIRE(result.uv[0] == Approx(0.4).margin(1e-6));
+        REQUIRE(result.uv[1] == Approx(0.5).margin(1e-6));
+
+        // Closest point at a corner of the domain: both parameters are held.
+        const Eigen::Matrix<Scalar, 1, 3> corner(-1.0, -1.0, -2.0);
+        result = nanospline::trust_region_newton_raphson(
+                patch, corner, UVPoint(0.2, 0.2), 0.0, 1.0, 0.0, 1.0);
+        REQUIRE(result.converged);
+        REQUIRE(result.uv[0] == 0.0);
+        REQUIRE(result.uv[1] == 0.0);
+        REQUIRE(result.residual == Approx((corner - patch.evaluate(0.0, 0.0)).norm()));
+
+        // The iteration budget is respected.
+        NewtonRaphsonSettings<Scalar> settings;
+        settings.max_iterations = 1;
+        result = nanospline::trust_region_newton_raphson(
+                patch, p, UVPoint(0.9, 0.1), 0.0, 1.0, 0.0, 1.0, settings);
+        REQUIRE(!result.converged);
+        REQUIRE(result.num_iterations == 1);
+        REQUIRE(result.residual == Approx(
+                    (patch.evaluate(result.uv[0], result.uv[1]) - p).norm()));
+    }
+}
+
+TEST_CASE("Warm-started inverse evaluation", "[generic_algorithms][warm_start]") {
+    using namespace nanospline;
+    using Scalar = double;
+
+    SECTION("BSpline") {
+        Eigen::Matrix<Scalar, 5, 2> ctrl_pts;
+        ctrl_pts << 0.0, 0.0,
+                    1.0, 2.0,
+                    2.0, -1.0,
+                    3.0, 2.0,
+                    4.0, 0.0;
+        Eigen::Matrix<Scalar, 9, 1> knots;
+        knots << 0.0, 0.0, 0.0, 0.0, 0.5, 1.0, 1.0, 1.0, 1.0;
+        BSpline<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+
+        // A point moving along the curve, slightly off to one side.
+        constexpr int num_frames = 51;
+        Eigen::Matrix<Scalar, num_frames, 2> track;
+        for (int i=0; i<num_frames; i++) {
+            const Scalar t = Scalar(i) / (num_frames - 1);
+            const Eigen::Matrix<Scalar, 1, 2> d = curve.evaluate_derivative(t);
+            track.row(i) = curve.evaluate(t) +
+                Eigen::Matrix<Scalar, 1, 2>(-d[1], d[0]).normalized() * 0.01;
+        }
+
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 1> ts;
+        curve.batch_inverse_evaluate(track, 0.0, 0.05, ts);
+        REQUIRE(ts.size() == num_frames);
+        for (int i=0; i<num_frames; i++) {
+            const Eigen::Matrix<Scalar, 1, 2> p = track.row(i);
+            REQUIRE(ts[i] == Approx(curve.inverse_evaluate(p)).margin(1e-8));
+            if (i > 0) {
+                Scalar t;
+                REQUIRE(nanospline::local_inverse_evaluate(curve, p, ts[i-1], 0.05, t));
+                REQUIRE(t == Approx(ts[i]).margin(1e-10));
+            }
+        }
+
+        // A point moving exactly on the curve.
+        for (int i=1; i<num_frames; i++) {
+            const Scalar prev_t = Scalar(i-1) / (num_frames - 1);
+            const Scalar curr_t = Scalar(i) / (num_frames - 1);
+            const Eigen::Matrix<Scalar, 1, 2> p = curve.evaluate(curr_t);
+            Scalar t;
+            REQUIRE(nanospline::local_inverse_evaluate(curve, p, prev_t, 0.05, t));
+            REQUIRE(t == Approx(curr_t).margin(1e-10));
+        }
+
+        // The guess is too far off to reach the closest point: fall back to
+        // the global search.
+        const Eigen::Matrix<Scalar, 1, 2> p = track.row(5);
+        Scalar t;
+        REQUIRE(!nanospline::local_inverse_evaluate(curve, p, 0.9, 0.01, t));
+        REQUIRE(!nanospline::local_inverse_evaluate(curve, p, 5.0, 0.1, t));
+        REQUIRE(curve.inverse_evaluate(p, 0.9, 0.01) ==
+                Approx(curve.inverse_evaluate(p)).margin(1e-10));
+
+        // A closest point at the end of the domain.
+        const Eigen::Matrix<Scalar, 1, 2> beyond(5.0, 0.0);
+        REQUIRE(nanospline::local_inverse_evaluate(curve, beyond, 0.95, 0.1, t));
+        REQUIRE(t == 1.0);
+    }
+
+    SECTION("BezierPatch") {
+        BezierPatch<Scalar, 3, 2, 2> patch;
+        Eigen::Matrix<Scalar, 9, 3> control_grid;
+        control_grid <<
+            0.0, 0.0, 0.0,
+            0.0, 0.5, 0.5,
+            0.0, 1.0, 0.0,
+            0.5, 0.0, 0.5,
+            0.5, 0.5, 1.0,
+            0.5, 1.0, 0.5,
+            1.0, 0.0, 0.0,
+            1.0, 0.5, 0.5,
+            1.0, 1.0, 0.0;
+        patch.set_control_grid(control_grid);
+        patch.initialize();
+        using UVPoint = Eigen::Matrix<Scalar, 1, 2>;
+
+        constexpr int num_frames = 41;
+        Eigen::Matrix<Scalar, num_frames, 3> track;
+        for (int i=0; i<num_frames; i++) {
+            const Scalar s = Scalar(i) / (num_frames - 1);
+            const Scalar u = 0.1 + 0.8 * s;
+            const Scalar v = 0.3 + 0.4 * s * s;
+            const Eigen::Matrix<Scalar, 1, 3> n =
+                patch.evaluate_derivative_u(u, v).cross(
+                        patch.evaluate_derivative_v(u, v)).normalized();
+            track.row(i) = patch.evaluate(u, v) + n * 0.02;
+        }
+
+        Eigen::Matrix<Scalar, Eigen::Dynamic, 2> uvs;
+        patch.batch_inverse_evaluate(track, UVPoint(0.1, 0.3), 0.05, uvs);
+        REQUIRE(uvs.rows() == num_frames);
+        for (int i=0; i<num_frames; i++) {
+            const Eigen::Matrix<Scalar, 1, 3> p = track.row(i);
+            const UVPoint uv = patch.inverse_evaluate(p, 0.0, 1.0, 0.0, 1.0);
+            REQUIRE((uvs.row(i) - uv).norm() == Approx(0.0).margin(1e-8));
+            if (i > 0) {
+                UVPoint local_uv;
+                REQUIRE(nanospline::local_inverse_evaluate(
+                            patch, p, UVPoint(uvs.row(i-1)), 0.05, local_uv));
+            }
+        }
+
+        // A point moving exactly on the patch.
+        for (int i=1; i<num_frames; i++) {
+            const Scalar prev_s = Scalar(i-1) / (num_frames - 1);
+            const Scalar curr_s = Scalar(i) / (num_frames - 1);
+            const UVPoint prev_uv(0.1 + 0.8 * prev_s, 0.3 + 0.4 * prev_s * prev_s);
+            const UVPoint curr_uv(0.1 + 0.8 * curr_s, 0.3 + 0.4 * curr_s * curr_s);
+            const Eigen::Matrix<Scalar, 1, 3> p = patch.evaluate(curr_uv[0], curr_uv[1]);
+            UVPoint local_uv;
+            REQUIRE(nanospline::local_inverse_evaluate(patch, p, prev_uv, 0.05, local_uv));
+            REQUIRE((local_uv - curr_uv).norm() == Approx(0.0).margin(1e-10));
+        }
+
+        const Eigen::Matrix<Scalar, 1, 3> p = track.row(0);
+        UVPoint uv;
+        REQUIRE(!nanospline::local_inverse_evaluate(patch, p, UVPoint(0.9, 0.9), 0.01, uv));
+        REQUIRE((patch.inverse_evaluate(p, UVPoint(0.9, 0.9), 0.01) -
+                    patch.inverse_evaluate(p, 0.0, 1.0, 0.0, 1.0)).norm() ==
+                Approx(0.0).margin(1e-10));
+
+        // Closest point on the boundary edge u = 0.
+        const Eigen::Matrix<Scalar, 1, 3> outside(-1.0, 0.4, 0.0);
+        REQUIRE(nanospline::local_inverse_evaluate(patch, outside, UVPoint(0.05, 0.4), 0.1, uv));
+        REQUIRE(uv[0] == 0.0);
+        REQUIRE((uv - patch.inverse_evaluate(outside, 0.0, 1.0, 0.0, 1.0)).norm() ==
+                Approx(0.0).margin(1e-6));
+    }
+}
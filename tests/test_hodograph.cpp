@@ -1,7 +1,6 @@
 #include <catch2/catch.hpp>
 
 #include <nanospline/hodograph.h>
-#include <nanospline/forward_declaration.h>
 #include "validation_utils.h"
 
 TEST_CASE("hodograph", "[hodograph]") {
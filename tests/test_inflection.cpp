@@ -5,10 +5,8 @@
 #include <nanospline/RationalBezier.h>
 #include <nanospline/split.h>
 #include <nanospline/save_svg.h>
-#include <nanospline/forward_declaration.h>
 
 TEST_CASE("inflection", "[inflection]") {
-#if NANOSPLINE_SYMPY
     using namespace nanospline;
     using Scalar = double;
 
@@ -205,12 +203,16 @@ TEST_CASE("inflection", "[inflection]") {
         }
         SECTION("Non-uniform weights") {
             weights << 1.0, 10.0, 1.0, 10.0, 1.0;
-            expected_num_inflections = 1;
+            expected_num_inflections = 0;
         }
 
         curve.set_weights(weights);
         curve.initialize();
         REQUIRE(curve.get_degree() == 4);
+
+        // The curve is symmetric, so the curvature vanishes at 0.5 without
+        // changing sign: a flat point, not an inflection.
+        REQUIRE(curve.evaluate_curvature(0.5).norm() == Approx(0.0).margin(1e-12));
         auto inflections = curve.compute_inflections(1e-12, 1.0-1e-12);
 
         CHECK(inflections.size() == static_cast<size_t>(expected_num_inflections));
@@ -219,5 +221,110 @@ TEST_CASE("inflection", "[inflection]") {
             REQUIRE(curvature.norm() == Approx(0.0).margin(1e-12));
         }
     }
-#endif
+
+    SECTION("High degree") {
+        // Degree 9 square wave: its inflections are the sign changes of
+        // x' y'' - y' x''.
+        Eigen::Matrix<Scalar, 10, 2> control_pts;
+        for (int i=0; i<10; i++) {
+            control_pts.row(i) << i, ((i/2)%2==0)?0.0:1.0;
+        }
+        using Curve = Bezier<Scalar, 2, -1>;
+        Curve curve;
+        curve.set_control_points(control_pts);
+
+        auto cross = [&](Scalar t) {
+            const auto d1 = curve.evaluate_derivative(t);
+            const auto d2 = curve.evaluate_2nd_derivative(t);
+            return d1[0] * d2[1] - d1[1] * d2[0];
+        };
+        constexpr int N = 1000;
+        size_t num_sign_changes = 0;
+        for (int i=0; i<N; i++) {
+            if ((cross(Scalar(i) / N) > 0) != (cross(Scalar(i + 1) / N) > 0)) {
+                num_sign_changes++;
+            }
+        }
+
+        auto inflections = curve.compute_inflections(0.0, 1.0);
+        REQUIRE(inflections.size() == num_sign_changes);
+        REQUIRE(inflections.size() == 4);
+        REQUIRE(inflections[0] + inflections[3] == Approx(1.0));
+        for (auto t : inflections) {
+            auto curvature = curve.evaluate_curvature(t);
+            REQUIRE(curvature.norm() == Approx(0.0).margin(1e-9));
+        }
+
+        auto partial = curve.compute_inflections(0.0, 0.5);
+        for (auto t : partial) {
+            REQUIRE(t <= 0.5);
+        }
+        REQUIRE(partial.size() < inflections.size());
+
+        // Elevating the degree keeps the curve, hence its cusp.
+        Eigen::Matrix<Scalar, 4, 2> cusp_pts;
+        cusp_pts << 0.0, 0.0,
+                    1.0, 1.0,
+                    0.0, 1.0,
+                    1.0, 0.0;
+        Curve cusp;
+        cusp.set_control_points(cusp_pts);
+        cusp = cusp.elevate_degree().elevate_degree().elevate_degree();
+        REQUIRE(cusp.get_degree() == 6);
+        auto singular_pts = cusp.compute_singularities(0, 1);
+        REQUIRE(singular_pts.size() == 1);
+        REQUIRE(singular_pts[0] == Approx(0.5));
+        REQUIRE(curve.compute_singularities(0, 1).empty());
+    }
+
+    SECTION("Scale invariance") {
+        Eigen::Matrix<Scalar, 4, 2> control_pts;
+        control_pts << 0.0, 0.0,
+                       1.0, 1.0,
+                       2.0,-1.0,
+                       3.0, 0.0;
+        Eigen::Matrix<Scalar, 4, 1> weights;
+        weights << 1.0, 2.0, 0.5, 1.0;
+
+        Bezier<Scalar, 2, 3> curve;
+        curve.set_control_points(control_pts);
+        RationalBezier<Scalar, 2, 3> rational;
+        rational.set_control_points(control_pts);
+        rational.set_weights(weights);
+        rational.initialize();
+        const auto inflections = curve.compute_inflections(0.0, 1.0);
+        const auto rational_inflections = rational.compute_inflections(0.0, 1.0);
+        REQUIRE(inflections.size() == 1);
+        REQUIRE(rational_inflections.size() == 1);
+
+        for (const Scalar scale : {1e-5, 1e-12, 1e8}) {
+            const Eigen::Matrix<Scalar, 4, 2> scaled_pts = control_pts * scale;
+            const Eigen::Matrix<Scalar, 4, 1> scaled_weights = weights * scale;
+            Bezier<Scalar, 2, 3> scaled;
+            scaled.set_control_points(scaled_pts);
+            const auto scaled_inflections = scaled.compute_inflections(0.0, 1.0);
+            REQUIRE(scaled_inflections.size() == 1);
+            REQUIRE(scaled_inflections[0] == Approx(inflections[0]));
+            REQUIRE(scaled.compute_singularities(0.0, 1.0).empty());
+
+            RationalBezier<Scalar, 2, 3> scaled_rational;
+            scaled_rational.set_control_points(scaled_pts);
+            scaled_rational.set_weights(scaled_weights);
+            scaled_rational.initialize();
+            const auto scaled_rational_inflections =
+                scaled_rational.compute_inflections(0.0, 1.0);
+            REQUIRE(scaled_rational_inflections.size() == 1);
+            REQUIRE(scaled_rational_inflections[0] == Approx(rational_inflections[0]));
+            REQUIRE(scaled_rational.compute_singularities(0.0, 1.0).empty());
+        }
+
+        // Every parameter of a curve collapsed to a point is singular, and
+        // none is isolated.
+        Eigen::Matrix<Scalar, 4, 2> point_pts;
+        point_pts.col(0).setConstant(1.0);
+        point_pts.col(1).setConstant(2.0);
+        Bezier<Scalar, 2, 3> point;
+        point.set_control_points(point_pts);
+        REQUIRE(point.compute_singularities(0.0, 1.0).empty());
+    }
 }
@@ -6,7 +6,6 @@
 #include <nanospline/NURBSPatch.h>
 #include <nanospline/BSplinePatch.h>
 #include <nanospline/save_svg.h>
-#include <nanospline/forward_declaration.h>
 #include "validation_utils.h"
 
 template<typename PatchType>
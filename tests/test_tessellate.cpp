@@ -0,0 +1,159 @@
+#include <catch2/catch.hpp>
+
+#include <sstream>
+
+#include <nanospline/tessellate.h>
+#include <nanospline/VectorExport.h>
+#include "validation_utils.h"
+
+namespace {
+
+template<typename CurveType, typename PointMatrix>
+void validate_uniform_samples(const CurveType& curve, const PointMatrix& points,
+        typename CurveType::Scalar t_min, typename CurveType::Scalar t_max,
+        typename CurveType::Scalar tol=1e-10) {
+    using Scalar = typename CurveType::Scalar;
+    const int num_segments = static_cast<int>(points.rows()) - 1;
+    for (int i=0; i<=num_segments; i++) {
+        const Scalar t = t_min + (t_max - t_min) * Scalar(i) / Scalar(num_segments);
+        REQUIRE((points.row(i) - curve.evaluate(t)).norm() ==
+                Approx(0.0).margin(tol));
+    }
+}
+
+}
+
+TEST_CASE("tessellate", "[tessellate]") {
+    using namespace nanospline;
+    using Scalar = double;
+
+    SECTION("Bezier degree 3") {
+        Eigen::Matrix<Scalar, 4, 2> ctrl_pts;
+        ctrl_pts << 0.0, 0.0,
+                    0.0, 1.0,
+                    1.0, 1.0,
+                    1.0, 0.0;
+        Bezier<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+
+        const auto points = tessellate(curve, 1000);
+        REQUIRE(points.rows() == 1001);
+        validate_uniform_samples(curve, points, 0.0, 1.0);
+        REQUIRE(points.row(1000) == ctrl_pts.row(3));
+
+        const auto coarse = tessellate(curve, 1);
+        REQUIRE(coarse.rows() == 2);
+        validate_uniform_samples(curve, coarse, 0.0, 1.0);
+
+        REQUIRE_THROWS(tessellate(curve, 0));
+    }
+
+    SECTION("Dynamic degree Bezier") {
+        Eigen::Matrix<Scalar, 7, 3> ctrl_pts;
+        ctrl_pts.setRandom();
+        Bezier<Scalar, 3, -1> curve;
+        curve.set_control_points(ctrl_pts);
+
+        const auto points = tessellate(curve, 100);
+        validate_uniform_samples(curve, points, 0.0, 1.0);
+    }
+
+    SECTION("BSpline") {
+        Eigen::Matrix<Scalar, 6, 2> ctrl_pts;
+        ctrl_pts.setRandom();
+        Eigen::Matrix<Scalar, 10, 1> knots;
+        knots << 0.0, 0.0, 0.0, 0.0, 0.3, 0.5, 1.0, 1.0, 1.0, 1.0;
+        BSpline<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+
+        // The knots fall on multiples of 1 / N: evenly spaced samples.
+        constexpr int N = 50;
+        const auto points = tessellate(curve, N);
+        REQUIRE(points.rows() == N + 1);
+        validate_uniform_samples(curve, points, 0.0, 1.0);
+
+        // Otherwise each Bezier segment is sampled evenly, with a number
+        // of samples proportional to its length.
+        const auto coarse = tessellate(curve, 7);
+        REQUIRE(coarse.rows() == 8);
+        validate_uniform_samples(curve, coarse.topRows(3), 0.0, 0.3);
+        validate_uniform_samples(curve, coarse.middleRows(2, 3), 0.3, 0.5);
+        validate_uniform_samples(curve, coarse.bottomRows(4), 0.5, 1.0);
+
+        // A segment too short for any sample is skipped.
+        const auto single = tessellate(curve, 1);
+        REQUIRE(single.rows() == 2);
+        validate_uniform_samples(curve, single, 0.0, 1.0);
+    }
+
+    SECTION("Generic curve") {
+        Eigen::Matrix<Scalar, 6, 2> ctrl_pts;
+        ctrl_pts.setRandom();
+        Eigen::Matrix<Scalar, 10, 1> knots;
+        knots << 0.0, 0.0, 0.0, 0.0, 0.3, 0.5, 1.0, 1.0, 1.0, 1.0;
+        BSpline<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+
+        const CurveBase<Scalar, 2>& base = curve;
+        const auto points = tessellate(base, 20);
+        REQUIRE(points.rows() == 21);
+        validate_uniform_samples(curve, points, 0.0, 1.0);
+    }
+
+    SECTION("RationalBezier") {
+        Eigen::Matrix<Scalar, 3, 2> ctrl_pts;
+        ctrl_pts << 1.0, 0.0,
+                    1.0, 1.0,
+                    0.0, 1.0;
+        Eigen::Matrix<Scalar, 3, 1> weights;
+        weights << 1.0, std::sqrt(2.0) / 2, 1.0;
+        RationalBezier<Scalar, 2, 2> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_weights(weights);
+        curve.initialize();
+
+        const auto points = tessellate(curve, 64);
+        validate_uniform_samples(curve, points, 0.0, 1.0);
+        for (int i=0; i<points.rows(); i++) {
+            REQUIRE(points.row(i).norm() == Approx(1.0));
+        }
+    }
+
+    SECTION("NURBS") {
+        Eigen::Matrix<Scalar, 5, 2> ctrl_pts;
+        ctrl_pts.setRandom();
+        Eigen::Matrix<Scalar, 8, 1> knots;
+        knots << 0.0, 0.0, 0.0, 0.5, 0.5, 1.0, 1.0, 1.0;
+        Eigen::Matrix<Scalar, 5, 1> weights;
+        weights << 1.0, 0.5, 2.0, 1.5, 1.0;
+        NURBS<Scalar, 2, 2> curve;
+        curve.set_control_points(ctrl_pts);
+        curve.set_knots(knots);
+        curve.set_weights(weights);
+        curve.initialize();
+
+        constexpr int N = 20;
+        const auto points = tessellate(curve, N);
+        REQUIRE(points.rows() == N + 1);
+        validate_uniform_samples(curve, points, 0.0, 1.0);
+    }
+
+    SECTION("SVG export") {
+        Eigen::Matrix<Scalar, 4, 2> ctrl_pts;
+        ctrl_pts << 0.0, 0.0,
+                    0.0, 1.0,
+                    1.0, 1.0,
+                    1.0, 0.0;
+        Bezier<Scalar, 2, 3> curve;
+        curve.set_control_points(ctrl_pts);
+
+        std::stringstream out;
+        Eigen::Matrix<Scalar, 1, 2> offset(0.0, 0.0);
+        to_svg(out, curve, offset, 1.0, false, "red", 0.2, "888888", 0.1, 10);
+        const auto svg = out.str();
+        REQUIRE(std::count(svg.begin(), svg.end(), 'M') == 1);
+        REQUIRE(std::count(svg.begin(), svg.end(), 'L') == 10);
+    }
+}
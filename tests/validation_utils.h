@@ -2,6 +2,8 @@
 #include <Eigen/Core>
 #include <catch2/catch.hpp>
 #include <limits>
+#include <thread>
+#include <vector>
 #include <nanospline/hodograph.h>
 
 namespace nanospline {
@@ -133,6 +135,117 @@ void validate_derivatives(const CurveType& curve, int num_samples,
     }
 }
 
+template<typename CurveType>
+void validate_batch_evaluation(const CurveType& curve, int num_samples,
+        const typename CurveType::Scalar tol=1e-12) {
+    using Scalar = typename CurveType::Scalar;
+    using ParameterVector = typename CurveType::ParameterVector;
+    using PointMatrix = typename CurveType::PointMatrix;
+
+    ParameterVector samples;
+    const Scalar t_min = curve.get_domain_lower_bound();
+    const Scalar t_max = curve.get_domain_upper_bound();
+    samples.setLinSpaced(num_samples+2, t_min, t_max);
+
+    // Both sorted and reversed inputs, to exercise the knot span sweep.
+    const ParameterVector reversed = samples.reverse();
+    for (const auto& ts : {samples, reversed}) {
+        PointMatrix values, derivatives, second_derivatives;
+        curve.batch_evaluate(ts, values);
+        curve.batch_evaluate_derivative(ts, derivatives);
+        curve.batch_evaluate_2nd_derivative(ts, second_derivatives);
+        REQUIRE(values.rows() == ts.size());
+        REQUIRE((values - curve.batch_evaluate(ts)).norm() == Approx(0.0).margin(tol));
+
+        for (int i=0; i<num_samples+2; i++) {
+            const auto t = ts[i];
+            REQUIRE((values.row(i) - curve.evaluate(t)).norm() ==
+                    Approx(0.0).margin(tol));
+            REQUIRE((derivatives.row(i) - curve.evaluate_derivative(t)).norm() ==
+                    Approx(0.0).margin(tol));
+            REQUIRE((second_derivatives.row(i) -
+                        curve.evaluate_2nd_derivative(t)).norm() ==
+                    Approx(0.0).margin(tol));
+        }
+    }
+}
+
+template<typename CurveType>
+void validate_evaluate_derivatives(const CurveType& curve, int num_samples,
+        const typename CurveType::Scalar tol=1e-6) {
+    using Scalar = typename CurveType::Scalar;
+
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 1> samples;
+    const Scalar t_min = curve.get_domain_lower_bound();
+    const Scalar t_max = curve.get_domain_upper_bound();
+    samples.setLinSpaced(num_samples+2, t_min, t_max);
+    const Scalar delta = (t_max - t_min) * 1e-6;
+
+    for (int i=0; i<num_samples+2; i++) {
+        const Scalar t = samples[i];
+        const auto ders = curve.evaluate_derivatives(t, 3);
+        REQUIRE(ders.rows() == 4);
+        REQUIRE((ders.row(0) - curve.evaluate(t)).norm() ==
+                Approx(0.0).margin(tol));
+        REQUIRE((ders.row(1) - curve.evaluate_derivative(t)).norm() ==
+                Approx(0.0).margin(tol));
+        REQUIRE((ders.row(2) - curve.evaluate_2nd_derivative(t)).norm() ==
+                Approx(0.0).margin(tol));
+
+        // Third derivative against finite difference of the second.
+        const Scalar t0 = std::max(t_min, t-delta/2);
+        const Scalar t1 = std::min(t_max, t+delta/2);
+        const typename CurveType::Point d2_0 = curve.evaluate_derivatives(t0, 2).row(2);
+        const typename CurveType::Point d2_1 = curve.evaluate_derivatives(t1, 2).row(2);
+        const typename CurveType::Point d3 = (curve.evaluate_derivatives(t0, 3).row(3) +
+                curve.evaluate_derivatives(t1, 3).row(3)) / 2;
+        for (int k=0; k<d3.cols(); k++) {
+            REQUIRE(d3[k] * (t1-t0) == Approx(d2_1[k] - d2_0[k]).margin(tol));
+        }
+    }
+}
+
+template<typename CurveType>
+void validate_power_basis(const CurveType& curve, int num_samples,
+        const typename CurveType::Scalar tol=1e-8) {
+    using Scalar = typename CurveType::Scalar;
+    auto fast_curve = curve;
+    fast_curve.set_evaluation_mode(nanospline::EvaluationMode::PowerBasis);
+
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 1> samples;
+    samples.setLinSpaced(num_samples+2,
+            curve.get_domain_lower_bound(), curve.get_domain_upper_bound());
+    auto check = [tol](const typename CurveType::Point& expected,
+            const typename CurveType::Point& actual) {
+        REQUIRE((expected - actual).norm() ==
+                Approx(0.0).margin(tol * (1 + expected.norm())));
+    };
+
+    for (int i=0; i<num_samples+2; i++) {
+        const Scalar t = samples[i];
+        check(curve.evaluate(t), fast_curve.evaluate(t));
+        check(curve.evaluate_derivative(t), fast_curve.evaluate_derivative(t));
+        check(curve.evaluate_2nd_derivative(t), fast_curve.evaluate_2nd_derivative(t));
+        const auto ders = curve.evaluate_derivatives(t, 3);
+        const auto fast_ders = fast_curve.evaluate_derivatives(t, 3);
+        for (int k=0; k<4; k++) {
+            check(ders.row(k), fast_ders.row(k));
+        }
+    }
+
+    typename CurveType::PointMatrix values, fast_values;
+    curve.batch_evaluate(samples, values);
+    fast_curve.batch_evaluate(samples, fast_values);
+    REQUIRE(fast_values.rows() == samples.size());
+    for (int i=0; i<num_samples+2; i++) check(values.row(i), fast_values.row(i));
+    curve.batch_evaluate_derivative(samples, values);
+    fast_curve.batch_evaluate_derivative(samples, fast_values);
+    for (int i=0; i<num_samples+2; i++) check(values.row(i), fast_values.row(i));
+    curve.batch_evaluate_2nd_derivative(samples, values);
+    fast_curve.batch_evaluate_2nd_derivative(samples, fast_values);
+    for (int i=0; i<num_samples+2; i++) check(values.row(i), fast_values.row(i));
+}
+
 template<typename PatchType>
 void validate_derivative(const PatchType& patch, int u_samples, int v_samples,
         const typename PatchType::Scalar tol=1e-6) {
@@ -197,6 +310,44 @@ void validate_derivative(const PatchType& patch, int u_samples, int v_samples,
     }
 }
 
+template<typename PatchType>
+void validate_evaluate_all(const PatchType& patch, int u_samples, int v_samples,
+        const typename PatchType::Scalar tol=1e-8) {
+    const auto dim = patch.get_dim();
+    const auto u_min = patch.get_u_lower_bound();
+    const auto u_max = patch.get_u_upper_bound();
+    const auto v_min = patch.get_v_lower_bound();
+    const auto v_max = patch.get_v_upper_bound();
+
+    for (int i=0; i<=u_samples; i++) {
+        const auto u = i * (u_max-u_min) / u_samples + u_min;
+        for (int j=0; j<=v_samples; j++) {
+            const auto v = j * (v_max-v_min) / v_samples + v_min;
+
+            const auto ders = patch.evaluate_all(u, v, 2);
+            REQUIRE(ders.rows() == 6);
+            REQUIRE(patch.evaluate_all(u, v, 0).rows() == 1);
+            REQUIRE(patch.evaluate_all(u, v, 1).rows() == 3);
+
+            const auto p = patch.evaluate(u, v);
+            const auto du = patch.evaluate_derivative_u(u, v);
+            const auto dv = patch.evaluate_derivative_v(u, v);
+            const auto duu = patch.evaluate_2nd_derivative_uu(u, v);
+            const auto duv = patch.evaluate_2nd_derivative_uv(u, v);
+            const auto dvv = patch.evaluate_2nd_derivative_vv(u, v);
+
+            for (int k=0; k<dim; k++) {
+                REQUIRE(ders(0, k) == Approx(p[k]).margin(tol));
+                REQUIRE(ders(1, k) == Approx(du[k]).margin(tol));
+                REQUIRE(ders(2, k) == Approx(dv[k]).margin(tol));
+                REQUIRE(ders(3, k) == Approx(duu[k]).margin(tol));
+                REQUIRE(ders(4, k) == Approx(duv[k]).margin(tol));
+                REQUIRE(ders(5, k) == Approx(dvv[k]).margin(tol));
+            }
+        }
+    }
+}
+
 template<typename PatchType>
 void validate_derivative_patches(const PatchType patch, int u_samples, int v_samples,
         const typename PatchType::Scalar tol=1e-6) {
@@ -233,8 +384,56 @@ void validate_derivative_patches(const PatchType patch, int u_samples, int v_sam
 
             REQUIRE((duv_0 - duv_2).norm() == Approx(0.0).margin(tol));
             REQUIRE((duv_1 - duv_2).norm() == Approx(0.0).margin(tol));
+
+            // Cached derivative patches.
+            REQUIRE((patch.get_du_patch().evaluate(u, v) - du_p).norm() ==
+                    Approx(0.0).margin(tol));
+            REQUIRE((patch.get_dv_patch().evaluate(u, v) - dv_p).norm() ==
+                    Approx(0.0).margin(tol));
+            REQUIRE((patch.get_duv_patch().evaluate(u, v) - duv_2).norm() ==
+                    Approx(0.0).margin(tol));
+            REQUIRE((patch.get_duu_patch().evaluate(u, v) -
+                        patch.evaluate_2nd_derivative_uu(u, v)).norm() ==
+                    Approx(0.0).margin(tol));
+            REQUIRE((patch.get_dvv_patch().evaluate(u, v) -
+                        patch.evaluate_2nd_derivative_vv(u, v)).norm() ==
+                    Approx(0.0).margin(tol));
         }
     }
+
+    // Cached derivative patches must follow control grid updates.
+    auto scaled_patch = patch;
+    scaled_patch.get_du_patch();
+    scaled_patch.get_duv_patch();
+    typename PatchType::ControlGrid scaled_grid = patch.get_control_grid() * 2;
+    scaled_patch.set_control_grid(scaled_grid);
+    const auto u_mid = (u_min + u_max) / 2;
+    const auto v_mid = (v_min + v_max) / 2;
+    REQUIRE((scaled_patch.get_du_patch().evaluate(u_mid, v_mid) -
+                2 * du_patch.evaluate(u_mid, v_mid)).norm() == Approx(0.0).margin(tol));
+    REQUIRE((scaled_patch.get_duv_patch().evaluate(u_mid, v_mid) -
+                2 * duv_patch_explicit.evaluate(u_mid, v_mid)).norm() ==
+            Approx(0.0).margin(tol));
+
+    // Concurrent first queries build each cached patch once.
+    scaled_patch.set_control_grid(patch.get_control_grid());
+    constexpr int num_threads = 4;
+    const auto dim = patch.get_control_grid().cols();
+    typename PatchType::ControlGrid duv(num_threads, dim), duu(num_threads, dim);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; i++) {
+        threads.emplace_back([&, i]() {
+            duv.row(i) = scaled_patch.evaluate_2nd_derivative_uv(u_mid, v_mid);
+            duu.row(i) = scaled_patch.evaluate_2nd_derivative_uu(u_mid, v_mid);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (int i = 0; i < num_threads; i++) {
+        REQUIRE((duv.row(i) - patch.evaluate_2nd_derivative_uv(u_mid, v_mid)).norm() ==
+                Approx(0.0).margin(tol));
+        REQUIRE((duu.row(i) - patch.evaluate_2nd_derivative_uu(u_mid, v_mid)).norm() ==
+                Approx(0.0).margin(tol));
+    }
 }
 
 /**
@@ -379,6 +578,29 @@ void validate_approximate_inverse_evaluation(const CurveType& curve, int num_sam
     }
 }
 
+template<typename CurveType>
+void validate_inverse_evaluation(const CurveType& curve, int num_samples) {
+    using Point = typename CurveType::Point;
+    const auto t_min = curve.get_domain_lower_bound();
+    const auto t_max = curve.get_domain_upper_bound();
+    for (int i=0; i<=num_samples; i++) {
+        const auto t = i * (t_max - t_min) / num_samples + t_min;
+        const Point q = curve.evaluate(t);
+        const auto t2 = curve.inverse_evaluate(q);
+        REQUIRE(t2 >= t_min);
+        REQUIRE(t2 <= t_max);
+        REQUIRE((curve.evaluate(t2) - q).norm() == Approx(0.0).margin(1e-10));
+
+        // Off the curve, the exact projection is never farther than the
+        // sampling based one.
+        const Point r = q + Point::Constant(0.1);
+        const auto t3 = curve.inverse_evaluate(r);
+        const auto t4 = curve.approximate_inverse_evaluate(r, t_min, t_max);
+        REQUIRE((curve.evaluate(t3) - r).norm() <=
+                (curve.evaluate(t4) - r).norm() + 1e-10);
+    }
+}
+
 template<typename PatchType>
 void validate_inverse_evaluation(const PatchType& patch,
         int u_samples, int v_samples) {